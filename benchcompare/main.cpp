@@ -0,0 +1,430 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file main.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include <cxinv/assertion.h>
+#include <cxbench/Baseline.h>
+#include <cxbench/BenchmarkResults.h>
+#include <cxbench/Comparison.h>
+#include <cxstd/parse.h>
+
+namespace
+{
+
+constexpr size_t DEFAULT_NB_RUNS = 3u;
+
+const std::string USAGE =
+    "Usage: connectx-benchcompare --baseline FILE [OPTION]... -- BENCHMARK [ARGUMENT]...\n"
+    "       connectx-benchcompare --baseline FILE [OPTION]... --results FILE...\n"
+    "\n"
+    "Runs a Google Benchmark executable (or reads results it saved as JSON) and compares\n"
+    "every metric against a baseline. Fails if any metric is worse than its baseline value\n"
+    "by more than the tolerance.\n"
+    "\n"
+    "Possible arguments:\n"
+    "--baseline FILE  the baseline, as written by --update\n"
+    "--runs N         run the benchmark N times and compare the medians (default: 3)\n"
+    "--results FILE   read results from FILE instead of running a benchmark (repeatable)\n"
+    "--update         write the results as the new baseline instead of comparing\n"
+    "--verbose        print every comparison, not only improvements and regressions\n";
+
+/**************************************************************************************************
+ * @brief Command line settings.
+ *
+ *************************************************************************************************/
+struct Settings final
+{
+    std::string m_baselineFilePath;
+    size_t m_nbRuns = DEFAULT_NB_RUNS;
+    std::vector<std::string> m_resultsFilePaths;
+    std::vector<std::string> m_benchmarkCommand;
+    bool m_update = false;
+    bool m_verbose = false;
+};
+
+/**************************************************************************************************
+ * @brief Makes the settings from the command line arguments.
+ *
+ * @param p_arguments The command line arguments, program name excluded.
+ * @param p_settings  The settings to fill.
+ *
+ * @return The first invalid argument, if any, an empty string otherwise.
+ *
+ *************************************************************************************************/
+std::string ParseSettings(const std::vector<std::string>& p_arguments, Settings& p_settings)
+{
+    for(size_t index = 0u; index < p_arguments.size(); ++index)
+    {
+        const std::string& option = p_arguments[index];
+
+        if(option == "--")
+        {
+            p_settings.m_benchmarkCommand.assign(p_arguments.cbegin() + static_cast<std::ptrdiff_t>(index) + 1, p_arguments.cend());
+            break;
+        }
+
+        if(option == "--update")
+        {
+            p_settings.m_update = true;
+            continue;
+        }
+
+        if(option == "--verbose")
+        {
+            p_settings.m_verbose = true;
+            continue;
+        }
+
+        if(index + 1u == p_arguments.size())
+        {
+            return option;
+        }
+
+        const std::string& value = p_arguments[++index];
+
+        if(option == "--baseline")
+        {
+            p_settings.m_baselineFilePath = value;
+        }
+        else if(option == "--runs")
+        {
+            const std::optional<size_t> nbRuns = cxstd::ParseInteger(value);
+            if(!nbRuns || *nbRuns == 0u)
+            {
+                return value;
+            }
+
+            p_settings.m_nbRuns = *nbRuns;
+        }
+        else if(option == "--results")
+        {
+            p_settings.m_resultsFilePaths.push_back(value);
+        }
+        else
+        {
+            return option;
+        }
+    }
+
+    if(p_settings.m_baselineFilePath.empty())
+    {
+        return "--baseline";
+    }
+
+    // Exactly one source of results:
+    if(p_settings.m_benchmarkCommand.empty() == p_settings.m_resultsFilePaths.empty())
+    {
+        return p_settings.m_benchmarkCommand.empty() ? "--" : "--results";
+    }
+
+    return {};
+}
+
+bool ReadFile(const std::string& p_filePath, std::string& p_contents)
+{
+    std::ifstream file{p_filePath};
+    if(!file)
+    {
+        return false;
+    }
+
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    p_contents = contents.str();
+
+    return true;
+}
+
+std::string Quote(const std::string& p_argument)
+{
+    std::string quoted = "'";
+    for(const char character : p_argument)
+    {
+        if(character == '\'')
+        {
+            quoted += "'\\''";
+        }
+        else
+        {
+            quoted.push_back(character);
+        }
+    }
+
+    return quoted + "'";
+}
+
+/**************************************************************************************************
+ * @brief Runs the benchmark executable once and reads the results it saved.
+ *
+ * The executable's own console output is discarded, only the JSON output is read.
+ *
+ * @param p_command The benchmark executable and its arguments.
+ * @param p_runs    The runs read are appended here.
+ *
+ * @return A success if the benchmark ran and its results could be read, an error otherwise.
+ *
+ *************************************************************************************************/
+cxmodel::Status RunBenchmark(const std::vector<std::string>& p_command, std::vector<cxbench::BenchmarkRun>& p_runs)
+{
+    std::string outputFilePath = (std::filesystem::temp_directory_path() / "connectx-benchcompare-XXXXXX").string();
+    const int outputFile = ::mkstemp(outputFilePath.data());
+    if(outputFile < 0)
+    {
+        return cxmodel::MakeError("Unable to create a temporary file.");
+    }
+    ::close(outputFile);
+
+    std::string command;
+    for(const std::string& argument : p_command)
+    {
+        command += Quote(argument) + " ";
+    }
+    command += Quote("--benchmark_out=" + outputFilePath) + " --benchmark_out_format=json > /dev/null";
+
+    const int exitCode = std::system(command.c_str());
+
+    std::string results;
+    const bool isRead = ReadFile(outputFilePath, results);
+    std::remove(outputFilePath.c_str());
+
+    if(exitCode != 0)
+    {
+        return cxmodel::MakeError("'" + p_command.front() + "' failed.");
+    }
+
+    if(!isRead)
+    {
+        return cxmodel::MakeError("Unable to read the results of '" + p_command.front() + "'.");
+    }
+
+    return cxbench::ReadBenchmarkRuns(results, p_runs);
+}
+
+/**************************************************************************************************
+ * @brief Gets the runs to compare, either by running the benchmark or from saved results.
+ *
+ * @param p_settings The command line settings.
+ * @param p_runs     The runs.
+ *
+ * @return A success if all runs could be gathered, an error otherwise.
+ *
+ *************************************************************************************************/
+cxmodel::Status GatherRuns(const Settings& p_settings, std::vector<cxbench::BenchmarkRun>& p_runs)
+{
+    for(const std::string& resultsFilePath : p_settings.m_resultsFilePaths)
+    {
+        std::string results;
+        if(!ReadFile(resultsFilePath, results))
+        {
+            return cxmodel::MakeError("Unable to read '" + resultsFilePath + "'.");
+        }
+
+        const cxmodel::Status status = cxbench::ReadBenchmarkRuns(results, p_runs);
+        ON_ERROR(status, return cxmodel::MakeError(resultsFilePath + ": " + status.GetMessage()););
+    }
+
+    if(!p_settings.m_benchmarkCommand.empty())
+    {
+        for(size_t run = 0u; run < p_settings.m_nbRuns; ++run)
+        {
+            std::cout << "Running " << p_settings.m_benchmarkCommand.front() << " (" << run + 1u << "/" << p_settings.m_nbRuns << ")..." << std::endl;
+
+            const cxmodel::Status status = RunBenchmark(p_settings.m_benchmarkCommand, p_runs);
+            ON_ERROR(status, return status;);
+        }
+    }
+
+    return cxmodel::MakeSuccess();
+}
+
+/**************************************************************************************************
+ * @brief Writes the results as the new baseline.
+ *
+ * @param p_settings The command line settings.
+ * @param p_previous The previous baseline (empty if none).
+ * @param p_results  The results.
+ *
+ * @return A success if the baseline was written, an error otherwise.
+ *
+ *************************************************************************************************/
+cxmodel::Status UpdateBaseline(const Settings& p_settings, const cxbench::Baseline& p_previous, const cxbench::BenchmarkResults& p_results)
+{
+    std::ofstream file{p_settings.m_baselineFilePath};
+    if(!file)
+    {
+        return cxmodel::MakeError("Unable to write '" + p_settings.m_baselineFilePath + "'.");
+    }
+
+    cxbench::WriteBaseline(file, cxbench::MakeBaseline(p_results, p_previous));
+    std::cout << p_results.size() << " benchmarks written to " << p_settings.m_baselineFilePath << std::endl;
+
+    return cxmodel::MakeSuccess();
+}
+
+/**************************************************************************************************
+ * @brief Compares the results against the baseline and prints the differences.
+ *
+ * @param p_settings The command line settings.
+ * @param p_baseline The baseline.
+ * @param p_results  The results.
+ *
+ * @return `true` if no metric regressed, `false` otherwise.
+ *
+ *************************************************************************************************/
+bool CompareAgainstBaseline(const Settings& p_settings, const cxbench::Baseline& p_baseline, const cxbench::BenchmarkResults& p_results)
+{
+    const std::vector<cxbench::MetricComparison> comparisons = cxbench::Compare(p_baseline, p_results);
+
+    std::vector<cxbench::MetricComparison> printed;
+    for(const cxbench::MetricComparison& comparison : comparisons)
+    {
+        if(p_settings.m_verbose ||
+           comparison.m_verdict == cxbench::Verdict::IMPROVED ||
+           comparison.m_verdict == cxbench::Verdict::REGRESSED)
+        {
+            printed.push_back(comparison);
+        }
+    }
+
+    if(!printed.empty())
+    {
+        std::cout << std::endl;
+        cxbench::PrintComparisonTable(std::cout, printed);
+    }
+
+    const size_t nbRegressed = cxbench::Count(comparisons, cxbench::Verdict::REGRESSED);
+
+    std::cout << std::endl
+              << comparisons.size() << " metrics compared: "
+              << nbRegressed << " regressed, "
+              << cxbench::Count(comparisons, cxbench::Verdict::IMPROVED) << " improved, "
+              << cxbench::Count(comparisons, cxbench::Verdict::MISSING) << " missing." << std::endl;
+
+    return nbRegressed == 0u;
+}
+
+} // namespace
+
+/******************************************************************************************//**
+ * @brief Start of the program in hosted environment (that is, with an operating system).
+ *
+ * @param argc
+ *      Non-negative value representing the number of arguments passed to the program
+ *      from the environment in which the program is run.
+ *
+ * @param argv
+ *      Pointer to the first element of an array of argc + 1 pointers, of which the last
+ *      one is null and the previous ones, if any, point to null-terminated multibyte
+ *      strings that represent the arguments passed to the program from the execution
+ *      environment.
+ *
+ * @return Exit status. EXIT_SUCCESS(0) if no metric regressed.
+ *
+ ********************************************************************************************/
+int main(int argc, char *argv[])
+{
+    int result = EXIT_FAILURE;
+
+    try
+    {
+        const std::vector<std::string> arguments(argv + 1, argv + argc);
+        if(arguments.empty() || arguments.front() == "--help")
+        {
+            std::cout << USAGE;
+            return arguments.empty() ? EXIT_FAILURE : EXIT_SUCCESS;
+        }
+
+        Settings settings;
+        const std::string invalidArgument = ParseSettings(arguments, settings);
+        if(!invalidArgument.empty())
+        {
+            std::cerr << "connectx-benchcompare: invalid or missing option '" << invalidArgument << "'" << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        // When updating, the baseline may not exist yet:
+        cxbench::Baseline baseline;
+        std::string baselineJson;
+        const bool hasBaseline = ReadFile(settings.m_baselineFilePath, baselineJson);
+        if(!hasBaseline && !settings.m_update)
+        {
+            std::cerr << "connectx-benchcompare: unable to read '" << settings.m_baselineFilePath << "'" << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        if(hasBaseline)
+        {
+            const cxmodel::Status status = cxbench::ReadBaseline(baselineJson, baseline);
+            if(!status.IsSuccess())
+            {
+                std::cerr << "connectx-benchcompare: " << settings.m_baselineFilePath << ": " << status.GetMessage() << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+
+        std::vector<cxbench::BenchmarkRun> runs;
+        const cxmodel::Status status = GatherRuns(settings, runs);
+        if(!status.IsSuccess())
+        {
+            std::cerr << "connectx-benchcompare: " << status.GetMessage() << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        const cxbench::BenchmarkResults results = cxbench::AggregateMedians(runs);
+
+        if(settings.m_update)
+        {
+            const cxmodel::Status updateStatus = UpdateBaseline(settings, baseline, results);
+            if(!updateStatus.IsSuccess())
+            {
+                std::cerr << "connectx-benchcompare: " << updateStatus.GetMessage() << std::endl;
+                return EXIT_FAILURE;
+            }
+
+            return EXIT_SUCCESS;
+        }
+
+        result = CompareAgainstBaseline(settings, baseline, results) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    catch(const std::exception& p_exception)
+    {
+        ASSERT_ERROR_MSG(p_exception.what());
+    }
+    catch(...)
+    {
+        ASSERT_ERROR_MSG("Unhandled exception.");
+    }
+
+    return result;
+}
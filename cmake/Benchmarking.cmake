@@ -0,0 +1,146 @@
+#*************************************************************************************************
+#  This file is part of Connect X.
+#
+#  Connect X is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  Connect X is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+#
+#************************************************************************************************/
+#*************************************************************************************************
+# CMake related benchmarking facilities.
+#
+# @file Benchmarking.cmake
+# @date 2026
+#
+#************************************************************************************************/
+
+option(
+    BENCHMARK_REGRESSION_TESTS
+    "Add tests comparing benchmark results against their checked in baselines."
+    OFF)
+
+set(BENCHMARK_REGRESSION_RUNS 3 CACHE STRING
+    "Number of benchmark runs from which median results are compared against the baselines.")
+
+set(BENCHMARK_REGRESSION_ARGUMENTS "--benchmark_min_time=0.05" CACHE STRING
+    "Arguments passed to benchmark executables when comparing against, or updating, the baselines.")
+
+#*************************************************************************************************
+# Generates a benchmark executable target for a library.
+#
+# Example: for some library `foo`, will create a target named `foobench`. This target is an
+#          executable running all benchmarks for `foo`. A second target, `foobench_json`, runs
+#          the benchmarks and writes their results to `<build>/benchmarks/foobench.json`, in
+#          the Google Benchmark JSON format, so that results can be compared across releases.
+#
+#          If a `baseline.json` file lies next to the benchmark sources, the `foobench_baseline`
+#          target updates it from new results, and when `BENCHMARK_REGRESSION_TESTS` is on, a
+#          `foobench_regression` test (labeled `benchmark`) fails if any metric regressed
+#          beyond its tolerance. See `connectx-benchcompare --help`. Since timings depend on
+#          the machine, baselines should be updated on the machine running the tests.
+#
+# This function assumes that the package `benchmark` (Google Benchmark) was imported before
+# use. If it was not found, no target is created.
+#
+# Parameters:
+#
+#    p_libName
+#        The name of the library to benchmark.
+#
+#    ARGN
+#        A list of dependencies. Include all benchmark source files after the `SOURCES` keyword
+#        and all library dependencies after the `LIBS` keyword.
+#
+#*************************************************************************************************
+function(add_lib_benchmark p_libName)
+
+  set(targetName "${p_libName}bench")
+
+  if(NOT TARGET benchmark::benchmark)
+    message(STATUS "Google Benchmark not found, ${targetName} will not be built.")
+    return()
+  endif()
+
+  # The supported set of keywords:
+  set(prefix DEPENDENCIES)
+  set(allDependencies SOURCES LIBS)
+
+  # Parsing the arguments for the dependencies:
+  cmake_parse_arguments(${prefix}
+                        ""
+                        ""
+                        "${allDependencies}"
+                        ${ARGN}
+  )
+
+  add_executable(${targetName} ${DEPENDENCIES_SOURCES})
+
+  # Adding include paths for every needed library:
+  foreach(lib ${DEPENDENCIES_LIBS})
+    target_include_directories(${targetName}
+      PRIVATE "${CMAKE_SOURCE_DIR}/${lib}/include"
+    )
+  endforeach()
+
+  # Linking with Google Benchmark and the benchmarked library:
+  target_link_libraries(${targetName}
+    PRIVATE benchmark::benchmark
+    PRIVATE benchmark::benchmark_main
+    PUBLIC ${p_libName}
+  )
+
+  # Linking with any needed library:
+  foreach(lib ${DEPENDENCIES_LIBS})
+    target_link_libraries(${targetName}
+      PRIVATE ${lib}
+    )
+  endforeach()
+
+  # Results, in JSON:
+  set(resultsDirectory "${CMAKE_BINARY_DIR}/benchmarks")
+  add_custom_target(${targetName}_json
+    COMMAND ${CMAKE_COMMAND} -E make_directory "${resultsDirectory}"
+    COMMAND ${targetName} --benchmark_out=${resultsDirectory}/${targetName}.json --benchmark_out_format=json
+    DEPENDS ${targetName}
+    COMMENT "Running ${targetName}, results in ${resultsDirectory}/${targetName}.json"
+    VERBATIM
+  )
+
+  # Comparison against the baseline:
+  set(baselineFile "${CMAKE_CURRENT_SOURCE_DIR}/baseline.json")
+  set(compareArguments
+    --baseline "${baselineFile}"
+    --runs ${BENCHMARK_REGRESSION_RUNS}
+  )
+  set(benchmarkCommand
+    -- $<TARGET_FILE:${targetName}> ${BENCHMARK_REGRESSION_ARGUMENTS}
+  )
+
+  add_custom_target(${targetName}_baseline
+    COMMAND connectx-benchcompare ${compareArguments} --update ${benchmarkCommand}
+    COMMENT "Updating ${baselineFile}"
+    VERBATIM
+  )
+
+  if(BENCHMARK_REGRESSION_TESTS AND EXISTS "${baselineFile}")
+    add_test(
+      NAME ${targetName}_regression
+      COMMAND connectx-benchcompare ${compareArguments} ${benchmarkCommand}
+    )
+
+    set_tests_properties(${targetName}_regression PROPERTIES
+      LABELS benchmark
+      RUN_SERIAL TRUE
+    )
+  endif()
+
+endfunction()
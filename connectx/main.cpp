@@ -35,7 +35,8 @@
 
 #include <generated/ressources.h>
 
-constexpr size_t CMD_STACK_SIZE = 200;
+// Enough to undo every drop of a game on the largest (64x64) board:
+constexpr size_t CMD_STACK_SIZE = 4096;
 
 /******************************************************************************************//**
  * @brief Creates a logger that logs to a file.
@@ -73,7 +74,7 @@ std::unique_ptr<cxlog::ILogger> CreateFileLogger(cxlog::VerbosityLevel p_verbosi
  ********************************************************************************************/
 cx::ModelReferences ModelReferencesCreate(cxmodel::Model& p_model)
 {
-    return cx::ModelReferences{p_model, p_model, p_model, p_model, p_model, p_model, p_model};
+    return cx::ModelReferences{p_model, p_model, p_model, p_model, p_model, p_model, p_model, p_model};
 }
 
 /******************************************************************************************//**
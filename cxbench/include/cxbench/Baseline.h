@@ -0,0 +1,124 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file Baseline.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef BASELINE_H_3BD1464D_DEEA_4AC1_9B29_118E949147DF
+#define BASELINE_H_3BD1464D_DEEA_4AC1_9B29_118E949147DF
+
+#include <optional>
+#include <ostream>
+#include <string>
+
+#include <cxmodel/Status.h>
+
+#include "BenchmarkResults.h"
+
+namespace cxbench
+{
+
+/** Default relative tolerance (10%). */
+inline constexpr double DEFAULT_TOLERANCE = 0.10;
+
+/**********************************************************************************************//**
+ * @brief Reference metrics for a benchmark.
+ *
+ *************************************************************************************************/
+struct BaselineEntry final
+{
+    /** The reference metric values. */
+    Metrics m_metrics;
+
+    /** A relative tolerance specific to this benchmark (ex.: 0.25 for 25%), if any. */
+    std::optional<double> m_tolerance;
+};
+
+/**********************************************************************************************//**
+ * @brief Reference benchmark results, against which new results are compared.
+ *
+ * Baselines are stored as JSON:
+ *
+ * @verbatim
+ *   {
+ *     "benchmarks": {
+ *       "BM_Foo/width:7": {
+ *         "metrics": {
+ *           "cpu_time": 1523.5,
+ *           "items_per_second": 656383.1
+ *         },
+ *         "tolerance": 0.25
+ *       }
+ *     },
+ *     "tolerance": 0.1
+ *   }
+ * @endverbatim
+ *
+ * Times are in nanoseconds. The top level tolerance applies to every benchmark which does not
+ * specify its own.
+ *
+ *************************************************************************************************/
+struct Baseline final
+{
+    /** The relative tolerance for benchmarks without a specific tolerance. */
+    double m_tolerance = DEFAULT_TOLERANCE;
+
+    /** The reference metrics, by benchmark name. */
+    std::map<std::string, BaselineEntry> m_entries;
+};
+
+/**********************************************************************************************//**
+ * @brief Reads a baseline.
+ *
+ * @param p_json     The baseline, as JSON.
+ * @param p_baseline The baseline read. Only meaningful on success.
+ *
+ * @return A success if the baseline could be read, an error otherwise (invalid JSON, missing
+ *         metrics, negative tolerances, etc).
+ *
+ *************************************************************************************************/
+[[nodiscard]] cxmodel::Status ReadBaseline(const std::string& p_json, Baseline& p_baseline);
+
+/**********************************************************************************************//**
+ * @brief Writes a baseline, as JSON.
+ *
+ * @param p_stream   The stream to write to.
+ * @param p_baseline The baseline to write.
+ *
+ *************************************************************************************************/
+void WriteBaseline(std::ostream& p_stream, const Baseline& p_baseline);
+
+/**********************************************************************************************//**
+ * @brief Makes a new baseline from benchmark results.
+ *
+ * Tolerances are carried over from the previous baseline, so that updating a baseline after an
+ * accepted performance change does not lose the tolerances tuned by hand.
+ *
+ * @param p_results  The new reference results.
+ * @param p_previous The previous baseline (may be empty).
+ *
+ * @return The new baseline.
+ *
+ *************************************************************************************************/
+[[nodiscard]] Baseline MakeBaseline(const BenchmarkResults& p_results, const Baseline& p_previous);
+
+} // namespace cxbench
+
+#endif // BASELINE_H_3BD1464D_DEEA_4AC1_9B29_118E949147DF
@@ -0,0 +1,97 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file BenchmarkResults.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef BENCHMARKRESULTS_H_44F6B226_B80D_432B_9803_48293B224DDD
+#define BENCHMARKRESULTS_H_44F6B226_B80D_432B_9803_48293B224DDD
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <cxmodel/Status.h>
+
+namespace cxbench
+{
+
+/** Metric values, by metric name (ex.: "cpu_time", "items_per_second"). */
+using Metrics = std::map<std::string, double>;
+
+/** Metrics, by benchmark name. */
+using BenchmarkResults = std::map<std::string, Metrics>;
+
+/**********************************************************************************************//**
+ * @brief Measurements from one run of a benchmark.
+ *
+ *************************************************************************************************/
+struct BenchmarkRun final
+{
+    /** The benchmark name, with its arguments (ex.: "BM_Foo/width:7/height:6"). */
+    std::string m_name;
+
+    /** The measured metrics. */
+    Metrics m_metrics;
+};
+
+/**********************************************************************************************//**
+ * @brief Reads the runs from Google Benchmark JSON output.
+ *
+ * Only iteration runs are read: aggregates (mean, median, etc) are ignored, as are runs which
+ * reported an error. The metrics are the real and CPU times, converted to nanoseconds, and the
+ * user counters (ex.: "items_per_second").
+ *
+ * @param p_json The Google Benchmark JSON output (`--benchmark_out_format=json`).
+ * @param p_runs The runs read are appended here.
+ *
+ * @return A success if the output could be read, an error otherwise.
+ *
+ *************************************************************************************************/
+[[nodiscard]] cxmodel::Status ReadBenchmarkRuns(const std::string& p_json, std::vector<BenchmarkRun>& p_runs);
+
+/**********************************************************************************************//**
+ * @brief Aggregates runs using the median.
+ *
+ * Runs usually come from repeated executions of a benchmark. Using the median, rather than
+ * the mean, keeps the occasional slow run on a busy machine from skewing the results.
+ *
+ * @param p_runs Some runs.
+ *
+ * @return For each benchmark, the median of each metric over all runs of that benchmark.
+ *
+ *************************************************************************************************/
+[[nodiscard]] BenchmarkResults AggregateMedians(const std::vector<BenchmarkRun>& p_runs);
+
+/**********************************************************************************************//**
+ * @brief Computes the median of some values.
+ *
+ * @pre There is at least one value.
+ *
+ * @param p_values Some values.
+ *
+ * @return The median (the mean of both middle values for an even number of values).
+ *
+ *************************************************************************************************/
+[[nodiscard]] double Median(std::vector<double> p_values);
+
+} // namespace cxbench
+
+#endif // BENCHMARKRESULTS_H_44F6B226_B80D_432B_9803_48293B224DDD
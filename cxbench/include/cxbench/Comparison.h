@@ -0,0 +1,134 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file Comparison.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef COMPARISON_H_B01410F2_95BE_43E9_B4A4_DB623921533E
+#define COMPARISON_H_B01410F2_95BE_43E9_B4A4_DB623921533E
+
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "Baseline.h"
+#include "BenchmarkResults.h"
+
+namespace cxbench
+{
+
+/**********************************************************************************************//**
+ * @brief Outcome of the comparison of a metric against its baseline.
+ *
+ *************************************************************************************************/
+enum class Verdict
+{
+    UNCHANGED, ///< Within tolerance.
+    IMPROVED,  ///< Better than the baseline, beyond tolerance.
+    REGRESSED, ///< Worse than the baseline, beyond tolerance.
+    MISSING,   ///< No current value (the benchmark was filtered out, renamed, etc).
+};
+
+/**********************************************************************************************//**
+ * @brief Comparison of a metric against its baseline.
+ *
+ *************************************************************************************************/
+struct MetricComparison final
+{
+    /** The benchmark name. */
+    std::string m_benchmark;
+
+    /** The metric name. */
+    std::string m_metric;
+
+    /** The baseline value. */
+    double m_baseline = 0.0;
+
+    /** The current value, if any. */
+    std::optional<double> m_current;
+
+    /** The relative change from the baseline (ex.: 0.05 for 5% more). */
+    double m_change = 0.0;
+
+    /** The relative tolerance used. */
+    double m_tolerance = DEFAULT_TOLERANCE;
+
+    /** The comparison outcome. */
+    Verdict m_verdict = Verdict::UNCHANGED;
+};
+
+/**********************************************************************************************//**
+ * @brief Checks if larger values of a metric mean better performance.
+ *
+ * Rates (ex.: "items_per_second") are better when higher. Everything else (times, percentiles)
+ * is better when lower.
+ *
+ * @param p_metric The metric name.
+ *
+ * @return `true` if larger is better, `false` otherwise.
+ *
+ *************************************************************************************************/
+[[nodiscard]] bool IsHigherBetter(const std::string& p_metric);
+
+/**********************************************************************************************//**
+ * @brief Compares results against a baseline.
+ *
+ * Every metric of every baseline benchmark is compared. Results for benchmarks which are not in
+ * the baseline are ignored.
+ *
+ * @param p_baseline The baseline.
+ * @param p_results  The current results.
+ *
+ * @return The comparisons, ordered by benchmark and metric names.
+ *
+ *************************************************************************************************/
+[[nodiscard]] std::vector<MetricComparison> Compare(const Baseline& p_baseline, const BenchmarkResults& p_results);
+
+/**********************************************************************************************//**
+ * @brief Counts comparisons with some verdict.
+ *
+ * @param p_comparisons Some comparisons.
+ * @param p_verdict     The verdict to count.
+ *
+ * @return The number of comparisons with the verdict.
+ *
+ *************************************************************************************************/
+[[nodiscard]] size_t Count(const std::vector<MetricComparison>& p_comparisons, Verdict p_verdict);
+
+/**********************************************************************************************//**
+ * @brief Prints comparisons as an aligned text table.
+ *
+ * For example:
+ *
+ * @verbatim
+ *   Benchmark         Metric    Baseline   Current   Change  Tolerance  Verdict
+ *   BM_Foo/width:7    cpu_time   1523.50   1901.20  +24.79%     10.00%  REGRESSED
+ * @endverbatim
+ *
+ * @param p_stream      The stream to print to.
+ * @param p_comparisons The comparisons to print.
+ *
+ *************************************************************************************************/
+void PrintComparisonTable(std::ostream& p_stream, const std::vector<MetricComparison>& p_comparisons);
+
+} // namespace cxbench
+
+#endif // COMPARISON_H_B01410F2_95BE_43E9_B4A4_DB623921533E
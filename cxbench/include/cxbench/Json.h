@@ -0,0 +1,145 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file Json.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef JSON_H_45DCB93C_3D45_4369_AF94_1B500BC00425
+#define JSON_H_45DCB93C_3D45_4369_AF94_1B500BC00425
+
+#include <cstddef>
+#include <map>
+#include <ostream>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include <cxmodel/Status.h>
+
+namespace cxbench
+{
+
+class JsonValue;
+
+/** A JSON array. */
+using JsonArray = std::vector<JsonValue>;
+
+/** A JSON object. Members are kept sorted by name. */
+using JsonObject = std::map<std::string, JsonValue>;
+
+/**********************************************************************************************//**
+ * @brief A JSON value (null, boolean, number, string, array or object).
+ *
+ * This is just enough JSON for benchmark result files: numbers are always stored as `double`
+ * and the order of object members is not preserved.
+ *
+ *************************************************************************************************/
+class JsonValue final
+{
+
+public:
+
+    /******************************************************************************************//**
+     * @brief Constructs a null value.
+     *
+     *********************************************************************************************/
+    JsonValue() = default;
+
+    /******************************************************************************************//**
+     * @brief Constructs a boolean, number, string, array or object value.
+     *
+     * @param p_value The value.
+     *
+     *********************************************************************************************/
+    JsonValue(bool p_value);
+    JsonValue(double p_value);
+    JsonValue(const char* p_value);
+    JsonValue(std::string p_value);
+    JsonValue(JsonArray p_value);
+    JsonValue(JsonObject p_value);
+
+    /******************************************************************************************//**
+     * @brief Checks the kind of value held.
+     *
+     * @tparam T One of `std::nullptr_t`, `bool`, `double`, `std::string`, `JsonArray` or
+     *           `JsonObject`.
+     *
+     * @return `true` if the value holds a `T`, `false` otherwise.
+     *
+     *********************************************************************************************/
+    template<typename T>
+    [[nodiscard]] bool Is() const
+    {
+        return std::holds_alternative<T>(m_value);
+    }
+
+    /******************************************************************************************//**
+     * @brief Accesses the value held.
+     *
+     * @pre The value holds a `T`.
+     *
+     * @return The value.
+     *
+     *********************************************************************************************/
+    template<typename T>
+    [[nodiscard]] const T& Get() const
+    {
+        return std::get<T>(m_value);
+    }
+
+    /******************************************************************************************//**
+     * @brief Looks for an object member.
+     *
+     * @param p_name The member name.
+     *
+     * @return The member value, or `nullptr` if the value is not an object or has no such member.
+     *
+     *********************************************************************************************/
+    [[nodiscard]] const JsonValue* Find(const std::string& p_name) const;
+
+private:
+
+    std::variant<std::nullptr_t, bool, double, std::string, JsonArray, JsonObject> m_value = nullptr;
+
+};
+
+/**********************************************************************************************//**
+ * @brief Parses JSON text.
+ *
+ * @param p_text  The JSON text.
+ * @param p_value The parsed value. Only meaningful on success.
+ *
+ * @return A success if the text is valid JSON, an error, locating the problem, otherwise.
+ *
+ *************************************************************************************************/
+[[nodiscard]] cxmodel::Status ParseJson(const std::string& p_text, JsonValue& p_value);
+
+/**********************************************************************************************//**
+ * @brief Writes a value as indented JSON text.
+ *
+ * @param p_stream The stream to write to.
+ * @param p_value  The value to write.
+ *
+ *************************************************************************************************/
+void WriteJson(std::ostream& p_stream, const JsonValue& p_value);
+
+} // namespace cxbench
+
+#endif // JSON_H_45DCB93C_3D45_4369_AF94_1B500BC00425
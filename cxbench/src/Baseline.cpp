@@ -0,0 +1,154 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file Baseline.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <cxbench/Baseline.h>
+#include <cxbench/Json.h>
+
+namespace
+{
+
+const std::string BENCHMARKS = "benchmarks";
+const std::string METRICS = "metrics";
+const std::string TOLERANCE = "tolerance";
+
+cxmodel::Status ReadTolerance(const cxbench::JsonValue& p_tolerance, const std::string& p_owner, double& p_value)
+{
+    if(!p_tolerance.Is<double>() || p_tolerance.Get<double>() < 0.0)
+    {
+        return cxmodel::MakeError("Invalid tolerance for " + p_owner + ".");
+    }
+
+    p_value = p_tolerance.Get<double>();
+    return cxmodel::MakeSuccess();
+}
+
+} // namespace
+
+cxmodel::Status cxbench::ReadBaseline(const std::string& p_json, Baseline& p_baseline)
+{
+    JsonValue document;
+    cxmodel::Status status = ParseJson(p_json, document);
+    ON_ERROR(status, return status;);
+
+    if(!document.Is<JsonObject>())
+    {
+        return cxmodel::MakeError("The baseline is not a JSON object.");
+    }
+
+    Baseline baseline;
+
+    if(const JsonValue* tolerance = document.Find(TOLERANCE); tolerance)
+    {
+        status = ReadTolerance(*tolerance, "the baseline", baseline.m_tolerance);
+        ON_ERROR(status, return status;);
+    }
+
+    const JsonValue* benchmarks = document.Find(BENCHMARKS);
+    if(!benchmarks || !benchmarks->Is<JsonObject>())
+    {
+        return cxmodel::MakeError("No benchmarks found in the baseline.");
+    }
+
+    for(const auto& [name, benchmark] : benchmarks->Get<JsonObject>())
+    {
+        BaselineEntry entry;
+
+        const JsonValue* metrics = benchmark.Find(METRICS);
+        if(!metrics || !metrics->Is<JsonObject>())
+        {
+            return cxmodel::MakeError("No metrics found for " + name + ".");
+        }
+
+        for(const auto& [metric, value] : metrics->Get<JsonObject>())
+        {
+            if(!value.Is<double>())
+            {
+                return cxmodel::MakeError("Invalid value for " + name + " " + metric + ".");
+            }
+
+            entry.m_metrics[metric] = value.Get<double>();
+        }
+
+        if(const JsonValue* tolerance = benchmark.Find(TOLERANCE); tolerance)
+        {
+            double value = 0.0;
+            status = ReadTolerance(*tolerance, name, value);
+            ON_ERROR(status, return status;);
+
+            entry.m_tolerance = value;
+        }
+
+        baseline.m_entries[name] = std::move(entry);
+    }
+
+    p_baseline = std::move(baseline);
+    return cxmodel::MakeSuccess();
+}
+
+void cxbench::WriteBaseline(std::ostream& p_stream, const Baseline& p_baseline)
+{
+    JsonObject benchmarks;
+    for(const auto& [name, entry] : p_baseline.m_entries)
+    {
+        JsonObject metrics;
+        for(const auto& [metric, value] : entry.m_metrics)
+        {
+            metrics[metric] = JsonValue{value};
+        }
+
+        JsonObject benchmark;
+        benchmark[METRICS] = JsonValue{std::move(metrics)};
+        if(entry.m_tolerance)
+        {
+            benchmark[TOLERANCE] = JsonValue{*entry.m_tolerance};
+        }
+
+        benchmarks[name] = JsonValue{std::move(benchmark)};
+    }
+
+    JsonObject document;
+    document[BENCHMARKS] = JsonValue{std::move(benchmarks)};
+    document[TOLERANCE] = JsonValue{p_baseline.m_tolerance};
+
+    WriteJson(p_stream, JsonValue{std::move(document)});
+}
+
+cxbench::Baseline cxbench::MakeBaseline(const BenchmarkResults& p_results, const Baseline& p_previous)
+{
+    Baseline baseline;
+    baseline.m_tolerance = p_previous.m_tolerance;
+
+    for(const auto& [name, metrics] : p_results)
+    {
+        BaselineEntry& entry = baseline.m_entries[name];
+        entry.m_metrics = metrics;
+
+        const auto previous = p_previous.m_entries.find(name);
+        if(previous != p_previous.m_entries.cend())
+        {
+            entry.m_tolerance = previous->second.m_tolerance;
+        }
+    }
+
+    return baseline;
+}
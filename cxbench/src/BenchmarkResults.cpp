@@ -0,0 +1,184 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file BenchmarkResults.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <algorithm>
+#include <set>
+
+#include <cxinv/assertion.h>
+#include <cxbench/BenchmarkResults.h>
+#include <cxbench/Json.h>
+
+namespace
+{
+
+// Numeric fields that describe the run rather than measure it:
+const std::set<std::string> NON_METRIC_FIELDS
+{
+    "family_index",
+    "iterations",
+    "per_family_instance_index",
+    "repetition_index",
+    "repetitions",
+    "threads",
+};
+
+// Fields holding times, in the run's time unit:
+const std::set<std::string> TIME_FIELDS
+{
+    "cpu_time",
+    "real_time",
+};
+
+bool ToNanoseconds(const std::string& p_timeUnit, double& p_factor)
+{
+    if(p_timeUnit == "ns")
+    {
+        p_factor = 1.0;
+    }
+    else if(p_timeUnit == "us")
+    {
+        p_factor = 1e3;
+    }
+    else if(p_timeUnit == "ms")
+    {
+        p_factor = 1e6;
+    }
+    else if(p_timeUnit == "s")
+    {
+        p_factor = 1e9;
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+bool IsTrue(const cxbench::JsonValue* p_value)
+{
+    return p_value && p_value->Is<bool>() && p_value->Get<bool>();
+}
+
+} // namespace
+
+cxmodel::Status cxbench::ReadBenchmarkRuns(const std::string& p_json, std::vector<BenchmarkRun>& p_runs)
+{
+    JsonValue document;
+    const cxmodel::Status status = ParseJson(p_json, document);
+    ON_ERROR(status, return status;);
+
+    const JsonValue* benchmarks = document.Find("benchmarks");
+    if(!benchmarks || !benchmarks->Is<JsonArray>())
+    {
+        return cxmodel::MakeError("No benchmarks found in the Google Benchmark output.");
+    }
+
+    for(const JsonValue& benchmark : benchmarks->Get<JsonArray>())
+    {
+        const JsonValue* name = benchmark.Find("name");
+        if(!name || !name->Is<std::string>())
+        {
+            return cxmodel::MakeError("Benchmark without a name in the Google Benchmark output.");
+        }
+
+        const JsonValue* runType = benchmark.Find("run_type");
+        if(runType && runType->Is<std::string>() && runType->Get<std::string>() != "iteration")
+        {
+            continue;
+        }
+
+        if(IsTrue(benchmark.Find("error_occurred")))
+        {
+            continue;
+        }
+
+        double timeFactor = 1.0;
+        const JsonValue* timeUnit = benchmark.Find("time_unit");
+        if(timeUnit && (!timeUnit->Is<std::string>() || !ToNanoseconds(timeUnit->Get<std::string>(), timeFactor)))
+        {
+            return cxmodel::MakeError("Unknown time unit for " + name->Get<std::string>() + ".");
+        }
+
+        // Repetitions of the same benchmark share a run name, which is the name without
+        // any aggregate suffix:
+        const JsonValue* runName = benchmark.Find("run_name");
+        BenchmarkRun run;
+        run.m_name = (runName && runName->Is<std::string>()) ? runName->Get<std::string>() : name->Get<std::string>();
+
+        for(const auto& [field, value] : benchmark.Get<JsonObject>())
+        {
+            if(!value.Is<double>() || NON_METRIC_FIELDS.count(field) > 0u)
+            {
+                continue;
+            }
+
+            const double factor = (TIME_FIELDS.count(field) > 0u) ? timeFactor : 1.0;
+            run.m_metrics[field] = value.Get<double>() * factor;
+        }
+
+        p_runs.push_back(std::move(run));
+    }
+
+    return cxmodel::MakeSuccess();
+}
+
+cxbench::BenchmarkResults cxbench::AggregateMedians(const std::vector<BenchmarkRun>& p_runs)
+{
+    std::map<std::string, std::map<std::string, std::vector<double>>> values;
+    for(const BenchmarkRun& run : p_runs)
+    {
+        for(const auto& [metric, value] : run.m_metrics)
+        {
+            values[run.m_name][metric].push_back(value);
+        }
+    }
+
+    BenchmarkResults results;
+    for(const auto& [benchmark, metrics] : values)
+    {
+        for(const auto& [metric, metricValues] : metrics)
+        {
+            results[benchmark][metric] = Median(metricValues);
+        }
+    }
+
+    return results;
+}
+
+double cxbench::Median(std::vector<double> p_values)
+{
+    IF_PRECONDITION_NOT_MET_DO(!p_values.empty(), return 0.0;);
+
+    const size_t middle = p_values.size() / 2u;
+    std::nth_element(p_values.begin(), p_values.begin() + middle, p_values.end());
+    const double upperMiddle = p_values[middle];
+
+    if(p_values.size() % 2u == 1u)
+    {
+        return upperMiddle;
+    }
+
+    const double lowerMiddle = *std::max_element(p_values.begin(), p_values.begin() + middle);
+    return (lowerMiddle + upperMiddle) / 2.0;
+}
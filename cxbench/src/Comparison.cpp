@@ -0,0 +1,197 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file Comparison.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+#include <cxinv/assertion.h>
+#include <cxbench/Comparison.h>
+
+namespace
+{
+
+const std::string RATE_SUFFIX = "_per_second";
+
+std::string ToString(cxbench::Verdict p_verdict)
+{
+    switch(p_verdict)
+    {
+        case cxbench::Verdict::UNCHANGED:
+            return "ok";
+
+        case cxbench::Verdict::IMPROVED:
+            return "IMPROVED";
+
+        case cxbench::Verdict::REGRESSED:
+            return "REGRESSED";
+
+        case cxbench::Verdict::MISSING:
+            return "missing";
+
+        default:
+            break;
+    }
+
+    ASSERT_ERROR_MSG("Unknown verdict");
+    return "?";
+}
+
+std::string FormatValue(double p_value)
+{
+    std::ostringstream stream;
+    stream << std::fixed << std::setprecision(2) << p_value;
+    return stream.str();
+}
+
+std::string FormatPercentage(double p_ratio, bool p_showSign)
+{
+    std::ostringstream stream;
+    stream << std::fixed << std::setprecision(2);
+    if(p_showSign)
+    {
+        stream << std::showpos;
+    }
+    stream << 100.0 * p_ratio << "%";
+    return stream.str();
+}
+
+} // namespace
+
+bool cxbench::IsHigherBetter(const std::string& p_metric)
+{
+    return p_metric.size() >= RATE_SUFFIX.size() &&
+           p_metric.compare(p_metric.size() - RATE_SUFFIX.size(), RATE_SUFFIX.size(), RATE_SUFFIX) == 0;
+}
+
+std::vector<cxbench::MetricComparison> cxbench::Compare(const Baseline& p_baseline, const BenchmarkResults& p_results)
+{
+    std::vector<MetricComparison> comparisons;
+
+    for(const auto& [benchmark, entry] : p_baseline.m_entries)
+    {
+        const auto results = p_results.find(benchmark);
+
+        for(const auto& [metric, baselineValue] : entry.m_metrics)
+        {
+            MetricComparison comparison;
+            comparison.m_benchmark = benchmark;
+            comparison.m_metric = metric;
+            comparison.m_baseline = baselineValue;
+            comparison.m_tolerance = entry.m_tolerance.value_or(p_baseline.m_tolerance);
+
+            if(results == p_results.cend() || results->second.count(metric) == 0u)
+            {
+                comparison.m_verdict = Verdict::MISSING;
+                comparisons.push_back(comparison);
+                continue;
+            }
+
+            const double currentValue = results->second.at(metric);
+            comparison.m_current = currentValue;
+
+            // A zero baseline (ex.: a counter which was never incremented) gives no scale
+            // to compare against:
+            if(baselineValue != 0.0)
+            {
+                comparison.m_change = (currentValue - baselineValue) / std::abs(baselineValue);
+            }
+
+            // Positive when performance got worse:
+            const double degradation = IsHigherBetter(metric) ? -comparison.m_change : comparison.m_change;
+
+            if(degradation > comparison.m_tolerance)
+            {
+                comparison.m_verdict = Verdict::REGRESSED;
+            }
+            else if(-degradation > comparison.m_tolerance)
+            {
+                comparison.m_verdict = Verdict::IMPROVED;
+            }
+
+            comparisons.push_back(comparison);
+        }
+    }
+
+    return comparisons;
+}
+
+size_t cxbench::Count(const std::vector<MetricComparison>& p_comparisons, Verdict p_verdict)
+{
+    return static_cast<size_t>(std::count_if(p_comparisons.cbegin(),
+                                             p_comparisons.cend(),
+                                             [p_verdict](const MetricComparison& p_comparison)
+                                             {
+                                                 return p_comparison.m_verdict == p_verdict;
+                                             }));
+}
+
+void cxbench::PrintComparisonTable(std::ostream& p_stream, const std::vector<MetricComparison>& p_comparisons)
+{
+    using Row = std::array<std::string, 7u>;
+
+    std::vector<Row> rows;
+    rows.push_back({"Benchmark", "Metric", "Baseline", "Current", "Change", "Tolerance", "Verdict"});
+
+    for(const MetricComparison& comparison : p_comparisons)
+    {
+        const bool hasCurrent = comparison.m_current.has_value();
+
+        rows.push_back({comparison.m_benchmark,
+                        comparison.m_metric,
+                        FormatValue(comparison.m_baseline),
+                        hasCurrent ? FormatValue(*comparison.m_current) : "-",
+                        hasCurrent ? FormatPercentage(comparison.m_change, true) : "-",
+                        FormatPercentage(comparison.m_tolerance, false),
+                        ToString(comparison.m_verdict)});
+    }
+
+    std::array<size_t, 7u> widths{};
+    for(const Row& row : rows)
+    {
+        for(size_t column = 0u; column < row.size(); ++column)
+        {
+            widths[column] = std::max(widths[column], row[column].size());
+        }
+    }
+
+    // Names are left aligned, numbers are right aligned, the verdict is not padded:
+    for(const Row& row : rows)
+    {
+        for(size_t column = 0u; column < row.size(); ++column)
+        {
+            if(column == row.size() - 1u)
+            {
+                p_stream << row[column] << "\n";
+                break;
+            }
+
+            const bool isName = (column < 2u);
+            p_stream << (isName ? std::left : std::right) << std::setw(static_cast<int>(widths[column])) << row[column] << "  ";
+        }
+    }
+
+    p_stream << std::right;
+}
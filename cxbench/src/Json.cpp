@@ -0,0 +1,550 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file Json.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <sstream>
+
+#include <cxinv/assertion.h>
+#include <cxbench/Json.h>
+
+namespace
+{
+
+/**************************************************************************************************
+ * @brief Recursive descent JSON parser.
+ *
+ *************************************************************************************************/
+class Parser final
+{
+
+public:
+
+    explicit Parser(const std::string& p_text)
+    : m_text{p_text}
+    {
+    }
+
+    cxmodel::Status Parse(cxbench::JsonValue& p_value)
+    {
+        const cxmodel::Status status = ParseValue(p_value);
+        ON_ERROR(status, return status;);
+
+        SkipWhitespace();
+        if(m_position != m_text.size())
+        {
+            return MakeError("unexpected trailing characters");
+        }
+
+        return cxmodel::MakeSuccess();
+    }
+
+private:
+
+    cxmodel::Status ParseValue(cxbench::JsonValue& p_value)
+    {
+        SkipWhitespace();
+        if(m_position >= m_text.size())
+        {
+            return MakeError("unexpected end of text");
+        }
+
+        switch(m_text[m_position])
+        {
+            case '{': return ParseObject(p_value);
+            case '[': return ParseArray(p_value);
+            case '"':
+            {
+                std::string value;
+                const cxmodel::Status status = ParseString(value);
+                ON_ERROR(status, return status;);
+
+                p_value = cxbench::JsonValue{std::move(value)};
+                return cxmodel::MakeSuccess();
+            }
+            case 't': return ParseLiteral("true", cxbench::JsonValue{true}, p_value);
+            case 'f': return ParseLiteral("false", cxbench::JsonValue{false}, p_value);
+            case 'n': return ParseLiteral("null", cxbench::JsonValue{}, p_value);
+            default:  return ParseNumber(p_value);
+        }
+    }
+
+    cxmodel::Status ParseObject(cxbench::JsonValue& p_value)
+    {
+        ++m_position; // '{'
+
+        cxbench::JsonObject object;
+
+        SkipWhitespace();
+        if(Consume('}'))
+        {
+            p_value = cxbench::JsonValue{std::move(object)};
+            return cxmodel::MakeSuccess();
+        }
+
+        while(true)
+        {
+            SkipWhitespace();
+            if(m_position >= m_text.size() || m_text[m_position] != '"')
+            {
+                return MakeError("member name expected");
+            }
+
+            std::string name;
+            cxmodel::Status status = ParseString(name);
+            ON_ERROR(status, return status;);
+
+            SkipWhitespace();
+            if(!Consume(':'))
+            {
+                return MakeError("':' expected");
+            }
+
+            cxbench::JsonValue member;
+            status = ParseValue(member);
+            ON_ERROR(status, return status;);
+
+            object[name] = std::move(member);
+
+            SkipWhitespace();
+            if(Consume('}'))
+            {
+                break;
+            }
+
+            if(!Consume(','))
+            {
+                return MakeError("',' or '}' expected");
+            }
+        }
+
+        p_value = cxbench::JsonValue{std::move(object)};
+        return cxmodel::MakeSuccess();
+    }
+
+    cxmodel::Status ParseArray(cxbench::JsonValue& p_value)
+    {
+        ++m_position; // '['
+
+        cxbench::JsonArray array;
+
+        SkipWhitespace();
+        if(Consume(']'))
+        {
+            p_value = cxbench::JsonValue{std::move(array)};
+            return cxmodel::MakeSuccess();
+        }
+
+        while(true)
+        {
+            cxbench::JsonValue element;
+            const cxmodel::Status status = ParseValue(element);
+            ON_ERROR(status, return status;);
+
+            array.push_back(std::move(element));
+
+            SkipWhitespace();
+            if(Consume(']'))
+            {
+                break;
+            }
+
+            if(!Consume(','))
+            {
+                return MakeError("',' or ']' expected");
+            }
+        }
+
+        p_value = cxbench::JsonValue{std::move(array)};
+        return cxmodel::MakeSuccess();
+    }
+
+    cxmodel::Status ParseString(std::string& p_value)
+    {
+        ++m_position; // '"'
+
+        while(m_position < m_text.size())
+        {
+            const char current = m_text[m_position++];
+
+            if(current == '"')
+            {
+                return cxmodel::MakeSuccess();
+            }
+
+            if(current != '\\')
+            {
+                p_value.push_back(current);
+                continue;
+            }
+
+            if(m_position >= m_text.size())
+            {
+                break;
+            }
+
+            const char escaped = m_text[m_position++];
+            switch(escaped)
+            {
+                case '"':  p_value.push_back('"');  break;
+                case '\\': p_value.push_back('\\'); break;
+                case '/':  p_value.push_back('/');  break;
+                case 'b':  p_value.push_back('\b'); break;
+                case 'f':  p_value.push_back('\f'); break;
+                case 'n':  p_value.push_back('\n'); break;
+                case 'r':  p_value.push_back('\r'); break;
+                case 't':  p_value.push_back('\t'); break;
+                case 'u':
+                {
+                    unsigned int codePoint = 0u;
+                    const cxmodel::Status status = ParseCodePoint(codePoint);
+                    ON_ERROR(status, return status;);
+
+                    AppendUtf8(codePoint, p_value);
+                    break;
+                }
+                default:
+                    return MakeError("invalid escape sequence");
+            }
+        }
+
+        return MakeError("unterminated string");
+    }
+
+    cxmodel::Status ParseCodePoint(unsigned int& p_codePoint)
+    {
+        cxmodel::Status status = ParseHexQuad(p_codePoint);
+        ON_ERROR(status, return status;);
+
+        // Characters outside the basic multilingual plane come as surrogate pairs:
+        if(p_codePoint >= 0xD800u && p_codePoint <= 0xDBFFu)
+        {
+            if(!Consume('\\') || !Consume('u'))
+            {
+                return MakeError("low surrogate expected");
+            }
+
+            unsigned int lowSurrogate = 0u;
+            status = ParseHexQuad(lowSurrogate);
+            ON_ERROR(status, return status;);
+
+            if(lowSurrogate < 0xDC00u || lowSurrogate > 0xDFFFu)
+            {
+                return MakeError("invalid low surrogate");
+            }
+
+            p_codePoint = 0x10000u + ((p_codePoint - 0xD800u) << 10u) + (lowSurrogate - 0xDC00u);
+        }
+
+        return cxmodel::MakeSuccess();
+    }
+
+    cxmodel::Status ParseHexQuad(unsigned int& p_value)
+    {
+        if(m_position + 4u > m_text.size())
+        {
+            return MakeError("unterminated unicode escape");
+        }
+
+        p_value = 0u;
+        for(size_t index = 0u; index < 4u; ++index)
+        {
+            const char digit = m_text[m_position++];
+            p_value <<= 4u;
+
+            if(digit >= '0' && digit <= '9')
+            {
+                p_value += static_cast<unsigned int>(digit - '0');
+            }
+            else if(digit >= 'a' && digit <= 'f')
+            {
+                p_value += static_cast<unsigned int>(digit - 'a' + 10);
+            }
+            else if(digit >= 'A' && digit <= 'F')
+            {
+                p_value += static_cast<unsigned int>(digit - 'A' + 10);
+            }
+            else
+            {
+                return MakeError("invalid unicode escape");
+            }
+        }
+
+        return cxmodel::MakeSuccess();
+    }
+
+    static void AppendUtf8(unsigned int p_codePoint, std::string& p_value)
+    {
+        if(p_codePoint < 0x80u)
+        {
+            p_value.push_back(static_cast<char>(p_codePoint));
+        }
+        else if(p_codePoint < 0x800u)
+        {
+            p_value.push_back(static_cast<char>(0xC0u | (p_codePoint >> 6u)));
+            p_value.push_back(static_cast<char>(0x80u | (p_codePoint & 0x3Fu)));
+        }
+        else if(p_codePoint < 0x10000u)
+        {
+            p_value.push_back(static_cast<char>(0xE0u | (p_codePoint >> 12u)));
+            p_value.push_back(static_cast<char>(0x80u | ((p_codePoint >> 6u) & 0x3Fu)));
+            p_value.push_back(static_cast<char>(0x80u | (p_codePoint & 0x3Fu)));
+        }
+        else
+        {
+            p_value.push_back(static_cast<char>(0xF0u | (p_codePoint >> 18u)));
+            p_value.push_back(static_cast<char>(0x80u | ((p_codePoint >> 12u) & 0x3Fu)));
+            p_value.push_back(static_cast<char>(0x80u | ((p_codePoint >> 6u) & 0x3Fu)));
+            p_value.push_back(static_cast<char>(0x80u | (p_codePoint & 0x3Fu)));
+        }
+    }
+
+    cxmodel::Status ParseNumber(cxbench::JsonValue& p_value)
+    {
+        const size_t start = m_position;
+        while(m_position < m_text.size() && std::string{"+-.0123456789eE"}.find(m_text[m_position]) != std::string::npos)
+        {
+            ++m_position;
+        }
+
+        if(start == m_position)
+        {
+            return MakeError("value expected");
+        }
+
+        const std::string token = m_text.substr(start, m_position - start);
+
+        char* end = nullptr;
+        const double value = std::strtod(token.c_str(), &end);
+        if(end != token.c_str() + token.size())
+        {
+            m_position = start;
+            return MakeError("invalid number");
+        }
+
+        p_value = cxbench::JsonValue{value};
+        return cxmodel::MakeSuccess();
+    }
+
+    cxmodel::Status ParseLiteral(const std::string& p_literal, const cxbench::JsonValue& p_literalValue, cxbench::JsonValue& p_value)
+    {
+        if(m_text.compare(m_position, p_literal.size(), p_literal) != 0)
+        {
+            return MakeError("invalid literal");
+        }
+
+        m_position += p_literal.size();
+        p_value = p_literalValue;
+
+        return cxmodel::MakeSuccess();
+    }
+
+    void SkipWhitespace()
+    {
+        while(m_position < m_text.size() && std::string{" \t\r\n"}.find(m_text[m_position]) != std::string::npos)
+        {
+            ++m_position;
+        }
+    }
+
+    bool Consume(char p_character)
+    {
+        if(m_position < m_text.size() && m_text[m_position] == p_character)
+        {
+            ++m_position;
+            return true;
+        }
+
+        return false;
+    }
+
+    cxmodel::Status MakeError(const std::string& p_message) const
+    {
+        return cxmodel::MakeError("Invalid JSON at offset " + std::to_string(m_position) + ": " + p_message + ".");
+    }
+
+    const std::string& m_text;
+    size_t m_position = 0u;
+
+};
+
+void WriteString(std::ostream& p_stream, const std::string& p_value)
+{
+    p_stream << '"';
+    for(const char character : p_value)
+    {
+        switch(character)
+        {
+            case '"':  p_stream << "\\\""; break;
+            case '\\': p_stream << "\\\\"; break;
+            case '\b': p_stream << "\\b";  break;
+            case '\f': p_stream << "\\f";  break;
+            case '\n': p_stream << "\\n";  break;
+            case '\r': p_stream << "\\r";  break;
+            case '\t': p_stream << "\\t";  break;
+            default:
+            {
+                if(static_cast<unsigned char>(character) < 0x20u)
+                {
+                    p_stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(character) << std::dec << std::setfill(' ');
+                }
+                else
+                {
+                    p_stream << character;
+                }
+            }
+        }
+    }
+    p_stream << '"';
+}
+
+void WriteValue(std::ostream& p_stream, const cxbench::JsonValue& p_value, size_t p_indentation)
+{
+    const std::string indentation(2u * p_indentation, ' ');
+    const std::string memberIndentation(2u * (p_indentation + 1u), ' ');
+
+    if(p_value.Is<bool>())
+    {
+        p_stream << (p_value.Get<bool>() ? "true" : "false");
+    }
+    else if(p_value.Is<double>())
+    {
+        // JSON has no representation for infinite values or NaNs:
+        const double number = p_value.Get<double>();
+        if(std::isfinite(number))
+        {
+            std::ostringstream formatted;
+            formatted << std::setprecision(15) << number;
+            p_stream << formatted.str();
+        }
+        else
+        {
+            p_stream << "null";
+        }
+    }
+    else if(p_value.Is<std::string>())
+    {
+        WriteString(p_stream, p_value.Get<std::string>());
+    }
+    else if(p_value.Is<cxbench::JsonArray>())
+    {
+        const cxbench::JsonArray& array = p_value.Get<cxbench::JsonArray>();
+        if(array.empty())
+        {
+            p_stream << "[]";
+            return;
+        }
+
+        p_stream << "[\n";
+        for(size_t index = 0u; index < array.size(); ++index)
+        {
+            p_stream << memberIndentation;
+            WriteValue(p_stream, array[index], p_indentation + 1u);
+            p_stream << (index + 1u < array.size() ? ",\n" : "\n");
+        }
+        p_stream << indentation << "]";
+    }
+    else if(p_value.Is<cxbench::JsonObject>())
+    {
+        const cxbench::JsonObject& object = p_value.Get<cxbench::JsonObject>();
+        if(object.empty())
+        {
+            p_stream << "{}";
+            return;
+        }
+
+        p_stream << "{\n";
+        size_t index = 0u;
+        for(const auto& [name, member] : object)
+        {
+            p_stream << memberIndentation;
+            WriteString(p_stream, name);
+            p_stream << ": ";
+            WriteValue(p_stream, member, p_indentation + 1u);
+            p_stream << (++index < object.size() ? ",\n" : "\n");
+        }
+        p_stream << indentation << "}";
+    }
+    else
+    {
+        p_stream << "null";
+    }
+}
+
+} // namespace
+
+cxbench::JsonValue::JsonValue(bool p_value)
+: m_value{p_value}
+{
+}
+
+cxbench::JsonValue::JsonValue(double p_value)
+: m_value{p_value}
+{
+}
+
+cxbench::JsonValue::JsonValue(const char* p_value)
+: m_value{std::string{p_value}}
+{
+}
+
+cxbench::JsonValue::JsonValue(std::string p_value)
+: m_value{std::move(p_value)}
+{
+}
+
+cxbench::JsonValue::JsonValue(JsonArray p_value)
+: m_value{std::move(p_value)}
+{
+}
+
+cxbench::JsonValue::JsonValue(JsonObject p_value)
+: m_value{std::move(p_value)}
+{
+}
+
+const cxbench::JsonValue* cxbench::JsonValue::Find(const std::string& p_name) const
+{
+    if(!Is<JsonObject>())
+    {
+        return nullptr;
+    }
+
+    const JsonObject& object = Get<JsonObject>();
+    const auto member = object.find(p_name);
+
+    return member == object.cend() ? nullptr : &member->second;
+}
+
+cxmodel::Status cxbench::ParseJson(const std::string& p_text, JsonValue& p_value)
+{
+    Parser parser{p_text};
+    return parser.Parse(p_value);
+}
+
+void cxbench::WriteJson(std::ostream& p_stream, const JsonValue& p_value)
+{
+    WriteValue(p_stream, p_value, 0u);
+    p_stream << "\n";
+}
@@ -0,0 +1,114 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file BaselineTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include <cxbench/Baseline.h>
+
+TEST(Baseline, /*DISABLED_*/ReadBaseline_ValidBaseline_EntriesAndTolerancesRead)
+{
+    const std::string json = R"({
+      "tolerance": 0.2,
+      "benchmarks": {
+        "BM_Foo": {"metrics": {"cpu_time": 100.0, "items_per_second": 10.0}, "tolerance": 0.5},
+        "BM_Bar": {"metrics": {"cpu_time": 7.0}}
+      }
+    })";
+
+    cxbench::Baseline baseline;
+    ASSERT_TRUE(cxbench::ReadBaseline(json, baseline).IsSuccess());
+
+    ASSERT_DOUBLE_EQ(baseline.m_tolerance, 0.2);
+    ASSERT_EQ(baseline.m_entries.size(), 2u);
+    ASSERT_DOUBLE_EQ(baseline.m_entries.at("BM_Foo").m_metrics.at("cpu_time"), 100.0);
+    ASSERT_DOUBLE_EQ(baseline.m_entries.at("BM_Foo").m_metrics.at("items_per_second"), 10.0);
+    ASSERT_DOUBLE_EQ(*baseline.m_entries.at("BM_Foo").m_tolerance, 0.5);
+    ASSERT_DOUBLE_EQ(baseline.m_entries.at("BM_Bar").m_metrics.at("cpu_time"), 7.0);
+    ASSERT_FALSE(baseline.m_entries.at("BM_Bar").m_tolerance.has_value());
+}
+
+TEST(Baseline, /*DISABLED_*/ReadBaseline_NoTopLevelTolerance_DefaultTolerance)
+{
+    cxbench::Baseline baseline;
+    ASSERT_TRUE(cxbench::ReadBaseline("{\"benchmarks\": {}}", baseline).IsSuccess());
+
+    ASSERT_DOUBLE_EQ(baseline.m_tolerance, cxbench::DEFAULT_TOLERANCE);
+    ASSERT_TRUE(baseline.m_entries.empty());
+}
+
+TEST(Baseline, /*DISABLED_*/ReadBaseline_InvalidBaseline_Error)
+{
+    cxbench::Baseline baseline;
+
+    ASSERT_FALSE(cxbench::ReadBaseline("[]", baseline).IsSuccess());
+    ASSERT_FALSE(cxbench::ReadBaseline("{\"tolerance\": 0.1}", baseline).IsSuccess());
+    ASSERT_FALSE(cxbench::ReadBaseline("{\"benchmarks\": {}, \"tolerance\": -0.1}", baseline).IsSuccess());
+    ASSERT_FALSE(cxbench::ReadBaseline("{\"benchmarks\": {\"BM_Foo\": {}}}", baseline).IsSuccess());
+    ASSERT_FALSE(cxbench::ReadBaseline("{\"benchmarks\": {\"BM_Foo\": {\"metrics\": {\"cpu_time\": \"fast\"}}}}", baseline).IsSuccess());
+}
+
+TEST(Baseline, /*DISABLED_*/WriteBaseline_ThenReadBaseline_SameBaseline)
+{
+    cxbench::Baseline baseline;
+    baseline.m_tolerance = 0.15;
+    baseline.m_entries["BM_Foo/width:7"] = {{{"cpu_time", 1523.5}}, 0.3};
+    baseline.m_entries["BM_Bar"] = {{{"cpu_time", 12.0}, {"p99_us", 40.25}}, std::nullopt};
+
+    std::ostringstream stream;
+    cxbench::WriteBaseline(stream, baseline);
+
+    cxbench::Baseline read;
+    ASSERT_TRUE(cxbench::ReadBaseline(stream.str(), read).IsSuccess());
+
+    ASSERT_DOUBLE_EQ(read.m_tolerance, 0.15);
+    ASSERT_EQ(read.m_entries.size(), 2u);
+    ASSERT_DOUBLE_EQ(read.m_entries.at("BM_Foo/width:7").m_metrics.at("cpu_time"), 1523.5);
+    ASSERT_DOUBLE_EQ(*read.m_entries.at("BM_Foo/width:7").m_tolerance, 0.3);
+    ASSERT_DOUBLE_EQ(read.m_entries.at("BM_Bar").m_metrics.at("p99_us"), 40.25);
+    ASSERT_FALSE(read.m_entries.at("BM_Bar").m_tolerance.has_value());
+}
+
+TEST(Baseline, /*DISABLED_*/MakeBaseline_PreviousBaseline_TolerancesKept)
+{
+    cxbench::Baseline previous;
+    previous.m_tolerance = 0.2;
+    previous.m_entries["BM_Foo"] = {{{"cpu_time", 100.0}}, 0.5};
+    previous.m_entries["BM_Removed"] = {{{"cpu_time", 1.0}}, 0.7};
+
+    const cxbench::BenchmarkResults results
+    {
+        {"BM_Foo", {{"cpu_time", 80.0}}},
+        {"BM_New", {{"cpu_time", 3.0}}},
+    };
+
+    const cxbench::Baseline baseline = cxbench::MakeBaseline(results, previous);
+
+    ASSERT_DOUBLE_EQ(baseline.m_tolerance, 0.2);
+    ASSERT_EQ(baseline.m_entries.size(), 2u);
+    ASSERT_DOUBLE_EQ(baseline.m_entries.at("BM_Foo").m_metrics.at("cpu_time"), 80.0);
+    ASSERT_DOUBLE_EQ(*baseline.m_entries.at("BM_Foo").m_tolerance, 0.5);
+    ASSERT_DOUBLE_EQ(baseline.m_entries.at("BM_New").m_metrics.at("cpu_time"), 3.0);
+    ASSERT_FALSE(baseline.m_entries.at("BM_New").m_tolerance.has_value());
+}
@@ -0,0 +1,142 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file BenchmarkResultsTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <cxbench/BenchmarkResults.h>
+
+namespace
+{
+
+// Trimmed down Google Benchmark output, with two repetitions and their aggregates:
+const std::string GOOGLE_BENCHMARK_OUTPUT = R"({
+  "context": {
+    "date": "2026-10-19T12:00:00+00:00",
+    "num_cpus": 1
+  },
+  "benchmarks": [
+    {
+      "name": "BM_Foo/width:7",
+      "family_index": 0,
+      "per_family_instance_index": 0,
+      "run_name": "BM_Foo/width:7",
+      "run_type": "iteration",
+      "repetitions": 2,
+      "repetition_index": 0,
+      "threads": 1,
+      "iterations": 1000,
+      "real_time": 1.5,
+      "cpu_time": 1.25,
+      "time_unit": "us",
+      "items_per_second": 800000.0
+    },
+    {
+      "name": "BM_Foo/width:7",
+      "family_index": 0,
+      "per_family_instance_index": 0,
+      "run_name": "BM_Foo/width:7",
+      "run_type": "iteration",
+      "repetitions": 2,
+      "repetition_index": 1,
+      "threads": 1,
+      "iterations": 1000,
+      "real_time": 2.5,
+      "cpu_time": 2.25,
+      "time_unit": "us",
+      "items_per_second": 444444.0
+    },
+    {
+      "name": "BM_Foo/width:7_mean",
+      "family_index": 0,
+      "per_family_instance_index": 0,
+      "run_name": "BM_Foo/width:7",
+      "run_type": "aggregate",
+      "aggregate_name": "mean",
+      "iterations": 2,
+      "real_time": 2.0,
+      "cpu_time": 1.75,
+      "time_unit": "us"
+    },
+    {
+      "name": "BM_Bar",
+      "run_name": "BM_Bar",
+      "run_type": "iteration",
+      "error_occurred": true,
+      "error_message": "Failed.",
+      "iterations": 0,
+      "real_time": 0.0,
+      "cpu_time": 0.0,
+      "time_unit": "ns"
+    }
+  ]
+})";
+
+} // namespace
+
+TEST(BenchmarkResults, /*DISABLED_*/ReadBenchmarkRuns_GoogleBenchmarkOutput_IterationRunsRead)
+{
+    std::vector<cxbench::BenchmarkRun> runs;
+    ASSERT_TRUE(cxbench::ReadBenchmarkRuns(GOOGLE_BENCHMARK_OUTPUT, runs).IsSuccess());
+
+    ASSERT_EQ(runs.size(), 2u);
+    ASSERT_EQ(runs[0].m_name, "BM_Foo/width:7");
+    ASSERT_EQ(runs[0].m_metrics.size(), 3u);
+    ASSERT_DOUBLE_EQ(runs[0].m_metrics.at("real_time"), 1500.0);
+    ASSERT_DOUBLE_EQ(runs[0].m_metrics.at("cpu_time"), 1250.0);
+    ASSERT_DOUBLE_EQ(runs[0].m_metrics.at("items_per_second"), 800000.0);
+    ASSERT_DOUBLE_EQ(runs[1].m_metrics.at("cpu_time"), 2250.0);
+}
+
+TEST(BenchmarkResults, /*DISABLED_*/ReadBenchmarkRuns_NotGoogleBenchmarkOutput_Error)
+{
+    std::vector<cxbench::BenchmarkRun> runs;
+
+    ASSERT_FALSE(cxbench::ReadBenchmarkRuns("{\"context\": {}}", runs).IsSuccess());
+    ASSERT_FALSE(cxbench::ReadBenchmarkRuns("{\"benchmarks\": [", runs).IsSuccess());
+    ASSERT_FALSE(cxbench::ReadBenchmarkRuns("{\"benchmarks\": [{\"name\": \"BM_Foo\", \"time_unit\": \"weeks\"}]}", runs).IsSuccess());
+}
+
+TEST(BenchmarkResults, /*DISABLED_*/AggregateMedians_SeveralRuns_MedianPerBenchmarkAndMetric)
+{
+    const std::vector<cxbench::BenchmarkRun> runs
+    {
+        {"BM_Foo", {{"cpu_time", 10.0}, {"items_per_second", 5.0}}},
+        {"BM_Bar", {{"cpu_time", 7.0}}},
+        {"BM_Foo", {{"cpu_time", 50.0}, {"items_per_second", 1.0}}},
+        {"BM_Foo", {{"cpu_time", 12.0}, {"items_per_second", 4.0}}},
+    };
+
+    const cxbench::BenchmarkResults results = cxbench::AggregateMedians(runs);
+
+    ASSERT_EQ(results.size(), 2u);
+    ASSERT_DOUBLE_EQ(results.at("BM_Foo").at("cpu_time"), 12.0);
+    ASSERT_DOUBLE_EQ(results.at("BM_Foo").at("items_per_second"), 4.0);
+    ASSERT_DOUBLE_EQ(results.at("BM_Bar").at("cpu_time"), 7.0);
+}
+
+TEST(BenchmarkResults, /*DISABLED_*/Median_OddAndEvenNumberOfValues_MiddleValue)
+{
+    ASSERT_DOUBLE_EQ(cxbench::Median({3.0}), 3.0);
+    ASSERT_DOUBLE_EQ(cxbench::Median({9.0, 1.0, 3.0}), 3.0);
+    ASSERT_DOUBLE_EQ(cxbench::Median({9.0, 1.0, 3.0, 4.0}), 3.5);
+}
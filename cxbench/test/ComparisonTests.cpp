@@ -0,0 +1,141 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file ComparisonTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include <cxbench/Comparison.h>
+
+namespace
+{
+
+cxbench::Baseline MakeTestBaseline()
+{
+    cxbench::Baseline baseline;
+    baseline.m_tolerance = 0.1;
+    baseline.m_entries["BM_Foo"] = {{{"cpu_time", 100.0}, {"items_per_second", 1000.0}}, std::nullopt};
+    baseline.m_entries["BM_Bar"] = {{{"cpu_time", 100.0}}, 0.5};
+
+    return baseline;
+}
+
+} // namespace
+
+TEST(Comparison, /*DISABLED_*/IsHigherBetter_RatesAndTimes_OnlyRatesHigherBetter)
+{
+    ASSERT_TRUE(cxbench::IsHigherBetter("items_per_second"));
+    ASSERT_TRUE(cxbench::IsHigherBetter("bytes_per_second"));
+    ASSERT_FALSE(cxbench::IsHigherBetter("cpu_time"));
+    ASSERT_FALSE(cxbench::IsHigherBetter("p99_us"));
+}
+
+TEST(Comparison, /*DISABLED_*/Compare_WithinTolerance_Unchanged)
+{
+    const cxbench::BenchmarkResults results
+    {
+        {"BM_Foo", {{"cpu_time", 109.0}, {"items_per_second", 920.0}}},
+        {"BM_Bar", {{"cpu_time", 140.0}}},
+    };
+
+    const auto comparisons = cxbench::Compare(MakeTestBaseline(), results);
+
+    ASSERT_EQ(comparisons.size(), 3u);
+    ASSERT_EQ(cxbench::Count(comparisons, cxbench::Verdict::UNCHANGED), 3u);
+
+    // Ordered by benchmark, then metric:
+    ASSERT_EQ(comparisons[0].m_benchmark, "BM_Bar");
+    ASSERT_DOUBLE_EQ(comparisons[0].m_change, 0.4);
+    ASSERT_DOUBLE_EQ(comparisons[0].m_tolerance, 0.5);
+    ASSERT_EQ(comparisons[1].m_metric, "cpu_time");
+    ASSERT_DOUBLE_EQ(comparisons[1].m_change, 0.09);
+    ASSERT_DOUBLE_EQ(comparisons[1].m_tolerance, 0.1);
+    ASSERT_EQ(comparisons[2].m_metric, "items_per_second");
+    ASSERT_DOUBLE_EQ(comparisons[2].m_change, -0.08);
+}
+
+TEST(Comparison, /*DISABLED_*/Compare_BeyondTolerance_RegressedOrImproved)
+{
+    const cxbench::BenchmarkResults results
+    {
+        // Slower, and lower rate:
+        {"BM_Foo", {{"cpu_time", 120.0}, {"items_per_second", 850.0}}},
+
+        // Faster:
+        {"BM_Bar", {{"cpu_time", 40.0}}},
+    };
+
+    const auto comparisons = cxbench::Compare(MakeTestBaseline(), results);
+
+    ASSERT_EQ(comparisons.size(), 3u);
+    ASSERT_EQ(comparisons[0].m_verdict, cxbench::Verdict::IMPROVED);
+    ASSERT_EQ(comparisons[1].m_verdict, cxbench::Verdict::REGRESSED);
+    ASSERT_EQ(comparisons[2].m_verdict, cxbench::Verdict::REGRESSED);
+}
+
+TEST(Comparison, /*DISABLED_*/Compare_HigherRate_Improved)
+{
+    const cxbench::BenchmarkResults results
+    {
+        {"BM_Foo", {{"cpu_time", 100.0}, {"items_per_second", 2000.0}}},
+        {"BM_Bar", {{"cpu_time", 100.0}}},
+    };
+
+    const auto comparisons = cxbench::Compare(MakeTestBaseline(), results);
+
+    ASSERT_EQ(comparisons[2].m_metric, "items_per_second");
+    ASSERT_EQ(comparisons[2].m_verdict, cxbench::Verdict::IMPROVED);
+}
+
+TEST(Comparison, /*DISABLED_*/Compare_MissingResults_MissingAndNewIgnored)
+{
+    const cxbench::BenchmarkResults results
+    {
+        {"BM_Foo", {{"cpu_time", 100.0}}},
+        {"BM_New", {{"cpu_time", 100.0}}},
+    };
+
+    const auto comparisons = cxbench::Compare(MakeTestBaseline(), results);
+
+    ASSERT_EQ(comparisons.size(), 3u);
+    ASSERT_EQ(comparisons[0].m_verdict, cxbench::Verdict::MISSING);
+    ASSERT_FALSE(comparisons[0].m_current.has_value());
+    ASSERT_EQ(comparisons[1].m_verdict, cxbench::Verdict::UNCHANGED);
+    ASSERT_EQ(comparisons[2].m_verdict, cxbench::Verdict::MISSING);
+}
+
+TEST(Comparison, /*DISABLED_*/PrintComparisonTable_SomeComparisons_AlignedTable)
+{
+    const cxbench::BenchmarkResults results
+    {
+        {"BM_Foo", {{"cpu_time", 120.0}}},
+    };
+
+    std::ostringstream stream;
+    cxbench::PrintComparisonTable(stream, cxbench::Compare(MakeTestBaseline(), results));
+
+    ASSERT_EQ(stream.str(), "Benchmark  Metric            Baseline  Current   Change  Tolerance  Verdict\n"
+                            "BM_Bar     cpu_time            100.00        -        -     50.00%  missing\n"
+                            "BM_Foo     cpu_time            100.00   120.00  +20.00%     10.00%  REGRESSED\n"
+                            "BM_Foo     items_per_second   1000.00        -        -     10.00%  missing\n");
+}
@@ -0,0 +1,114 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file JsonTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include <cxbench/Json.h>
+
+TEST(Json, /*DISABLED_*/ParseJson_Scalars_ValuesParsed)
+{
+    cxbench::JsonValue value;
+
+    ASSERT_TRUE(cxbench::ParseJson("null", value).IsSuccess());
+    ASSERT_TRUE(value.Is<std::nullptr_t>());
+
+    ASSERT_TRUE(cxbench::ParseJson(" true ", value).IsSuccess());
+    ASSERT_TRUE(value.Get<bool>());
+
+    ASSERT_TRUE(cxbench::ParseJson("false", value).IsSuccess());
+    ASSERT_FALSE(value.Get<bool>());
+
+    ASSERT_TRUE(cxbench::ParseJson("-1.5e3", value).IsSuccess());
+    ASSERT_DOUBLE_EQ(value.Get<double>(), -1500.0);
+
+    ASSERT_TRUE(cxbench::ParseJson("\"a\\\"b\\\\c\\n\\u00e9\\ud83d\\ude00\"", value).IsSuccess());
+    ASSERT_EQ(value.Get<std::string>(), "a\"b\\c\n\xC3\xA9\xF0\x9F\x98\x80");
+}
+
+TEST(Json, /*DISABLED_*/ParseJson_NestedContainers_ValuesParsed)
+{
+    cxbench::JsonValue value;
+    ASSERT_TRUE(cxbench::ParseJson("{\"a\": [1, {\"b\": \"c\"}, []], \"d\": {}}", value).IsSuccess());
+
+    const cxbench::JsonValue* a = value.Find("a");
+    ASSERT_TRUE(a);
+    ASSERT_EQ(a->Get<cxbench::JsonArray>().size(), 3u);
+    ASSERT_DOUBLE_EQ(a->Get<cxbench::JsonArray>()[0].Get<double>(), 1.0);
+    ASSERT_EQ(a->Get<cxbench::JsonArray>()[1].Find("b")->Get<std::string>(), "c");
+    ASSERT_TRUE(a->Get<cxbench::JsonArray>()[2].Get<cxbench::JsonArray>().empty());
+    ASSERT_TRUE(value.Find("d")->Get<cxbench::JsonObject>().empty());
+    ASSERT_FALSE(value.Find("e"));
+}
+
+TEST(Json, /*DISABLED_*/ParseJson_InvalidJson_ErrorWithOffset)
+{
+    cxbench::JsonValue value;
+
+    const cxmodel::Status status = cxbench::ParseJson("{\"a\": 1,}", value);
+    ASSERT_FALSE(status.IsSuccess());
+    ASSERT_EQ(status.GetMessage(), "Invalid JSON at offset 8: member name expected.");
+
+    ASSERT_FALSE(cxbench::ParseJson("", value).IsSuccess());
+    ASSERT_FALSE(cxbench::ParseJson("[1 2]", value).IsSuccess());
+    ASSERT_FALSE(cxbench::ParseJson("\"abc", value).IsSuccess());
+    ASSERT_FALSE(cxbench::ParseJson("tru", value).IsSuccess());
+    ASSERT_FALSE(cxbench::ParseJson("1.2.3", value).IsSuccess());
+    ASSERT_FALSE(cxbench::ParseJson("{} {}", value).IsSuccess());
+}
+
+TEST(Json, /*DISABLED_*/WriteJson_NestedContainers_IndentedJsonWritten)
+{
+    const cxbench::JsonValue value{cxbench::JsonObject{
+        {"b", cxbench::JsonArray{1.5, true, cxbench::JsonValue{}}},
+        {"a", "x\"y"},
+        {"c", cxbench::JsonObject{}},
+    }};
+
+    std::ostringstream stream;
+    cxbench::WriteJson(stream, value);
+
+    ASSERT_EQ(stream.str(), "{\n"
+                            "  \"a\": \"x\\\"y\",\n"
+                            "  \"b\": [\n"
+                            "    1.5,\n"
+                            "    true,\n"
+                            "    null\n"
+                            "  ],\n"
+                            "  \"c\": {}\n"
+                            "}\n");
+}
+
+TEST(Json, /*DISABLED_*/WriteJson_ThenParseJson_SameValue)
+{
+    const cxbench::JsonValue value{cxbench::JsonObject{{"name", "BM_Foo/width:7"}, {"time", 1234.5678}}};
+
+    std::ostringstream stream;
+    cxbench::WriteJson(stream, value);
+
+    cxbench::JsonValue parsed;
+    ASSERT_TRUE(cxbench::ParseJson(stream.str(), parsed).IsSuccess());
+    ASSERT_EQ(parsed.Find("name")->Get<std::string>(), "BM_Foo/width:7");
+    ASSERT_DOUBLE_EQ(parsed.Find("time")->Get<double>(), 1234.5678);
+}
@@ -0,0 +1,105 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file AsyncLineWriter.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef ASYNCLINEWRITER_H_6B42A588_A992_4C7E_AF74_4EEB9962FB23
+#define ASYNCLINEWRITER_H_6B42A588_A992_4C7E_AF74_4EEB9962FB23
+
+#include <condition_variable>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace cx
+{
+
+/*********************************************************************************************//**
+ * @brief Writes lines to a stream from a dedicated thread.
+ *
+ * Writing to the standard output can block for as long as the reading end of the pipe is not
+ * read. Threads which must not wait, such as search threads, hand their lines to this writer
+ * instead: queuing a line only takes a short lock, and the actual writing is done by the
+ * writer thread. Lines are written in the order in which they are queued, and each one is
+ * flushed as soon as it is written.
+ *
+ ************************************************************************************************/
+class AsyncLineWriter
+{
+
+public:
+
+    /******************************************************************************************//**
+     * @brief Constructor. Starts the writer thread.
+     *
+     * @param p_stream
+     *      The stream to write to. It must outlive the writer.
+     *
+     ********************************************************************************************/
+    explicit AsyncLineWriter(std::ostream& p_stream);
+
+    /******************************************************************************************//**
+     * @brief Destructor. Writes the lines still queued and joins the writer thread.
+     *
+     ********************************************************************************************/
+    ~AsyncLineWriter();
+
+    AsyncLineWriter(const AsyncLineWriter&) = delete;
+    AsyncLineWriter& operator=(const AsyncLineWriter&) = delete;
+
+    /******************************************************************************************//**
+     * @brief Queues a line for writing. Can be called from any thread.
+     *
+     * @param p_line
+     *      The line to write, without its end of line character.
+     *
+     ********************************************************************************************/
+    void Write(std::string p_line);
+
+    /******************************************************************************************//**
+     * @brief Waits until every line queued so far is written.
+     *
+     ********************************************************************************************/
+    void Flush();
+
+private:
+
+    void Run();
+
+    std::ostream& m_stream;
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+
+    // Protected by the mutex:
+    std::vector<std::string> m_pendingLines;
+    size_t m_nbQueuedLines = 0u;
+    size_t m_nbWrittenLines = 0u;
+    bool m_isShuttingDown = false;
+
+    std::thread m_writer;
+};
+
+} // namespace cx
+
+#endif // ASYNCLINEWRITER_H_6B42A588_A992_4C7E_AF74_4EEB9962FB23
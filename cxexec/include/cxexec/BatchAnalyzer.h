@@ -0,0 +1,153 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file BatchAnalyzer.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef BATCHANALYZER_H_4DF7499B_2BD8_4BFA_AE9C_2240FD4CB105
+#define BATCHANALYZER_H_4DF7499B_2BD8_4BFA_AE9C_2240FD4CB105
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <istream>
+#include <mutex>
+#include <ostream>
+#include <queue>
+#include <string>
+#include <vector>
+
+#include <cxmodel/Search.h>
+
+namespace cxmodel
+{
+    class IConnectXLimits;
+}
+
+namespace cx
+{
+
+/*********************************************************************************************//**
+ * @brief Settings for the analysis of a series of positions.
+ *
+ ************************************************************************************************/
+struct BatchAnalysisSettings final
+{
+    /** The number of positions analyzed at the same time, each on its own thread. */
+    size_t m_nbWorkers = 1u;
+
+    /** The limits of each search. */
+    cxmodel::SearchLimits m_limits{10u, 0u, std::chrono::milliseconds{0}};
+
+    /** The size of the transposition table of each worker, in megabytes. */
+    size_t m_hashSizeInMB = 16u;
+};
+
+/*********************************************************************************************//**
+ * @brief Analyzes a stream of positions on a fixed pool of workers.
+ *
+ * Each input line describes a position, in engine protocol words (see @c cx::EngineProtocol):
+ *
+ *   [board WxH] [inarow K] [players N] [moves C C ...]
+ *
+ * Parameters which are not given take their classic values (7x6 board, four in a row, two
+ * players). Empty lines, and lines starting with @c #, are skipped.
+ *
+ * For each position, in input order, a @c "bestmove C score ... depth D" line is written. If
+ * the game is already over, @c "bestmove none" is written instead, and if the line is not a
+ * valid position, an @c "error ..." line.
+ *
+ * Each worker owns a search, and so a transposition table, which it keeps from one position to
+ * the next. Results are put back in input order in a reorder buffer of a few positions per
+ * worker. Input is only read when the buffer has room for it, so that memory use does not
+ * depend on the size of the input.
+ *
+ ************************************************************************************************/
+class BatchAnalyzer
+{
+
+public:
+
+    /******************************************************************************************//**
+     * @brief Constructor.
+     *
+     * @param p_settings
+     *      The analysis settings.
+     * @param p_limits
+     *      The model limits, against which board parameters are checked.
+     *
+     * @pre There is at least one worker.
+     *
+     ********************************************************************************************/
+    BatchAnalyzer(const BatchAnalysisSettings& p_settings, const cxmodel::IConnectXLimits& p_limits);
+
+    /******************************************************************************************//**
+     * @brief Analyzes every position of an input stream.
+     *
+     * @param p_input
+     *      The stream from which positions are read, until its end.
+     * @param p_output
+     *      The stream to which results are written.
+     *
+     * @return The number of lines which were not valid positions.
+     *
+     ********************************************************************************************/
+    size_t Run(std::istream& p_input, std::ostream& p_output);
+
+private:
+
+    enum class SlotState
+    {
+        FREE,
+        PENDING,
+        DONE,
+    };
+
+    // A place in the reorder buffer. Position number i uses slot i % <number of slots>:
+    struct Slot
+    {
+        SlotState m_state = SlotState::FREE;
+        std::string m_text;
+        bool m_isValid = true;
+    };
+
+    void Work();
+    void Write(std::ostream& p_output);
+
+    const BatchAnalysisSettings m_settings;
+    const cxmodel::IConnectXLimits& m_limits;
+
+    std::mutex m_mutex;
+    std::condition_variable m_slotFreed;
+    std::condition_variable m_slotFilled;
+    std::condition_variable m_slotDone;
+
+    // All of these are protected by the mutex:
+    std::vector<Slot> m_slots;
+    std::queue<size_t> m_pendingPositions;
+    size_t m_nbReadPositions = 0u;
+    size_t m_nbWrittenPositions = 0u;
+    size_t m_nbInvalidPositions = 0u;
+    bool m_isInputOver = false;
+};
+
+} // namespace cx
+
+#endif // BATCHANALYZER_H_4DF7499B_2BD8_4BFA_AE9C_2240FD4CB105
@@ -0,0 +1,105 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file BotWorkerPool.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef BOTWORKERPOOL_H_7A0968D3_8928_421A_893A_AAF79EAB73B5
+#define BOTWORKERPOOL_H_7A0968D3_8928_421A_893A_AAF79EAB73B5
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cx
+{
+
+/*********************************************************************************************//**
+ * @brief Fixed pool of threads computing bot drops.
+ *
+ * Tasks are run in the order they are posted, on the first free worker. The pool is shared by
+ * all the games of a process, so that the number of threads does not depend on the number of
+ * games.
+ *
+ ************************************************************************************************/
+class BotWorkerPool
+{
+
+public:
+
+    /** A unit of work. */
+    using Task = std::function<void()>;
+
+    /******************************************************************************************//**
+     * @brief Constructor. Starts the workers.
+     *
+     * @param p_nbWorkers
+     *      The number of workers.
+     *
+     * @pre There is at least one worker.
+     *
+     ********************************************************************************************/
+    explicit BotWorkerPool(size_t p_nbWorkers);
+
+    /******************************************************************************************//**
+     * @brief Destructor. Waits for running tasks. Tasks not yet started are dropped.
+     *
+     ********************************************************************************************/
+    ~BotWorkerPool();
+
+    BotWorkerPool(const BotWorkerPool&) = delete;
+    BotWorkerPool& operator=(const BotWorkerPool&) = delete;
+
+    /******************************************************************************************//**
+     * @brief Queues a task. Can be called from any thread.
+     *
+     * @param p_task
+     *      The task to run.
+     *
+     ********************************************************************************************/
+    void Post(Task p_task);
+
+    /******************************************************************************************//**
+     * @brief Gets the number of workers.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] size_t GetNbWorkers() const {return m_workers.size();}
+
+private:
+
+    void Work();
+
+    std::mutex m_mutex;
+    std::condition_variable m_taskPosted;
+
+    // Protected by the mutex:
+    std::deque<Task> m_tasks;
+    bool m_isStopping = false;
+
+    std::vector<std::thread> m_workers;
+};
+
+} // namespace cx
+
+#endif // BOTWORKERPOOL_H_7A0968D3_8928_421A_893A_AAF79EAB73B5
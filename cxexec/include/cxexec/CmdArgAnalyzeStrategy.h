@@ -0,0 +1,87 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file CmdArgAnalyzeStrategy.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef CMDARGANALYZESTRATEGY_H_8EB37465_A362_48AB_9C79_E41B72F31FF5
+#define CMDARGANALYZESTRATEGY_H_8EB37465_A362_48AB_9C79_E41B72F31FF5
+
+#include <string>
+
+#include "BatchAnalyzer.h"
+#include "ICmdArgWorkflowStrategy.h"
+
+namespace cx
+{
+    struct ModelReferences;
+}
+
+namespace cx
+{
+
+/*********************************************************************************************//**
+ * @brief Workflow for the @c --analyze command line argument.
+ *
+ * Analyzes every position of a file, or of the standard input, and writes the results to the
+ * standard output, in input order (see @c cx::BatchAnalyzer for the formats). The user
+ * interface is never created.
+ *
+ ************************************************************************************************/
+class CmdArgAnalyzeStrategy : public ICmdArgWorkflowStrategy
+{
+
+public:
+
+    /******************************************************************************************//**
+     * @brief Constructor.
+     *
+     * @param p_settings
+     *      The analysis settings.
+     * @param p_inputPath
+     *      The path of the file holding the positions, or @c "-" for the standard input.
+     * @param p_model
+     *      References to a Connect X compatible model.
+     *
+     * @pre There is at least one worker.
+     *
+     ********************************************************************************************/
+    CmdArgAnalyzeStrategy(const BatchAnalysisSettings& p_settings, const std::string& p_inputPath, cx::ModelReferences& p_model);
+
+    /******************************************************************************************//**
+     * @brief Analyzes the positions.
+     *
+     * @return @c EXIT_SUCCESS if every line was a valid position, @c EXIT_FAILURE otherwise, or
+     *         if the file could not be opened.
+     *
+     ********************************************************************************************/
+    int Handle() override;
+
+private:
+
+    const BatchAnalysisSettings m_settings;
+    const std::string m_inputPath;
+    cx::ModelReferences& m_model;
+
+};
+
+} // namespace cx
+
+#endif // CMDARGANALYZESTRATEGY_H_8EB37465_A362_48AB_9C79_E41B72F31FF5
@@ -0,0 +1,77 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file CmdArgEngineStrategy.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef CMDARGENGINESTRATEGY_H_058AC237_0276_4CD5_BC68_AC9478A32738
+#define CMDARGENGINESTRATEGY_H_058AC237_0276_4CD5_BC68_AC9478A32738
+
+#include <istream>
+
+#include "ICmdArgWorkflowStrategy.h"
+
+namespace cx
+{
+    struct ModelReferences;
+}
+
+namespace cx
+{
+
+/*********************************************************************************************//**
+ * @brief Workflow for the @c --engine command line argument.
+ *
+ * Reads engine protocol commands (see @c cx::EngineProtocol), one per line, and writes the
+ * answers to the standard output, so that external programs can drive the search engine. As
+ * for @c --selfplay, the user interface is never created, so this works without a display.
+ *
+ * The session ends on the @c quit command, or at the end of the input. In the latter case,
+ * a search with limits is given the time to complete first.
+ *
+ ************************************************************************************************/
+class CmdArgEngineStrategy : public ICmdArgWorkflowStrategy
+{
+
+public:
+
+    /******************************************************************************************//**
+     * @brief Constructor.
+     *
+     * @param p_input
+     *      The stream from which commands are read.
+     * @param p_model
+     *      References to a Connect X compatible model.
+     *
+     ********************************************************************************************/
+    CmdArgEngineStrategy(std::istream& p_input, cx::ModelReferences& p_model);
+
+    int Handle() override;
+
+private:
+
+    std::istream& m_input;
+    cx::ModelReferences& m_model;
+
+};
+
+} // namespace cx
+
+#endif // CMDARGENGINESTRATEGY_H_058AC237_0276_4CD5_BC68_AC9478A32738
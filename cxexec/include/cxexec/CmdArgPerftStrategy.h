@@ -0,0 +1,75 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file CmdArgPerftStrategy.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef CMDARGPERFTSTRATEGY_H_A619A2E3_F11D_4AFF_A6FE_F974E7139B6A
+#define CMDARGPERFTSTRATEGY_H_A619A2E3_F11D_4AFF_A6FE_F974E7139B6A
+
+#include <cstddef>
+
+#include <cxexec/ICmdArgWorkflowStrategy.h>
+
+namespace cx
+{
+
+/*********************************************************************************************//**
+ * @brief Workflow for the @c --perft command line argument.
+ *
+ * Enumerates all drop sequences on the classic 7x6 board, for every depth up to the requested
+ * one, with both the fast board snapshot and the reference game board. For each depth, the
+ * counts and speeds are printed, and the counts are compared. This checks the board, drop and
+ * win resolution code after optimizations.
+ *
+ ************************************************************************************************/
+class CmdArgPerftStrategy : public ICmdArgWorkflowStrategy
+{
+
+public:
+
+    /******************************************************************************************//**
+     * @brief Constructor.
+     *
+     * @param p_maxDepth The deepest enumeration to run.
+     *
+     * @pre The depth is at least 1.
+     *
+     ********************************************************************************************/
+    explicit CmdArgPerftStrategy(size_t p_maxDepth);
+
+    /******************************************************************************************//**
+     * @brief Runs the enumerations.
+     *
+     * @return @c EXIT_SUCCESS if both implementations agree at every depth, @c EXIT_FAILURE
+     *         otherwise.
+     *
+     ********************************************************************************************/
+    int Handle() override;
+
+private:
+
+    const size_t m_maxDepth;
+
+};
+
+} // namespace cx
+
+#endif // CMDARGPERFTSTRATEGY_H_A619A2E3_F11D_4AFF_A6FE_F974E7139B6A
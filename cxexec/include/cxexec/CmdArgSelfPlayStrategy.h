@@ -0,0 +1,125 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file CmdArgSelfPlayStrategy.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef CMDARGSELFPLAYSTRATEGY_H_2D5768BC_C112_443B_9F2B_C16C86D4E4E0
+#define CMDARGSELFPLAYSTRATEGY_H_2D5768BC_C112_443B_9F2B_C16C86D4E4E0
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <cxmodel/BotSettings.h>
+
+#include "ICmdArgWorkflowStrategy.h"
+
+namespace cx
+{
+    struct ModelReferences;
+}
+
+namespace cxlog
+{
+    class ILogger;
+}
+
+namespace cx
+{
+
+/*********************************************************************************************//**
+ * @brief Settings for a series of self-play games.
+ *
+ ************************************************************************************************/
+struct SelfPlaySettings final
+{
+    /** The number of games to play. */
+    size_t m_nbGames = 1u;
+
+    /** The board width. */
+    size_t m_gridWidth = 7u;
+
+    /** The board height. */
+    size_t m_gridHeight = 6u;
+
+    /** The in-a-row value. */
+    size_t m_inARowValue = 4u;
+
+    /** The settings of each bot, in turn order. */
+    std::vector<cxmodel::BotSettings> m_players{2u};
+
+    /** The seed from which each game seed is made. If there is none, a random one is used. */
+    std::optional<std::uint64_t> m_seed;
+};
+
+/*********************************************************************************************//**
+ * @brief Workflow for the @c --selfplay command line argument.
+ *
+ * Plays a series of bot-only games directly on the model, without any user interface, and
+ * prints the throughput and outcomes. Since the user interface is never created, Gtkmm is
+ * never initialized and the games start right away, even on machines without a display.
+ *
+ * While the games are played, the logger verbosity is lowered to warnings, so that per move
+ * logs do not dominate the run time.
+ *
+ * Each game is seeded from the series seed and the game index. The series seed is printed with
+ * the statistics, so that running again with it (see @c SelfPlaySettings::m_seed) replays the
+ * same games, as long as the bots are not limited by time.
+ *
+ ************************************************************************************************/
+class CmdArgSelfPlayStrategy : public ICmdArgWorkflowStrategy
+{
+
+public:
+
+    /******************************************************************************************//**
+     * @brief Constructor.
+     *
+     * @param p_settings
+     *      The self-play settings.
+     * @param p_model
+     *      References to a Connect X compatible model.
+     * @param p_logger
+     *      The model logger.
+     *
+     * @pre There are at least two players.
+     *
+     ********************************************************************************************/
+    CmdArgSelfPlayStrategy(const SelfPlaySettings& p_settings, cx::ModelReferences& p_model, cxlog::ILogger& p_logger);
+
+    int Handle() override;
+
+private:
+
+    struct Outcomes;
+
+    [[nodiscard]] bool PlayGame(Outcomes& p_outcomes, std::uint64_t p_gameSeed);
+
+    const SelfPlaySettings m_settings;
+    cx::ModelReferences& m_model;
+    cxlog::ILogger& m_logger;
+
+};
+
+} // namespace cx
+
+#endif // CMDARGSELFPLAYSTRATEGY_H_2D5768BC_C112_443B_9F2B_C16C86D4E4E0
@@ -0,0 +1,86 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file CmdArgServerStrategy.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef CMDARGSERVERSTRATEGY_H_59ACEC4F_10D3_4424_A5AB_A3059540C377
+#define CMDARGSERVERSTRATEGY_H_59ACEC4F_10D3_4424_A5AB_A3059540C377
+
+#include <cstddef>
+#include <string>
+
+#include "ICmdArgWorkflowStrategy.h"
+
+namespace cxlog
+{
+    class ILogger;
+}
+
+namespace cx
+{
+
+/*********************************************************************************************//**
+ * @brief Workflow for the @c --server command line argument.
+ *
+ * Hosts headless games for local clients (see @c cx::GameServer), until the process is
+ * interrupted or terminated. The user interface is never created.
+ *
+ ************************************************************************************************/
+class CmdArgServerStrategy : public ICmdArgWorkflowStrategy
+{
+
+public:
+
+    /******************************************************************************************//**
+     * @brief Constructor.
+     *
+     * @param p_address
+     *      The address to listen on: @c "unix:PATH" or @c "tcp:PORT".
+     * @param p_nbWorkers
+     *      The number of threads computing bot drops.
+     * @param p_logger
+     *      The application logger.
+     *
+     * @pre There is at least one worker.
+     *
+     ********************************************************************************************/
+    CmdArgServerStrategy(const std::string& p_address, size_t p_nbWorkers, cxlog::ILogger& p_logger);
+
+    /******************************************************************************************//**
+     * @brief Runs the server.
+     *
+     * @return @c EXIT_SUCCESS once the server is interrupted, @c EXIT_FAILURE if it could not
+     *         listen on its address.
+     *
+     ********************************************************************************************/
+    int Handle() override;
+
+private:
+
+    const std::string m_address;
+    const size_t m_nbWorkers;
+    cxlog::ILogger& m_logger;
+
+};
+
+} // namespace cx
+
+#endif // CMDARGSERVERSTRATEGY_H_59ACEC4F_10D3_4424_A5AB_A3059540C377
@@ -0,0 +1,139 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file EnginePosition.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef ENGINEPOSITION_H_272CFD7C_5ABE_4DF7_8D23_42261138CCA7
+#define ENGINEPOSITION_H_272CFD7C_5ABE_4DF7_8D23_42261138CCA7
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <cxmodel/BoardSnapshot.h>
+
+namespace cxmodel
+{
+    class IConnectXLimits;
+}
+
+namespace cx
+{
+
+/*********************************************************************************************//**
+ * @brief Parameters of the board on which engine positions are played.
+ *
+ ************************************************************************************************/
+struct BoardParameters final
+{
+    /** The board width. */
+    size_t m_gridWidth = 7u;
+
+    /** The board height. */
+    size_t m_gridHeight = 6u;
+
+    /** The in-a-row value. */
+    size_t m_inARowValue = 4u;
+
+    /** The number of players. */
+    size_t m_nbPlayers = 2u;
+};
+
+/*********************************************************************************************//**
+ * @brief Checks board parameters against the model limits.
+ *
+ * @param p_parameters
+ *      The board parameters.
+ * @param p_limits
+ *      The model limits.
+ *
+ * @return @c true if a game can be played with these parameters, @c false otherwise. The
+ *         in-a-row value must also fit in the board, in at least one direction.
+ *
+ ************************************************************************************************/
+[[nodiscard]] bool AreValid(const BoardParameters& p_parameters, const cxmodel::IConnectXLimits& p_limits);
+
+/*********************************************************************************************//**
+ * @brief A position, as played from a sequence of drops.
+ *
+ ************************************************************************************************/
+struct EnginePosition final
+{
+    /** The position. */
+    cxmodel::BoardSnapshot m_snapshot;
+
+    /** @c true if the last drop won the game, @c false otherwise. */
+    bool m_isWon = false;
+};
+
+/*********************************************************************************************//**
+ * @brief Plays a sequence of drops on an empty board.
+ *
+ * Columns are numbered from 1, left to right, as they are shown to users. Players drop in
+ * turn, starting with the first one.
+ *
+ * @param p_parameters
+ *      The board parameters.
+ * @param p_moves
+ *      The drop columns, in order.
+ *
+ * @pre The board parameters are valid.
+ *
+ * @return The position, or nothing if a column is not a number, is outside the board or is
+ *         full, or if a drop is made after the game was won.
+ *
+ ************************************************************************************************/
+[[nodiscard]] std::optional<EnginePosition> MakeEnginePosition(const BoardParameters& p_parameters,
+                                                               const std::vector<std::string>& p_moves);
+
+/*********************************************************************************************//**
+ * @brief Formats a search score for the engine text outputs.
+ *
+ * Forced results are written as @c "win N" or @c "loss N", where @c N is the number of
+ * drops, for all players, until the game ends. Other scores are written as @c "value S".
+ *
+ * @param p_score
+ *      The score, from the point of view of the active player.
+ * @param p_nbPositions
+ *      The number of positions on the board.
+ *
+ * @return The formatted score.
+ *
+ ************************************************************************************************/
+[[nodiscard]] std::string FormatScore(int p_score, size_t p_nbPositions);
+
+/*********************************************************************************************//**
+ * @brief Chooses a column when a search could not complete a single iteration.
+ *
+ * @param p_position
+ *      The position.
+ *
+ * @pre The board is not full.
+ *
+ * @return The free column closest to the center.
+ *
+ ************************************************************************************************/
+[[nodiscard]] size_t GetFallbackColumn(const cxmodel::BoardSnapshot& p_position);
+
+} // namespace cx
+
+#endif // ENGINEPOSITION_H_272CFD7C_5ABE_4DF7_8D23_42261138CCA7
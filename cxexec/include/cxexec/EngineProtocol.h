@@ -0,0 +1,155 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file EngineProtocol.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef ENGINEPROTOCOL_H_8E6AA0C2_9544_4D9F_B938_531E471F7145
+#define ENGINEPROTOCOL_H_8E6AA0C2_9544_4D9F_B938_531E471F7145
+
+#include <atomic>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "AsyncLineWriter.h"
+#include "EnginePosition.h"
+
+namespace cxmodel
+{
+    class IConnectXLimits;
+    class IVersioning;
+    class Search;
+    struct SearchResult;
+}
+
+namespace cx
+{
+
+/*********************************************************************************************//**
+ * @brief Line based text protocol to drive the search engine, in the spirit of UCI.
+ *
+ * Each command is a line of space separated words. The following commands are understood:
+ *
+ *   - @c cxp : identifies the engine (@c "id name ...") and answers @c cxpok.
+ *   - @c isready : answers @c readyok.
+ *   - @c newgame : forgets everything learned by previous searches.
+ *   - @c board @c WxH, @c inarow @c K, @c players @c N : change the board parameters. The
+ *     position is reset to the empty board.
+ *   - @c position @c startpos [@c moves @c C @c C ...] : sets the position from a sequence
+ *     of drops. Columns are numbered from 1.
+ *   - @c go [@c depth @c D] [@c nodes @c N] [@c movetime @c MS] [@c infinite] : searches the
+ *     position, within the given limits, if any. After each completed iteration, an
+ *     @c "info depth D seldepth S score ... nodes N nps N time MS pv C C ..." line is written.
+ *     Once the search is over, @c "bestmove C" is written.
+ *   - @c stop : stops the running search, which then writes its best move.
+ *   - @c quit : stops the running search and ends the session.
+ *
+ * Errors are reported on an @c "info string ..." line, and the command is ignored.
+ *
+ * Searches run on their own thread, so that @c stop, @c isready and @c quit are handled while
+ * searching. The other commands first wait for a search with limits to end, and stop a search
+ * without limits: scripts can send a whole series of positions and searches at once.
+ *
+ * Scores are from the point of view of the player to drop. Forced results are written as
+ * @c "win N" or @c "loss N", other scores as @c "value S".
+ *
+ * Lines are written by an asynchronous writer, so that a driver which is slow to read the
+ * output never slows the search down.
+ *
+ ************************************************************************************************/
+class EngineProtocol
+{
+
+public:
+
+    /******************************************************************************************//**
+     * @brief Constructor.
+     *
+     * @param p_output
+     *      The stream to which answers are written.
+     * @param p_limits
+     *      The model limits, against which board parameters are checked.
+     * @param p_versioning
+     *      The model name and version, used to identify the engine.
+     *
+     ********************************************************************************************/
+    EngineProtocol(std::ostream& p_output,
+                   const cxmodel::IConnectXLimits& p_limits,
+                   const cxmodel::IVersioning& p_versioning);
+
+    /******************************************************************************************//**
+     * @brief Destructor. Stops the running search, if any, and writes the pending answers.
+     *
+     ********************************************************************************************/
+    ~EngineProtocol();
+
+    EngineProtocol(const EngineProtocol&) = delete;
+    EngineProtocol& operator=(const EngineProtocol&) = delete;
+
+    /******************************************************************************************//**
+     * @brief Executes a command.
+     *
+     * @param p_command
+     *      The command line.
+     *
+     * @return @c false if the command ends the session, @c true otherwise.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] bool Execute(const std::string& p_command);
+
+    /******************************************************************************************//**
+     * @brief Waits for the running search, if any, to end.
+     *
+     * Searches without any limit would never end, so they are stopped instead.
+     *
+     ********************************************************************************************/
+    void WaitForSearch();
+
+private:
+
+    void SetBoardParameters(const BoardParameters& p_parameters);
+    void SetPosition(const std::vector<std::string>& p_arguments);
+    void Go(const std::vector<std::string>& p_arguments);
+    void StopSearch();
+    void WriteInfo(const cxmodel::SearchResult& p_result);
+
+    const cxmodel::IConnectXLimits& m_limits;
+    const cxmodel::IVersioning& m_versioning;
+
+    AsyncLineWriter m_writer;
+
+    BoardParameters m_parameters;
+    EnginePosition m_position;
+
+    // Only used by the search thread while a search is running:
+    std::unique_ptr<cxmodel::Search> m_search;
+    size_t m_searchPlayerIndex = 0u;
+
+    std::atomic<bool> m_stop{false};
+    bool m_isInfinite = false;
+    std::thread m_searchThread;
+};
+
+} // namespace cx
+
+#endif // ENGINEPROTOCOL_H_8E6AA0C2_9544_4D9F_B938_531E471F7145
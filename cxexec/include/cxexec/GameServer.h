@@ -0,0 +1,182 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file GameServer.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef GAMESERVER_H_4C9218D2_56B6_4419_971B_592B1D64DB70
+#define GAMESERVER_H_4C9218D2_56B6_4419_971B_592B1D64DB70
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <cxstd/ObjectPool.h>
+#include <cxmodel/Status.h>
+
+#include "BotWorkerPool.h"
+#include "GameSession.h"
+
+namespace cxlog
+{
+    class ILogger;
+}
+
+namespace cx
+{
+
+/*********************************************************************************************//**
+ * @brief Hosts headless games for local clients.
+ *
+ * The server listens on a Unix domain socket (@c "unix:PATH") or on a TCP port of the loopback
+ * interface (@c "tcp:PORT"). Each connection is a game session (see @c cx::GameSession for the
+ * line protocol), and @c "quit" closes it.
+ *
+ * All sockets, and all sessions, are handled by a single thread running an epoll event loop.
+ * Bot drops are computed on a shared pool of workers, and their results come back to the
+ * loop through a queue and an event file descriptor. When a bot drops, the server sends an
+ * unrequested @c "bot C STATE" line to the client.
+ *
+ * Connections, and so sessions, are allocated from a pool, which keeps its slots when clients
+ * come and go.
+ *
+ ************************************************************************************************/
+class GameServer
+{
+
+public:
+
+    /******************************************************************************************//**
+     * @brief Constructor.
+     *
+     * @param p_nbWorkers
+     *      The number of threads computing bot drops.
+     * @param p_logger
+     *      The logger used by the sessions. It is only used from the thread running the server.
+     *
+     * @pre There is at least one worker.
+     *
+     ********************************************************************************************/
+    GameServer(size_t p_nbWorkers, cxlog::ILogger& p_logger);
+
+    /******************************************************************************************//**
+     * @brief Destructor. Closes all connections and removes the Unix domain socket file.
+     *
+     ********************************************************************************************/
+    ~GameServer();
+
+    GameServer(const GameServer&) = delete;
+    GameServer& operator=(const GameServer&) = delete;
+
+    /******************************************************************************************//**
+     * @brief Starts listening.
+     *
+     * @param p_address
+     *      @c "unix:PATH" or @c "tcp:PORT". With port 0, a free port is chosen (see
+     *      @c GetPort).
+     *
+     * @return A success, or an error describing why the server can not listen.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] cxmodel::Status Listen(const std::string& p_address);
+
+    /******************************************************************************************//**
+     * @brief Gets the TCP port the server listens on, or 0 if it does not listen on one.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] uint16_t GetPort() const;
+
+    /******************************************************************************************//**
+     * @brief Runs the event loop, until @c Stop is called.
+     *
+     * @pre The server listens.
+     *
+     ********************************************************************************************/
+    void Run();
+
+    /******************************************************************************************//**
+     * @brief Makes @c Run return. Can be called from any thread.
+     *
+     ********************************************************************************************/
+    void Stop();
+
+    /******************************************************************************************//**
+     * @brief Gets the number of open connections.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] size_t GetNbConnections() const {return m_connections.size();}
+
+private:
+
+    struct Connection
+    {
+        Connection(int p_fd, uint64_t p_id, uint32_t p_events, cxlog::ILogger& p_logger);
+
+        int m_fd;
+        uint64_t m_id;
+        std::string m_input;
+        std::string m_output;
+        uint32_t m_events;
+        bool m_isClosing = false;
+        GameSession m_session;
+    };
+
+    struct BotDropResult
+    {
+        uint64_t m_connectionId;
+        uint64_t m_generation;
+        size_t m_column;
+    };
+
+    void Accept();
+    void Read(Connection& p_connection);
+    void ExecuteLines(Connection& p_connection);
+    void RequestBotDrop(Connection& p_connection);
+    void ApplyBotDrops();
+    void Flush(Connection& p_connection);
+    void Close(uint64_t p_connectionId);
+
+    cxlog::ILogger& m_logger;
+
+    int m_epollFd = -1;
+    int m_listenFd = -1;
+    int m_wakeUpFd = -1;
+    std::string m_socketPath;
+    std::atomic<bool> m_isStopping{false};
+
+    cxstd::ObjectPool<Connection> m_connectionPool;
+    std::unordered_map<uint64_t, cxstd::ObjectPool<Connection>::Handle> m_connections;
+    uint64_t m_nextConnectionId;
+
+    std::mutex m_botDropResultsMutex;
+    std::vector<BotDropResult> m_botDropResults;
+
+    // Workers post results to the members above, so they are stopped first:
+    std::unique_ptr<BotWorkerPool> m_workers;
+};
+
+} // namespace cx
+
+#endif // GAMESERVER_H_4C9218D2_56B6_4419_971B_592B1D64DB70
@@ -0,0 +1,179 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file GameSession.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef GAMESESSION_H_DB3F0A35_B675_4A90_B375_397B0FBCC862
+#define GAMESESSION_H_DB3F0A35_B675_4A90_B375_397B0FBCC862
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <cxmodel/BoardSnapshot.h>
+#include <cxmodel/INextDropColumnComputationStrategy.h>
+#include <cxmodel/Model.h>
+
+namespace cxlog
+{
+    class ILogger;
+}
+
+namespace cx
+{
+
+/*********************************************************************************************//**
+ * @brief A bot drop to compute, away from the session.
+ *
+ ************************************************************************************************/
+struct BotDropRequest final
+{
+    /** The strategy of the bot to drop. It is shared so that it outlives a closed session. */
+    std::shared_ptr<cxmodel::INextDropColumnComputationStrategy> m_strategy;
+
+    /** The position in which the bot drops. */
+    cxmodel::BoardSnapshot m_position;
+
+    /** The session generation when the request was made. */
+    uint64_t m_generation;
+};
+
+/*********************************************************************************************//**
+ * @brief A headless game, driven by text commands.
+ *
+ * The session owns its model. The board, the commands and the game records the model allocates
+ * are kept in a memory pool owned by the session, and released all at once with it. Every
+ * player is a human player for the model: bot drops are computed outside of the session (see
+ * @c StartBotDrop and @c CompleteBotDrop), so that a slow bot never holds up the thread running
+ * the session. Bots draw from the game seed, so a game replays from its seed and its
+ * commands. Commands, one per line:
+ *
+ *   new WxH K SEAT,SEAT,... [SEED]   Creates a game. A SEAT is @c human, or a bot description,
+ *                                    as for @c --selfplay (@c random, @c alphabeta:250ms, ...).
+ *                                    Without a SEED, a random one is used.
+ *   drop C                           Drops the active human player's chip in column C (1 based).
+ *   undo                             Undoes drops, back to the previous human turn.
+ *   redo                             Redoes drops, up to the next human turn.
+ *   board                            Queries the board.
+ *   seed                             Queries the game seed.
+ *
+ * Answers are @c "ok STATE", @c "board STATE ROWS", @c "seed SEED" or @c "error ...", where
+ * STATE is @c "play P" (player P to drop, 1 based), @c "won P" or @c "tie", and ROWS lists the
+ * rows from the top, separated by @c '/', with a @c '.' for an empty cell and the player number
+ * (@c 'A' for the tenth) otherwise.
+ *
+ ************************************************************************************************/
+class GameSession
+{
+
+public:
+
+    /******************************************************************************************//**
+     * @brief Constructor.
+     *
+     * @param p_logger
+     *      The logger used by the session model.
+     *
+     ********************************************************************************************/
+    explicit GameSession(cxlog::ILogger& p_logger);
+
+    /******************************************************************************************//**
+     * @brief Executes a command.
+     *
+     * @param p_command
+     *      The command line, without its end of line.
+     *
+     * @return The answer line.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] std::string Execute(const std::string& p_command);
+
+    /******************************************************************************************//**
+     * @brief Indicates if a bot must drop, and no drop was requested for it yet.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] bool IsBotDropNeeded() const;
+
+    /******************************************************************************************//**
+     * @brief Requests the active bot drop.
+     *
+     * Until it is completed, no other bot drop is requested for the session.
+     *
+     * @pre A bot drop is needed.
+     *
+     * @return What the bot needs to compute its drop.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] BotDropRequest StartBotDrop();
+
+    /******************************************************************************************//**
+     * @brief Completes a requested bot drop.
+     *
+     * If the game changed since the request (new game, undo or redo), the drop is ignored.
+     *
+     * @param p_generation
+     *      The generation of the request.
+     * @param p_column
+     *      The column computed by the bot (0 based).
+     *
+     * @return The @c "bot C STATE" line to send, or nothing if the drop was ignored.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] std::optional<std::string> CompleteBotDrop(uint64_t p_generation, size_t p_column);
+
+private:
+
+    struct Seat
+    {
+        std::shared_ptr<cxmodel::IPlayer> m_player;
+        std::shared_ptr<cxmodel::INextDropColumnComputationStrategy> m_bot;
+    };
+
+    [[nodiscard]] std::string CreateGame(const std::vector<std::string>& p_arguments);
+    [[nodiscard]] std::string DropHumanChip(const std::vector<std::string>& p_arguments);
+    [[nodiscard]] std::string Undo();
+    [[nodiscard]] std::string Redo();
+    [[nodiscard]] std::string DescribeBoard() const;
+    [[nodiscard]] std::string DescribeSeed() const;
+
+    [[nodiscard]] bool IsGameOver() const;
+    [[nodiscard]] bool IsColumnFull(size_t p_column) const;
+    [[nodiscard]] size_t GetActiveSeatIndex() const;
+    [[nodiscard]] size_t GetSeatIndex(const cxmodel::IChip& p_chip) const;
+    [[nodiscard]] std::string GetState() const;
+
+    // Declared first, so that it outlives the model:
+    std::pmr::unsynchronized_pool_resource m_resource;
+
+    cxmodel::Model m_model;
+
+    std::vector<Seat> m_seats;
+    uint64_t m_generation = 0u;
+    bool m_isBotDropRequested = false;
+};
+
+} // namespace cx
+
+#endif // GAMESESSION_H_DB3F0A35_B675_4A90_B375_397B0FBCC862
@@ -26,6 +26,7 @@
 
 #include <memory>
 
+#include <glibmm/dispatcher.h>
 #include <gtkmm/application.h>
 
 #include <cxmodel/ModelNotificationContext.h>
@@ -73,6 +74,12 @@ public:
      ********************************************************************************************/
     GtkmmUIManager(int argc, char *argv[], cx::ModelReferences& p_model);
 
+    /******************************************************************************************//**
+     * @brief Destructor. Detaches the main window presenter from the model.
+     *
+     ********************************************************************************************/
+    ~GtkmmUIManager() override;
+
     int Manage() override;
 
 
@@ -84,6 +91,12 @@ private:
 
     Glib::RefPtr<Gtk::Application> m_app;
 
+    cxmodel::ModelSubject& m_model;
+    cxmodel::ModelSubject::Subscription m_presenterSubscription;
+
+    // Shared with the model's analysis callback, which may outlive the UI:
+    std::shared_ptr<Glib::Dispatcher> m_analysisDispatcher;
+
     std::unique_ptr<cxgui::IMainWindowController> m_controller;
     std::unique_ptr<cxgui::IMainWindowPresenter> m_presenter;
     std::unique_ptr<cxgui::IWindow> m_mainWindow;
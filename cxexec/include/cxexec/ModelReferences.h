@@ -25,6 +25,7 @@
 #define MODELREFERENCES_H_B4CBAD24_EFCC_429A_8293_DAE7B2FA8D9E
 
 #include <cxmodel/IConnectXAI.h>
+#include <cxmodel/IConnectXAnalysis.h>
 #include <cxmodel/IConnectXGameActions.h>
 #include <cxmodel/IConnectXGameInformation.h>
 #include <cxmodel/IConnectXLimits.h>
@@ -75,7 +76,8 @@ public:
                     cxmodel::IConnectXLimits& p_asLimits,
                     cxmodel::IVersioning& p_asVersionning,
                     cxmodel::IUndoRedo& p_asUndoRedo,
-                    cxmodel::IConnectXAI& p_asAi)
+                    cxmodel::IConnectXAI& p_asAi,
+                    cxmodel::IConnectXAnalysis& p_asAnalysis)
     : m_asSubject{p_asSubject}
     , m_asGameActions{p_asGameActions}
     , m_asGameInformation{p_asGameInformation}
@@ -83,6 +85,7 @@ public:
     , m_asVersionning{p_asVersionning}
     , m_asUndoRedo{p_asUndoRedo}
     , m_asAi{p_asAi}
+    , m_asAnalysis{p_asAnalysis}
     {
         // Nothing to do...
     }
@@ -108,6 +111,9 @@ public:
     /** Part of the model managing the AI behind bot players. */
     cxmodel::IConnectXAI& m_asAi;
 
+    /** Part of the model analyzing the current position. */
+    cxmodel::IConnectXAnalysis& m_asAnalysis;
+
 };
 
 } // namespace cx
@@ -0,0 +1,94 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file AsyncLineWriter.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <cxexec/AsyncLineWriter.h>
+
+cx::AsyncLineWriter::AsyncLineWriter(std::ostream& p_stream)
+: m_stream{p_stream}
+{
+    // The writer is started last, once everything it uses is initialized:
+    m_writer = std::thread{&AsyncLineWriter::Run, this};
+}
+
+cx::AsyncLineWriter::~AsyncLineWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_isShuttingDown = true;
+    }
+
+    m_condition.notify_all();
+
+    if(m_writer.joinable())
+    {
+        m_writer.join();
+    }
+}
+
+void cx::AsyncLineWriter::Write(std::string p_line)
+{
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_pendingLines.push_back(std::move(p_line));
+        ++m_nbQueuedLines;
+    }
+
+    m_condition.notify_all();
+}
+
+void cx::AsyncLineWriter::Flush()
+{
+    std::unique_lock<std::mutex> lock{m_mutex};
+    const size_t nbQueuedLines = m_nbQueuedLines;
+    m_condition.wait(lock, [this, nbQueuedLines](){return m_nbWrittenLines >= nbQueuedLines;});
+}
+
+void cx::AsyncLineWriter::Run()
+{
+    std::vector<std::string> lines;
+    while(true)
+    {
+        {
+            std::unique_lock<std::mutex> lock{m_mutex};
+            m_nbWrittenLines += lines.size();
+            lines.clear();
+            m_condition.notify_all();
+
+            m_condition.wait(lock, [this](){return m_isShuttingDown || !m_pendingLines.empty();});
+            if(m_pendingLines.empty())
+            {
+                // Shutting down, and everything was written:
+                return;
+            }
+
+            // The lines are taken all at once, so that writers are never held up by the
+            // stream:
+            std::swap(lines, m_pendingLines);
+        }
+
+        for(const std::string& line : lines)
+        {
+            m_stream << line << std::endl;
+        }
+    }
+}
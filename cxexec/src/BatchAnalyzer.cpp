@@ -0,0 +1,310 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file BatchAnalyzer.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <thread>
+
+#include <cxinv/assertion.h>
+#include <cxstd/parse.h>
+#include <cxexec/BatchAnalyzer.h>
+#include <cxexec/EnginePosition.h>
+
+namespace
+{
+
+// Enough positions per worker for workers not to wait on a slow one, or on the output:
+constexpr size_t NB_SLOTS_PER_WORKER = 4u;
+
+bool IsSkipped(const std::string& p_line)
+{
+    const auto first = std::find_if(p_line.cbegin(), p_line.cend(), [](char p_char){return p_char != ' ' && p_char != '\t' && p_char != '\r';});
+    return first == p_line.cend() || *first == '#';
+}
+
+bool operator==(const cx::BoardParameters& p_lhs, const cx::BoardParameters& p_rhs)
+{
+    return p_lhs.m_gridWidth == p_rhs.m_gridWidth &&
+           p_lhs.m_gridHeight == p_rhs.m_gridHeight &&
+           p_lhs.m_inARowValue == p_rhs.m_inARowValue &&
+           p_lhs.m_nbPlayers == p_rhs.m_nbPlayers;
+}
+
+// Parses a "[board WxH] [inarow K] [players N] [moves C C ...]" line. Returns nothing if the
+// words are not in that form, whatever their values:
+std::optional<cx::BoardParameters> ParseParameters(const std::vector<std::string>& p_words, std::vector<std::string>& p_moves)
+{
+    cx::BoardParameters parameters;
+
+    size_t index = 0u;
+    while(index < p_words.size() && p_words[index] != "moves")
+    {
+        if(index + 1u == p_words.size())
+        {
+            return std::nullopt;
+        }
+
+        const std::string& option = p_words[index];
+        const std::string& value = p_words[index + 1u];
+        if(option == "board")
+        {
+            const size_t separator = value.find('x');
+            const std::optional<size_t> width = cxstd::ParsePositiveInteger(value.substr(0u, separator));
+            const std::optional<size_t> height = separator == std::string::npos ? std::nullopt : cxstd::ParsePositiveInteger(value.substr(separator + 1u));
+            if(!width || !height)
+            {
+                return std::nullopt;
+            }
+
+            parameters.m_gridWidth = *width;
+            parameters.m_gridHeight = *height;
+        }
+        else if(option == "inarow" || option == "players")
+        {
+            const std::optional<size_t> number = cxstd::ParsePositiveInteger(value);
+            if(!number)
+            {
+                return std::nullopt;
+            }
+
+            (option == "inarow" ? parameters.m_inARowValue : parameters.m_nbPlayers) = *number;
+        }
+        else
+        {
+            return std::nullopt;
+        }
+
+        index += 2u;
+    }
+
+    // The "moves" word itself is skipped:
+    const size_t firstMove = std::min(index + 1u, p_words.size());
+    p_moves.assign(p_words.cbegin() + static_cast<std::ptrdiff_t>(firstMove), p_words.cend());
+
+    return parameters;
+}
+
+} // namespace
+
+cx::BatchAnalyzer::BatchAnalyzer(const BatchAnalysisSettings& p_settings, const cxmodel::IConnectXLimits& p_limits)
+: m_settings{p_settings}
+, m_limits{p_limits}
+{
+    PRECONDITION(p_settings.m_nbWorkers > 0u);
+}
+
+size_t cx::BatchAnalyzer::Run(std::istream& p_input, std::ostream& p_output)
+{
+    const size_t nbWorkers = std::max<size_t>(m_settings.m_nbWorkers, 1u);
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_slots.assign(nbWorkers * NB_SLOTS_PER_WORKER, Slot{});
+        m_pendingPositions = {};
+        m_nbReadPositions = 0u;
+        m_nbWrittenPositions = 0u;
+        m_nbInvalidPositions = 0u;
+        m_isInputOver = false;
+    }
+
+    std::vector<std::thread> workers;
+    for(size_t worker = 0u; worker < nbWorkers; ++worker)
+    {
+        workers.emplace_back(&BatchAnalyzer::Work, this);
+    }
+
+    // Results are written as they come, even if reading the input blocks:
+    std::thread writer{&BatchAnalyzer::Write, this, std::ref(p_output)};
+
+    std::string line;
+    while(std::getline(p_input, line))
+    {
+        if(IsSkipped(line))
+        {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock{m_mutex};
+
+        // The position waits for its slot to be written out. This is what keeps the memory
+        // use bounded:
+        Slot& slot = m_slots[m_nbReadPositions % m_slots.size()];
+        m_slotFreed.wait(lock, [&slot](){return slot.m_state == SlotState::FREE;});
+
+        slot.m_state = SlotState::PENDING;
+        slot.m_text = std::move(line);
+        m_pendingPositions.push(m_nbReadPositions);
+        ++m_nbReadPositions;
+
+        lock.unlock();
+        m_slotFilled.notify_one();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_isInputOver = true;
+    }
+
+    m_slotFilled.notify_all();
+    m_slotDone.notify_all();
+
+    for(std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    writer.join();
+
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_nbInvalidPositions;
+}
+
+void cx::BatchAnalyzer::Work()
+{
+    // The search, and its table, is kept for as long as positions are searched on the same
+    // board and for the same player, since scores are from the point of view of that player:
+    std::unique_ptr<cxmodel::Search> search;
+    BoardParameters searchParameters;
+    size_t searchPlayerIndex = 0u;
+
+    while(true)
+    {
+        size_t positionIndex = 0u;
+        std::string line;
+        {
+            std::unique_lock<std::mutex> lock{m_mutex};
+            m_slotFilled.wait(lock, [this](){return m_isInputOver || !m_pendingPositions.empty();});
+            if(m_pendingPositions.empty())
+            {
+                return;
+            }
+
+            positionIndex = m_pendingPositions.front();
+            m_pendingPositions.pop();
+            line = std::move(m_slots[positionIndex % m_slots.size()].m_text);
+        }
+
+        std::ostringstream result;
+        bool isValid = false;
+
+        std::istringstream stream{line};
+        const std::vector<std::string> words{std::istream_iterator<std::string>{stream}, std::istream_iterator<std::string>{}};
+        std::vector<std::string> moves;
+        const std::optional<BoardParameters> parameters = ParseParameters(words, moves);
+        if(!parameters || !AreValid(*parameters, m_limits))
+        {
+            result << "error invalid board parameters '" << line << "'";
+        }
+        else if(const std::optional<EnginePosition> position = MakeEnginePosition(*parameters, moves); !position)
+        {
+            result << "error invalid moves '" << line << "'";
+        }
+        else if(position->m_isWon || position->m_snapshot.IsFull())
+        {
+            isValid = true;
+            result << "bestmove none";
+        }
+        else
+        {
+            isValid = true;
+
+            const cxmodel::BoardSnapshot& snapshot = position->m_snapshot;
+            if(!search || !(searchParameters == *parameters) || searchPlayerIndex != snapshot.GetActivePlayerIndex())
+            {
+                search = std::make_unique<cxmodel::Search>(m_settings.m_hashSizeInMB);
+                searchParameters = *parameters;
+                searchPlayerIndex = snapshot.GetActivePlayerIndex();
+            }
+
+            // Nothing stops a batch search but its limits:
+            const std::atomic<bool> stop{false};
+            const cxmodel::SearchResult searchResult = search->Run(snapshot, m_settings.m_limits, stop);
+
+            const size_t column = searchResult.m_depth > 0u ? searchResult.m_bestColumn : GetFallbackColumn(snapshot);
+            const int score = searchResult.m_depth > 0u ? searchResult.m_columnScores[column] : 0;
+            result << "bestmove " << column + 1u
+                   << " score " << FormatScore(score, parameters->m_gridWidth * parameters->m_gridHeight)
+                   << " depth " << searchResult.m_depth;
+        }
+
+        bool isNextToWrite = false;
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            Slot& slot = m_slots[positionIndex % m_slots.size()];
+            slot.m_state = SlotState::DONE;
+            slot.m_text = result.str();
+            slot.m_isValid = isValid;
+            isNextToWrite = (positionIndex == m_nbWrittenPositions);
+        }
+
+        // Otherwise, the writer is waiting for another position:
+        if(isNextToWrite)
+        {
+            m_slotDone.notify_one();
+        }
+    }
+}
+
+void cx::BatchAnalyzer::Write(std::ostream& p_output)
+{
+    while(true)
+    {
+        std::string text;
+        bool isNextDone = false;
+        {
+            std::unique_lock<std::mutex> lock{m_mutex};
+            Slot* slot = nullptr;
+            m_slotDone.wait(lock, [this, &slot]()
+                                  {
+                                      slot = &m_slots[m_nbWrittenPositions % m_slots.size()];
+                                      return slot->m_state == SlotState::DONE || (m_isInputOver && m_nbWrittenPositions == m_nbReadPositions);
+                                  });
+
+            if(slot->m_state != SlotState::DONE)
+            {
+                // Everything was written:
+                return;
+            }
+
+            text = std::move(slot->m_text);
+            m_nbInvalidPositions += slot->m_isValid ? 0u : 1u;
+            slot->m_state = SlotState::FREE;
+            slot->m_isValid = true;
+            ++m_nbWrittenPositions;
+            isNextDone = (m_slots[m_nbWrittenPositions % m_slots.size()].m_state == SlotState::DONE);
+        }
+
+        m_slotFreed.notify_one();
+
+        // Outside of the lock, so that a slow reader of the output never holds the workers. The
+        // output is only flushed when no other result is ready to follow:
+        p_output << text << '\n';
+        if(!isNextDone)
+        {
+            p_output.flush();
+        }
+    }
+}
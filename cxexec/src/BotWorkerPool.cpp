@@ -0,0 +1,86 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file BotWorkerPool.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <utility>
+
+#include <cxinv/assertion.h>
+#include <cxexec/BotWorkerPool.h>
+
+cx::BotWorkerPool::BotWorkerPool(size_t p_nbWorkers)
+{
+    PRECONDITION(p_nbWorkers > 0u);
+
+    m_workers.reserve(p_nbWorkers);
+    for(size_t index = 0u; index < p_nbWorkers; ++index)
+    {
+        m_workers.emplace_back([this](){Work();});
+    }
+}
+
+cx::BotWorkerPool::~BotWorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_isStopping = true;
+        m_tasks.clear();
+    }
+    m_taskPosted.notify_all();
+
+    for(std::thread& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+void cx::BotWorkerPool::Post(Task p_task)
+{
+    PRECONDITION(p_task);
+
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_tasks.push_back(std::move(p_task));
+    }
+    m_taskPosted.notify_one();
+}
+
+void cx::BotWorkerPool::Work()
+{
+    while(true)
+    {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock{m_mutex};
+            m_taskPosted.wait(lock, [this](){return m_isStopping || !m_tasks.empty();});
+
+            if(m_isStopping)
+            {
+                return;
+            }
+
+            task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+        }
+
+        task();
+    }
+}
@@ -0,0 +1,75 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file CmdArgAnalyzeStrategy.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+#include <cxinv/assertion.h>
+#include <cxmodel/ModelNotificationContext.h>
+#include <cxexec/CmdArgAnalyzeStrategy.h>
+#include <cxexec/ModelReferences.h>
+
+namespace
+{
+
+const std::string STANDARD_INPUT_PATH = "-";
+
+} // namespace
+
+cx::CmdArgAnalyzeStrategy::CmdArgAnalyzeStrategy(const BatchAnalysisSettings& p_settings, const std::string& p_inputPath, cx::ModelReferences& p_model)
+ : m_settings{p_settings}
+ , m_inputPath{p_inputPath}
+ , m_model{p_model}
+{
+    PRECONDITION(p_settings.m_nbWorkers > 0u);
+}
+
+int cx::CmdArgAnalyzeStrategy::Handle()
+{
+    IF_CONDITION_NOT_MET_DO(m_settings.m_nbWorkers > 0u, return EXIT_FAILURE;);
+
+    std::ifstream file;
+    if(m_inputPath != STANDARD_INPUT_PATH)
+    {
+        file.open(m_inputPath);
+        if(!file)
+        {
+            std::cerr << "Connect X: cannot read '" << m_inputPath << "'" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::istream& input = (m_inputPath == STANDARD_INPUT_PATH) ? std::cin : file;
+
+    BatchAnalyzer analyzer{m_settings, m_model.m_asLimits};
+    const size_t nbInvalidPositions = analyzer.Run(input, std::cout);
+
+    if(nbInvalidPositions > 0u)
+    {
+        std::cerr << "Connect X: " << nbInvalidPositions << " invalid position(s)" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,56 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file CmdArgEngineStrategy.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include <cxmodel/ModelNotificationContext.h>
+#include <cxexec/CmdArgEngineStrategy.h>
+#include <cxexec/EngineProtocol.h>
+#include <cxexec/ModelReferences.h>
+
+cx::CmdArgEngineStrategy::CmdArgEngineStrategy(std::istream& p_input, cx::ModelReferences& p_model)
+: m_input{p_input}
+, m_model{p_model}
+{
+}
+
+int cx::CmdArgEngineStrategy::Handle()
+{
+    EngineProtocol protocol{std::cout, m_model.m_asLimits, m_model.m_asVersionning};
+
+    std::string command;
+    while(std::getline(m_input, command))
+    {
+        if(!protocol.Execute(command))
+        {
+            return EXIT_SUCCESS;
+        }
+    }
+
+    // No more commands will come, the last search is the last thing to wait for:
+    protocol.WaitForSearch();
+
+    return EXIT_SUCCESS;
+}
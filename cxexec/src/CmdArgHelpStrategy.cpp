@@ -33,6 +33,15 @@ int cx::CmdArgHelpStrategy::Handle()
     << "Possible arguments:" << std::endl
     << "--help        display this help and exit" << std::endl
     << "--version     output version information and exit" << std::endl
+    << "--perft N     count drop sequences up to depth N on the classic board and exit" << std::endl
+    << "--engine      read engine protocol commands from the standard input, without the interface" << std::endl
+    << "--analyze F   analyze each position of file F ('-' for the standard input) and exit." << std::endl
+    << "              Options: --workers N, --depth D, --nodes N, --movetime MS" << std::endl
+    << "--server A    host headless games on address A ('unix:PATH' or 'tcp:PORT'), until interrupted." << std::endl
+    << "              Options: --workers N" << std::endl
+    << "--selfplay N  play N bot games without the interface, print statistics and exit." << std::endl
+    << "              Options: --board WxH, --inarow K, --seed S, --players BOT,BOT,... where BOT is" << std::endl
+    << "              'random' or 'alphabeta', optionally followed by ':Nms' or ':Nnodes'" << std::endl
     << std::endl
     << "Exit status:" << std::endl
     << " 0 if OK," << std::endl
@@ -0,0 +1,91 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file CmdArgPerftStrategy.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include <cxinv/assertion.h>
+#include <cxmodel/BoardSnapshot.h>
+#include <cxmodel/Perft.h>
+#include <cxexec/CmdArgPerftStrategy.h>
+
+namespace
+{
+
+constexpr size_t CLASSIC_NB_ROWS = 6u;
+constexpr size_t CLASSIC_NB_COLUMNS = 7u;
+constexpr size_t CLASSIC_IN_A_ROW_VALUE = 4u;
+constexpr size_t CLASSIC_NB_PLAYERS = 2u;
+
+constexpr int COLUMN_WIDTH = 14;
+
+} // namespace
+
+cx::CmdArgPerftStrategy::CmdArgPerftStrategy(size_t p_maxDepth)
+ : m_maxDepth{p_maxDepth}
+{
+    PRECONDITION(p_maxDepth > 0u);
+}
+
+int cx::CmdArgPerftStrategy::Handle()
+{
+    const cxmodel::BoardSnapshot position{CLASSIC_NB_ROWS, CLASSIC_NB_COLUMNS, CLASSIC_IN_A_ROW_VALUE, CLASSIC_NB_PLAYERS};
+
+    std::cout << std::left
+              << std::setw(COLUMN_WIDTH) << "depth"
+              << std::setw(COLUMN_WIDTH) << "nodes"
+              << std::setw(COLUMN_WIDTH) << "wins"
+              << std::setw(COLUMN_WIDTH) << "ties"
+              << std::setw(COLUMN_WIDTH) << "nps"
+              << std::setw(COLUMN_WIDTH) << "reference nps"
+              << "result" << std::endl;
+
+    bool allMatch = true;
+    for(size_t depth = 1u; depth <= m_maxDepth; ++depth)
+    {
+        const cxmodel::PerftResult result = cxmodel::Perft(position, depth);
+        const cxmodel::PerftResult reference = cxmodel::ReferencePerft(position, depth);
+
+        const bool isMatch = (result == reference);
+        allMatch = allMatch && isMatch;
+
+        std::cout << std::setw(COLUMN_WIDTH) << depth
+                  << std::setw(COLUMN_WIDTH) << result.m_nbNodes
+                  << std::setw(COLUMN_WIDTH) << result.m_nbWins
+                  << std::setw(COLUMN_WIDTH) << result.m_nbTies
+                  << std::setw(COLUMN_WIDTH) << cxmodel::GetNodesPerSecond(result)
+                  << std::setw(COLUMN_WIDTH) << cxmodel::GetNodesPerSecond(reference)
+                  << (isMatch ? "OK" : "MISMATCH") << std::endl;
+
+        if(!isMatch)
+        {
+            std::cerr << "Connect X: perft mismatch at depth " << depth << ": "
+                      << "reference found " << reference.m_nbNodes << " nodes, "
+                      << reference.m_nbWins << " wins and "
+                      << reference.m_nbTies << " ties" << std::endl;
+        }
+    }
+
+    return allMatch ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,177 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file CmdArgSelfPlayStrategy.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <cxinv/assertion.h>
+#include <cxlog/ILogger.h>
+#include <cxmodel/BotGame.h>
+#include <cxmodel/ChipColor.h>
+#include <cxmodel/IPlayer.h>
+#include <cxmodel/ModelNotificationContext.h>
+#include <cxmodel/NewGameInformation.h>
+#include <cxmodel/RandomNumberGenerator.h>
+#include <cxmodel/SearchStatistics.h>
+#include <cxexec/CmdArgSelfPlayStrategy.h>
+#include <cxexec/ModelReferences.h>
+
+namespace
+{
+
+double PerSecond(size_t p_count, double p_nbSeconds)
+{
+    return p_nbSeconds > 0.0 ? static_cast<double>(p_count) / p_nbSeconds : 0.0;
+}
+
+double Percentage(size_t p_count, size_t p_total)
+{
+    return p_total > 0u ? 100.0 * static_cast<double>(p_count) / static_cast<double>(p_total) : 0.0;
+}
+
+} // namespace
+
+/*********************************************************************************************//**
+ * @brief Outcomes of the games played so far.
+ *
+ ************************************************************************************************/
+struct cx::CmdArgSelfPlayStrategy::Outcomes
+{
+    size_t m_nbGames = 0u;
+    size_t m_nbMoves = 0u;
+    size_t m_nbTies = 0u;
+    std::vector<size_t> m_nbWins;
+    cxmodel::SearchStatistics m_searchStatistics;
+};
+
+cx::CmdArgSelfPlayStrategy::CmdArgSelfPlayStrategy(const SelfPlaySettings& p_settings, cx::ModelReferences& p_model, cxlog::ILogger& p_logger)
+ : m_settings{p_settings}
+ , m_model{p_model}
+ , m_logger{p_logger}
+{
+    PRECONDITION(p_settings.m_players.size() >= 2u);
+    PRECONDITION(p_settings.m_players.size() <= cxmodel::NB_PLAYER_COLORS);
+}
+
+int cx::CmdArgSelfPlayStrategy::Handle()
+{
+    IF_CONDITION_NOT_MET_DO(m_settings.m_players.size() >= 2u, return EXIT_FAILURE;);
+    IF_CONDITION_NOT_MET_DO(m_settings.m_players.size() <= cxmodel::NB_PLAYER_COLORS, return EXIT_FAILURE;);
+
+    const cxlog::VerbosityLevel verbosityLevel = m_logger.GetVerbosityLevel();
+    m_logger.SetVerbosityLevel(cxlog::VerbosityLevel::WARNING);
+
+    Outcomes outcomes;
+    outcomes.m_nbWins.assign(m_settings.m_players.size(), 0u);
+
+    const std::uint64_t seed = m_settings.m_seed ? *m_settings.m_seed : cxmodel::MakeRandomSeed();
+
+    bool isSuccess = true;
+    const auto start = std::chrono::steady_clock::now();
+    while(isSuccess && outcomes.m_nbGames < m_settings.m_nbGames)
+    {
+        isSuccess = PlayGame(outcomes, cxmodel::MixSeed(seed, outcomes.m_nbGames));
+    }
+    const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+    m_logger.SetVerbosityLevel(verbosityLevel);
+
+    const double nbSeconds = duration.count();
+    std::cout << std::fixed << std::setprecision(1)
+              << "Games   : " << outcomes.m_nbGames << " (" << PerSecond(outcomes.m_nbGames, nbSeconds) << " games/s)" << std::endl
+              << "Moves   : " << outcomes.m_nbMoves << " (" << PerSecond(outcomes.m_nbMoves, nbSeconds) << " moves/s)" << std::endl
+              << "Time    : " << std::setprecision(3) << nbSeconds << " s" << std::setprecision(1) << std::endl
+              << "Seed    : " << seed << std::endl;
+
+    for(size_t playerIndex = 0u; playerIndex < outcomes.m_nbWins.size(); ++playerIndex)
+    {
+        const size_t nbWins = outcomes.m_nbWins[playerIndex];
+        std::cout << cxmodel::MakeBotName(playerIndex) << "   : " << nbWins << " wins (" << Percentage(nbWins, outcomes.m_nbGames) << "%), "
+                  << m_settings.m_players[playerIndex] << std::endl;
+    }
+
+    std::cout << "Ties    : " << outcomes.m_nbTies << " (" << Percentage(outcomes.m_nbTies, outcomes.m_nbGames) << "%)" << std::endl;
+
+    // Random bots do not search:
+    if(outcomes.m_searchStatistics.m_nbNodes > 0u)
+    {
+        std::cout << "Search  : " << outcomes.m_searchStatistics << std::endl;
+    }
+
+    if(!isSuccess)
+    {
+        std::cerr << "Connect X: self-play game " << outcomes.m_nbGames + 1u << " (seed " << cxmodel::MixSeed(seed, outcomes.m_nbGames) << ") did not end" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+bool cx::CmdArgSelfPlayStrategy::PlayGame(Outcomes& p_outcomes, std::uint64_t p_gameSeed)
+{
+    cxmodel::NewGameInformation gameInformation;
+    gameInformation.m_gridWidth = m_settings.m_gridWidth;
+    gameInformation.m_gridHeight = m_settings.m_gridHeight;
+    gameInformation.m_inARowValue = m_settings.m_inARowValue;
+    gameInformation.m_seed = p_gameSeed;
+
+    for(size_t playerIndex = 0u; playerIndex < m_settings.m_players.size(); ++playerIndex)
+    {
+        gameInformation.m_players.push_back(cxmodel::CreatePlayer(cxmodel::MakeBotName(playerIndex),
+                                                                  cxmodel::MakePlayerColor(playerIndex),
+                                                                  cxmodel::PlayerType::BOT,
+                                                                  m_settings.m_players[playerIndex]));
+    }
+
+    m_model.m_asGameActions.CreateNewGame(std::move(gameInformation));
+
+    const cxmodel::BotGameOutcome outcome = cxmodel::PlayBotGame(m_model.m_asGameActions,
+                                                                 m_model.m_asGameInformation,
+                                                                 m_model.m_asAi,
+                                                                 m_settings.m_players.size());
+    if(!outcome.m_isOver)
+    {
+        m_model.m_asGameActions.EndCurrentGame();
+        return false;
+    }
+
+    if(outcome.m_winnerIndex)
+    {
+        ++p_outcomes.m_nbWins[*outcome.m_winnerIndex];
+    }
+    else
+    {
+        ++p_outcomes.m_nbTies;
+    }
+
+    ++p_outcomes.m_nbGames;
+    p_outcomes.m_nbMoves += outcome.m_nbMoves;
+    cxmodel::Accumulate(p_outcomes.m_searchStatistics, m_model.m_asAi.GetGameSearchStatistics());
+
+    m_model.m_asGameActions.EndCurrentGame();
+
+    return true;
+}
@@ -0,0 +1,122 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file CmdArgServerStrategy.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <atomic>
+#include <csignal>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <thread>
+
+#include <pthread.h>
+#include <sys/resource.h>
+
+#include <cxinv/assertion.h>
+#include <cxlog/ILogger.h>
+#include <cxexec/CmdArgServerStrategy.h>
+#include <cxexec/GameServer.h>
+
+namespace
+{
+
+// Each connection takes a file descriptor, so the limit is raised as far as allowed:
+void RaiseFileDescriptorLimit()
+{
+    rlimit limit{};
+    if(::getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max)
+    {
+        limit.rlim_cur = limit.rlim_max;
+        ::setrlimit(RLIMIT_NOFILE, &limit);
+    }
+}
+
+} // namespace
+
+cx::CmdArgServerStrategy::CmdArgServerStrategy(const std::string& p_address, size_t p_nbWorkers, cxlog::ILogger& p_logger)
+ : m_address{p_address}
+ , m_nbWorkers{p_nbWorkers}
+ , m_logger{p_logger}
+{
+    PRECONDITION(p_nbWorkers > 0u);
+}
+
+int cx::CmdArgServerStrategy::Handle()
+{
+    IF_CONDITION_NOT_MET_DO(m_nbWorkers > 0u, return EXIT_FAILURE;);
+
+    RaiseFileDescriptorLimit();
+
+    // Interruptions are waited for by a dedicated thread. They are blocked before the
+    // server workers are created, so that the workers inherit the mask:
+    sigset_t stopSignals;
+    sigemptyset(&stopSignals);
+    sigaddset(&stopSignals, SIGINT);
+    sigaddset(&stopSignals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &stopSignals, nullptr);
+
+    const cxlog::VerbosityLevel verbosityLevel = m_logger.GetVerbosityLevel();
+    m_logger.SetVerbosityLevel(cxlog::VerbosityLevel::WARNING);
+
+    int status = EXIT_SUCCESS;
+    {
+        GameServer server{m_nbWorkers, m_logger};
+
+        const cxmodel::Status listenStatus = server.Listen(m_address);
+        if(listenStatus.IsSuccess())
+        {
+            const uint16_t port = server.GetPort();
+            std::cout << "Connect X: listening on " << (port > 0u ? "tcp:" + std::to_string(port) : m_address) << std::endl;
+
+            std::atomic<bool> isServerDone{false};
+            std::thread signalWaiter{[&server, &stopSignals, &isServerDone]()
+            {
+                // The wait is bounded, so that the thread also ends if the server stops on
+                // its own:
+                const timespec timeout{0, 200'000'000};
+                while(!isServerDone)
+                {
+                    if(::sigtimedwait(&stopSignals, nullptr, &timeout) > 0)
+                    {
+                        server.Stop();
+                        return;
+                    }
+                }
+            }};
+
+            server.Run();
+
+            isServerDone = true;
+            signalWaiter.join();
+        }
+        else
+        {
+            std::cerr << "Connect X: cannot listen on '" << m_address << "': " << listenStatus.GetMessage() << std::endl;
+            status = EXIT_FAILURE;
+        }
+    }
+
+    m_logger.SetVerbosityLevel(verbosityLevel);
+    pthread_sigmask(SIG_UNBLOCK, &stopSignals, nullptr);
+
+    return status;
+}
@@ -22,16 +22,28 @@
  *************************************************************************************************/
 
 #include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
 #include <memory>
+#include <optional>
+#include <thread>
 #include <vector>
 
 #include <cxinv/assertion.h>
 #include <cxlog/ILogger.h>
+#include <cxmodel/BotSettings.h>
+#include <cxstd/parse.h>
 #include <cxexec/CmdArgWorkflowFactory.h>
+#include <cxexec/CmdArgAnalyzeStrategy.h>
+#include <cxexec/CmdArgEngineStrategy.h>
 #include <cxexec/CmdArgHelpStrategy.h>
 #include <cxexec/CmdArgInvalidStrategy.h>
 #include <cxexec/CmdArgMainStrategy.h>
 #include <cxexec/CmdArgNoStrategy.h>
+#include <cxexec/CmdArgPerftStrategy.h>
+#include <cxexec/CmdArgSelfPlayStrategy.h>
+#include <cxexec/CmdArgServerStrategy.h>
 #include <cxexec/CmdArgVerboseStrategy.h>
 #include <cxexec/CmdArgVersionStrategy.h>
 #include <cxexec/ModelReferences.h>
@@ -42,6 +54,261 @@ namespace
 const std::string HELP_ARG    = "--help";
 const std::string VERSION_ARG = "--version";
 const std::string VERBOSE_ARG = "--verbose";
+const std::string PERFT_ARG   = "--perft";
+const std::string ENGINE_ARG  = "--engine";
+
+const std::string SELF_PLAY_ARG = "--selfplay";
+const std::string BOARD_ARG     = "--board";
+const std::string IN_A_ROW_ARG  = "--inarow";
+const std::string PLAYERS_ARG   = "--players";
+const std::string SEED_ARG      = "--seed";
+
+const std::string ANALYZE_ARG  = "--analyze";
+const std::string WORKERS_ARG  = "--workers";
+const std::string DEPTH_ARG    = "--depth";
+const std::string NODES_ARG    = "--nodes";
+const std::string MOVETIME_ARG = "--movetime";
+
+const std::string SERVER_ARG = "--server";
+
+// The --perft argument must come alone, followed by its depth:
+std::unique_ptr<cx::ICmdArgWorkflowStrategy> CreatePerftStrategy(const std::vector<std::string>& p_arguments)
+{
+    if(p_arguments.size() < 2u)
+    {
+        return std::make_unique<cx::CmdArgInvalidStrategy>(PERFT_ARG);
+    }
+
+    const std::optional<size_t> depth = cxstd::ParsePositiveInteger(p_arguments[1]);
+    if(p_arguments.size() > 2u || !depth)
+    {
+        return std::make_unique<cx::CmdArgInvalidStrategy>(p_arguments.size() > 2u ? p_arguments[2] : p_arguments[1]);
+    }
+
+    return std::make_unique<cx::CmdArgPerftStrategy>(*depth);
+}
+
+std::vector<std::string> Split(const std::string& p_string, char p_separator)
+{
+    std::vector<std::string> parts;
+
+    size_t begin = 0u;
+    size_t end = p_string.find(p_separator);
+    while(end != std::string::npos)
+    {
+        parts.push_back(p_string.substr(begin, end - begin));
+        begin = end + 1u;
+        end = p_string.find(p_separator, begin);
+    }
+    parts.push_back(p_string.substr(begin));
+
+    return parts;
+}
+
+// The --selfplay argument must come first, followed by the number of games. The other
+// options, all optional, come after in any order:
+//
+//   --selfplay N [--board WxH] [--inarow K] [--seed S] [--players BOT,BOT,...]
+//
+std::unique_ptr<cx::ICmdArgWorkflowStrategy> CreateSelfPlayStrategy(const std::vector<std::string>& p_arguments,
+                                                                    cx::ModelReferences& p_model,
+                                                                    cxlog::ILogger& p_logger)
+{
+    if(p_arguments.size() < 2u)
+    {
+        return std::make_unique<cx::CmdArgInvalidStrategy>(SELF_PLAY_ARG);
+    }
+
+    cx::SelfPlaySettings settings;
+    const std::optional<size_t> nbGames = cxstd::ParsePositiveInteger(p_arguments[1]);
+    if(!nbGames)
+    {
+        return std::make_unique<cx::CmdArgInvalidStrategy>(p_arguments[1]);
+    }
+    settings.m_nbGames = *nbGames;
+
+    const cxmodel::IConnectXLimits& limits = p_model.m_asLimits;
+    for(size_t index = 2u; index < p_arguments.size(); index += 2u)
+    {
+        const std::string& option = p_arguments[index];
+        if(index + 1u == p_arguments.size())
+        {
+            return std::make_unique<cx::CmdArgInvalidStrategy>(option);
+        }
+
+        const std::string& value = p_arguments[index + 1u];
+        bool isValid = false;
+
+        if(option == BOARD_ARG)
+        {
+            const std::vector<std::string> dimensions = Split(value, 'x');
+            if(dimensions.size() == 2u)
+            {
+                // Invalid dimensions are made 0, which is below the limits:
+                settings.m_gridWidth = cxstd::ParseInteger(dimensions[0]).value_or(0u);
+                settings.m_gridHeight = cxstd::ParseInteger(dimensions[1]).value_or(0u);
+                isValid = settings.m_gridWidth >= limits.GetMinimumGridWidth() &&
+                          settings.m_gridWidth <= limits.GetMaximumGridWidth() &&
+                          settings.m_gridHeight >= limits.GetMinimumGridHeight() &&
+                          settings.m_gridHeight <= limits.GetMaximumGridHeight();
+            }
+        }
+        else if(option == IN_A_ROW_ARG)
+        {
+            settings.m_inARowValue = cxstd::ParseInteger(value).value_or(0u);
+            isValid = settings.m_inARowValue >= limits.GetMinimumInARowValue() &&
+                      settings.m_inARowValue <= limits.GetMaximumInARowValue();
+        }
+        else if(option == SEED_ARG)
+        {
+            settings.m_seed = cxstd::ParseInteger<std::uint64_t>(value);
+            isValid = settings.m_seed.has_value();
+        }
+        else if(option == PLAYERS_ARG)
+        {
+            settings.m_players.clear();
+            isValid = true;
+            for(const std::string& player : Split(value, ','))
+            {
+                const std::optional<cxmodel::BotSettings> botSettings = cxmodel::MakeBotSettings(player);
+                isValid = isValid && botSettings.has_value();
+                if(isValid)
+                {
+                    settings.m_players.push_back(*botSettings);
+                }
+            }
+
+            isValid = isValid &&
+                      settings.m_players.size() >= limits.GetMinimumNumberOfPlayers() &&
+                      settings.m_players.size() <= limits.GetMaximumNumberOfPlayers();
+        }
+        else
+        {
+            return std::make_unique<cx::CmdArgInvalidStrategy>(option);
+        }
+
+        if(!isValid)
+        {
+            return std::make_unique<cx::CmdArgInvalidStrategy>(value);
+        }
+    }
+
+    // The in-a-row value must fit in the board, at least in one direction:
+    if(settings.m_inARowValue > std::max(settings.m_gridWidth, settings.m_gridHeight))
+    {
+        return std::make_unique<cx::CmdArgInvalidStrategy>(IN_A_ROW_ARG);
+    }
+
+    return std::make_unique<cx::CmdArgSelfPlayStrategy>(settings, p_model, p_logger);
+}
+
+// The --analyze argument must come first, followed by the input file ("-" for the standard
+// input). The other options, all optional, come after in any order:
+//
+//   --analyze FILE [--workers N] [--depth D] [--nodes N] [--movetime MS]
+//
+std::unique_ptr<cx::ICmdArgWorkflowStrategy> CreateAnalyzeStrategy(const std::vector<std::string>& p_arguments,
+                                                                   cx::ModelReferences& p_model)
+{
+    if(p_arguments.size() < 2u)
+    {
+        return std::make_unique<cx::CmdArgInvalidStrategy>(ANALYZE_ARG);
+    }
+
+    cx::BatchAnalysisSettings settings;
+    settings.m_nbWorkers = std::max(std::thread::hardware_concurrency(), 1u);
+
+    // As soon as a limit is given, the default depth limit no longer applies:
+    cxmodel::SearchLimits limits;
+    bool hasLimits = false;
+
+    for(size_t index = 2u; index < p_arguments.size(); index += 2u)
+    {
+        const std::string& option = p_arguments[index];
+        if(index + 1u == p_arguments.size())
+        {
+            return std::make_unique<cx::CmdArgInvalidStrategy>(option);
+        }
+
+        const std::string& value = p_arguments[index + 1u];
+        // Invalid numbers are made 0, which is rejected below:
+        const size_t number = cxstd::ParsePositiveInteger(value).value_or(0u);
+
+        if(option == WORKERS_ARG)
+        {
+            settings.m_nbWorkers = number;
+        }
+        else if(option == DEPTH_ARG)
+        {
+            limits.m_maxDepth = number;
+            hasLimits = true;
+        }
+        else if(option == NODES_ARG)
+        {
+            limits.m_maxNodes = number;
+            hasLimits = true;
+        }
+        else if(option == MOVETIME_ARG)
+        {
+            limits.m_maxTime = std::chrono::milliseconds{number};
+            hasLimits = true;
+        }
+        else
+        {
+            return std::make_unique<cx::CmdArgInvalidStrategy>(option);
+        }
+
+        if(number == 0u)
+        {
+            return std::make_unique<cx::CmdArgInvalidStrategy>(value);
+        }
+    }
+
+    if(hasLimits)
+    {
+        settings.m_limits = limits;
+    }
+
+    return std::make_unique<cx::CmdArgAnalyzeStrategy>(settings, p_arguments[1], p_model);
+}
+
+// The --server argument must come first, followed by the address to listen on. The number
+// of bot workers, optional, comes after:
+//
+//   --server unix:PATH|tcp:PORT [--workers N]
+//
+std::unique_ptr<cx::ICmdArgWorkflowStrategy> CreateServerStrategy(const std::vector<std::string>& p_arguments,
+                                                                  cxlog::ILogger& p_logger)
+{
+    if(p_arguments.size() < 2u)
+    {
+        return std::make_unique<cx::CmdArgInvalidStrategy>(SERVER_ARG);
+    }
+
+    size_t nbWorkers = std::max(std::thread::hardware_concurrency(), 1u);
+
+    if(p_arguments.size() > 2u)
+    {
+        if(p_arguments[2] != WORKERS_ARG || p_arguments.size() < 4u)
+        {
+            return std::make_unique<cx::CmdArgInvalidStrategy>(p_arguments[2]);
+        }
+
+        if(p_arguments.size() > 4u)
+        {
+            return std::make_unique<cx::CmdArgInvalidStrategy>(p_arguments[4]);
+        }
+
+        const std::optional<size_t> number = cxstd::ParsePositiveInteger(p_arguments[3]);
+        if(!number)
+        {
+            return std::make_unique<cx::CmdArgInvalidStrategy>(p_arguments[3]);
+        }
+        nbWorkers = *number;
+    }
+
+    return std::make_unique<cx::CmdArgServerStrategy>(p_arguments[1], nbWorkers, p_logger);
+}
 
 } // namespace cx
 
@@ -66,6 +333,37 @@ std::unique_ptr<cx::ICmdArgWorkflowStrategy> cx::CmdArgWorkflowFactory::Create(i
             arguments.push_back(argv[i]);
         }
 
+        if(arguments.front() == PERFT_ARG)
+        {
+            return CreatePerftStrategy(arguments);
+        }
+
+        // The --engine argument must come alone, commands are read from the standard input:
+        if(arguments.front() == ENGINE_ARG)
+        {
+            if(arguments.size() > 1u)
+            {
+                return std::make_unique<CmdArgInvalidStrategy>(arguments[1]);
+            }
+
+            return std::make_unique<CmdArgEngineStrategy>(std::cin, p_model);
+        }
+
+        if(arguments.front() == ANALYZE_ARG)
+        {
+            return CreateAnalyzeStrategy(arguments, p_model);
+        }
+
+        if(arguments.front() == SERVER_ARG)
+        {
+            return CreateServerStrategy(arguments, p_logger);
+        }
+
+        if(arguments.front() == SELF_PLAY_ARG)
+        {
+            return CreateSelfPlayStrategy(arguments, p_model, p_logger);
+        }
+
         bool hasInvalidArguments = false;
         std::string firstInvalidArgument;
         for(const auto& argument : arguments)
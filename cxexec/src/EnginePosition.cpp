@@ -0,0 +1,132 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file EnginePosition.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <sstream>
+
+#include <cxinv/assertion.h>
+#include <cxmodel/IConnectXLimits.h>
+#include <cxmodel/Search.h>
+#include <cxstd/parse.h>
+#include <cxexec/EnginePosition.h>
+
+namespace
+{
+
+// Parses a column number, as shown to users (from 1). Returns nothing if the argument is not
+// a column of the board:
+std::optional<size_t> ParseColumn(const std::string& p_argument, size_t p_nbColumns)
+{
+    const std::optional<size_t> column = cxstd::ParsePositiveInteger(p_argument);
+    if(!column || *column > p_nbColumns)
+    {
+        return std::nullopt;
+    }
+
+    return *column - 1u;
+}
+
+} // namespace
+
+bool cx::AreValid(const BoardParameters& p_parameters, const cxmodel::IConnectXLimits& p_limits)
+{
+    return p_parameters.m_gridWidth >= p_limits.GetMinimumGridWidth() &&
+           p_parameters.m_gridWidth <= p_limits.GetMaximumGridWidth() &&
+           p_parameters.m_gridHeight >= p_limits.GetMinimumGridHeight() &&
+           p_parameters.m_gridHeight <= p_limits.GetMaximumGridHeight() &&
+           p_parameters.m_inARowValue >= p_limits.GetMinimumInARowValue() &&
+           p_parameters.m_inARowValue <= p_limits.GetMaximumInARowValue() &&
+           p_parameters.m_inARowValue <= std::max(p_parameters.m_gridWidth, p_parameters.m_gridHeight) &&
+           p_parameters.m_nbPlayers >= p_limits.GetMinimumNumberOfPlayers() &&
+           p_parameters.m_nbPlayers <= p_limits.GetMaximumNumberOfPlayers();
+}
+
+std::optional<cx::EnginePosition> cx::MakeEnginePosition(const BoardParameters& p_parameters,
+                                                         const std::vector<std::string>& p_moves)
+{
+    EnginePosition position{cxmodel::BoardSnapshot{p_parameters.m_gridHeight,
+                                                   p_parameters.m_gridWidth,
+                                                   p_parameters.m_inARowValue,
+                                                   p_parameters.m_nbPlayers},
+                            false};
+
+    for(const std::string& move : p_moves)
+    {
+        const std::optional<size_t> column = ParseColumn(move, p_parameters.m_gridWidth);
+        if(!column || position.m_isWon || position.m_snapshot.IsColumnFull(*column))
+        {
+            return std::nullopt;
+        }
+
+        position.m_snapshot.DropChip(*column);
+        position.m_isWon = position.m_snapshot.IsLastDropWinning(*column);
+    }
+
+    return position;
+}
+
+std::string cx::FormatScore(int p_score, size_t p_nbPositions)
+{
+    IF_PRECONDITION_NOT_MET_DO(p_score != cxmodel::NO_SCORE, return "none";);
+
+    // A win found on the next drop scores WIN_SCORE - 1, and one less per extra drop:
+    const int nbDropsToEnd = cxmodel::WIN_SCORE - std::abs(p_score);
+
+    std::ostringstream stream;
+    if(nbDropsToEnd <= static_cast<int>(p_nbPositions))
+    {
+        stream << (p_score > 0 ? "win " : "loss ") << nbDropsToEnd;
+    }
+    else
+    {
+        stream << "value " << p_score;
+    }
+
+    return stream.str();
+}
+
+size_t cx::GetFallbackColumn(const cxmodel::BoardSnapshot& p_position)
+{
+    PRECONDITION(!p_position.IsFull());
+
+    // Distances are doubled, so that even widths have a center too:
+    const auto distanceToCenter = [nbColumns = p_position.GetNbColumns()](size_t p_column)
+    {
+        const size_t doubledColumn = 2u * p_column;
+        return doubledColumn > nbColumns - 1u ? doubledColumn - (nbColumns - 1u) : (nbColumns - 1u) - doubledColumn;
+    };
+
+    size_t bestColumn = 0u;
+    bool isFound = false;
+    for(size_t column = 0u; column < p_position.GetNbColumns(); ++column)
+    {
+        if(!p_position.IsColumnFull(column) && (!isFound || distanceToCenter(column) < distanceToCenter(bestColumn)))
+        {
+            bestColumn = column;
+            isFound = true;
+        }
+    }
+
+    return bestColumn;
+}
@@ -0,0 +1,288 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file EngineProtocol.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <iterator>
+#include <optional>
+#include <sstream>
+
+#include <cxinv/assertion.h>
+#include <cxmodel/IConnectXLimits.h>
+#include <cxmodel/IVersioning.h>
+#include <cxmodel/Search.h>
+#include <cxstd/parse.h>
+#include <cxexec/EngineProtocol.h>
+
+namespace
+{
+
+// The table is kept from one search to the next, as long as the same player is to drop:
+constexpr size_t ENGINE_HASH_SIZE_IN_MB = 16u;
+
+// Splits a line into its whitespace separated words:
+std::vector<std::string> SplitWords(const std::string& p_line)
+{
+    std::istringstream stream{p_line};
+    return {std::istream_iterator<std::string>{stream}, std::istream_iterator<std::string>{}};
+}
+
+} // namespace
+
+cx::EngineProtocol::EngineProtocol(std::ostream& p_output,
+                                   const cxmodel::IConnectXLimits& p_limits,
+                                   const cxmodel::IVersioning& p_versioning)
+: m_limits{p_limits}
+, m_versioning{p_versioning}
+, m_writer{p_output}
+, m_position{*MakeEnginePosition(m_parameters, {})}
+{
+}
+
+cx::EngineProtocol::~EngineProtocol()
+{
+    StopSearch();
+}
+
+bool cx::EngineProtocol::Execute(const std::string& p_command)
+{
+    const std::vector<std::string> words = SplitWords(p_command);
+    if(words.empty())
+    {
+        return true;
+    }
+
+    const std::string& command = words.front();
+    const std::vector<std::string> arguments{words.cbegin() + 1, words.cend()};
+
+    // Only these are handled while searching. For the others, the search must end first, so
+    // that their answers come after its own:
+    if(command != "isready" && command != "stop" && command != "quit")
+    {
+        WaitForSearch();
+    }
+
+    if(command == "cxp")
+    {
+        m_writer.Write("id name " + m_versioning.GetName() + " " + m_versioning.GetVersionNumber());
+        m_writer.Write("cxpok");
+    }
+    else if(command == "isready")
+    {
+        m_writer.Write("readyok");
+    }
+    else if(command == "newgame")
+    {
+        SetBoardParameters(m_parameters);
+    }
+    else if(command == "board" || command == "inarow" || command == "players")
+    {
+        BoardParameters parameters = m_parameters;
+        bool isValid = (arguments.size() == 1u);
+        if(isValid && command == "board")
+        {
+            const size_t separator = arguments[0].find('x');
+            const std::optional<size_t> width = cxstd::ParsePositiveInteger(arguments[0].substr(0u, separator));
+            const std::optional<size_t> height = separator == std::string::npos ? std::nullopt : cxstd::ParsePositiveInteger(arguments[0].substr(separator + 1u));
+            isValid = width && height;
+            parameters.m_gridWidth = width.value_or(0u);
+            parameters.m_gridHeight = height.value_or(0u);
+        }
+        else if(isValid)
+        {
+            const std::optional<size_t> value = cxstd::ParsePositiveInteger(arguments[0]);
+            isValid = value.has_value();
+            (command == "inarow" ? parameters.m_inARowValue : parameters.m_nbPlayers) = value.value_or(0u);
+        }
+
+        if(isValid && AreValid(parameters, m_limits))
+        {
+            SetBoardParameters(parameters);
+        }
+        else
+        {
+            m_writer.Write("info string invalid board parameters '" + p_command + "'");
+        }
+    }
+    else if(command == "position")
+    {
+        SetPosition(arguments);
+    }
+    else if(command == "go")
+    {
+        Go(arguments);
+    }
+    else if(command == "stop")
+    {
+        StopSearch();
+    }
+    else if(command == "quit")
+    {
+        StopSearch();
+        return false;
+    }
+    else
+    {
+        m_writer.Write("info string unknown command '" + command + "'");
+    }
+
+    return true;
+}
+
+void cx::EngineProtocol::WaitForSearch()
+{
+    if(m_searchThread.joinable())
+    {
+        if(m_isInfinite)
+        {
+            m_stop = true;
+        }
+
+        m_searchThread.join();
+    }
+}
+
+void cx::EngineProtocol::SetBoardParameters(const BoardParameters& p_parameters)
+{
+    // Nothing learned on another board, or in another game, is kept:
+    m_search.reset();
+
+    m_parameters = p_parameters;
+    m_position = *MakeEnginePosition(m_parameters, {});
+}
+
+void cx::EngineProtocol::SetPosition(const std::vector<std::string>& p_arguments)
+{
+    const bool hasStart = !p_arguments.empty() && p_arguments[0] == "startpos";
+    const bool hasMoves = p_arguments.size() > 1u && p_arguments[1] == "moves";
+    if(!hasStart || (p_arguments.size() > 1u && !hasMoves))
+    {
+        m_writer.Write("info string invalid position, expected 'position startpos [moves C C ...]'");
+        return;
+    }
+
+    const std::vector<std::string> moves{p_arguments.cbegin() + (hasMoves ? 2 : 1), p_arguments.cend()};
+    std::optional<EnginePosition> position = MakeEnginePosition(m_parameters, moves);
+    if(!position)
+    {
+        m_writer.Write("info string invalid moves for a " + std::to_string(m_parameters.m_gridWidth) + "x" +
+                       std::to_string(m_parameters.m_gridHeight) + " board");
+        return;
+    }
+
+    m_position = std::move(*position);
+}
+
+void cx::EngineProtocol::Go(const std::vector<std::string>& p_arguments)
+{
+    cxmodel::SearchLimits limits;
+    for(size_t index = 0u; index < p_arguments.size(); ++index)
+    {
+        const std::string& option = p_arguments[index];
+        if(option == "infinite")
+        {
+            continue;
+        }
+
+        const std::optional<size_t> value = (index + 1u < p_arguments.size()) ? cxstd::ParsePositiveInteger(p_arguments[index + 1u]) : std::nullopt;
+        if(!value || (option != "depth" && option != "nodes" && option != "movetime"))
+        {
+            m_writer.Write("info string invalid go option '" + option + "'");
+            return;
+        }
+
+        if(option == "depth")
+        {
+            limits.m_maxDepth = *value;
+        }
+        else if(option == "nodes")
+        {
+            limits.m_maxNodes = *value;
+        }
+        else
+        {
+            limits.m_maxTime = std::chrono::milliseconds{*value};
+        }
+
+        ++index;
+    }
+
+    const cxmodel::BoardSnapshot& position = m_position.m_snapshot;
+    if(m_position.m_isWon || position.IsFull())
+    {
+        m_writer.Write("bestmove none");
+        return;
+    }
+
+    // Scores, and so table entries, are from the point of view of the player to drop:
+    if(!m_search || m_searchPlayerIndex != position.GetActivePlayerIndex())
+    {
+        m_search = std::make_unique<cxmodel::Search>(ENGINE_HASH_SIZE_IN_MB);
+        m_searchPlayerIndex = position.GetActivePlayerIndex();
+    }
+
+    m_isInfinite = (limits.m_maxDepth == 0u && limits.m_maxNodes == 0u && limits.m_maxTime.count() == 0);
+    m_stop = false;
+    m_searchThread = std::thread{[this, position, limits]()
+                                 {
+                                     const cxmodel::SearchResult result = m_search->Run(position,
+                                                                                        limits,
+                                                                                        m_stop,
+                                                                                        [this](const cxmodel::SearchResult& p_result)
+                                                                                        {
+                                                                                            WriteInfo(p_result);
+                                                                                        });
+
+                                     const size_t column = result.m_depth > 0u ? result.m_bestColumn : GetFallbackColumn(position);
+                                     m_writer.Write("bestmove " + std::to_string(column + 1u));
+                                 }};
+}
+
+void cx::EngineProtocol::StopSearch()
+{
+    if(m_searchThread.joinable())
+    {
+        m_stop = true;
+        m_searchThread.join();
+    }
+}
+
+void cx::EngineProtocol::WriteInfo(const cxmodel::SearchResult& p_result)
+{
+    const cxmodel::SearchStatistics& statistics = p_result.m_statistics;
+    const size_t nbPositions = m_parameters.m_gridWidth * m_parameters.m_gridHeight;
+
+    std::ostringstream line;
+    line << "info depth " << p_result.m_depth
+         << " seldepth " << statistics.m_selectiveDepth
+         << " score " << FormatScore(p_result.m_columnScores[p_result.m_bestColumn], nbPositions)
+         << " nodes " << statistics.m_nbNodes
+         << " nps " << cxmodel::GetNodesPerSecond(statistics)
+         << " time " << std::chrono::duration_cast<std::chrono::milliseconds>(statistics.m_duration).count()
+         << " pv";
+
+    for(const size_t column : statistics.m_principalVariation)
+    {
+        line << " " << column + 1u;
+    }
+
+    m_writer.Write(line.str());
+}
@@ -0,0 +1,528 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file GameServer.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <array>
+#include <cerrno>
+#include <cstring>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cxinv/assertion.h>
+#include <cxlog/ILogger.h>
+#include <cxexec/GameServer.h>
+
+namespace
+{
+
+const std::string UNIX_PREFIX = "unix:";
+const std::string TCP_PREFIX = "tcp:";
+
+// Epoll data of the file descriptors which are not connections:
+constexpr uint64_t LISTEN_ID = 0u;
+constexpr uint64_t WAKE_UP_ID = 1u;
+constexpr uint64_t FIRST_CONNECTION_ID = 2u;
+
+constexpr size_t MAX_EVENTS = 256u;
+constexpr size_t READ_BUFFER_SIZE = 4096u;
+
+// Longest accepted command. Clients sending longer lines are disconnected:
+constexpr size_t MAX_LINE_SIZE = 1024u;
+
+// Answers waiting for a client to read them, above which its commands are no longer read:
+constexpr size_t MAX_PENDING_OUTPUT_SIZE = 64u * 1024u;
+
+std::string MakeSystemError(const std::string& p_action)
+{
+    return p_action + ": " + std::strerror(errno);
+}
+
+bool Watch(int p_epollFd, int p_operation, int p_fd, uint32_t p_events, uint64_t p_id)
+{
+    epoll_event event{};
+    event.events = p_events;
+    event.data.u64 = p_id;
+
+    return ::epoll_ctl(p_epollFd, p_operation, p_fd, &event) == 0;
+}
+
+void WakeUp(int p_wakeUpFd)
+{
+    // If the counter is saturated, the loop is already woken up, so the result does not matter:
+    const uint64_t one = 1u;
+    const ssize_t size = ::write(p_wakeUpFd, &one, sizeof(one));
+    static_cast<void>(size);
+}
+
+} // namespace
+
+cx::GameServer::Connection::Connection(int p_fd, uint64_t p_id, uint32_t p_events, cxlog::ILogger& p_logger)
+: m_fd{p_fd}
+, m_id{p_id}
+, m_events{p_events}
+, m_session{p_logger}
+{
+}
+
+cx::GameServer::GameServer(size_t p_nbWorkers, cxlog::ILogger& p_logger)
+: m_logger{p_logger}
+, m_nextConnectionId{FIRST_CONNECTION_ID}
+, m_workers{std::make_unique<BotWorkerPool>(p_nbWorkers)}
+{
+    m_epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+    m_wakeUpFd = ::eventfd(0u, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    // On failure, Listen reports the error:
+    if(m_epollFd >= 0 && m_wakeUpFd >= 0 && !Watch(m_epollFd, EPOLL_CTL_ADD, m_wakeUpFd, EPOLLIN, WAKE_UP_ID))
+    {
+        ::close(m_wakeUpFd);
+        m_wakeUpFd = -1;
+    }
+}
+
+cx::GameServer::~GameServer()
+{
+    // Workers may still be posting results:
+    m_workers.reset();
+
+    for(const auto& [id, connection] : m_connections)
+    {
+        ::close(connection->m_fd);
+    }
+    m_connections.clear();
+
+    for(const int fd : {m_listenFd, m_wakeUpFd, m_epollFd})
+    {
+        if(fd >= 0)
+        {
+            ::close(fd);
+        }
+    }
+
+    if(!m_socketPath.empty())
+    {
+        ::unlink(m_socketPath.c_str());
+    }
+}
+
+cxmodel::Status cx::GameServer::Listen(const std::string& p_address)
+{
+    IF_PRECONDITION_NOT_MET_DO(m_listenFd < 0, return cxmodel::MakeError("The server already listens."););
+
+    if(m_epollFd < 0 || m_wakeUpFd < 0)
+    {
+        return cxmodel::MakeError("The event loop could not be created.");
+    }
+
+    int listenFd = -1;
+
+    if(p_address.compare(0u, UNIX_PREFIX.size(), UNIX_PREFIX) == 0)
+    {
+        const std::string path = p_address.substr(UNIX_PREFIX.size());
+
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        if(path.empty() || path.size() >= sizeof(address.sun_path))
+        {
+            return cxmodel::MakeError("Invalid socket path '" + path + "'.");
+        }
+        std::memcpy(address.sun_path, path.c_str(), path.size() + 1u);
+
+        listenFd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if(listenFd < 0)
+        {
+            return cxmodel::MakeError(MakeSystemError("socket"));
+        }
+
+        // A previous server may have left its socket file behind:
+        ::unlink(path.c_str());
+
+        if(::bind(listenFd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+        {
+            const cxmodel::Status error = cxmodel::MakeError(MakeSystemError("bind"));
+            ::close(listenFd);
+
+            return error;
+        }
+
+        m_socketPath = path;
+    }
+    else if(p_address.compare(0u, TCP_PREFIX.size(), TCP_PREFIX) == 0)
+    {
+        const std::string port = p_address.substr(TCP_PREFIX.size());
+        if(port.empty() || port.size() > 5u || port.find_first_not_of("0123456789") != std::string::npos || std::stoul(port) > 65535u)
+        {
+            return cxmodel::MakeError("Invalid port '" + port + "'.");
+        }
+
+        // Only local clients are served:
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(static_cast<uint16_t>(std::stoul(port)));
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+        listenFd = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if(listenFd < 0)
+        {
+            return cxmodel::MakeError(MakeSystemError("socket"));
+        }
+
+        const int enabled = 1;
+        ::setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &enabled, sizeof(enabled));
+
+        if(::bind(listenFd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+        {
+            const cxmodel::Status error = cxmodel::MakeError(MakeSystemError("bind"));
+            ::close(listenFd);
+
+            return error;
+        }
+    }
+    else
+    {
+        return cxmodel::MakeError("Invalid address '" + p_address + "'.");
+    }
+
+    if(::listen(listenFd, SOMAXCONN) != 0 || !Watch(m_epollFd, EPOLL_CTL_ADD, listenFd, EPOLLIN, LISTEN_ID))
+    {
+        const cxmodel::Status error = cxmodel::MakeError(MakeSystemError("listen"));
+        ::close(listenFd);
+
+        return error;
+    }
+
+    m_listenFd = listenFd;
+
+    return cxmodel::MakeSuccess();
+}
+
+uint16_t cx::GameServer::GetPort() const
+{
+    sockaddr_in address{};
+    socklen_t size = sizeof(address);
+    if(m_listenFd < 0 || ::getsockname(m_listenFd, reinterpret_cast<sockaddr*>(&address), &size) != 0 || address.sin_family != AF_INET)
+    {
+        return 0u;
+    }
+
+    return ntohs(address.sin_port);
+}
+
+void cx::GameServer::Run()
+{
+    IF_PRECONDITION_NOT_MET_DO(m_listenFd >= 0, return;);
+
+    std::array<epoll_event, MAX_EVENTS> events;
+
+    while(!m_isStopping)
+    {
+        const int nbEvents = ::epoll_wait(m_epollFd, events.data(), static_cast<int>(events.size()), -1);
+        if(nbEvents < 0)
+        {
+            IF_CONDITION_NOT_MET_DO(errno == EINTR, return;);
+            continue;
+        }
+
+        for(int index = 0; index < nbEvents; ++index)
+        {
+            const uint64_t id = events[index].data.u64;
+            const uint32_t flags = events[index].events;
+
+            if(id == LISTEN_ID)
+            {
+                Accept();
+                continue;
+            }
+
+            if(id == WAKE_UP_ID)
+            {
+                ApplyBotDrops();
+                continue;
+            }
+
+            // The connection may have been closed by an earlier event of the same batch:
+            const auto it = m_connections.find(id);
+            if(it == m_connections.end())
+            {
+                continue;
+            }
+
+            Connection& connection = *it->second;
+
+            if(flags & (EPOLLERR | EPOLLHUP))
+            {
+                Close(id);
+                continue;
+            }
+
+            if(flags & EPOLLOUT)
+            {
+                Flush(connection);
+            }
+
+            // A hang up is seen as the end of the input:
+            if((flags & (EPOLLIN | EPOLLRDHUP)) && m_connections.count(id) > 0u)
+            {
+                Read(connection);
+            }
+        }
+    }
+}
+
+void cx::GameServer::Stop()
+{
+    m_isStopping = true;
+    WakeUp(m_wakeUpFd);
+}
+
+void cx::GameServer::Accept()
+{
+    while(true)
+    {
+        const int fd = ::accept4(m_listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if(fd < 0)
+        {
+            if(errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+            {
+                m_logger.Log(cxlog::VerbosityLevel::WARNING, __FILE__, __FUNCTION__, __LINE__, MakeSystemError("accept"));
+            }
+
+            return;
+        }
+
+        // Answers are small and awaited by the client, they must not be delayed:
+        if(m_socketPath.empty())
+        {
+            const int enabled = 1;
+            ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enabled, sizeof(enabled));
+        }
+
+        const uint64_t id = m_nextConnectionId++;
+        const uint32_t events = EPOLLIN | EPOLLRDHUP;
+        if(!Watch(m_epollFd, EPOLL_CTL_ADD, fd, events, id))
+        {
+            ::close(fd);
+            continue;
+        }
+
+        m_connections.emplace(id, m_connectionPool.Create(fd, id, events, m_logger));
+    }
+}
+
+void cx::GameServer::Read(Connection& p_connection)
+{
+    // A single read per event: a client sending many commands at once does not hold up the
+    // others. Epoll reports the rest of its input on the next round.
+    std::array<char, READ_BUFFER_SIZE> buffer;
+
+    ssize_t size = -1;
+    do
+    {
+        size = ::recv(p_connection.m_fd, buffer.data(), buffer.size(), 0);
+    }
+    while(size < 0 && errno == EINTR);
+
+    if(size > 0)
+    {
+        p_connection.m_input.append(buffer.data(), static_cast<size_t>(size));
+    }
+
+    const bool isPeerDone = (size == 0) || (size < 0 && errno != EAGAIN && errno != EWOULDBLOCK);
+
+    ExecuteLines(p_connection);
+
+    if(!p_connection.m_isClosing && p_connection.m_input.size() > MAX_LINE_SIZE)
+    {
+        p_connection.m_output += "error line too long\n";
+        p_connection.m_isClosing = true;
+    }
+
+    p_connection.m_isClosing = p_connection.m_isClosing || isPeerDone;
+
+    Flush(p_connection);
+}
+
+void cx::GameServer::ExecuteLines(Connection& p_connection)
+{
+    size_t begin = 0u;
+    size_t end = p_connection.m_input.find('\n');
+
+    while(end != std::string::npos && !p_connection.m_isClosing)
+    {
+        std::string line = p_connection.m_input.substr(begin, end - begin);
+        if(!line.empty() && line.back() == '\r')
+        {
+            line.pop_back();
+        }
+
+        if(line == "quit")
+        {
+            p_connection.m_isClosing = true;
+        }
+        else if(!line.empty())
+        {
+            p_connection.m_output += p_connection.m_session.Execute(line);
+            p_connection.m_output += '\n';
+
+            RequestBotDrop(p_connection);
+        }
+
+        begin = end + 1u;
+        end = p_connection.m_input.find('\n', begin);
+    }
+
+    p_connection.m_input.erase(0u, begin);
+}
+
+void cx::GameServer::RequestBotDrop(Connection& p_connection)
+{
+    if(!p_connection.m_session.IsBotDropNeeded())
+    {
+        return;
+    }
+
+    BotDropRequest request = p_connection.m_session.StartBotDrop();
+    const uint64_t connectionId = p_connection.m_id;
+
+    m_workers->Post([this, connectionId, request = std::move(request)]()
+    {
+        const size_t column = request.m_strategy->Compute(request.m_position);
+
+        {
+            std::lock_guard<std::mutex> lock{m_botDropResultsMutex};
+            m_botDropResults.push_back({connectionId, request.m_generation, column});
+        }
+
+        WakeUp(m_wakeUpFd);
+    });
+}
+
+void cx::GameServer::ApplyBotDrops()
+{
+    // Results are all taken below, however many wake ups they caused:
+    uint64_t counter = 0u;
+    const ssize_t size = ::read(m_wakeUpFd, &counter, sizeof(counter));
+    static_cast<void>(size);
+
+    std::vector<BotDropResult> results;
+    {
+        std::lock_guard<std::mutex> lock{m_botDropResultsMutex};
+        results.swap(m_botDropResults);
+    }
+
+    for(const BotDropResult& result : results)
+    {
+        // The client may have left while the bot was thinking:
+        const auto it = m_connections.find(result.m_connectionId);
+        if(it == m_connections.end())
+        {
+            continue;
+        }
+
+        Connection& connection = *it->second;
+
+        const std::optional<std::string> line = connection.m_session.CompleteBotDrop(result.m_generation, result.m_column);
+        if(line)
+        {
+            connection.m_output += *line;
+            connection.m_output += '\n';
+        }
+
+        // Either the next player is a bot too, or the result was stale and a bot still has to
+        // drop in the new position:
+        RequestBotDrop(connection);
+
+        Flush(connection);
+    }
+}
+
+void cx::GameServer::Flush(Connection& p_connection)
+{
+    size_t nbSent = 0u;
+    while(nbSent < p_connection.m_output.size())
+    {
+        const ssize_t size = ::send(p_connection.m_fd, p_connection.m_output.data() + nbSent, p_connection.m_output.size() - nbSent, MSG_NOSIGNAL);
+        if(size > 0)
+        {
+            nbSent += static_cast<size_t>(size);
+            continue;
+        }
+
+        if(size < 0 && errno == EINTR)
+        {
+            continue;
+        }
+
+        if(size < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            break;
+        }
+
+        // The peer is gone, nothing more can be sent:
+        Close(p_connection.m_id);
+        return;
+    }
+    p_connection.m_output.erase(0u, nbSent);
+
+    const bool hasPendingOutput = !p_connection.m_output.empty();
+    if(!hasPendingOutput && p_connection.m_isClosing)
+    {
+        Close(p_connection.m_id);
+        return;
+    }
+
+    // Only wait for the socket to be writable while there is something to write, and stop
+    // reading commands from a client which does not read its answers:
+    uint32_t events = hasPendingOutput ? EPOLLOUT : 0u;
+    if(p_connection.m_output.size() < MAX_PENDING_OUTPUT_SIZE)
+    {
+        events |= EPOLLIN | EPOLLRDHUP;
+    }
+
+    if(events != p_connection.m_events)
+    {
+        if(!Watch(m_epollFd, EPOLL_CTL_MOD, p_connection.m_fd, events, p_connection.m_id))
+        {
+            Close(p_connection.m_id);
+            return;
+        }
+
+        p_connection.m_events = events;
+    }
+}
+
+void cx::GameServer::Close(uint64_t p_connectionId)
+{
+    const auto it = m_connections.find(p_connectionId);
+    IF_CONDITION_NOT_MET_DO(it != m_connections.end(), return;);
+
+    // Closing the file descriptor also removes it from the epoll set:
+    ::close(it->second->m_fd);
+    m_connections.erase(it);
+}
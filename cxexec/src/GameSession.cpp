@@ -0,0 +1,433 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file GameSession.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <sstream>
+
+#include <cxinv/assertion.h>
+#include <cxlog/ILogger.h>
+#include <cxmodel/BotSettings.h>
+#include <cxmodel/ChipColor.h>
+#include <cxmodel/IChip.h>
+#include <cxmodel/IPlayer.h>
+#include <cxmodel/MoveJournal.h>
+#include <cxmodel/NewGameInformation.h>
+#include <cxmodel/RandomNumberGenerator.h>
+#include <cxstd/parse.h>
+#include <cxexec/GameSession.h>
+
+namespace
+{
+
+// A journal entry is a few bytes, so the history is much longer than a command stack's:
+constexpr size_t MOVE_JOURNAL_SIZE = 1024u;
+
+// Small chunks keep idle sessions light. The move journal storage is bigger than the largest
+// pooled block, so it is allocated on its own:
+const std::pmr::pool_options SESSION_POOL_OPTIONS{4u, 1024u};
+
+const std::string HUMAN_SEAT = "human";
+
+// Player numbers, as shown on the board (1 based):
+constexpr std::array<char, 10u> PLAYER_SYMBOLS = {'1', '2', '3', '4', '5', '6', '7', '8', '9', 'A'};
+
+std::vector<std::string> Split(const std::string& p_string, char p_separator)
+{
+    std::vector<std::string> parts;
+
+    size_t begin = 0u;
+    size_t end = p_string.find(p_separator);
+    while(end != std::string::npos)
+    {
+        parts.push_back(p_string.substr(begin, end - begin));
+        begin = end + 1u;
+        end = p_string.find(p_separator, begin);
+    }
+    parts.push_back(p_string.substr(begin));
+
+    return parts;
+}
+
+std::string MakeError(const std::string& p_message)
+{
+    return "error " + p_message;
+}
+
+} // namespace
+
+cx::GameSession::GameSession(cxlog::ILogger& p_logger)
+: m_resource{SESSION_POOL_OPTIONS}
+, m_model{cxmodel::MoveJournal{MOVE_JOURNAL_SIZE, &m_resource}, p_logger, &m_resource}
+{
+}
+
+std::string cx::GameSession::Execute(const std::string& p_command)
+{
+    std::istringstream stream{p_command};
+
+    std::string name;
+    stream >> name;
+
+    std::vector<std::string> arguments;
+    std::string argument;
+    while(stream >> argument)
+    {
+        arguments.push_back(argument);
+    }
+
+    if(name == "new")
+    {
+        return CreateGame(arguments);
+    }
+
+    if(m_seats.empty())
+    {
+        return MakeError("no game");
+    }
+
+    if(name == "drop")
+    {
+        return DropHumanChip(arguments);
+    }
+
+    if(name == "undo" && arguments.empty())
+    {
+        return Undo();
+    }
+
+    if(name == "redo" && arguments.empty())
+    {
+        return Redo();
+    }
+
+    if(name == "board" && arguments.empty())
+    {
+        return DescribeBoard();
+    }
+
+    if(name == "seed" && arguments.empty())
+    {
+        return DescribeSeed();
+    }
+
+    return MakeError("invalid command '" + p_command + "'");
+}
+
+bool cx::GameSession::IsBotDropNeeded() const
+{
+    return !m_seats.empty() &&
+           !m_isBotDropRequested &&
+           !IsGameOver() &&
+           m_seats[GetActiveSeatIndex()].m_bot;
+}
+
+cx::BotDropRequest cx::GameSession::StartBotDrop()
+{
+    PRECONDITION(IsBotDropNeeded());
+
+    const size_t nbRows = m_model.GetCurrentGridHeight();
+    const size_t nbColumns = m_model.GetCurrentGridWidth();
+
+    cxmodel::BoardSnapshot position{nbRows, nbColumns, m_model.GetCurrentInARowValue(), m_seats.size()};
+    for(size_t column = 0u; column < nbColumns; ++column)
+    {
+        // Chips are stacked from the bottom, so the rest of the column is empty after the
+        // first transparent chip:
+        for(size_t row = 0u; row < nbRows; ++row)
+        {
+            const size_t seatIndex = GetSeatIndex(m_model.GetChip(row, column));
+            if(seatIndex == cxmodel::BoardSnapshot::NO_PLAYER)
+            {
+                break;
+            }
+
+            position.PlaceChip(column, seatIndex);
+        }
+    }
+
+    const size_t activeSeatIndex = GetActiveSeatIndex();
+    position.SetActivePlayerIndex(activeSeatIndex);
+
+    m_isBotDropRequested = true;
+
+    return BotDropRequest{m_seats[activeSeatIndex].m_bot, std::move(position), m_generation};
+}
+
+std::optional<std::string> cx::GameSession::CompleteBotDrop(uint64_t p_generation, size_t p_column)
+{
+    m_isBotDropRequested = false;
+
+    if(p_generation != m_generation || IsGameOver() || !m_seats[GetActiveSeatIndex()].m_bot)
+    {
+        return std::nullopt;
+    }
+
+    IF_CONDITION_NOT_MET_DO(p_column < m_model.GetCurrentGridWidth() && !IsColumnFull(p_column), return std::nullopt;);
+
+    m_model.DropChip(m_model.GetActivePlayer().GetChip(), p_column);
+    ++m_generation;
+
+    return "bot " + std::to_string(p_column + 1u) + " " + GetState();
+}
+
+std::string cx::GameSession::CreateGame(const std::vector<std::string>& p_arguments)
+{
+    if(p_arguments.size() != 3u && p_arguments.size() != 4u)
+    {
+        return MakeError("usage: new WxH K SEAT,SEAT,... [SEED]");
+    }
+
+    const std::vector<std::string> dimensions = Split(p_arguments[0], 'x');
+    const size_t width = dimensions.size() == 2u ? cxstd::ParseInteger(dimensions[0]).value_or(0u) : 0u;
+    const size_t height = dimensions.size() == 2u ? cxstd::ParseInteger(dimensions[1]).value_or(0u) : 0u;
+    if(width < m_model.GetMinimumGridWidth() || width > m_model.GetMaximumGridWidth() ||
+       height < m_model.GetMinimumGridHeight() || height > m_model.GetMaximumGridHeight())
+    {
+        return MakeError("invalid board '" + p_arguments[0] + "'");
+    }
+
+    // The in-a-row value must fit in the board, at least in one direction:
+    const size_t inARowValue = cxstd::ParseInteger(p_arguments[1]).value_or(0u);
+    if(inARowValue < m_model.GetMinimumInARowValue() || inARowValue > m_model.GetMaximumInARowValue() ||
+       inARowValue > std::max(width, height))
+    {
+        return MakeError("invalid in-a-row value '" + p_arguments[1] + "'");
+    }
+
+    const std::vector<std::string> descriptions = Split(p_arguments[2], ',');
+    if(descriptions.size() < m_model.GetMinimumNumberOfPlayers() || descriptions.size() > m_model.GetMaximumNumberOfPlayers())
+    {
+        return MakeError("invalid players '" + p_arguments[2] + "'");
+    }
+
+    const std::optional<std::uint64_t> seed = p_arguments.size() == 4u ? cxstd::ParseInteger<std::uint64_t>(p_arguments[3]) : cxmodel::MakeRandomSeed();
+    if(!seed)
+    {
+        return MakeError("invalid seed '" + p_arguments[3] + "'");
+    }
+
+    std::vector<Seat> seats;
+    for(size_t seatIndex = 0u; seatIndex < descriptions.size(); ++seatIndex)
+    {
+        Seat seat;
+        seat.m_player = cxmodel::CreatePlayer("Player " + std::to_string(seatIndex + 1u), cxmodel::MakePlayerColor(seatIndex), cxmodel::PlayerType::HUMAN);
+
+        if(descriptions[seatIndex] != HUMAN_SEAT)
+        {
+            const std::optional<cxmodel::BotSettings> botSettings = cxmodel::MakeBotSettings(descriptions[seatIndex]);
+            if(!botSettings)
+            {
+                return MakeError("invalid player '" + descriptions[seatIndex] + "'");
+            }
+
+            // The model does not know the seat is a bot, so the seat draws from the player's
+            // stream itself:
+            seat.m_bot = cxmodel::NextDropColumnComputationStrategyCreate(*botSettings, cxmodel::MakePlayerRandomNumberGenerator(*seed, seatIndex));
+        }
+
+        IF_CONDITION_NOT_MET_DO(seat.m_player, return MakeError("internal error"););
+        seats.push_back(std::move(seat));
+    }
+
+    cxmodel::NewGameInformation gameInformation;
+    gameInformation.m_gridWidth = width;
+    gameInformation.m_gridHeight = height;
+    gameInformation.m_inARowValue = inARowValue;
+    gameInformation.m_seed = *seed;
+    for(const Seat& seat : seats)
+    {
+        gameInformation.m_players.push_back(seat.m_player);
+    }
+
+    if(!m_seats.empty())
+    {
+        m_model.EndCurrentGame();
+    }
+
+    m_model.CreateNewGame(std::move(gameInformation));
+    m_seats = std::move(seats);
+    ++m_generation;
+
+    return "ok " + GetState();
+}
+
+std::string cx::GameSession::DropHumanChip(const std::vector<std::string>& p_arguments)
+{
+    if(p_arguments.size() != 1u)
+    {
+        return MakeError("usage: drop C");
+    }
+
+    if(IsGameOver())
+    {
+        return MakeError("game over");
+    }
+
+    if(m_seats[GetActiveSeatIndex()].m_bot)
+    {
+        return MakeError("not a human turn");
+    }
+
+    const size_t column = cxstd::ParseInteger(p_arguments[0]).value_or(0u);
+    if(column == 0u || column > m_model.GetCurrentGridWidth())
+    {
+        return MakeError("invalid column '" + p_arguments[0] + "'");
+    }
+
+    if(IsColumnFull(column - 1u))
+    {
+        return MakeError("column full");
+    }
+
+    m_model.DropChip(m_model.GetActivePlayer().GetChip(), column - 1u);
+    ++m_generation;
+
+    return "ok " + GetState();
+}
+
+// A finished game can not be undone: the model keeps the winner as the active player, which
+// undoing the last drop would not restore.
+std::string cx::GameSession::Undo()
+{
+    if(IsGameOver())
+    {
+        return MakeError("game over");
+    }
+
+    if(!m_model.CanUndo())
+    {
+        return MakeError("nothing to undo");
+    }
+
+    do
+    {
+        m_model.Undo();
+    }
+    while(m_model.CanUndo() && m_seats[GetActiveSeatIndex()].m_bot);
+
+    ++m_generation;
+
+    return "ok " + GetState();
+}
+
+std::string cx::GameSession::Redo()
+{
+    if(!m_model.CanRedo())
+    {
+        return MakeError("nothing to redo");
+    }
+
+    do
+    {
+        m_model.Redo();
+    }
+    while(m_model.CanRedo() && !IsGameOver() && m_seats[GetActiveSeatIndex()].m_bot);
+
+    ++m_generation;
+
+    return "ok " + GetState();
+}
+
+std::string cx::GameSession::DescribeBoard() const
+{
+    const size_t nbRows = m_model.GetCurrentGridHeight();
+    const size_t nbColumns = m_model.GetCurrentGridWidth();
+
+    std::string rows;
+    rows.reserve(nbRows * (nbColumns + 1u));
+
+    for(size_t row = nbRows; row > 0u; --row)
+    {
+        for(size_t column = 0u; column < nbColumns; ++column)
+        {
+            const size_t seatIndex = GetSeatIndex(m_model.GetChip(row - 1u, column));
+            rows += (seatIndex == cxmodel::BoardSnapshot::NO_PLAYER) ? '.' : PLAYER_SYMBOLS[seatIndex];
+        }
+
+        if(row > 1u)
+        {
+            rows += '/';
+        }
+    }
+
+    return "board " + GetState() + " " + rows;
+}
+
+std::string cx::GameSession::DescribeSeed() const
+{
+    return "seed " + std::to_string(m_model.GetSeed());
+}
+
+bool cx::GameSession::IsGameOver() const
+{
+    return m_model.IsWon() || m_model.IsTie();
+}
+
+bool cx::GameSession::IsColumnFull(size_t p_column) const
+{
+    const size_t topRow = m_model.GetCurrentGridHeight() - 1u;
+
+    return m_model.GetChip(topRow, p_column).GetColor() != cxmodel::MakeTransparent();
+}
+
+size_t cx::GameSession::GetActiveSeatIndex() const
+{
+    const cxmodel::IPlayer& activePlayer = m_model.GetActivePlayer();
+
+    const auto it = std::find_if(m_seats.cbegin(), m_seats.cend(), [&activePlayer](const Seat& p_seat){return p_seat.m_player.get() == &activePlayer;});
+    IF_CONDITION_NOT_MET_DO(it != m_seats.cend(), return 0u;);
+
+    return static_cast<size_t>(std::distance(m_seats.cbegin(), it));
+}
+
+size_t cx::GameSession::GetSeatIndex(const cxmodel::IChip& p_chip) const
+{
+    if(p_chip.GetColor() == cxmodel::MakeTransparent())
+    {
+        return cxmodel::BoardSnapshot::NO_PLAYER;
+    }
+
+    for(size_t seatIndex = 0u; seatIndex < m_seats.size(); ++seatIndex)
+    {
+        if(m_seats[seatIndex].m_player->GetChip() == p_chip)
+        {
+            return seatIndex;
+        }
+    }
+
+    return cxmodel::BoardSnapshot::NO_PLAYER;
+}
+
+std::string cx::GameSession::GetState() const
+{
+    const std::string player = std::to_string(GetActiveSeatIndex() + 1u);
+
+    if(m_model.IsWon())
+    {
+        return "won " + player;
+    }
+
+    return m_model.IsTie() ? "tie" : "play " + player;
+}
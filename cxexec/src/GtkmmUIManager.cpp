@@ -29,6 +29,7 @@
 #include <cxexec/ModelReferences.h>
 
 cx::GtkmmUIManager::GtkmmUIManager(int argc, char *argv[], cx::ModelReferences& p_model)
+: m_model{p_model.m_asSubject}
 {
     PRECONDITION(argc > 0);
     PRECONDITION(argv);
@@ -50,14 +51,30 @@ cx::GtkmmUIManager::GtkmmUIManager(int argc, char *argv[], cx::ModelReferences&
         m_mainWindow = std::move(mainWindow);
     }
 
-    p_model.m_asSubject.Attach(m_presenter.get());
+    // Analysis results are not displayed yet, so the main window does not need to hear about them:
+    m_presenterSubscription = m_model.Attach(m_presenter.get(), cxmodel::ModelSubject::ContextSet::All().Without(cxmodel::ModelNotificationContext::ANALYSIS_UPDATED));
     m_presenter->Attach(m_mainWindow.get());
 
+    // Analysis results are computed on a worker thread. The dispatcher brings them back to the
+    // GUI thread, where observers are notified:
+    m_analysisDispatcher = std::make_shared<Glib::Dispatcher>();
+    cxmodel::IConnectXAnalysis& analysis = p_model.m_asAnalysis;
+    m_analysisDispatcher->connect([&analysis](){analysis.ProcessAnalysisUpdate();});
+    analysis.SetAnalysisUpdatedCallback([dispatcher = m_analysisDispatcher](){dispatcher->emit();});
+
     POSTCONDITION(m_mainWindow);
 
     CheckInvariants();
 }
 
+cx::GtkmmUIManager::~GtkmmUIManager()
+{
+    if(m_presenterSubscription.IsAttached())
+    {
+        m_model.Detatch(m_presenterSubscription);
+    }
+}
+
 int cx::GtkmmUIManager::Manage()
 {
     CheckInvariants();
@@ -82,4 +99,5 @@ void cx::GtkmmUIManager::CheckInvariants()
     INVARIANT(m_controller);
     INVARIANT(m_presenter);
     INVARIANT(m_mainWindow);
+    INVARIANT(m_analysisDispatcher);
 }
@@ -86,6 +86,7 @@ cx::ModelReferences ApplicationTestFixture::GetModelReferences()
         *m_model,
         *m_model,
         *m_model,
+        *m_model,
         *m_model
     }; 
 
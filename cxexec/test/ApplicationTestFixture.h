@@ -28,6 +28,7 @@
 
 #include <cxunit/StdStreamRedirector.h>
 
+#include <cxmodel/IConnectXAnalysis.h>
 #include <cxmodel/IConnectXGameActions.h>
 #include <cxmodel/IConnectXGameInformation.h>
 #include <cxmodel/IConnectXLimits.h>
@@ -75,7 +76,8 @@ private:
                                  public cxmodel::IConnectXLimits,
                                  public cxmodel::IUndoRedo,
                                  public cxmodel::IVersioning,
-                                 public cxmodel::IConnectXAI
+                                 public cxmodel::IConnectXAI,
+                                 public cxmodel::IConnectXAnalysis
     {
 
     public:
@@ -92,6 +94,7 @@ private:
         size_t GetCurrentGridHeight() const override {return 6u;}
         size_t GetCurrentGridWidth() const override {return 7u;}
         size_t GetCurrentInARowValue() const override {return 4u;}
+        std::uint64_t GetSeed() const override {return 0u;}
         const cxmodel::IPlayer& GetActivePlayer() const override {return *m_ACTIVE_PLAYER;}
         const cxmodel::IPlayer& GetNextPlayer() const override {return *m_NEXT_PLAYER;}
         const cxmodel::IChip& GetChip(size_t p_row, size_t p_column) const override;
@@ -121,6 +124,16 @@ private:
         // IConnectXAI:
         void ComputeNextDropColumn(cxmodel::DropColumnComputation /*p_algorithm*/) override {}
         [[nodiscard]] size_t GetCurrentBotTarget() const override {return 5u;};
+        [[nodiscard]] cxmodel::SearchStatistics GetLastSearchStatistics() const override {return {};}
+        [[nodiscard]] cxmodel::SearchStatistics GetGameSearchStatistics() const override {return {};}
+
+        // IConnectXAnalysis:
+        void StartAnalysis() override {}
+        void StopAnalysis() override {}
+        [[nodiscard]] bool IsAnalysisEnabled() const override {return false;}
+        [[nodiscard]] cxmodel::SearchResult GetAnalysis() const override {return {};}
+        void SetAnalysisUpdatedCallback(AnalysisUpdatedCallback /*p_onAnalysisUpdated*/) override {}
+        bool ProcessAnalysisUpdate() override {return false;}
 
 
     private:
@@ -0,0 +1,139 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file BatchAnalyzerTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <memory>
+#include <regex>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <cxmodel/CommandStack.h>
+#include <cxmodel/Model.h>
+#include <cxexec/BatchAnalyzer.h>
+
+#include "LoggerMock.h"
+
+namespace
+{
+
+class BatchAnalyzerTestFixture : public ::testing::Test
+{
+
+public:
+
+    BatchAnalyzerTestFixture()
+    : m_model{std::make_unique<cxmodel::CommandStack>(200), m_logger}
+    {
+    }
+
+    // Analyzes the input and returns the results:
+    std::string Analyze(const std::string& p_input, size_t p_nbWorkers, size_t& p_nbInvalidPositions)
+    {
+        cx::BatchAnalysisSettings settings;
+        settings.m_nbWorkers = p_nbWorkers;
+        settings.m_limits.m_maxDepth = 4u;
+        settings.m_hashSizeInMB = 1u;
+
+        std::istringstream input{p_input};
+        std::ostringstream output;
+
+        cx::BatchAnalyzer analyzer{settings, m_model};
+        p_nbInvalidPositions = analyzer.Run(input, output);
+
+        return output.str();
+    }
+
+private:
+
+    LoggerMock m_logger;
+    cxmodel::Model m_model;
+
+};
+
+} // namespace
+
+TEST_F(BatchAnalyzerTestFixture, /*DISABLED_*/Run_ValidPositions_ResultsWrittenInInputOrder)
+{
+    const std::string input = "moves 1 2 1 2 1 2\n"
+                              "\n"
+                              "# Comments are skipped.\n"
+                              "moves 2 1 2 1 2 1 3\n"
+                              "board 9x7 inarow 5 players 3 moves 9 9 9\n"
+                              "moves 1 2 1 2 1 2 1\n";
+
+    size_t nbInvalidPositions = 0u;
+    const std::string output = Analyze(input, 3u, nbInvalidPositions);
+
+    const std::regex expected{"bestmove 1 score win 1 depth 4\n"
+                              "bestmove 1 score win 1 depth 4\n"
+                              "bestmove [1-9] score \\S+ -?\\d+ depth 4\n"
+                              "bestmove none\n"};
+
+    ASSERT_TRUE(std::regex_match(output, expected));
+    ASSERT_EQ(nbInvalidPositions, 0u);
+}
+
+TEST_F(BatchAnalyzerTestFixture, /*DISABLED_*/Run_InvalidPositions_ErrorsWrittenInPlace)
+{
+    const std::string input = "board 5x4 moves 1\n"
+                              "moves 8\n"
+                              "moves 1 2 1 2 1 2\n"
+                              "inarow\n";
+
+    size_t nbInvalidPositions = 0u;
+    const std::string output = Analyze(input, 2u, nbInvalidPositions);
+
+    const std::string expected = "error invalid board parameters 'board 5x4 moves 1'\n"
+                                 "error invalid moves 'moves 8'\n"
+                                 "bestmove 1 score win 1 depth 4\n"
+                                 "error invalid board parameters 'inarow'\n";
+
+    ASSERT_EQ(output, expected);
+    ASSERT_EQ(nbInvalidPositions, 3u);
+}
+
+TEST_F(BatchAnalyzerTestFixture, /*DISABLED_*/Run_MorePositionsThanBufferSlots_AllWrittenInOrder)
+{
+    // The first player wins right away in the column it has three chips in, which changes
+    // from one line to the next:
+    std::ostringstream input;
+    std::ostringstream expected;
+    for(size_t line = 0u; line < 100u; ++line)
+    {
+        const size_t column = 1u + line % 6u;
+        input << "moves " << column << " " << column + 1u << " " << column << " " << column + 1u << " " << column << " " << column + 1u << "\n";
+        expected << "bestmove " << column << " score win 1 depth 4\n";
+    }
+
+    size_t nbInvalidPositions = 0u;
+    ASSERT_EQ(Analyze(input.str(), 4u, nbInvalidPositions), expected.str());
+    ASSERT_EQ(nbInvalidPositions, 0u);
+}
+
+TEST_F(BatchAnalyzerTestFixture, /*DISABLED_*/Run_EmptyInput_NothingWritten)
+{
+    size_t nbInvalidPositions = 0u;
+    ASSERT_EQ(Analyze("", 2u, nbInvalidPositions), std::string());
+    ASSERT_EQ(nbInvalidPositions, 0u);
+}
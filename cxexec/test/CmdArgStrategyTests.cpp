@@ -23,6 +23,7 @@
 
 #include <memory>
 #include <regex>
+#include <sstream>
 
 #include <gtest/gtest.h>
 
@@ -30,11 +31,16 @@
 #include <cxlog/ISO8601TimestampFormatter.h>
 #include <cxlog/CSVMessageFormatter.h>
 #include <cxlog/StdLogTarget.h>
+#include <cxmodel/CommandStack.h>
+#include <cxmodel/Model.h>
+#include <cxexec/CmdArgEngineStrategy.h>
 #include <cxexec/CmdArgHelpStrategy.h>
 #include <cxexec/CmdArgInvalidStrategy.h>
 #include <cxexec/CmdArgNoStrategy.h>
+#include <cxexec/CmdArgPerftStrategy.h>
 #include <cxexec/CmdArgVerboseStrategy.h>
 #include <cxexec/CmdArgVersionStrategy.h>
+#include <cxexec/CmdArgWorkflowFactory.h>
 
 #include "ApplicationTestFixture.h"
 
@@ -81,6 +87,15 @@ TEST_F(ApplicationTestFixtureBothStreamsRedirector, Handle_HelpStrategy_HelpStri
                                                "Possible arguments:\n"
                                                "--help        display this help and exit\n"
                                                "--version     output version information and exit\n"
+                                               "--perft N     count drop sequences up to depth N on the classic board and exit\n"
+                                               "--engine      read engine protocol commands from the standard input, without the interface\n"
+                                               "--analyze F   analyze each position of file F ('-' for the standard input) and exit.\n"
+                                               "              Options: --workers N, --depth D, --nodes N, --movetime MS\n"
+                                               "--server A    host headless games on address A ('unix:PATH' or 'tcp:PORT'), until interrupted.\n"
+                                               "              Options: --workers N\n"
+                                               "--selfplay N  play N bot games without the interface, print statistics and exit.\n"
+                                               "              Options: --board WxH, --inarow K, --seed S, --players BOT,BOT,... where BOT is\n"
+                                               "              'random' or 'alphabeta', optionally followed by ':Nms' or ':Nnodes'\n"
                                                "\n"
                                                "Exit status:\n"
                                                " 0 if OK,\n"
@@ -180,3 +195,296 @@ TEST_F(ApplicationTestFixtureBothStreamsRedirector, Handle_InvalidArgStrategy_Er
     ASSERT_EQ(expectedStdOutContents, stdOutContents);
     ASSERT_EQ(expectedStdErrContents, stdErrContents);
 }
+
+TEST_F(ApplicationTestFixtureBothStreamsRedirector, Handle_PerftStrategy_CountsPrintedForEachDepth)
+{
+    const std::unique_ptr<cx::ICmdArgWorkflowStrategy> strategy = std::make_unique<cx::CmdArgPerftStrategy>(3u);
+
+    ASSERT_TRUE(strategy);
+    ASSERT_EQ(strategy->Handle(), EXIT_SUCCESS);
+
+    const std::string stdOutContents = GetStdOutContents();
+    const std::string stdErrContents = GetStdErrContents();
+
+    // Speeds are machine dependent, so only counts are checked:
+    const std::regex expectedStdOutContents{"depth +nodes +wins +ties +nps +reference nps +result\\n"
+                                            "1 +7 +0 +0 +\\d+ +\\d+ +OK\\n"
+                                            "2 +49 +0 +0 +\\d+ +\\d+ +OK\\n"
+                                            "3 +343 +0 +0 +\\d+ +\\d+ +OK\\n"};
+
+    ASSERT_TRUE(std::regex_match(stdOutContents, expectedStdOutContents));
+    ASSERT_EQ(std::string(), stdErrContents);
+}
+
+TEST_F(ApplicationTestFixtureBothStreamsRedirector, Create_PerftWithoutDepth_InvalidArgument)
+{
+    const int argc = 2;
+    const char *argv[] = {"connectx", "--perft"};
+
+    auto modelRefs = GetModelReferences();
+    cx::CmdArgWorkflowFactory factory;
+    const auto strategy = factory.Create(argc, (char**)argv, modelRefs, GetLogger());
+    ASSERT_TRUE(strategy);
+
+    ASSERT_EQ(strategy->Handle(), EXIT_FAILURE);
+    ASSERT_EQ(GetStdErrContents(), "Connect X: invalid option '--perft'\n");
+}
+
+TEST_F(ApplicationTestFixtureBothStreamsRedirector, Create_PerftWithInvalidDepth_InvalidArgument)
+{
+    const int argc = 3;
+    const char *argv[] = {"connectx", "--perft", "-2"};
+
+    auto modelRefs = GetModelReferences();
+    cx::CmdArgWorkflowFactory factory;
+    const auto strategy = factory.Create(argc, (char**)argv, modelRefs, GetLogger());
+    ASSERT_TRUE(strategy);
+
+    ASSERT_EQ(strategy->Handle(), EXIT_FAILURE);
+    ASSERT_EQ(GetStdErrContents(), "Connect X: invalid option '-2'\n");
+}
+
+namespace
+{
+
+// Self-play needs a model that actually plays:
+class SelfPlayModel
+{
+
+public:
+
+    explicit SelfPlayModel(cxlog::ILogger& p_logger)
+    : m_model{std::make_unique<cxmodel::CommandStack>(200), p_logger}
+    {
+    }
+
+    cx::ModelReferences GetModelReferences()
+    {
+        return cx::ModelReferences{m_model, m_model, m_model, m_model, m_model, m_model, m_model, m_model};
+    }
+
+private:
+
+    cxmodel::Model m_model;
+
+};
+
+} // namespace
+
+TEST_F(ApplicationTestFixtureBothStreamsRedirector, Handle_SelfPlayStrategy_StatisticsPrinted)
+{
+    const int argc = 5;
+    const char *argv[] = {"connectx", "--selfplay", "3", "--players", "random,random,random"};
+
+    SelfPlayModel model{GetLogger()};
+    auto modelRefs = model.GetModelReferences();
+    cx::CmdArgWorkflowFactory factory;
+    const auto strategy = factory.Create(argc, (char**)argv, modelRefs, GetLogger());
+    ASSERT_TRUE(strategy);
+
+    ASSERT_EQ(strategy->Handle(), EXIT_SUCCESS);
+
+    const std::string stdOutContents = GetStdOutContents();
+    ASSERT_TRUE(stdOutContents.find("Games   : 3 (") != std::string::npos);
+    ASSERT_TRUE(stdOutContents.find("Bot 1   : ") != std::string::npos);
+    ASSERT_TRUE(stdOutContents.find("Bot 3   : ") != std::string::npos);
+    ASSERT_TRUE(stdOutContents.find("Ties    : ") != std::string::npos);
+    ASSERT_EQ(GetStdErrContents(), std::string());
+}
+
+TEST_F(ApplicationTestFixtureBothStreamsRedirector, Handle_SelfPlayStrategyOnCustomBoard_StatisticsPrinted)
+{
+    const int argc = 9;
+    const char *argv[] = {"connectx", "--selfplay", "2", "--board", "8x7", "--inarow", "3", "--players", "random,alphabeta:1000nodes"};
+
+    SelfPlayModel model{GetLogger()};
+    auto modelRefs = model.GetModelReferences();
+    cx::CmdArgWorkflowFactory factory;
+    const auto strategy = factory.Create(argc, (char**)argv, modelRefs, GetLogger());
+    ASSERT_TRUE(strategy);
+
+    ASSERT_EQ(strategy->Handle(), EXIT_SUCCESS);
+
+    const std::string stdOutContents = GetStdOutContents();
+    ASSERT_TRUE(stdOutContents.find("Games   : 2 (") != std::string::npos);
+    ASSERT_TRUE(stdOutContents.find("alphabeta:1000nodes") != std::string::npos);
+    ASSERT_EQ(GetStdErrContents(), std::string());
+}
+
+TEST_F(ApplicationTestFixtureBothStreamsRedirector, Handle_SelfPlayStrategyWithSeed_SeedPrinted)
+{
+    const int argc = 5;
+    const char *argv[] = {"connectx", "--selfplay", "2", "--seed", "18446744073709551615"};
+
+    SelfPlayModel model{GetLogger()};
+    auto modelRefs = model.GetModelReferences();
+    cx::CmdArgWorkflowFactory factory;
+    const auto strategy = factory.Create(argc, (char**)argv, modelRefs, GetLogger());
+    ASSERT_TRUE(strategy);
+
+    ASSERT_EQ(strategy->Handle(), EXIT_SUCCESS);
+    ASSERT_TRUE(GetStdOutContents().find("Seed    : 18446744073709551615\n") != std::string::npos);
+}
+
+TEST_F(ApplicationTestFixtureBothStreamsRedirector, Create_SelfPlayWithoutNbGames_InvalidArgument)
+{
+    const int argc = 2;
+    const char *argv[] = {"connectx", "--selfplay"};
+
+    auto modelRefs = GetModelReferences();
+    cx::CmdArgWorkflowFactory factory;
+    const auto strategy = factory.Create(argc, (char**)argv, modelRefs, GetLogger());
+    ASSERT_TRUE(strategy);
+
+    ASSERT_EQ(strategy->Handle(), EXIT_FAILURE);
+    ASSERT_EQ(GetStdErrContents(), "Connect X: invalid option '--selfplay'\n");
+}
+
+TEST_F(ApplicationTestFixtureBothStreamsRedirector, Create_SelfPlayWithInvalidBoard_InvalidArgument)
+{
+    const int argc = 5;
+    const char *argv[] = {"connectx", "--selfplay", "1", "--board", "7by6"};
+
+    auto modelRefs = GetModelReferences();
+    cx::CmdArgWorkflowFactory factory;
+    const auto strategy = factory.Create(argc, (char**)argv, modelRefs, GetLogger());
+    ASSERT_TRUE(strategy);
+
+    ASSERT_EQ(strategy->Handle(), EXIT_FAILURE);
+    ASSERT_EQ(GetStdErrContents(), "Connect X: invalid option '7by6'\n");
+}
+
+TEST_F(ApplicationTestFixtureBothStreamsRedirector, Create_SelfPlayWithInvalidSeed_InvalidArgument)
+{
+    const int argc = 5;
+    const char *argv[] = {"connectx", "--selfplay", "1", "--seed", "18446744073709551616"};
+
+    auto modelRefs = GetModelReferences();
+    cx::CmdArgWorkflowFactory factory;
+    const auto strategy = factory.Create(argc, (char**)argv, modelRefs, GetLogger());
+    ASSERT_TRUE(strategy);
+
+    ASSERT_EQ(strategy->Handle(), EXIT_FAILURE);
+    ASSERT_EQ(GetStdErrContents(), "Connect X: invalid option '18446744073709551616'\n");
+}
+
+TEST_F(ApplicationTestFixtureBothStreamsRedirector, Create_SelfPlayWithInvalidPlayer_InvalidArgument)
+{
+    const int argc = 5;
+    const char *argv[] = {"connectx", "--selfplay", "1", "--players", "random,alphabeta:10s"};
+
+    auto modelRefs = GetModelReferences();
+    cx::CmdArgWorkflowFactory factory;
+    const auto strategy = factory.Create(argc, (char**)argv, modelRefs, GetLogger());
+    ASSERT_TRUE(strategy);
+
+    ASSERT_EQ(strategy->Handle(), EXIT_FAILURE);
+    ASSERT_EQ(GetStdErrContents(), "Connect X: invalid option 'random,alphabeta:10s'\n");
+}
+
+TEST_F(ApplicationTestFixtureBothStreamsRedirector, Create_SelfPlayWithUnknownOption_InvalidArgument)
+{
+    const int argc = 5;
+    const char *argv[] = {"connectx", "--selfplay", "1", "--colors", "red"};
+
+    auto modelRefs = GetModelReferences();
+    cx::CmdArgWorkflowFactory factory;
+    const auto strategy = factory.Create(argc, (char**)argv, modelRefs, GetLogger());
+    ASSERT_TRUE(strategy);
+
+    ASSERT_EQ(strategy->Handle(), EXIT_FAILURE);
+    ASSERT_EQ(GetStdErrContents(), "Connect X: invalid option '--colors'\n");
+}
+
+TEST_F(ApplicationTestFixtureBothStreamsRedirector, Handle_EngineStrategy_BestMovePrinted)
+{
+    std::istringstream commands{"position startpos moves 1 2 1 2 1 2\n"
+                                "go depth 2\n"};
+
+    SelfPlayModel model{GetLogger()};
+    auto modelRefs = model.GetModelReferences();
+    const std::unique_ptr<cx::ICmdArgWorkflowStrategy> strategy = std::make_unique<cx::CmdArgEngineStrategy>(commands, modelRefs);
+
+    ASSERT_TRUE(strategy);
+    ASSERT_EQ(strategy->Handle(), EXIT_SUCCESS);
+
+    // The search is waited for, since no stop command can come after the end of the input:
+    const std::regex expectedStdOutContents{"info depth 1 seldepth 1 score win 1 nodes \\d+ nps \\d+ time \\d+ pv 1\\n"
+                                            "info depth 2 seldepth 2 score win 1 nodes \\d+ nps \\d+ time \\d+ pv 1\\n"
+                                            "bestmove 1\\n"};
+
+    ASSERT_TRUE(std::regex_match(GetStdOutContents(), expectedStdOutContents));
+    ASSERT_EQ(GetStdErrContents(), std::string());
+}
+
+TEST_F(ApplicationTestFixtureBothStreamsRedirector, Create_EngineWithExtraArgument_InvalidArgument)
+{
+    const int argc = 3;
+    const char *argv[] = {"connectx", "--engine", "--verbose"};
+
+    auto modelRefs = GetModelReferences();
+    cx::CmdArgWorkflowFactory factory;
+    const auto strategy = factory.Create(argc, (char**)argv, modelRefs, GetLogger());
+    ASSERT_TRUE(strategy);
+
+    ASSERT_EQ(strategy->Handle(), EXIT_FAILURE);
+    ASSERT_EQ(GetStdErrContents(), "Connect X: invalid option '--verbose'\n");
+}
+
+TEST_F(ApplicationTestFixtureBothStreamsRedirector, Handle_AnalyzeStrategyWithMissingFile_ErrorPrinted)
+{
+    const int argc = 5;
+    const char *argv[] = {"connectx", "--analyze", "/no/such/positions.txt", "--workers", "2"};
+
+    auto modelRefs = GetModelReferences();
+    cx::CmdArgWorkflowFactory factory;
+    const auto strategy = factory.Create(argc, (char**)argv, modelRefs, GetLogger());
+    ASSERT_TRUE(strategy);
+
+    ASSERT_EQ(strategy->Handle(), EXIT_FAILURE);
+    ASSERT_EQ(GetStdOutContents(), std::string());
+    ASSERT_EQ(GetStdErrContents(), "Connect X: cannot read '/no/such/positions.txt'\n");
+}
+
+TEST_F(ApplicationTestFixtureBothStreamsRedirector, Create_AnalyzeWithInvalidLimit_InvalidArgument)
+{
+    const int argc = 5;
+    const char *argv[] = {"connectx", "--analyze", "-", "--depth", "0"};
+
+    auto modelRefs = GetModelReferences();
+    cx::CmdArgWorkflowFactory factory;
+    const auto strategy = factory.Create(argc, (char**)argv, modelRefs, GetLogger());
+    ASSERT_TRUE(strategy);
+
+    ASSERT_EQ(strategy->Handle(), EXIT_FAILURE);
+    ASSERT_EQ(GetStdErrContents(), "Connect X: invalid option '0'\n");
+}
+
+TEST_F(ApplicationTestFixtureBothStreamsRedirector, Handle_ServerStrategyWithInvalidAddress_ErrorPrinted)
+{
+    const int argc = 5;
+    const char *argv[] = {"connectx", "--server", "udp:4000", "--workers", "2"};
+
+    auto modelRefs = GetModelReferences();
+    cx::CmdArgWorkflowFactory factory;
+    const auto strategy = factory.Create(argc, (char**)argv, modelRefs, GetLogger());
+    ASSERT_TRUE(strategy);
+
+    ASSERT_EQ(strategy->Handle(), EXIT_FAILURE);
+    ASSERT_EQ(GetStdOutContents(), std::string());
+    ASSERT_EQ(GetStdErrContents(), "Connect X: cannot listen on 'udp:4000': Invalid address 'udp:4000'.\n");
+}
+
+TEST_F(ApplicationTestFixtureBothStreamsRedirector, Create_ServerWithUnknownOption_InvalidArgument)
+{
+    const int argc = 5;
+    const char *argv[] = {"connectx", "--server", "tcp:4000", "--depth", "2"};
+
+    auto modelRefs = GetModelReferences();
+    cx::CmdArgWorkflowFactory factory;
+    const auto strategy = factory.Create(argc, (char**)argv, modelRefs, GetLogger());
+    ASSERT_TRUE(strategy);
+
+    ASSERT_EQ(strategy->Handle(), EXIT_FAILURE);
+    ASSERT_EQ(GetStdErrContents(), "Connect X: invalid option '--depth'\n");
+}
@@ -0,0 +1,186 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file EngineProtocolTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <memory>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <cxmodel/CommandStack.h>
+#include <cxmodel/Model.h>
+#include <cxmodel/Search.h>
+#include <cxexec/EngineProtocol.h>
+
+#include "LoggerMock.h"
+
+namespace
+{
+
+// Runs commands in a new session, and returns everything it wrote once over:
+std::string RunSession(const std::vector<std::string>& p_commands)
+{
+    LoggerMock logger;
+    cxmodel::Model model{std::make_unique<cxmodel::CommandStack>(200), logger};
+
+    std::ostringstream output;
+    {
+        cx::EngineProtocol protocol{output, model, model};
+        for(const std::string& command : p_commands)
+        {
+            if(!protocol.Execute(command))
+            {
+                break;
+            }
+        }
+
+        protocol.WaitForSearch();
+    }
+
+    return output.str();
+}
+
+} // namespace
+
+TEST(EngineProtocol, /*DISABLED_*/Execute_Handshake_EngineIdentified)
+{
+    const std::string output = RunSession({"cxp", "isready"});
+
+    ASSERT_TRUE(std::regex_match(output, std::regex{"id name Connect X v\\S+\ncxpok\nreadyok\n"}));
+}
+
+TEST(EngineProtocol, /*DISABLED_*/Execute_GoWithDepth_InfoForEachIterationThenBestMove)
+{
+    const std::string output = RunSession({"position startpos moves 4 4", "go depth 3"});
+
+    const std::regex expected{"info depth 1 seldepth 1 score value -?\\d+ nodes \\d+ nps \\d+ time \\d+ pv \\d\n"
+                              "info depth 2 seldepth 2 score value -?\\d+ nodes \\d+ nps \\d+ time \\d+ pv \\d \\d\n"
+                              "info depth 3 seldepth 3 score value -?\\d+ nodes \\d+ nps \\d+ time \\d+ pv \\d \\d \\d\n"
+                              "bestmove \\d\n"};
+
+    ASSERT_TRUE(std::regex_match(output, expected));
+}
+
+TEST(EngineProtocol, /*DISABLED_*/Execute_ForcedWin_WinScoreReported)
+{
+    // The first player makes an open three on the bottom row, and wins on its next drop:
+    const std::string output = RunSession({"position startpos moves 3 3 4 4", "go depth 4"});
+
+    ASSERT_NE(output.find("info depth 4 seldepth"), std::string::npos);
+    ASSERT_NE(output.find("score win 3"), std::string::npos);
+}
+
+TEST(EngineProtocol, /*DISABLED_*/Execute_GoWithNodeBudget_BestMoveReported)
+{
+    const std::string output = RunSession({"go nodes 1000"});
+
+    ASSERT_TRUE(std::regex_search(output, std::regex{"\nbestmove [1-7]\n$"}));
+}
+
+TEST(EngineProtocol, /*DISABLED_*/Execute_GoInfiniteThenStop_BestMoveReported)
+{
+    const std::string output = RunSession({"go infinite", "stop", "isready"});
+
+    ASSERT_TRUE(std::regex_search(output, std::regex{"bestmove [1-7]\n"}));
+    ASSERT_NE(output.find("readyok\n"), std::string::npos);
+}
+
+TEST(EngineProtocol, /*DISABLED_*/Execute_CustomBoard_PositionPlayedOnIt)
+{
+    const std::string output = RunSession({"board 9x7", "inarow 5", "players 3", "position startpos moves 9 9 9", "go depth 1"});
+
+    ASSERT_TRUE(std::regex_search(output, std::regex{"info depth 1 .* pv [1-9]\nbestmove [1-9]\n$"}));
+}
+
+TEST(EngineProtocol, /*DISABLED_*/Execute_GameOver_NoBestMove)
+{
+    const std::string output = RunSession({"position startpos moves 1 2 1 2 1 2 1", "go depth 1"});
+
+    ASSERT_EQ(output, "bestmove none\n");
+}
+
+TEST(EngineProtocol, /*DISABLED_*/Execute_InvalidCommands_ErrorsReportedAndIgnored)
+{
+    const std::string output = RunSession({"board 5x4",
+                                    "inarow 9",
+                                    "position startpos moves 8",
+                                    "position startpos moves 1 2 1 2 1 2 1 2",
+                                    "go depth",
+                                    "fly",
+                                    "go depth 1"});
+
+    const std::regex expected{"info string invalid board parameters 'board 5x4'\n"
+                              "info string invalid board parameters 'inarow 9'\n"
+                              "info string invalid moves for a 7x6 board\n"
+                              "info string invalid moves for a 7x6 board\n"
+                              "info string invalid go option 'depth'\n"
+                              "info string unknown command 'fly'\n"
+                              "info depth 1 .*\n"
+                              "bestmove 4\n"};
+
+    ASSERT_TRUE(std::regex_match(output, expected));
+}
+
+TEST(EngineProtocol, /*DISABLED_*/Execute_Quit_SessionEnded)
+{
+    LoggerMock logger;
+    cxmodel::Model model{std::make_unique<cxmodel::CommandStack>(200), logger};
+
+    std::ostringstream output;
+    cx::EngineProtocol protocol{output, model, model};
+
+    ASSERT_TRUE(protocol.Execute("isready"));
+    ASSERT_TRUE(protocol.Execute(""));
+    ASSERT_FALSE(protocol.Execute("quit"));
+}
+
+TEST(EnginePosition, /*DISABLED_*/MakeEnginePosition_ValidMoves_PositionPlayed)
+{
+    const std::optional<cx::EnginePosition> position = cx::MakeEnginePosition(cx::BoardParameters{}, {"4", "4", "7"});
+
+    ASSERT_TRUE(position);
+    ASSERT_FALSE(position->m_isWon);
+    ASSERT_EQ(position->m_snapshot.GetNbDrops(), 3u);
+    ASSERT_EQ(position->m_snapshot.GetPlayerIndex(1u, 3u), 1u);
+    ASSERT_EQ(position->m_snapshot.GetPlayerIndex(0u, 6u), 0u);
+    ASSERT_EQ(position->m_snapshot.GetActivePlayerIndex(), 1u);
+}
+
+TEST(EnginePosition, /*DISABLED_*/MakeEnginePosition_InvalidMoves_NoPosition)
+{
+    const cx::BoardParameters parameters;
+
+    ASSERT_FALSE(cx::MakeEnginePosition(parameters, {"0"}));
+    ASSERT_FALSE(cx::MakeEnginePosition(parameters, {"8"}));
+    ASSERT_FALSE(cx::MakeEnginePosition(parameters, {"d"}));
+    ASSERT_FALSE(cx::MakeEnginePosition(parameters, {"1", "1", "1", "1", "1", "1", "1"}));
+}
+
+TEST(EnginePosition, /*DISABLED_*/FormatScore_ForcedAndHeuristicScores_Formatted)
+{
+    ASSERT_EQ(cx::FormatScore(cxmodel::WIN_SCORE - 1, 42u), "win 1");
+    ASSERT_EQ(cx::FormatScore(-(cxmodel::WIN_SCORE - 4), 42u), "loss 4");
+    ASSERT_EQ(cx::FormatScore(-12, 42u), "value -12");
+}
@@ -0,0 +1,208 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file GameServerTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include <cxexec/GameServer.h>
+
+#include "LoggerMock.h"
+
+namespace
+{
+
+// A blocking client, reading the server answers line by line:
+class Client final
+{
+
+public:
+
+    explicit Client(int p_fd)
+    : m_fd{p_fd}
+    {
+    }
+
+    ~Client()
+    {
+        if(m_fd >= 0)
+        {
+            ::close(m_fd);
+        }
+    }
+
+    [[nodiscard]] bool IsConnected() const {return m_fd >= 0;}
+
+    void Send(const std::string& p_lines)
+    {
+        ASSERT_EQ(::send(m_fd, p_lines.data(), p_lines.size(), MSG_NOSIGNAL), static_cast<ssize_t>(p_lines.size()));
+    }
+
+    // Returns an empty string once the server closed the connection:
+    std::string ReadLine()
+    {
+        size_t end = m_input.find('\n');
+        while(end == std::string::npos)
+        {
+            char buffer[256];
+            const ssize_t size = ::recv(m_fd, buffer, sizeof(buffer), 0);
+            if(size <= 0)
+            {
+                return {};
+            }
+
+            m_input.append(buffer, static_cast<size_t>(size));
+            end = m_input.find('\n');
+        }
+
+        const std::string line = m_input.substr(0u, end);
+        m_input.erase(0u, end + 1u);
+
+        return line;
+    }
+
+private:
+
+    int m_fd;
+    std::string m_input;
+
+};
+
+int ConnectUnix(const std::string& p_path)
+{
+    const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, p_path.c_str(), sizeof(address.sun_path) - 1u);
+
+    if(fd < 0 || ::connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+    {
+        return -1;
+    }
+
+    return fd;
+}
+
+int ConnectTcp(uint16_t p_port)
+{
+    const int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(p_port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    if(fd < 0 || ::connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+    {
+        return -1;
+    }
+
+    return fd;
+}
+
+} // namespace
+
+TEST(GameServer, /*DISABLED_*/Listen_InvalidAddress_ErrorReturned)
+{
+    LoggerMock logger;
+    cx::GameServer server{1u, logger};
+
+    ASSERT_FALSE(server.Listen("udp:4000").IsSuccess());
+    ASSERT_FALSE(server.Listen("tcp:65536").IsSuccess());
+    ASSERT_FALSE(server.Listen("unix:").IsSuccess());
+}
+
+TEST(GameServer, /*DISABLED_*/Run_UnixSocketClient_BotDropSent)
+{
+    const std::string path = "/tmp/connectx-server-test-" + std::to_string(::getpid()) + ".sock";
+
+    LoggerMock logger;
+    cx::GameServer server{2u, logger};
+    ASSERT_TRUE(server.Listen("unix:" + path).IsSuccess());
+    ASSERT_EQ(server.GetPort(), 0u);
+
+    std::thread loop{[&server](){server.Run();}};
+
+    {
+        Client client{ConnectUnix(path)};
+        ASSERT_TRUE(client.IsConnected());
+
+        client.Send("board\nnew 7x6 4 human,random\ndrop 4\n");
+        ASSERT_EQ(client.ReadLine(), "error no game");
+        ASSERT_EQ(client.ReadLine(), "ok play 1");
+        ASSERT_EQ(client.ReadLine(), "ok play 2");
+
+        const std::string botDrop = client.ReadLine();
+        ASSERT_EQ(botDrop.substr(0u, 4u), "bot ");
+        ASSERT_EQ(botDrop.substr(botDrop.size() - 7u), " play 1");
+
+        client.Send("quit\n");
+        ASSERT_EQ(client.ReadLine(), std::string());
+    }
+
+    server.Stop();
+    loop.join();
+
+    ASSERT_EQ(server.GetNbConnections(), 0u);
+}
+
+TEST(GameServer, /*DISABLED_*/Run_ManyTcpClients_SessionsIndependent)
+{
+    LoggerMock logger;
+    cx::GameServer server{1u, logger};
+    ASSERT_TRUE(server.Listen("tcp:0").IsSuccess());
+    ASSERT_NE(server.GetPort(), 0u);
+
+    std::thread loop{[&server](){server.Run();}};
+
+    {
+        Client first{ConnectTcp(server.GetPort())};
+        Client second{ConnectTcp(server.GetPort())};
+        ASSERT_TRUE(first.IsConnected());
+        ASSERT_TRUE(second.IsConnected());
+
+        first.Send("new 7x6 4 human,human\ndrop 1\n");
+        second.Send("new 8x7 5 human,human,human\ndrop 8\ndrop 8\n");
+
+        ASSERT_EQ(first.ReadLine(), "ok play 1");
+        ASSERT_EQ(first.ReadLine(), "ok play 2");
+        ASSERT_EQ(second.ReadLine(), "ok play 1");
+        ASSERT_EQ(second.ReadLine(), "ok play 2");
+        ASSERT_EQ(second.ReadLine(), "ok play 3");
+
+        first.Send("board\n");
+        ASSERT_EQ(first.ReadLine(), "board play 2 ......./......./......./......./......./1......");
+    }
+
+    server.Stop();
+    loop.join();
+}
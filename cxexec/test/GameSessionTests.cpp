@@ -0,0 +1,201 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file GameSessionTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <cxexec/GameSession.h>
+
+#include "LoggerMock.h"
+
+namespace
+{
+
+class GameSessionTestFixture : public ::testing::Test
+{
+
+public:
+
+    GameSessionTestFixture()
+    : m_session{m_logger}
+    {
+    }
+
+    cx::GameSession& GetSession()
+    {
+        return m_session;
+    }
+
+private:
+
+    LoggerMock m_logger;
+    cx::GameSession m_session;
+
+};
+
+} // namespace
+
+TEST_F(GameSessionTestFixture, /*DISABLED_*/Execute_NoGame_ErrorReturned)
+{
+    ASSERT_EQ(GetSession().Execute("drop 1"), "error no game");
+    ASSERT_EQ(GetSession().Execute("board"), "error no game");
+    ASSERT_FALSE(GetSession().IsBotDropNeeded());
+}
+
+TEST_F(GameSessionTestFixture, /*DISABLED_*/Execute_InvalidNewGame_ErrorReturned)
+{
+    ASSERT_EQ(GetSession().Execute("new 7x6 4"), "error usage: new WxH K SEAT,SEAT,... [SEED]");
+    ASSERT_EQ(GetSession().Execute("new 3x3 4 human,human"), "error invalid board '3x3'");
+    ASSERT_EQ(GetSession().Execute("new 7x6 9 human,human"), "error invalid in-a-row value '9'");
+    ASSERT_EQ(GetSession().Execute("new 7x6 4 human"), "error invalid players 'human'");
+    ASSERT_EQ(GetSession().Execute("new 7x6 4 human,minimax"), "error invalid player 'minimax'");
+    ASSERT_EQ(GetSession().Execute("new 7x6 4 human,human -1"), "error invalid seed '-1'");
+    ASSERT_EQ(GetSession().Execute("new 7x6 4 human,human 18446744073709551616"), "error invalid seed '18446744073709551616'");
+    ASSERT_EQ(GetSession().Execute("drop 1"), "error no game");
+}
+
+TEST_F(GameSessionTestFixture, /*DISABLED_*/Execute_HumanDrops_BoardUpdated)
+{
+    ASSERT_EQ(GetSession().Execute("new 7x6 4 human,human"), "ok play 1");
+    ASSERT_EQ(GetSession().Execute("drop 1"), "ok play 2");
+    ASSERT_EQ(GetSession().Execute("drop 2"), "ok play 1");
+    ASSERT_EQ(GetSession().Execute("drop 1"), "ok play 2");
+
+    ASSERT_EQ(GetSession().Execute("board"), "board play 2 ......./......./......./......./1....../12.....");
+    ASSERT_FALSE(GetSession().IsBotDropNeeded());
+}
+
+TEST_F(GameSessionTestFixture, /*DISABLED_*/Execute_InvalidDrops_ErrorReturned)
+{
+    ASSERT_EQ(GetSession().Execute("new 7x6 4 human,human"), "ok play 1");
+    ASSERT_EQ(GetSession().Execute("drop 0"), "error invalid column '0'");
+    ASSERT_EQ(GetSession().Execute("drop 8"), "error invalid column '8'");
+    ASSERT_EQ(GetSession().Execute("drop"), "error usage: drop C");
+
+    for(size_t row = 0u; row < 6u; ++row)
+    {
+        ASSERT_EQ(GetSession().Execute("drop 3"), row % 2u == 0u ? "ok play 2" : "ok play 1");
+    }
+    ASSERT_EQ(GetSession().Execute("drop 3"), "error column full");
+    ASSERT_EQ(GetSession().Execute("jump 3"), "error invalid command 'jump 3'");
+}
+
+TEST_F(GameSessionTestFixture, /*DISABLED_*/Execute_WinningDrop_GameOver)
+{
+    ASSERT_EQ(GetSession().Execute("new 7x6 4 human,human"), "ok play 1");
+    for(const char* column : {"1", "2", "1", "2", "1", "2"})
+    {
+        ASSERT_TRUE(GetSession().Execute(std::string{"drop "} + column).rfind("ok play", 0u) == 0u);
+    }
+
+    ASSERT_EQ(GetSession().Execute("drop 1"), "ok won 1");
+    ASSERT_EQ(GetSession().Execute("drop 3"), "error game over");
+    ASSERT_EQ(GetSession().Execute("undo"), "error game over");
+
+    // A new game can still be created:
+    ASSERT_EQ(GetSession().Execute("new 8x7 5 human,human,human"), "ok play 1");
+}
+
+TEST_F(GameSessionTestFixture, /*DISABLED_*/CompleteBotDrop_BotTurn_ChipDropped)
+{
+    ASSERT_EQ(GetSession().Execute("new 7x6 4 human,random"), "ok play 1");
+    ASSERT_FALSE(GetSession().IsBotDropNeeded());
+
+    ASSERT_EQ(GetSession().Execute("drop 4"), "ok play 2");
+    ASSERT_EQ(GetSession().Execute("drop 5"), "error not a human turn");
+    ASSERT_TRUE(GetSession().IsBotDropNeeded());
+
+    const cx::BotDropRequest request = GetSession().StartBotDrop();
+    ASSERT_TRUE(request.m_strategy);
+    ASSERT_EQ(request.m_position.GetNbDrops(), 1u);
+    ASSERT_EQ(request.m_position.GetPlayerIndex(0u, 3u), 0u);
+    ASSERT_EQ(request.m_position.GetActivePlayerIndex(), 1u);
+
+    // Only one drop is requested at a time:
+    ASSERT_FALSE(GetSession().IsBotDropNeeded());
+
+    ASSERT_EQ(GetSession().CompleteBotDrop(request.m_generation, 0u), std::optional<std::string>{"bot 1 play 1"});
+    ASSERT_FALSE(GetSession().IsBotDropNeeded());
+    ASSERT_EQ(GetSession().Execute("board"), "board play 1 ......./......./......./......./......./2..1...");
+}
+
+TEST_F(GameSessionTestFixture, /*DISABLED_*/Execute_NewGameWithSeed_SeedReturned)
+{
+    ASSERT_EQ(GetSession().Execute("new 7x6 4 human,random 18446744073709551615"), "ok play 1");
+    ASSERT_EQ(GetSession().Execute("seed"), "seed 18446744073709551615");
+}
+
+TEST_F(GameSessionTestFixture, /*DISABLED_*/StartBotDrop_SameSeed_SameBotDrops)
+{
+    const auto playBot = [this]()
+    {
+        std::vector<size_t> drops;
+
+        EXPECT_EQ(GetSession().Execute("new 7x6 4 random,random 42"), "ok play 1");
+        while(GetSession().IsBotDropNeeded())
+        {
+            cx::BotDropRequest request = GetSession().StartBotDrop();
+            drops.push_back(request.m_strategy->Compute(request.m_position));
+            EXPECT_TRUE(GetSession().CompleteBotDrop(request.m_generation, drops.back()));
+        }
+
+        return drops;
+    };
+
+    ASSERT_EQ(playBot(), playBot());
+}
+
+TEST_F(GameSessionTestFixture, /*DISABLED_*/CompleteBotDrop_GameChangedSinceRequest_DropIgnored)
+{
+    ASSERT_EQ(GetSession().Execute("new 7x6 4 human,random"), "ok play 1");
+    ASSERT_EQ(GetSession().Execute("drop 4"), "ok play 2");
+
+    const cx::BotDropRequest request = GetSession().StartBotDrop();
+    ASSERT_EQ(GetSession().Execute("undo"), "ok play 1");
+
+    ASSERT_EQ(GetSession().CompleteBotDrop(request.m_generation, 0u), std::nullopt);
+    ASSERT_EQ(GetSession().Execute("board"), "board play 1 ......./......./......./......./......./.......");
+}
+
+TEST_F(GameSessionTestFixture, /*DISABLED_*/Execute_UndoRedoWithBot_BackToHumanTurn)
+{
+    ASSERT_EQ(GetSession().Execute("new 7x6 4 human,random"), "ok play 1");
+    ASSERT_EQ(GetSession().Execute("undo"), "error nothing to undo");
+
+    ASSERT_EQ(GetSession().Execute("drop 4"), "ok play 2");
+    const cx::BotDropRequest request = GetSession().StartBotDrop();
+    ASSERT_EQ(GetSession().CompleteBotDrop(request.m_generation, 6u), std::optional<std::string>{"bot 7 play 1"});
+
+    // The bot drop and the human drop are undone together:
+    ASSERT_EQ(GetSession().Execute("undo"), "ok play 1");
+    ASSERT_EQ(GetSession().Execute("board"), "board play 1 ......./......./......./......./......./.......");
+    ASSERT_FALSE(GetSession().IsBotDropNeeded());
+
+    // And redone together:
+    ASSERT_EQ(GetSession().Execute("redo"), "ok play 1");
+    ASSERT_EQ(GetSession().Execute("board"), "board play 1 ......./......./......./......./......./...1..2");
+    ASSERT_EQ(GetSession().Execute("redo"), "error nothing to redo");
+}
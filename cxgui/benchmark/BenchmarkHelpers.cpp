@@ -0,0 +1,206 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file BenchmarkHelpers.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+
+#include <cxinv/assertion.h>
+#include <cxgui/FrameAnimationStrategy.h>
+
+#include "BenchmarkHelpers.h"
+
+namespace
+{
+
+constexpr cxgui::AnimationSpeed ANIMATION_SPEED{3u};
+
+/**************************************************************************************************
+ * @brief Gets a percentile (nearest rank method) from sorted values.
+ *
+ * @param p_sortedValues
+ *      The values, in increasing order.
+ * @param p_percentile
+ *      The wanted percentile, in [0, 100].
+ *
+ * @return The percentile.
+ *
+ *************************************************************************************************/
+double Percentile(const std::vector<double>& p_sortedValues, double p_percentile)
+{
+    IF_PRECONDITION_NOT_MET_DO(!p_sortedValues.empty(), return 0.0;);
+
+    const double rank = std::ceil(p_percentile / 100.0 * static_cast<double>(p_sortedValues.size()));
+    const size_t index = std::max<size_t>(static_cast<size_t>(rank), 1u) - 1u;
+
+    return p_sortedValues[std::min(index, p_sortedValues.size() - 1u)];
+}
+
+} // namespace
+
+BenchmarkAnimatedBoardPresenter::BenchmarkAnimatedBoardPresenter(const cxmodel::Height& p_nbRows, const cxmodel::Width& p_nbColumns)
+: m_nbRows{p_nbRows}
+, m_nbColumns{p_nbColumns}
+{
+    for(size_t row = 0u; row < m_nbRows.Get(); ++row)
+    {
+        m_chipColors.push_back(std::vector<cxmodel::ChipColor>());
+
+        for(size_t column = 0u; column < m_nbColumns.Get(); ++column)
+        {
+            if(2u * row < m_nbRows.Get())
+            {
+                m_chipColors[row].push_back(cxmodel::MakeTransparent());
+            }
+            else
+            {
+                m_chipColors[row].push_back(((row + column) % 2u == 0u) ? cxmodel::MakeRed() : cxmodel::MakeYellow());
+            }
+        }
+    }
+}
+
+void BenchmarkAnimatedBoardPresenter::Sync()
+{
+    // Nothing to synchronize: the board never changes.
+}
+
+cxmodel::Height BenchmarkAnimatedBoardPresenter::GetBoardHeight() const
+{
+    return m_nbRows;
+}
+
+cxmodel::Width BenchmarkAnimatedBoardPresenter::GetBoardWidth() const
+{
+    return m_nbColumns;
+}
+
+cxgui::Color BenchmarkAnimatedBoardPresenter::GetGameViewBoardColor() const
+{
+    return cxgui::Color{8481u, 8481u, 51143u};
+}
+
+cxgui::Color BenchmarkAnimatedBoardPresenter::GetGameViewColumnHighlightColor() const
+{
+    return cxgui::Color{19660u, 19660u, 19660u, 32767u};
+}
+
+cxmodel::ChipColor BenchmarkAnimatedBoardPresenter::GetActivePlayerChipColor() const
+{
+    return cxmodel::MakeRed();
+}
+
+const cxgui::IGameViewPresenter::ChipColors& BenchmarkAnimatedBoardPresenter::GetBoardChipColors() const
+{
+    return m_chipColors;
+}
+
+cxmodel::Column BenchmarkAnimatedBoardPresenter::GetBotTarget() const
+{
+    return cxmodel::Column{0u};
+}
+
+OffscreenBoard::OffscreenBoard(const cxmodel::Height& p_nbRows, const cxmodel::Width& p_nbColumns, const cxmath::Dimensions& p_resolution)
+: m_resolution{p_resolution}
+, m_presenter{p_nbRows, p_nbColumns}
+, m_animationModel{m_presenter, ANIMATION_SPEED}
+, m_renderer{m_animationModel, m_presenter}
+{
+    m_surface = Cairo::ImageSurface::create(Cairo::Format::FORMAT_ARGB32,
+                                            static_cast<int>(m_resolution.m_width.Get()),
+                                            static_cast<int>(m_resolution.m_height.Get()));
+    m_context = Cairo::Context::create(m_surface);
+
+    // Same initialization as the widget, once its size is allocated:
+    m_animationModel.Update(m_resolution, true);
+    m_animationModel.ResetChipPositions();
+
+    POSTCONDITION(m_surface);
+    POSTCONDITION(m_context);
+}
+
+void OffscreenBoard::Animate(cxgui::BoardAnimation p_animation)
+{
+    IF_PRECONDITION_NOT_MET_DO(p_animation == cxgui::BoardAnimation::MOVE_CHIP_LEFT_ONE_COLUMN ||
+                               p_animation == cxgui::BoardAnimation::MOVE_CHIP_RIGHT_ONE_COLUMN ||
+                               p_animation == cxgui::BoardAnimation::DROP_CHIP, return;);
+
+    if(p_animation == cxgui::BoardAnimation::DROP_CHIP)
+    {
+        if(!m_dropAnimationInfo.m_isAnimating)
+        {
+            m_dropAnimationInfo.Start(p_animation);
+        }
+    }
+    else if(!m_horizontalAnimationInfo.m_isAnimating)
+    {
+        m_horizontalAnimationInfo.Start(p_animation);
+    }
+
+    const auto strategy = cxgui::CreateFrameAnimationStrategy(m_animationModel, m_presenter, p_animation);
+    IF_CONDITION_NOT_MET_DO(strategy, return;);
+
+    // When the animation completes, the animation information is reset by the strategy
+    // and the animation is restarted on the next call:
+    strategy->PerformAnimation(m_dropAnimationInfo, m_horizontalAnimationInfo);
+}
+
+void OffscreenBoard::DrawFrame()
+{
+    m_animationModel.Update(m_resolution, m_horizontalAnimationInfo.m_isAnimating);
+    m_renderer.Render(m_context);
+}
+
+void OffscreenBoard::ClearCaches()
+{
+    m_renderer.ClearCaches();
+}
+
+void BoardSizesAndResolutions(benchmark::internal::Benchmark* p_benchmark)
+{
+    IF_PRECONDITION_NOT_MET_DO(p_benchmark, return;);
+
+    p_benchmark->ArgNames({"width", "height", "xres", "yres"});
+
+    const std::vector<std::pair<int, int>> boardSizes{{7, 6}, {16, 16}, {32, 32}, {64, 64}};
+    const std::vector<std::pair<int, int>> resolutions{{640, 480}, {1280, 720}, {1920, 1080}, {3840, 2160}};
+
+    for(const auto& [width, height] : boardSizes)
+    {
+        for(const auto& [xResolution, yResolution] : resolutions)
+        {
+            p_benchmark->Args({width, height, xResolution, yResolution});
+        }
+    }
+}
+
+void ReportFrameTimePercentiles(benchmark::State& p_state, std::vector<double>& p_frameTimes)
+{
+    IF_CONDITION_NOT_MET_DO(!p_frameTimes.empty(), return;);
+
+    std::sort(p_frameTimes.begin(), p_frameTimes.end());
+
+    p_state.counters["p50_us"] = Percentile(p_frameTimes, 50.0);
+    p_state.counters["p90_us"] = Percentile(p_frameTimes, 90.0);
+    p_state.counters["p99_us"] = Percentile(p_frameTimes, 99.0);
+    p_state.counters["max_us"] = p_frameTimes.back();
+}
@@ -0,0 +1,156 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file BenchmarkHelpers.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef BENCHMARKHELPERS_H_F0EE8285_982C_4965_863C_0C816B6186C5
+#define BENCHMARKHELPERS_H_F0EE8285_982C_4965_863C_0C816B6186C5
+
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <cairomm/context.h>
+#include <cairomm/surface.h>
+
+#include <cxgui/AnimatedBoardModel.h>
+#include <cxgui/AnimationInformation.h>
+#include <cxgui/BoardRenderer.h>
+#include <cxgui/IAnimatedBoardPresenter.h>
+
+/**********************************************************************************************//**
+ * @brief Animated board presenter for benchmarks.
+ *
+ * The lower half of the board is filled with chips of alternating colors, the upper half is
+ * left empty, so that drop animations have some room to fall.
+ *
+ *************************************************************************************************/
+class BenchmarkAnimatedBoardPresenter : public cxgui::IAnimatedBoardPresenter
+{
+
+public:
+
+    BenchmarkAnimatedBoardPresenter(const cxmodel::Height& p_nbRows, const cxmodel::Width& p_nbColumns);
+
+    void Sync() override;
+    [[nodiscard]] cxmodel::Height GetBoardHeight() const override;
+    [[nodiscard]] cxmodel::Width GetBoardWidth() const override;
+    [[nodiscard]] cxgui::Color GetGameViewBoardColor() const override;
+    [[nodiscard]] cxgui::Color GetGameViewColumnHighlightColor() const override;
+    [[nodiscard]] cxmodel::ChipColor GetActivePlayerChipColor() const override;
+    [[nodiscard]] const cxgui::IGameViewPresenter::ChipColors& GetBoardChipColors() const override;
+    [[nodiscard]] cxmodel::Column GetBotTarget() const override;
+
+private:
+
+    cxmodel::Height m_nbRows;
+    cxmodel::Width m_nbColumns;
+    cxgui::IGameViewPresenter::ChipColors m_chipColors;
+
+};
+
+/**********************************************************************************************//**
+ * @brief An animated board drawn into an in memory image surface.
+ *
+ * No display is needed: frames are drawn by the board renderer into a `Cairo::ImageSurface`
+ * of the requested resolution, exactly as they would be in the animated board widget.
+ *
+ *************************************************************************************************/
+class OffscreenBoard
+{
+
+public:
+
+    /******************************************************************************************//**
+     * @brief Constructor.
+     *
+     * @param p_nbRows
+     *      The number of rows on the board.
+     * @param p_nbColumns
+     *      The number of columns on the board.
+     * @param p_resolution
+     *      The dimensions of the drawing area (in pixels).
+     *
+     *********************************************************************************************/
+    OffscreenBoard(const cxmodel::Height& p_nbRows, const cxmodel::Width& p_nbColumns, const cxmath::Dimensions& p_resolution);
+
+    /******************************************************************************************//**
+     * @brief Advances some animation by one frame.
+     *
+     * The animation is restarted once it completes, so this can be called indefinitely.
+     *
+     * @param p_animation
+     *      The animation to advance. Only horizontal moves and drops are supported.
+     *
+     *********************************************************************************************/
+    void Animate(cxgui::BoardAnimation p_animation);
+
+    /******************************************************************************************//**
+     * @brief Draws the current frame (model update and rendering).
+     *
+     *********************************************************************************************/
+    void DrawFrame();
+
+    /******************************************************************************************//**
+     * @brief Clears all renderer caches, as a resize would.
+     *
+     *********************************************************************************************/
+    void ClearCaches();
+
+private:
+
+    const cxmath::Dimensions m_resolution;
+
+    BenchmarkAnimatedBoardPresenter m_presenter;
+    cxgui::AnimatedBoardModel m_animationModel;
+    cxgui::BoardRenderer m_renderer;
+
+    cxgui::AnimationInformations<cxmath::Width> m_horizontalAnimationInfo;
+    cxgui::AnimationInformations<cxmath::Height> m_dropAnimationInfo;
+
+    Cairo::RefPtr<Cairo::ImageSurface> m_surface;
+    Cairo::RefPtr<Cairo::Context> m_context;
+
+};
+
+/**********************************************************************************************//**
+ * @brief Adds board sizes and drawing area resolutions arguments to a benchmark.
+ *
+ * @param p_benchmark
+ *      The benchmark to add arguments to.
+ *
+ *************************************************************************************************/
+void BoardSizesAndResolutions(benchmark::internal::Benchmark* p_benchmark);
+
+/**********************************************************************************************//**
+ * @brief Reports frame time percentiles as benchmark counters.
+ *
+ * The 50th, 90th and 99th percentiles, as well as the maximum, are reported in microseconds.
+ *
+ * @param p_state
+ *      The benchmark state.
+ * @param p_frameTimes
+ *      The measured frame times (in microseconds). They are sorted by the call.
+ *
+ *************************************************************************************************/
+void ReportFrameTimePercentiles(benchmark::State& p_state, std::vector<double>& p_frameTimes);
+
+#endif // BENCHMARKHELPERS_H_F0EE8285_982C_4965_863C_0C816B6186C5
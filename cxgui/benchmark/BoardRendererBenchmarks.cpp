@@ -0,0 +1,123 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file BoardRendererBenchmarks.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkHelpers.h"
+
+namespace
+{
+
+/**************************************************************************************************
+ * @brief Creates an offscreen board from the benchmark arguments.
+ *
+ * @param p_state
+ *      The benchmark state. Arguments are, in order: board width, board height, horizontal
+ *      resolution and vertical resolution.
+ *
+ * @return The offscreen board.
+ *
+ *************************************************************************************************/
+std::unique_ptr<OffscreenBoard> MakeOffscreenBoard(const benchmark::State& p_state)
+{
+    const cxmodel::Width nbColumns{static_cast<size_t>(p_state.range(0))};
+    const cxmodel::Height nbRows{static_cast<size_t>(p_state.range(1))};
+    const cxmath::Dimensions resolution{cxmath::Height{static_cast<double>(p_state.range(3))},
+                                        cxmath::Width{static_cast<double>(p_state.range(2))}};
+
+    return std::make_unique<OffscreenBoard>(nbRows, nbColumns, resolution);
+}
+
+/**************************************************************************************************
+ * @brief Draws frames and reports frame time percentiles.
+ *
+ * @param p_state
+ *      The benchmark state.
+ * @param p_board
+ *      The offscreen board to draw.
+ * @param p_prepareFrame
+ *      Called (untimed) before each frame is drawn.
+ *
+ *************************************************************************************************/
+template<typename PrepareFrame>
+void DrawFrames(benchmark::State& p_state, OffscreenBoard& p_board, PrepareFrame p_prepareFrame)
+{
+    // Warm up the caches, as after the first frame in the widget:
+    p_board.DrawFrame();
+
+    std::vector<double> frameTimes;
+    for(auto _ : p_state)
+    {
+        p_state.PauseTiming();
+        p_prepareFrame();
+        p_state.ResumeTiming();
+
+        const auto start = std::chrono::steady_clock::now();
+        p_board.DrawFrame();
+        const auto end = std::chrono::steady_clock::now();
+
+        frameTimes.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+    }
+
+    p_state.SetItemsProcessed(p_state.iterations());
+    ReportFrameTimePercentiles(p_state, frameTimes);
+}
+
+// Full frames, as drawn when the whole widget is invalidated:
+void BM_BoardRendererFullFrame(benchmark::State& p_state)
+{
+    const auto board = MakeOffscreenBoard(p_state);
+    DrawFrames(p_state, *board, [](){});
+}
+
+// First frame after a resize, when all caches must be rebuilt:
+void BM_BoardRendererFirstFrame(benchmark::State& p_state)
+{
+    const auto board = MakeOffscreenBoard(p_state);
+    DrawFrames(p_state, *board, [&board](){board->ClearCaches();});
+}
+
+// Drop animation frames:
+void BM_BoardRendererDropFrame(benchmark::State& p_state)
+{
+    const auto board = MakeOffscreenBoard(p_state);
+    DrawFrames(p_state, *board, [&board](){board->Animate(cxgui::BoardAnimation::DROP_CHIP);});
+}
+
+// Horizontal move frames (including the mirror chip when wrapping around):
+void BM_BoardRendererHorizontalMoveFrame(benchmark::State& p_state)
+{
+    const auto board = MakeOffscreenBoard(p_state);
+    DrawFrames(p_state, *board, [&board](){board->Animate(cxgui::BoardAnimation::MOVE_CHIP_RIGHT_ONE_COLUMN);});
+}
+
+} // namespace
+
+BENCHMARK(BM_BoardRendererFullFrame)->Apply(BoardSizesAndResolutions)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BoardRendererFirstFrame)->Apply(BoardSizesAndResolutions)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BoardRendererDropFrame)->Apply(BoardSizesAndResolutions)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BoardRendererHorizontalMoveFrame)->Apply(BoardSizesAndResolutions)->Unit(benchmark::kMicrosecond);
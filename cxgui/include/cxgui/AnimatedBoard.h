@@ -32,13 +32,13 @@
 #include "AnimationInformation.h"
 #include "BoardAnimation.h"
 #include "BoardAnimationNotificationContext.h"
-#include "BoardElementCache.h"
 #include "IAnimatedBoardModel.h"
 #include "IBoardInformation.h"
 
 namespace cxgui
 {
 
+class BoardRenderer;
 class IAnimatedBoardPresenter;
 class IGameViewPresenter;
 
@@ -93,7 +93,7 @@ public:
      * @brief Destructor.
      *
      *********************************************************************************************/
-    ~AnimatedBoard() = default;
+    ~AnimatedBoard();
 
     // cxgui::IBoardInformation:
     [[nodiscard]] const cxmodel::Column& GetCurrentColumn() const override;
@@ -104,8 +104,6 @@ private:
     void PerformChipAnimation(BoardAnimation p_animation);
 
     bool on_draw(const Cairo::RefPtr<Cairo::Context>& p_context) override;
-    void DrawActiveColumnHighlight(const Cairo::RefPtr<Cairo::Context>& p_context);
-    void DrawBoardElement(const Cairo::RefPtr<Cairo::Context>& p_context, const cxmodel::Row& p_row, const cxmodel::Column& p_column);
 
     bool Redraw();
 
@@ -123,6 +121,9 @@ private:
     std::unique_ptr<IAnimatedBoardPresenter> m_presenter;
     std::unique_ptr<IAnimatedBoardModel> m_animationModel;
 
+    // Draws the frames (holds the surface caches):
+    std::unique_ptr<BoardRenderer> m_renderer;
+
     // Clock (ticks m_FPS times per second):
     std::unique_ptr<AnimatedBoardTimerRAII> m_timer;
 
@@ -132,13 +133,6 @@ private:
 
     cxmath::Dimensions m_lastFrameDimensions{cxmath::Height{0.0}, cxmath::Width{0.0}};
 
-    // Surfaces in RAM on which to perform the drawing, in memory, before effectively
-    // drawing on the screen. Caching these surfaces here avoids recreating them on every
-    // frame draw, which helps performancewise:
-    BoardElementCache m_boardElementsCache;             // For individual discs.
-    Cairo::RefPtr<Cairo::Surface> m_columnHilightCache; // For the column hilight.
-    Cairo::RefPtr<Cairo::Surface> m_surfaceCache;       // For the whole drawn surface.
-
     // Signals:
     sigc::connection m_mouseButtonPressedConnection;
     sigc::connection m_mouseMotionConnection;
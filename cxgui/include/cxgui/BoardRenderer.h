@@ -0,0 +1,131 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file BoardRenderer.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef BOARDRENDERER_H_38212077_09CC_4C3E_A0FA_C9153185487C
+#define BOARDRENDERER_H_38212077_09CC_4C3E_A0FA_C9153185487C
+
+#include <cairomm/refptr.h>
+
+#include <cxmodel/common.h>
+
+#include "BoardElementCache.h"
+
+/** @cond */
+/*  We explicitely tell Doxygen not to document this part. Otherwise, it is included even
+    though is it related to Cairo, not Connect X.*/
+namespace Cairo
+{
+    class Context;
+    class Surface;
+}
+/** @endcond */
+
+namespace cxgui
+{
+
+class IAnimatedBoardModel;
+class IAnimatedBoardPresenter;
+
+/**********************************************************************************************//**
+ * @brief Draws the animated game board on a Cairo context.
+ *
+ * The renderer draws a complete frame of the animated board (column highlight, chip(s) and
+ * board elements) as described by an animated board model and presenter. It only depends on
+ * Cairo, which means it can draw into a `Cairo::ImageSurface` without any GTK window, for
+ * example to measure drawing performance on a headless machine.
+ *
+ * Surfaces drawn once are cached and reused on following frames. The caches must be cleared
+ * whenever what they hold becomes stale (the widget is resized, the board is reinitialized,
+ * etc).
+ *
+ *************************************************************************************************/
+class BoardRenderer
+{
+
+public:
+
+    /******************************************************************************************//**
+     * @brief Constructor.
+     *
+     * @param p_animationModel
+     *      The animated board model, holding positions and dimensions.
+     * @param p_presenter
+     *      The animated board presenter, holding board and chip colors.
+     *
+     *********************************************************************************************/
+    BoardRenderer(const IAnimatedBoardModel& p_animationModel, const IAnimatedBoardPresenter& p_presenter);
+
+    /******************************************************************************************//**
+     * @brief Destructor.
+     *
+     *********************************************************************************************/
+    ~BoardRenderer();
+
+    /******************************************************************************************//**
+     * @brief Draws a complete frame.
+     *
+     * The model is not updated by the renderer: it is expected to be up to date for the
+     * frame to draw.
+     *
+     * @param p_context
+     *      The Cairo context to draw on.
+     *
+     *********************************************************************************************/
+    void Render(const Cairo::RefPtr<Cairo::Context>& p_context);
+
+    /******************************************************************************************//**
+     * @brief Clears the cached board elements.
+     *
+     * Should be called when board colors may have changed.
+     *
+     *********************************************************************************************/
+    void ClearBoardElementsCache();
+
+    /******************************************************************************************//**
+     * @brief Clears all cached surfaces.
+     *
+     * Should be called when the drawing area dimensions have changed.
+     *
+     *********************************************************************************************/
+    void ClearCaches();
+
+private:
+
+    void DrawActiveColumnHighlight(const Cairo::RefPtr<Cairo::Context>& p_context);
+    void DrawBoardElement(const Cairo::RefPtr<Cairo::Context>& p_context, const cxmodel::Row& p_row, const cxmodel::Column& p_column);
+
+    const IAnimatedBoardModel& m_animationModel;
+    const IAnimatedBoardPresenter& m_presenter;
+
+    // Surfaces in RAM on which to perform the drawing, in memory, before effectively
+    // drawing on the screen. Caching these surfaces here avoids recreating them on every
+    // frame draw, which helps performancewise:
+    BoardElementCache m_boardElementsCache;             // For individual discs.
+    Cairo::RefPtr<Cairo::Surface> m_columnHilightCache; // For the column hilight.
+    Cairo::RefPtr<Cairo::Surface> m_surfaceCache;       // For the whole drawn surface.
+
+};
+
+} // namespace cxgui
+
+#endif // BOARDRENDERER_H_38212077_09CC_4C3E_A0FA_C9153185487C
@@ -155,6 +155,7 @@ private:
     IMainWindowController& m_controller;
     IMainWindowPresenter& m_presenter;
     std::unique_ptr<IStatusBarPresenter> m_statusbarPresenter;
+    cxmodel::ModelSubject::Subscription m_statusbarPresenterSubscription;
 
     std::unique_ptr<IStatusBar> m_statusbar;
 
@@ -27,78 +27,19 @@
 
 #include <cxinv/assertion.h>
 #include <cxstd/helpers.h>
-#include <cxmodel/Disc.h>
 #include <cxgui/AnimatedBoard.h>
 #include <cxgui/AnimatedBoardModel.h>
 #include <cxgui/AnimatedBoardPresenter.h>
+#include <cxgui/BoardRenderer.h>
 #include <cxgui/common.h>
-#include <cxgui/ContextRestoreRAII.h>
 #include <cxgui/FrameAnimationStrategy.h>
 #include <cxgui/IGameViewPresenter.h>
-#include <cxgui/pathHelpers.h>
-
-namespace
-{
-
-/**************************************************************************************************
- * @brief Sets the source pattern within the Cairo context to a translucent color. 
- *
- * This color will then be used for any subsequent drawing operation until a new source pattern
- * is set.
- *
- * @param p_context
- *      The cairo context to use.
- * @param p_newSourceColor
- *      The new source color to use.
- *
- *************************************************************************************************/
-template<typename Channel>
-void SetSourceColor(const Cairo::RefPtr<Cairo::Context>& p_context,
-                    const cxmodel::Color<Channel>& p_newSourceColor)
-{
-    p_context->set_source_rgba(cxmodel::NormalizedR(p_newSourceColor),
-                               cxmodel::NormalizedG(p_newSourceColor),
-                               cxmodel::NormalizedB(p_newSourceColor),
-                               cxmodel::NormalizedA(p_newSourceColor));
-}
-
-/**************************************************************************************************
- * @brief Draw a chip.
- *
- * The chip will have a boarder around it.
- *
- * @param p_context
- *      The cairo context to use.
- * @param p_centerPosition
- *      The chip's wanted center position.
- * @param p_radius
- *      The chips wanted radius.
- * @param p_backgroundColor
- *      The chips wanted background color.
- *
- *************************************************************************************************/
-void DrawChip(const Cairo::RefPtr<Cairo::Context>& p_context,
-              const cxmath::Position& p_centerPosition,
-              double p_radius,
-              const cxmodel::ChipColor& p_backgroundColor)
-{
-    cxgui::ContextRestoreRAII contextRestoreRAII{p_context};
-
-    cxgui::MakeCircularPath(p_context, p_centerPosition, p_radius);
-
-    // Set background color:
-    SetSourceColor(p_context, p_backgroundColor);
-
-    // Draw everything:
-    p_context->fill();
-}
-
-} // namespace
 
 cxgui::AnimatedBoard::AnimatedBoard(const IGameViewPresenter& p_presenter, const cxgui::AnimationSpeed& p_speed)
 {
     m_presenter = std::make_unique<cxgui::AnimatedBoardPresenter>(p_presenter);
     m_animationModel = std::make_unique<cxgui::AnimatedBoardModel>(*m_presenter, p_speed);
+    m_renderer = std::make_unique<cxgui::BoardRenderer>(*m_animationModel, *m_presenter);
 
     // Customize width and height according to window dimension.
     signal_realize().connect([this](){
@@ -145,8 +86,11 @@ cxgui::AnimatedBoard::AnimatedBoard(const IGameViewPresenter& p_presenter, const
 
     POSTCONDITION(m_presenter);
     POSTCONDITION(m_animationModel);
+    POSTCONDITION(m_renderer);
 }
 
+cxgui::AnimatedBoard::~AnimatedBoard() = default;
+
 // Performs an "frame increment". This is called on every tick (m_FPS times/sec) and
 // keeps track of all displacements. It also notifies when the animation completes.
 void cxgui::AnimatedBoard::PerformChipAnimation(BoardAnimation p_animation)
@@ -159,7 +103,7 @@ void cxgui::AnimatedBoard::PerformChipAnimation(BoardAnimation p_animation)
 
     if(p_animation == cxgui::BoardAnimation::REINITIALIZE)
     {
-        m_boardElementsCache.Clear();
+        m_renderer->ClearBoardElementsCache();
     }
     
     auto strategy = CreateFrameAnimationStrategy(*m_animationModel, *m_presenter, p_animation);
@@ -183,185 +127,21 @@ cxmodel::ChipColor cxgui::AnimatedBoard::GetCurrentChipColor() const
     return m_presenter->GetActivePlayerChipColor();
 }
 
-// Does the actual drawing. Be careful it mofifying this, it is performance
-// critical:
-//
-//  1. Draw to surfaces to avoid over using the X server.
-//  2. Cache the results to avoid redrawing the same things every time.
-//
-// Make sure that if you change this, the performance is not decreased.
+// Does the actual drawing (see cxgui::BoardRenderer). We keep track of previous frame
+// dimensions to allow calculating a scaling factor in the case of a resize.
 bool cxgui::AnimatedBoard::on_draw(const Cairo::RefPtr<Cairo::Context>& p_context)
 {
-    // Get window dimensions. We keep track of previous frame dimensions to allow
-    // calculating a scaling factor in the case of a resize:
     const Gtk::Allocation allocation = get_allocation();
     m_lastFrameDimensions.m_height = cxmath::Height{static_cast<double>(allocation.get_height())};
     m_lastFrameDimensions.m_width = cxmath::Width{static_cast<double>(allocation.get_width())};
 
     m_animationModel->Update(m_lastFrameDimensions, m_moveLeftAnimationInfo.m_isAnimating || m_moveRightAnimationInfo.m_isAnimating);
 
-    if(!m_surfaceCache)
-    {
-        m_surfaceCache = Cairo::ImageSurface::create(Cairo::Format::FORMAT_ARGB32,
-                                                      m_animationModel->GetAnimatedAreaDimensions().m_width.Get(),
-                                                      m_animationModel->GetAnimatedAreaDimensions().m_height.Get());
-        ASSERT(m_surfaceCache);
-    }
-
-    const auto bufferContext = Cairo::Context::create(m_surfaceCache);
-    
-    // We clear the surface:
-    {
-        const cxgui::ContextRestoreRAII contextRestoreRAII{bufferContext};
-
-        cxgui::MakeRectanglarPath(bufferContext,
-                                  {0.0, 0.0},
-                                  m_animationModel->GetAnimatedAreaDimensions().m_height.Get(),
-                                  m_animationModel->GetAnimatedAreaDimensions().m_width.Get());
-
-        SetSourceColor(bufferContext, cxmodel::MakeTransparent());
-        bufferContext->set_operator(Cairo::Operator::OPERATOR_SOURCE);
-        bufferContext->fill_preserve();
-        bufferContext->stroke();
-    }
-
-    // Draw colum highlight:
-    DrawActiveColumnHighlight(bufferContext);
-
-    // Draw Chip(s):
-    const cxmodel::ChipColor chipColor = m_presenter->GetActivePlayerChipColor();
-    DrawChip(bufferContext,
-             m_animationModel->GetChipPosition(),
-             m_animationModel->GetChipRadius().Get() + m_animationModel->GetLineWidth(cxgui::Feature::CHIP).Get(),
-             chipColor);
-
-    if(m_animationModel->IsMirrorChipNeeded())
-    {
-        DrawChip(bufferContext,
-                 m_animationModel->GetMirrorChipPosition(),
-                 m_animationModel->GetChipRadius().Get() + m_animationModel->GetLineWidth(cxgui::Feature::CHIP).Get(),
-                 chipColor);
-    }
-
-    // Draw the game board:
-    for(size_t row = 0u; row < m_presenter->GetBoardHeight().Get(); ++row)
-    {
-        for(size_t column = 0u; column < m_presenter->GetBoardWidth().Get(); ++column)
-        {
-            DrawBoardElement(bufferContext, cxmodel::Row{row}, cxmodel::Column{column});
-        }
-    }
-
-    // Draw the whole thing:
-    p_context->set_source(m_surfaceCache, 0, 0);
-    p_context->paint();
+    m_renderer->Render(p_context);
 
     return true;
 }
 
-// Draws a "column highlight" that follows the current chip. This helps the user locate the
-// current column. Especially helpful on larger boards.
-void cxgui::AnimatedBoard::DrawActiveColumnHighlight(const Cairo::RefPtr<Cairo::Context>& p_context)
-{
-    const cxmath::Dimensions cellDimensions = m_animationModel->GetCellDimensions();
-    const double cellWidth = cellDimensions.m_width.Get();
-    const double cellHeight = cellDimensions.m_height.Get();
-
-    const cxgui::ContextRestoreRAII contextRestoreRAII{p_context};
-
-    if(m_columnHilightCache)
-    {
-        p_context->set_source(m_columnHilightCache, m_animationModel->GetChipPosition().m_x - (cellWidth / 2.0), cellHeight);
-        p_context->paint();
-
-        return;
-    }
-
-    m_columnHilightCache = Cairo::ImageSurface::create(Cairo::Format::FORMAT_ARGB32, cellWidth, m_animationModel->GetAnimatedAreaDimensions().m_height.Get() - cellHeight);
-    ASSERT(m_columnHilightCache);
-
-    const auto bufferContext = Cairo::Context::create(m_columnHilightCache);
-    {
-        const cxgui::ContextRestoreRAII bufferContextRestoreRAII{bufferContext};
-
-        cxgui::MakeRectanglarPath(bufferContext, {0.0, 0.0}, m_animationModel->GetAnimatedAreaDimensions().m_height.Get() - cellHeight, cellWidth);
-        SetSourceColor(bufferContext, m_presenter->GetGameViewColumnHighlightColor());
-        bufferContext->fill_preserve();
-        bufferContext->stroke();
-    }
-    
-    // Draw everything:
-    p_context->set_source(m_columnHilightCache, m_animationModel->GetChipPosition().m_x - (cellWidth / 2.0), cellHeight);
-    p_context->paint();
-}
-
-// See `on_draw()`. Basically draws a chip and the rectangular space around it (which has the board color). All
-// these elements together make the board.
-void cxgui::AnimatedBoard::DrawBoardElement(const Cairo::RefPtr<Cairo::Context>& p_context, const cxmodel::Row& p_row, const cxmodel::Column& p_column)
-{
-    const cxmath::Dimensions cellDimensions = m_animationModel->GetCellDimensions();
-    const double cellWidth = cellDimensions.m_width.Get();
-    const double cellHeight = cellDimensions.m_height.Get();
-    const double radius = m_animationModel->GetChipRadius().Get() + m_animationModel->GetLineWidth(cxgui::Feature::CHIP).Get();
-
-    const IGameViewPresenter::ChipColors& chipColors = m_presenter->GetBoardChipColors();
-    const cxmodel::ChipColor chipColor = chipColors[p_row.Get()][p_column.Get()];
-
-    const cxgui::ContextRestoreRAII contextRestoreRAII{p_context};
-
-    if(m_boardElementsCache.HasElement(chipColor))
-    {
-        // Paint that part to the canvas:
-        p_context->set_source(m_boardElementsCache.Get(chipColor),
-                              p_column.Get() * cellWidth,
-                              (p_row.Get() + 1) * cellHeight);
-        p_context->paint();
-
-        return;
-    }
-
-    // Add a little extra to cover everything...
-    auto buffer = Cairo::ImageSurface::create(Cairo::Format::FORMAT_ARGB32,
-                                              cellWidth + m_animationModel->GetLineWidth(cxgui::Feature::CELL).Get(),
-                                              cellHeight + m_animationModel->GetLineWidth(cxgui::Feature::CELL).Get());
-    const auto bufferContext = Cairo::Context::create(buffer);
-    {
-        cxgui::ContextRestoreRAII bufferContextRestoreRAII{bufferContext};
-
-        // Draw paths for chip space and the cell contour:
-        cxgui::MakeCircularPath(bufferContext, {cellWidth / 2.0, cellHeight / 2.0}, radius);
-        cxgui::MakeRectanglarPath(bufferContext, {0.0, 0.0}, cellHeight, cellWidth);
-
-        // Set background color:
-        SetSourceColor(bufferContext, m_presenter->GetGameViewBoardColor());
-
-        // Draw everything:
-        bufferContext->set_fill_rule(Cairo::FILL_RULE_EVEN_ODD);
-        bufferContext->fill_preserve();
-        bufferContext->stroke();
-    }
-
-    // Add border and draw model chips:
-    {
-        cxgui::ContextRestoreRAII bufferContextRestoreRAII{bufferContext};
-
-        cxgui::MakeCircularPath(bufferContext, {cellWidth / 2.0, cellHeight / 2.0}, radius);
-
-        SetSourceColor(bufferContext, chipColor);
-
-        bufferContext->fill();
-    }
-
-    // Add to the cache:
-    m_boardElementsCache.Add(chipColor, buffer);
-
-    // Paint that part to the canvas:
-    p_context->set_source(buffer,
-                          p_column.Get() * cellWidth,
-                          (p_row.Get() + 1) * cellHeight);
-    p_context->paint();
-}
-
 // Schedule redraws for specific board regions. Called m_FPS times per second.
 //
 // This function is critical for performance: redrawing too often or too much
@@ -440,9 +220,7 @@ bool cxgui::AnimatedBoard::OnResize(const cxmath::Dimensions& p_newDimensions)
     RETURN_IF(m_lastFrameDimensions.m_height == cxmath::Height{0.0}, cxgui::STOP_EVENT_PROPAGATION);
     RETURN_IF(m_lastFrameDimensions.m_width == cxmath::Width{0.0}, cxgui::STOP_EVENT_PROPAGATION);
 
-    m_boardElementsCache.Clear();
-    m_columnHilightCache.clear();
-    m_surfaceCache.clear();
+    m_renderer->ClearCaches();
 
     if(!cxmath::AreLogicallyEqual(p_newDimensions.m_height.Get(), m_lastFrameDimensions.m_height.Get()))
     {
@@ -0,0 +1,284 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file BoardRenderer.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <cairomm/context.h>
+#include <cairomm/surface.h>
+
+#include <cxinv/assertion.h>
+#include <cxmodel/Disc.h>
+#include <cxgui/BoardRenderer.h>
+#include <cxgui/common.h>
+#include <cxgui/ContextRestoreRAII.h>
+#include <cxgui/IAnimatedBoardModel.h>
+#include <cxgui/IAnimatedBoardPresenter.h>
+#include <cxgui/pathHelpers.h>
+
+namespace
+{
+
+/**************************************************************************************************
+ * @brief Sets the source pattern within the Cairo context to a translucent color. 
+ *
+ * This color will then be used for any subsequent drawing operation until a new source pattern
+ * is set.
+ *
+ * @param p_context
+ *      The cairo context to use.
+ * @param p_newSourceColor
+ *      The new source color to use.
+ *
+ *************************************************************************************************/
+template<typename Channel>
+void SetSourceColor(const Cairo::RefPtr<Cairo::Context>& p_context,
+                    const cxmodel::Color<Channel>& p_newSourceColor)
+{
+    p_context->set_source_rgba(cxmodel::NormalizedR(p_newSourceColor),
+                               cxmodel::NormalizedG(p_newSourceColor),
+                               cxmodel::NormalizedB(p_newSourceColor),
+                               cxmodel::NormalizedA(p_newSourceColor));
+}
+
+/**************************************************************************************************
+ * @brief Draw a chip.
+ *
+ * The chip will have a boarder around it.
+ *
+ * @param p_context
+ *      The cairo context to use.
+ * @param p_centerPosition
+ *      The chip's wanted center position.
+ * @param p_radius
+ *      The chips wanted radius.
+ * @param p_backgroundColor
+ *      The chips wanted background color.
+ *
+ *************************************************************************************************/
+void DrawChip(const Cairo::RefPtr<Cairo::Context>& p_context,
+              const cxmath::Position& p_centerPosition,
+              double p_radius,
+              const cxmodel::ChipColor& p_backgroundColor)
+{
+    cxgui::ContextRestoreRAII contextRestoreRAII{p_context};
+
+    cxgui::MakeCircularPath(p_context, p_centerPosition, p_radius);
+
+    // Set background color:
+    SetSourceColor(p_context, p_backgroundColor);
+
+    // Draw everything:
+    p_context->fill();
+}
+
+} // namespace
+
+cxgui::BoardRenderer::BoardRenderer(const IAnimatedBoardModel& p_animationModel, const IAnimatedBoardPresenter& p_presenter)
+: m_animationModel{p_animationModel}
+, m_presenter{p_presenter}
+{
+}
+
+cxgui::BoardRenderer::~BoardRenderer() = default;
+
+// Does the actual drawing. Be careful it mofifying this, it is performance
+// critical:
+//
+//  1. Draw to surfaces to avoid over using the X server.
+//  2. Cache the results to avoid redrawing the same things every time.
+//
+// Make sure that if you change this, the performance is not decreased (see
+// the cxguibench target).
+void cxgui::BoardRenderer::Render(const Cairo::RefPtr<Cairo::Context>& p_context)
+{
+    IF_PRECONDITION_NOT_MET_DO(p_context, return;);
+
+    if(!m_surfaceCache)
+    {
+        m_surfaceCache = Cairo::ImageSurface::create(Cairo::Format::FORMAT_ARGB32,
+                                                      m_animationModel.GetAnimatedAreaDimensions().m_width.Get(),
+                                                      m_animationModel.GetAnimatedAreaDimensions().m_height.Get());
+        ASSERT(m_surfaceCache);
+    }
+
+    const auto bufferContext = Cairo::Context::create(m_surfaceCache);
+    
+    // We clear the surface:
+    {
+        const cxgui::ContextRestoreRAII contextRestoreRAII{bufferContext};
+
+        cxgui::MakeRectanglarPath(bufferContext,
+                                  {0.0, 0.0},
+                                  m_animationModel.GetAnimatedAreaDimensions().m_height.Get(),
+                                  m_animationModel.GetAnimatedAreaDimensions().m_width.Get());
+
+        SetSourceColor(bufferContext, cxmodel::MakeTransparent());
+        bufferContext->set_operator(Cairo::Operator::OPERATOR_SOURCE);
+        bufferContext->fill_preserve();
+        bufferContext->stroke();
+    }
+
+    // Draw colum highlight:
+    DrawActiveColumnHighlight(bufferContext);
+
+    // Draw Chip(s):
+    const cxmodel::ChipColor chipColor = m_presenter.GetActivePlayerChipColor();
+    DrawChip(bufferContext,
+             m_animationModel.GetChipPosition(),
+             m_animationModel.GetChipRadius().Get() + m_animationModel.GetLineWidth(cxgui::Feature::CHIP).Get(),
+             chipColor);
+
+    if(m_animationModel.IsMirrorChipNeeded())
+    {
+        DrawChip(bufferContext,
+                 m_animationModel.GetMirrorChipPosition(),
+                 m_animationModel.GetChipRadius().Get() + m_animationModel.GetLineWidth(cxgui::Feature::CHIP).Get(),
+                 chipColor);
+    }
+
+    // Draw the game board:
+    for(size_t row = 0u; row < m_presenter.GetBoardHeight().Get(); ++row)
+    {
+        for(size_t column = 0u; column < m_presenter.GetBoardWidth().Get(); ++column)
+        {
+            DrawBoardElement(bufferContext, cxmodel::Row{row}, cxmodel::Column{column});
+        }
+    }
+
+    // Draw the whole thing:
+    p_context->set_source(m_surfaceCache, 0, 0);
+    p_context->paint();
+}
+
+void cxgui::BoardRenderer::ClearBoardElementsCache()
+{
+    m_boardElementsCache.Clear();
+}
+
+void cxgui::BoardRenderer::ClearCaches()
+{
+    m_boardElementsCache.Clear();
+    m_columnHilightCache.clear();
+    m_surfaceCache.clear();
+}
+
+// Draws a "column highlight" that follows the current chip. This helps the user locate the
+// current column. Especially helpful on larger boards.
+void cxgui::BoardRenderer::DrawActiveColumnHighlight(const Cairo::RefPtr<Cairo::Context>& p_context)
+{
+    const cxmath::Dimensions cellDimensions = m_animationModel.GetCellDimensions();
+    const double cellWidth = cellDimensions.m_width.Get();
+    const double cellHeight = cellDimensions.m_height.Get();
+
+    const cxgui::ContextRestoreRAII contextRestoreRAII{p_context};
+
+    if(m_columnHilightCache)
+    {
+        p_context->set_source(m_columnHilightCache, m_animationModel.GetChipPosition().m_x - (cellWidth / 2.0), cellHeight);
+        p_context->paint();
+
+        return;
+    }
+
+    m_columnHilightCache = Cairo::ImageSurface::create(Cairo::Format::FORMAT_ARGB32, cellWidth, m_animationModel.GetAnimatedAreaDimensions().m_height.Get() - cellHeight);
+    ASSERT(m_columnHilightCache);
+
+    const auto bufferContext = Cairo::Context::create(m_columnHilightCache);
+    {
+        const cxgui::ContextRestoreRAII bufferContextRestoreRAII{bufferContext};
+
+        cxgui::MakeRectanglarPath(bufferContext, {0.0, 0.0}, m_animationModel.GetAnimatedAreaDimensions().m_height.Get() - cellHeight, cellWidth);
+        SetSourceColor(bufferContext, m_presenter.GetGameViewColumnHighlightColor());
+        bufferContext->fill_preserve();
+        bufferContext->stroke();
+    }
+    
+    // Draw everything:
+    p_context->set_source(m_columnHilightCache, m_animationModel.GetChipPosition().m_x - (cellWidth / 2.0), cellHeight);
+    p_context->paint();
+}
+
+// See `Render()`. Basically draws a chip and the rectangular space around it (which has the board color). All
+// these elements together make the board.
+void cxgui::BoardRenderer::DrawBoardElement(const Cairo::RefPtr<Cairo::Context>& p_context, const cxmodel::Row& p_row, const cxmodel::Column& p_column)
+{
+    const cxmath::Dimensions cellDimensions = m_animationModel.GetCellDimensions();
+    const double cellWidth = cellDimensions.m_width.Get();
+    const double cellHeight = cellDimensions.m_height.Get();
+    const double radius = m_animationModel.GetChipRadius().Get() + m_animationModel.GetLineWidth(cxgui::Feature::CHIP).Get();
+
+    const IGameViewPresenter::ChipColors& chipColors = m_presenter.GetBoardChipColors();
+    const cxmodel::ChipColor chipColor = chipColors[p_row.Get()][p_column.Get()];
+
+    const cxgui::ContextRestoreRAII contextRestoreRAII{p_context};
+
+    if(m_boardElementsCache.HasElement(chipColor))
+    {
+        // Paint that part to the canvas:
+        p_context->set_source(m_boardElementsCache.Get(chipColor),
+                              p_column.Get() * cellWidth,
+                              (p_row.Get() + 1) * cellHeight);
+        p_context->paint();
+
+        return;
+    }
+
+    // Add a little extra to cover everything...
+    auto buffer = Cairo::ImageSurface::create(Cairo::Format::FORMAT_ARGB32,
+                                              cellWidth + m_animationModel.GetLineWidth(cxgui::Feature::CELL).Get(),
+                                              cellHeight + m_animationModel.GetLineWidth(cxgui::Feature::CELL).Get());
+    const auto bufferContext = Cairo::Context::create(buffer);
+    {
+        cxgui::ContextRestoreRAII bufferContextRestoreRAII{bufferContext};
+
+        // Draw paths for chip space and the cell contour:
+        cxgui::MakeCircularPath(bufferContext, {cellWidth / 2.0, cellHeight / 2.0}, radius);
+        cxgui::MakeRectanglarPath(bufferContext, {0.0, 0.0}, cellHeight, cellWidth);
+
+        // Set background color:
+        SetSourceColor(bufferContext, m_presenter.GetGameViewBoardColor());
+
+        // Draw everything:
+        bufferContext->set_fill_rule(Cairo::FILL_RULE_EVEN_ODD);
+        bufferContext->fill_preserve();
+        bufferContext->stroke();
+    }
+
+    // Add border and draw model chips:
+    {
+        cxgui::ContextRestoreRAII bufferContextRestoreRAII{bufferContext};
+
+        cxgui::MakeCircularPath(bufferContext, {cellWidth / 2.0, cellHeight / 2.0}, radius);
+
+        SetSourceColor(bufferContext, chipColor);
+
+        bufferContext->fill();
+    }
+
+    // Add to the cache:
+    m_boardElementsCache.Add(chipColor, buffer);
+
+    // Paint that part to the canvas:
+    p_context->set_source(buffer,
+                          p_column.Get() * cellWidth,
+                          (p_row.Get() + 1) * cellHeight);
+    p_context->paint();
+}
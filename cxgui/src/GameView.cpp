@@ -154,7 +154,9 @@ void cxgui::GameView::Update(cxmodel::ModelNotificationContext p_context)
             break;
         }
         case cxmodel::ModelNotificationContext::REDO_CHIP_DROPPED:
+        case cxmodel::ModelNotificationContext::MOVES_APPLIED:
         {
+            // Like for a redo, the chips simply appear, so the board is synced with the model:
             UpdateRedoChipDropped();
             break;
         }
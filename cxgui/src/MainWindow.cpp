@@ -78,6 +78,11 @@ cxgui::MainWindow::MainWindow(Gtk::Application& p_gtkApplication,
 
 cxgui::MainWindow::~MainWindow()
 {
+    if(m_statusbarPresenterSubscription.IsAttached())
+    {
+        m_model.Detatch(m_statusbarPresenterSubscription);
+    }
+
     // We unregister the current view from the main layout. If the view is
     // reset before the layout has had time to unregister it, we get a dangling
     // reference to it in the layout.
@@ -123,7 +128,8 @@ void cxgui::MainWindow::ConfigureWidgets()
     m_gameMenuItem.set_label(m_presenter.GetMenuLabel(MenuItem::GAME));
     m_helpMenuItem.set_label(m_presenter.GetMenuLabel(MenuItem::HELP));
 
-    m_model.Attach(m_statusbarPresenter.get());
+    // Analysis results are not shown in the status bar:
+    m_statusbarPresenterSubscription = m_model.Attach(m_statusbarPresenter.get(), cxmodel::ModelSubject::ContextSet::All().Without(cxmodel::ModelNotificationContext::ANALYSIS_UPDATED));
     m_statusbarPresenter->Attach(m_statusbar.get());
 }
 
@@ -173,6 +179,7 @@ void cxgui::MainWindow::Update(cxmodel::ModelNotificationContext p_context, cxmo
                 break;
             }
             case cxmodel::ModelNotificationContext::REDO_CHIP_DROPPED:
+            case cxmodel::ModelNotificationContext::MOVES_APPLIED:
             {
                 UpdateChipDropped(p_context);
                 break;
@@ -197,6 +204,11 @@ void cxgui::MainWindow::Update(cxmodel::ModelNotificationContext p_context, cxmo
                 UpdateGameReinitialized(p_context);
                 break;
             }
+            case cxmodel::ModelNotificationContext::ANALYSIS_UPDATED:
+            {
+                // Not displayed yet.
+                break;
+            }
             default:
                 ASSERT_ERROR_MSG("Unsupported notification context.");
         }
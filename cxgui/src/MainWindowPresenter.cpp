@@ -81,6 +81,12 @@ cxgui::MainWindowPresenter::MainWindowPresenter(const cxmodel::IConnectXLimits&
 
 void cxgui::MainWindowPresenter::Update(cxmodel::ModelNotificationContext p_context, cxmodel::ModelSubject* p_subject)
 {
+    // Analysis results do not change what the main window can do, and are not displayed yet:
+    if(p_context == cxmodel::ModelNotificationContext::ANALYSIS_UPDATED)
+    {
+        return;
+    }
+
     if(INL_PRECONDITION(p_subject))
     {
         m_canRequestNewGame = false;
@@ -122,6 +128,7 @@ void cxgui::MainWindowPresenter::Update(cxmodel::ModelNotificationContext p_cont
                 break;
             }
             case cxmodel::ModelNotificationContext::REDO_CHIP_DROPPED:
+            case cxmodel::ModelNotificationContext::MOVES_APPLIED:
             {
                 m_canRequestNewGame = true;
                 m_canCurrentGameBeReinitialized = true;
@@ -34,6 +34,12 @@ std::string cxgui::StatusBarPresenter::GetStatusBarMessage() const
 
 void cxgui::StatusBarPresenter::Update(cxmodel::ModelNotificationContext p_context, cxmodel::ModelSubject* p_subject)
 {
+    // Analysis results are not shown in the status bar:
+    if(p_context == cxmodel::ModelNotificationContext::ANALYSIS_UPDATED)
+    {
+        return;
+    }
+
     if(p_subject)
     {
         m_statusBarMessage = MakeStatusBarContextString(p_context);
@@ -79,6 +85,12 @@ std::string cxgui::MakeStatusBarContextString(cxmodel::ModelNotificationContext
         case cxmodel::ModelNotificationContext::GAME_REINITIALIZED:
             return "Game reinitialized.";
 
+        case cxmodel::ModelNotificationContext::ANALYSIS_UPDATED:
+            return NO_MESSAGE;
+
+        case cxmodel::ModelNotificationContext::MOVES_APPLIED:
+            return "Chips dropped.";
+
         default:                                                     // LCOV_EXCL_LINE
             ASSERT_ERROR_MSG("Unknown notification context.");       // LCOV_EXCL_LINE
             return NO_MESSAGE;                                       // LCOV_EXCL_LINE
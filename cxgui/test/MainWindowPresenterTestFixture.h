@@ -89,6 +89,7 @@ private:
         size_t GetCurrentGridHeight() const override {return 6u;}
         size_t GetCurrentGridWidth() const override {return 7u;};
         size_t GetCurrentInARowValue() const override {return 4u;};
+        std::uint64_t GetSeed() const override {return 0u;};
         const cxmodel::IPlayer& GetActivePlayer() const override {return *m_activePlayer;};
         const cxmodel::IPlayer& GetNextPlayer() const override {return *m_nextPlayer;};
         const cxmodel::IChip& GetChip(size_t p_row, size_t p_column) const override;
@@ -114,6 +115,8 @@ private:
         // IConnectXAI:
         void ComputeNextDropColumn(cxmodel::DropColumnComputation /*p_algorithm*/) override {};
         [[nodiscard]] size_t GetCurrentBotTarget() const override {return 5u;};
+        [[nodiscard]] cxmodel::SearchStatistics GetLastSearchStatistics() const override {return {};}
+        [[nodiscard]] cxmodel::SearchStatistics GetGameSearchStatistics() const override {return {};}
 
 
     private:
@@ -470,6 +470,17 @@ TEST_F(MainWindowPresenterTestFixture, /*DISABLED_*/IsNewGamePossible_ChipDropRe
     ASSERT_TRUE(presenter.IsNewGamePossible());
 }
 
+TEST_F(MainWindowPresenterTestFixture, /*DISABLED_*/IsNewGamePossible_MovesAppliedNotification_TrueReturned)
+{
+    auto& actionModel = GetActionsModel();
+    actionModel.CreateNewGame(cxmodel::NewGameInformation{});
+
+    SendNotification(cxmodel::ModelNotificationContext::MOVES_APPLIED);
+
+    const auto& presenter = GetPresenter();
+    ASSERT_TRUE(presenter.IsNewGamePossible());
+}
+
 TEST_F(MainWindowPresenterTestFixture, /*DISABLED_*/IsNewGamePossible_ChipMovedLeftOneColumnNotification_TrueReturned)
 {
     auto& actionModel = GetActionsModel();
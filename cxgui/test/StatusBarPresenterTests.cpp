@@ -91,6 +91,16 @@ TEST(StatusBarPresenter, MakeStatusBarContextString_GameReinitialized_GameReinit
     ASSERT_EQ(cxgui::MakeStatusBarContextString(cxmodel::ModelNotificationContext::GAME_REINITIALIZED), "Game reinitialized.");
 }
 
+TEST(StatusBarPresenter, MakeStatusBarContextString_AnalysisUpdated_NoMessage)
+{
+    ASSERT_EQ(cxgui::MakeStatusBarContextString(cxmodel::ModelNotificationContext::ANALYSIS_UPDATED), "");
+}
+
+TEST(StatusBarPresenter, MakeStatusBarContextString_MovesApplied_ChipsDroppedStringCreated)
+{
+    ASSERT_EQ(cxgui::MakeStatusBarContextString(cxmodel::ModelNotificationContext::MOVES_APPLIED), "Chips dropped.");
+}
+
 TEST(StatusBarPresenter, Constructor_NoAction_NoMessage)
 {
     cxgui::StatusBarPresenter presenter;
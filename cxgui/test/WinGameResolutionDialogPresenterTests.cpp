@@ -44,6 +44,7 @@ public:
     size_t GetCurrentGridHeight() const override {return 6u;}
     size_t GetCurrentGridWidth() const override {return 7u;}
     size_t GetCurrentInARowValue() const override {return 4u;}
+    std::uint64_t GetSeed() const override {return 0u;}
     const cxmodel::IPlayer& GetActivePlayer() const override {return *m_activePlayer;}
     const cxmodel::IPlayer& GetNextPlayer() const override {return *m_nextPlayer;}
     const cxmodel::IChip& GetChip(size_t p_row, size_t p_column) const override
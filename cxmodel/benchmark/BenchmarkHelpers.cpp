@@ -0,0 +1,192 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file BenchmarkHelpers.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+#include <cxmodel/ChipColor.h>
+#include <cxmodel/IPlayer.h>
+
+#include "BenchmarkHelpers.h"
+
+namespace
+{
+
+// From the classic board to the largest one, as (width, height):
+const std::vector<std::pair<int64_t, int64_t>> BOARD_SIZES = {{7, 6}, {9, 8}, {16, 16}, {32, 32}, {64, 64}};
+
+} // namespace
+
+size_t BenchmarkLimits::GetMinimumGridHeight() const
+{
+    return 6u;
+}
+
+size_t BenchmarkLimits::GetMinimumGridWidth() const
+{
+    return 7u;
+}
+
+size_t BenchmarkLimits::GetMinimumInARowValue() const
+{
+    return 3u;
+}
+
+size_t BenchmarkLimits::GetMaximumGridHeight() const
+{
+    return 64u;
+}
+
+size_t BenchmarkLimits::GetMaximumGridWidth() const
+{
+    return 64u;
+}
+
+size_t BenchmarkLimits::GetMaximumInARowValue() const
+{
+    return 8u;
+}
+
+size_t BenchmarkLimits::GetMinimumNumberOfPlayers() const
+{
+    return 2u;
+}
+
+size_t BenchmarkLimits::GetMaximumNumberOfPlayers() const
+{
+    return cxmodel::NB_PLAYER_COLORS;
+}
+
+void BenchmarkLogger::Log(const cxlog::VerbosityLevel /*p_verbosityLevel*/,
+                          const std::string& /*p_fileName*/,
+                          const std::string& /*p_functionName*/,
+                          const size_t /*p_lineNumber*/,
+                          const std::string& /*p_message*/)
+{
+}
+
+void BenchmarkLogger::SetVerbosityLevel(const cxlog::VerbosityLevel /*p_verbosityLevel*/)
+{
+}
+
+cxlog::VerbosityLevel BenchmarkLogger::GetVerbosityLevel() const
+{
+    return cxlog::VerbosityLevel::NONE;
+}
+
+size_t CountingMemoryResource::GetNbAllocations() const
+{
+    return m_nbAllocations;
+}
+
+size_t CountingMemoryResource::GetNbBytesInUse() const
+{
+    return m_nbBytesInUse;
+}
+
+size_t CountingMemoryResource::GetPeakNbBytesInUse() const
+{
+    return m_peakNbBytesInUse;
+}
+
+void* CountingMemoryResource::do_allocate(size_t p_bytes, size_t p_alignment)
+{
+    void* const memory = std::pmr::get_default_resource()->allocate(p_bytes, p_alignment);
+
+    ++m_nbAllocations;
+    m_nbBytesInUse += p_bytes;
+    m_peakNbBytesInUse = std::max(m_peakNbBytesInUse, m_nbBytesInUse);
+
+    return memory;
+}
+
+void CountingMemoryResource::do_deallocate(void* p_memory, size_t p_bytes, size_t p_alignment)
+{
+    std::pmr::get_default_resource()->deallocate(p_memory, p_bytes, p_alignment);
+
+    m_nbBytesInUse -= p_bytes;
+}
+
+bool CountingMemoryResource::do_is_equal(const std::pmr::memory_resource& p_other) const noexcept
+{
+    return this == &p_other;
+}
+
+cxmodel::PlayersList MakePlayers(size_t p_nbPlayers)
+{
+    cxmodel::PlayersList players;
+    for(size_t playerIndex = 0u; playerIndex < p_nbPlayers && playerIndex < cxmodel::NB_PLAYER_COLORS; ++playerIndex)
+    {
+        players.push_back(cxmodel::CreatePlayer("Player " + std::to_string(playerIndex + 1u), cxmodel::MakePlayerColor(playerIndex), cxmodel::PlayerType::BOT));
+    }
+
+    return players;
+}
+
+size_t DropChips(cxmodel::IBoard& p_board,
+                 const cxmodel::PlayersList& p_players,
+                 size_t p_nbChips,
+                 std::pmr::vector<cxmodel::IBoard::Position>& p_takenPositions)
+{
+    size_t playerIndex = 0u;
+    for(size_t chipIndex = 0u; chipIndex < p_nbChips; ++chipIndex)
+    {
+        playerIndex = chipIndex % p_players.size();
+
+        cxmodel::IBoard::Position position;
+        if(p_board.DropChip(chipIndex % p_board.GetNbColumns(), p_players[playerIndex]->GetChip(), position))
+        {
+            p_takenPositions.push_back(position);
+        }
+    }
+
+    return playerIndex;
+}
+
+void BoardSizesAndPlayers(benchmark::internal::Benchmark* p_benchmark)
+{
+    p_benchmark->ArgNames({"width", "height", "players"});
+    for(const auto& [width, height] : BOARD_SIZES)
+    {
+        for(const int64_t nbPlayers : {2, 5, 10})
+        {
+            p_benchmark->Args({width, height, nbPlayers});
+        }
+    }
+}
+
+void BoardSizesInARowValuesAndPlayers(benchmark::internal::Benchmark* p_benchmark)
+{
+    p_benchmark->ArgNames({"width", "height", "inarow", "players"});
+    for(const auto& [width, height] : BOARD_SIZES)
+    {
+        for(const int64_t inARowValue : {3, 4, 6, 8})
+        {
+            for(const int64_t nbPlayers : {2, 10})
+            {
+                p_benchmark->Args({width, height, inARowValue, nbPlayers});
+            }
+        }
+    }
+}
@@ -0,0 +1,148 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file BenchmarkHelpers.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef BENCHMARKHELPERS_H_B3B75BEC_08CE_4C20_BB8F_10F8C9D66846
+#define BENCHMARKHELPERS_H_B3B75BEC_08CE_4C20_BB8F_10F8C9D66846
+
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <cxlog/ILogger.h>
+#include <cxmodel/IBoard.h>
+#include <cxmodel/IConnectXLimits.h>
+#include <cxmodel/PlayerInformation.h>
+
+/*********************************************************************************************//**
+ * @brief Limits of the Connect X game, without the need for a model.
+ *
+ ************************************************************************************************/
+class BenchmarkLimits final : public cxmodel::IConnectXLimits
+{
+
+public:
+
+    size_t GetMinimumGridHeight() const override;
+    size_t GetMinimumGridWidth() const override;
+    size_t GetMinimumInARowValue() const override;
+    size_t GetMaximumGridHeight() const override;
+    size_t GetMaximumGridWidth() const override;
+    size_t GetMaximumInARowValue() const override;
+    size_t GetMinimumNumberOfPlayers() const override;
+    size_t GetMaximumNumberOfPlayers() const override;
+
+};
+
+/*********************************************************************************************//**
+ * @brief Logger dropping every message, so that logging does not weigh on measures.
+ *
+ ************************************************************************************************/
+class BenchmarkLogger final : public cxlog::ILogger
+{
+
+public:
+
+    void Log(const cxlog::VerbosityLevel p_verbosityLevel,
+             const std::string&   p_fileName,
+             const std::string&   p_functionName,
+             const size_t         p_lineNumber,
+             const std::string&   p_message) override;
+
+    void SetVerbosityLevel(const cxlog::VerbosityLevel p_verbosityLevel) override;
+    [[nodiscard]] cxlog::VerbosityLevel GetVerbosityLevel() const override;
+
+};
+
+/*********************************************************************************************//**
+ * @brief Memory resource counting what is allocated through it.
+ *
+ * Allocations are forwarded to the default resource.
+ *
+ ************************************************************************************************/
+class CountingMemoryResource final : public std::pmr::memory_resource
+{
+
+public:
+
+    [[nodiscard]] size_t GetNbAllocations() const;
+    [[nodiscard]] size_t GetNbBytesInUse() const;
+    [[nodiscard]] size_t GetPeakNbBytesInUse() const;
+
+private:
+
+    void* do_allocate(size_t p_bytes, size_t p_alignment) override;
+    void do_deallocate(void* p_memory, size_t p_bytes, size_t p_alignment) override;
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& p_other) const noexcept override;
+
+    size_t m_nbAllocations = 0u;
+    size_t m_nbBytesInUse = 0u;
+    size_t m_peakNbBytesInUse = 0u;
+
+};
+
+/*********************************************************************************************//**
+ * @brief Makes a list of bot players, each with its own color.
+ *
+ * @param p_nbPlayers The number of players.
+ *
+ * @return The players.
+ *
+ ************************************************************************************************/
+[[nodiscard]] cxmodel::PlayersList MakePlayers(size_t p_nbPlayers);
+
+/*********************************************************************************************//**
+ * @brief Drops chips, players taking turns, column after column.
+ *
+ * @param p_board          The board to drop chips into.
+ * @param p_players        The players, in turn order.
+ * @param p_nbChips        The number of chips to drop.
+ * @param p_takenPositions The list of taken positions, updated with every drop.
+ *
+ * @return The index of the player who dropped last.
+ *
+ ************************************************************************************************/
+size_t DropChips(cxmodel::IBoard& p_board,
+                 const cxmodel::PlayersList& p_players,
+                 size_t p_nbChips,
+                 std::pmr::vector<cxmodel::IBoard::Position>& p_takenPositions);
+
+/*********************************************************************************************//**
+ * @brief Adds arguments for board sizes, from 7x6 to 64x64, and 2, 5 and 10 players.
+ *
+ * @param p_benchmark The benchmark to add the arguments to.
+ *
+ ************************************************************************************************/
+void BoardSizesAndPlayers(benchmark::internal::Benchmark* p_benchmark);
+
+/*********************************************************************************************//**
+ * @brief Adds arguments for board sizes, from 7x6 to 64x64, in-a-row values from 3 to 8, and
+ *        2 and 10 players.
+ *
+ * @param p_benchmark The benchmark to add the arguments to.
+ *
+ ************************************************************************************************/
+void BoardSizesInARowValuesAndPlayers(benchmark::internal::Benchmark* p_benchmark);
+
+#endif // BENCHMARKHELPERS_H_B3B75BEC_08CE_4C20_BB8F_10F8C9D66846
@@ -0,0 +1,89 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file BoardBenchmarks.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include <cxmodel/Board.h>
+
+#include "BenchmarkHelpers.h"
+
+namespace
+{
+
+void BM_BoardDropChip(benchmark::State& p_state)
+{
+    const size_t width = static_cast<size_t>(p_state.range(0));
+    const size_t height = static_cast<size_t>(p_state.range(1));
+    const cxmodel::PlayersList players = MakePlayers(static_cast<size_t>(p_state.range(2)));
+    const BenchmarkLimits limits;
+
+    // Every iteration fills a new board:
+    for(auto _ : p_state)
+    {
+        p_state.PauseTiming();
+        auto board = std::make_unique<cxmodel::Board>(height, width, limits);
+        p_state.ResumeTiming();
+
+        cxmodel::IBoard::Position position;
+        for(size_t chipIndex = 0u; chipIndex < width * height; ++chipIndex)
+        {
+            benchmark::DoNotOptimize(board->DropChip(chipIndex % width, players[chipIndex % players.size()]->GetChip(), position));
+        }
+
+        p_state.PauseTiming();
+        board.reset();
+        p_state.ResumeTiming();
+    }
+
+    p_state.SetItemsProcessed(p_state.iterations() * static_cast<int64_t>(width * height));
+}
+
+void BM_BoardIsColumnFull(benchmark::State& p_state)
+{
+    const size_t width = static_cast<size_t>(p_state.range(0));
+    const size_t height = static_cast<size_t>(p_state.range(1));
+    const cxmodel::PlayersList players = MakePlayers(static_cast<size_t>(p_state.range(2)));
+    const BenchmarkLimits limits;
+
+    // Half full, so that no column is known to be empty or full in advance:
+    cxmodel::Board board{height, width, limits};
+    std::pmr::vector<cxmodel::IBoard::Position> takenPositions;
+    DropChips(board, players, width * height / 2u, takenPositions);
+
+    for(auto _ : p_state)
+    {
+        for(size_t column = 0u; column < width; ++column)
+        {
+            benchmark::DoNotOptimize(board.IsColumnFull(column));
+        }
+    }
+
+    p_state.SetItemsProcessed(p_state.iterations() * static_cast<int64_t>(width));
+}
+
+} // namespace
+
+BENCHMARK(BM_BoardDropChip)->Apply(BoardSizesAndPlayers);
+BENCHMARK(BM_BoardIsColumnFull)->Apply(BoardSizesAndPlayers);
@@ -0,0 +1,128 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file CommandStackBenchmarks.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include <cxmodel/Board.h>
+#include <cxmodel/CommandCompletionStatus.h>
+#include <cxmodel/CommandDropChip.h>
+#include <cxmodel/CommandStack.h>
+#include <cxmodel/Disc.h>
+
+#include "BenchmarkHelpers.h"
+
+namespace
+{
+
+// Same as the application's:
+constexpr size_t COMMAND_STACK_SIZE = 200u;
+
+/*************************************************************************************************
+ * @brief Measures a chip drop executed through the command stack, then undone and redone.
+ *
+ ************************************************************************************************/
+void BM_CommandStackExecuteUndoRedo(benchmark::State& p_state)
+{
+    const size_t width = static_cast<size_t>(p_state.range(0));
+    const size_t height = static_cast<size_t>(p_state.range(1));
+    const size_t nbPlayers = static_cast<size_t>(p_state.range(2));
+    const BenchmarkLimits limits;
+    BenchmarkLogger logger;
+
+    std::unique_ptr<cxmodel::Board> board;
+    std::unique_ptr<cxmodel::CommandStack> stack;
+    std::unique_ptr<cxmodel::PlayerInformation> playersInfo;
+    std::pmr::vector<cxmodel::IBoard::Position> takenPositions;
+    size_t nbDrops = width * height;
+
+    for(auto _ : p_state)
+    {
+        // Every drop stays on the board, so a new game starts when it is full:
+        if(nbDrops == width * height)
+        {
+            p_state.PauseTiming();
+            board = std::make_unique<cxmodel::Board>(height, width, limits);
+            stack = std::make_unique<cxmodel::CommandStack>(COMMAND_STACK_SIZE);
+            playersInfo = std::make_unique<cxmodel::PlayerInformation>(MakePlayers(nbPlayers), 0u, 1u);
+            takenPositions.clear();
+            nbDrops = 0u;
+            p_state.ResumeTiming();
+        }
+
+        const cxmodel::IPlayer& activePlayer = *playersInfo->m_players[playersInfo->m_activePlayerIndex];
+        auto command = std::make_unique<cxmodel::CommandDropChip>(*board,
+                                                                  *playersInfo,
+                                                                  activePlayer.GetChip(),
+                                                                  nbDrops % width,
+                                                                  takenPositions,
+                                                                  logger);
+
+        benchmark::DoNotOptimize(stack->Execute(std::move(command)));
+        stack->Undo();
+        stack->Redo();
+
+        ++nbDrops;
+    }
+
+    p_state.SetItemsProcessed(p_state.iterations());
+}
+
+// Cheapest command, so that the stack itself is measured:
+class NoOpCommand final : public cxmodel::ICommand
+{
+
+public:
+
+    [[nodiscard]] cxmodel::CommandCompletionStatus Execute() override {return cxmodel::CommandCompletionStatus::SUCCESS;}
+    void Undo() override {}
+
+};
+
+/*************************************************************************************************
+ * @brief Measures commands executed on a full stack, each one evicting the oldest command.
+ *
+ ************************************************************************************************/
+void BM_CommandStackExecuteWhenFull(benchmark::State& p_state)
+{
+    const size_t capacity = static_cast<size_t>(p_state.range(0));
+
+    cxmodel::CommandStack stack{capacity};
+    while(!stack.IsFull())
+    {
+        benchmark::DoNotOptimize(stack.Execute(std::make_unique<NoOpCommand>()));
+    }
+
+    for(auto _ : p_state)
+    {
+        benchmark::DoNotOptimize(stack.Execute(std::make_unique<NoOpCommand>()));
+    }
+
+    p_state.SetItemsProcessed(p_state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(BM_CommandStackExecuteUndoRedo)->Apply(BoardSizesAndPlayers);
+BENCHMARK(BM_CommandStackExecuteWhenFull)->ArgName("capacity")->Arg(200)->Arg(4096)->Arg(100000);
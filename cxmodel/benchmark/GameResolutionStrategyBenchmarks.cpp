@@ -0,0 +1,65 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file GameResolutionStrategyBenchmarks.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <cxmodel/Board.h>
+#include <cxmodel/TieGameResolutionStrategy.h>
+#include <cxmodel/WinGameResolutionStrategy.h>
+
+#include "BenchmarkHelpers.h"
+
+namespace
+{
+
+/*************************************************************************************************
+ * @brief Measures a game resolution strategy on a half full board.
+ *
+ * Half way through a game, the board has enough chips for the strategy to have work to do,
+ * and enough room left for the game to go on.
+ *
+ ************************************************************************************************/
+template<typename Strategy>
+void BM_GameResolutionStrategyHandle(benchmark::State& p_state)
+{
+    const size_t width = static_cast<size_t>(p_state.range(0));
+    const size_t height = static_cast<size_t>(p_state.range(1));
+    const size_t inARowValue = static_cast<size_t>(p_state.range(2));
+    const cxmodel::PlayersList players = MakePlayers(static_cast<size_t>(p_state.range(3)));
+    const BenchmarkLimits limits;
+
+    cxmodel::Board board{height, width, limits};
+    std::pmr::vector<cxmodel::IBoard::Position> takenPositions;
+    const size_t lastPlayerIndex = DropChips(board, players, width * height / 2u, takenPositions);
+
+    const Strategy strategy{board, inARowValue, players, takenPositions};
+    for(auto _ : p_state)
+    {
+        benchmark::DoNotOptimize(strategy.Handle(*players[lastPlayerIndex]));
+    }
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_GameResolutionStrategyHandle, cxmodel::WinGameResolutionStrategy)->Apply(BoardSizesInARowValuesAndPlayers);
+BENCHMARK_TEMPLATE(BM_GameResolutionStrategyHandle, cxmodel::TieGameResolutionStrategy)->Apply(BoardSizesInARowValuesAndPlayers);
@@ -0,0 +1,282 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file ModelBenchmarks.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <cxmodel/CommandStack.h>
+#include <cxmodel/Model.h>
+#include <cxmodel/MoveJournal.h>
+#include <cxmodel/NewGameInformation.h>
+
+#include "BenchmarkHelpers.h"
+
+namespace
+{
+
+// Same as the application's:
+constexpr size_t COMMAND_STACK_SIZE = 200u;
+
+/*************************************************************************************************
+ * @brief Measures the model's chip drops, from the first one to the end of the game.
+ *
+ * This includes the command stack, the game resolution strategies and the notifications, as
+ * seen by the user interface.
+ *
+ ************************************************************************************************/
+void BM_ModelDropChip(benchmark::State& p_state)
+{
+    const size_t width = static_cast<size_t>(p_state.range(0));
+    const size_t height = static_cast<size_t>(p_state.range(1));
+    const size_t inARowValue = static_cast<size_t>(p_state.range(2));
+    const size_t nbPlayers = static_cast<size_t>(p_state.range(3));
+    BenchmarkLogger logger;
+
+    cxmodel::Model model{std::make_unique<cxmodel::CommandStack>(COMMAND_STACK_SIZE), logger};
+
+    const auto startNewGame = [&model, width, height, inARowValue, nbPlayers]()
+    {
+        cxmodel::NewGameInformation gameInformation;
+        gameInformation.m_gridWidth = width;
+        gameInformation.m_gridHeight = height;
+        gameInformation.m_inARowValue = inARowValue;
+
+        // Human players, so that the model does not create bot strategies:
+        for(const auto& player : MakePlayers(nbPlayers))
+        {
+            gameInformation.m_players.push_back(cxmodel::CreatePlayer(player->GetName(), player->GetChip().GetColor(), cxmodel::PlayerType::HUMAN));
+        }
+
+        model.CreateNewGame(std::move(gameInformation));
+    };
+
+    startNewGame();
+
+    size_t nbGameDrops = 0u;
+    for(auto _ : p_state)
+    {
+        model.DropChip(model.GetActivePlayer().GetChip(), nbGameDrops % width);
+        ++nbGameDrops;
+
+        if(model.IsWon() || model.IsTie() || nbGameDrops == width * height)
+        {
+            p_state.PauseTiming();
+            model.EndCurrentGame();
+            startNewGame();
+            nbGameDrops = 0u;
+            p_state.ResumeTiming();
+        }
+    }
+
+    p_state.SetItemsProcessed(p_state.iterations());
+}
+
+/*************************************************************************************************
+ * @brief Measures what a model allocates from its memory resource, for whole sessions.
+ *
+ * Each iteration creates a model in its own resource and plays a game to its end. The
+ * @c allocs_per_move counter is the number of allocations made by chip drops, and the
+ * @c bytes_per_session counter is the most memory the session used at once. The undo history
+ * is either kept in a command stack or in a move journal.
+ *
+ ************************************************************************************************/
+void BM_ModelSession(benchmark::State& p_state)
+{
+    const size_t width = static_cast<size_t>(p_state.range(0));
+    const size_t height = static_cast<size_t>(p_state.range(1));
+    const size_t inARowValue = static_cast<size_t>(p_state.range(2));
+    const size_t nbPlayers = static_cast<size_t>(p_state.range(3));
+    const bool isJournaled = p_state.range(4) != 0;
+    BenchmarkLogger logger;
+
+    size_t nbDrops = 0u;
+    size_t nbDropAllocations = 0u;
+    size_t nbSessionBytes = 0u;
+
+    for(auto _ : p_state)
+    {
+        CountingMemoryResource resource;
+
+        {
+            std::unique_ptr<cxmodel::Model> modelPtr;
+            if(isJournaled)
+            {
+                modelPtr = std::make_unique<cxmodel::Model>(cxmodel::MoveJournal{COMMAND_STACK_SIZE, &resource}, logger, &resource);
+            }
+            else
+            {
+                modelPtr = std::make_unique<cxmodel::Model>(std::unique_ptr<cxmodel::ICommandStack>{new(&resource) cxmodel::CommandStack(COMMAND_STACK_SIZE, &resource)}, logger, &resource);
+            }
+            cxmodel::Model& model = *modelPtr;
+
+            cxmodel::NewGameInformation gameInformation;
+            gameInformation.m_gridWidth = width;
+            gameInformation.m_gridHeight = height;
+            gameInformation.m_inARowValue = inARowValue;
+
+            // Human players, so that the model does not create bot strategies:
+            for(const auto& player : MakePlayers(nbPlayers))
+            {
+                gameInformation.m_players.push_back(cxmodel::CreatePlayer(player->GetName(), player->GetChip().GetColor(), cxmodel::PlayerType::HUMAN));
+            }
+
+            model.CreateNewGame(std::move(gameInformation));
+
+            const size_t nbAllocationsBeforeDrops = resource.GetNbAllocations();
+
+            size_t nbGameDrops = 0u;
+            while(!model.IsWon() && !model.IsTie() && nbGameDrops < width * height)
+            {
+                model.DropChip(model.GetActivePlayer().GetChip(), nbGameDrops % width);
+                ++nbGameDrops;
+            }
+
+            nbDrops += nbGameDrops;
+            nbDropAllocations += resource.GetNbAllocations() - nbAllocationsBeforeDrops;
+        }
+
+        nbSessionBytes += resource.GetPeakNbBytesInUse();
+    }
+
+    p_state.counters["allocs_per_move"] = nbDrops > 0u ? static_cast<double>(nbDropAllocations) / static_cast<double>(nbDrops) : 0.0;
+    p_state.counters["bytes_per_session"] = static_cast<double>(nbSessionBytes) / static_cast<double>(p_state.iterations());
+    p_state.SetItemsProcessed(p_state.iterations());
+}
+
+// A game filling a 62x64 board without a win: four players drop in turn, from the left column
+// to the right one, so that no two neighbour chips (in any direction) are of the same player:
+constexpr size_t LONG_GAME_WIDTH = 62u;
+constexpr size_t LONG_GAME_HEIGHT = 64u;
+constexpr size_t LONG_GAME_NB_PLAYERS = 4u;
+
+std::unique_ptr<cxmodel::Model> MakeLongGameModel(bool p_isJournaled, cxlog::ILogger& p_logger)
+{
+    std::unique_ptr<cxmodel::Model> model;
+    if(p_isJournaled)
+    {
+        model = std::make_unique<cxmodel::Model>(cxmodel::MoveJournal{LONG_GAME_WIDTH * LONG_GAME_HEIGHT}, p_logger);
+    }
+    else
+    {
+        model = std::make_unique<cxmodel::Model>(std::make_unique<cxmodel::CommandStack>(LONG_GAME_WIDTH * LONG_GAME_HEIGHT), p_logger);
+    }
+
+    return model;
+}
+
+void StartLongGame(cxmodel::Model& p_model)
+{
+    cxmodel::NewGameInformation gameInformation;
+    gameInformation.m_gridWidth = LONG_GAME_WIDTH;
+    gameInformation.m_gridHeight = LONG_GAME_HEIGHT;
+    gameInformation.m_inARowValue = 4u;
+
+    for(const auto& player : MakePlayers(LONG_GAME_NB_PLAYERS))
+    {
+        gameInformation.m_players.push_back(cxmodel::CreatePlayer(player->GetName(), player->GetChip().GetColor(), cxmodel::PlayerType::HUMAN));
+    }
+
+    p_model.CreateNewGame(std::move(gameInformation));
+}
+
+std::vector<size_t> MakeLongGameColumns()
+{
+    std::vector<size_t> columns(LONG_GAME_WIDTH * LONG_GAME_HEIGHT);
+    for(size_t drop = 0u; drop < columns.size(); ++drop)
+    {
+        columns[drop] = drop % LONG_GAME_WIDTH;
+    }
+
+    return columns;
+}
+
+/*************************************************************************************************
+ * @brief Measures loading a long game (3968 drops) by dropping its chips one by one.
+ *
+ ************************************************************************************************/
+void BM_ModelDropChipLongGame(benchmark::State& p_state)
+{
+    BenchmarkLogger logger;
+    const std::unique_ptr<cxmodel::Model> model = MakeLongGameModel(p_state.range(0) != 0, logger);
+    const std::vector<size_t> columns = MakeLongGameColumns();
+
+    for(auto _ : p_state)
+    {
+        p_state.PauseTiming();
+        StartLongGame(*model);
+        p_state.ResumeTiming();
+
+        for(const size_t column : columns)
+        {
+            model->DropChip(model->GetActivePlayer().GetChip(), column);
+        }
+
+        p_state.PauseTiming();
+        model->EndCurrentGame();
+        p_state.ResumeTiming();
+    }
+
+    p_state.SetItemsProcessed(p_state.iterations() * static_cast<int64_t>(columns.size()));
+}
+
+/*************************************************************************************************
+ * @brief Measures loading a long game (3968 drops) with a single @c ApplyMoves call.
+ *
+ ************************************************************************************************/
+void BM_ModelApplyMovesLongGame(benchmark::State& p_state)
+{
+    BenchmarkLogger logger;
+    const std::unique_ptr<cxmodel::Model> model = MakeLongGameModel(p_state.range(0) != 0, logger);
+    const std::vector<size_t> columns = MakeLongGameColumns();
+
+    for(auto _ : p_state)
+    {
+        p_state.PauseTiming();
+        StartLongGame(*model);
+        p_state.ResumeTiming();
+
+        benchmark::DoNotOptimize(model->ApplyMoves(columns));
+
+        p_state.PauseTiming();
+        model->EndCurrentGame();
+        p_state.ResumeTiming();
+    }
+
+    p_state.SetItemsProcessed(p_state.iterations() * static_cast<int64_t>(columns.size()));
+}
+
+} // namespace
+
+BENCHMARK(BM_ModelDropChipLongGame)->ArgName("journal")->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ModelApplyMovesLongGame)->ArgName("journal")->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ModelDropChip)->Apply(BoardSizesInARowValuesAndPlayers);
+// Full games are slow to resolve on large boards with many players, so only a few are played:
+BENCHMARK(BM_ModelSession)->ArgNames({"width", "height", "inarow", "players", "journal"})
+                          ->Args({7, 6, 4, 2, 0})
+                          ->Args({16, 16, 4, 5, 0})
+                          ->Args({64, 64, 4, 2, 0})
+                          ->Args({7, 6, 4, 2, 1})
+                          ->Args({16, 16, 4, 5, 1})
+                          ->Args({64, 64, 4, 2, 1});
@@ -0,0 +1,140 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file AnalysisService.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef ANALYSISSERVICE_H_BC0E48AB_663E_40F6_BA85_CDC7EF755D90
+#define ANALYSISSERVICE_H_BC0E48AB_663E_40F6_BA85_CDC7EF755D90
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include "BoardSnapshot.h"
+#include "Search.h"
+
+namespace cxmodel
+{
+
+/**********************************************************************************************//**
+ * @brief Scores every column of a position, in the background.
+ *
+ * The service owns a worker thread, on which positions submitted to it are analyzed with an
+ * anytime search. As the search deepens, the latest result is made available and the owner
+ * is called back, at a bounded rate. Submitting and cancelling never wait for the search:
+ * the running search is only asked to stop.
+ *
+ * @note The update callback is called from the worker thread.
+ *
+ *************************************************************************************************/
+class AnalysisService
+{
+
+public:
+
+    /** Called, from the worker thread, when a new result is available. */
+    using UpdateCallback = std::function<void()>;
+
+    /******************************************************************************************//**
+     * @brief Constructor. Starts the worker thread.
+     *
+     * @param p_onUpdate            Called when a new result is available.
+     * @param p_limits              The limits applied to each analysis.
+     * @param p_minUpdateInterval   The minimum time between two update calls.
+     *
+     * @pre The update callback is valid.
+     *
+     ********************************************************************************************/
+    AnalysisService(UpdateCallback p_onUpdate,
+                    const SearchLimits& p_limits,
+                    std::chrono::milliseconds p_minUpdateInterval);
+
+    /******************************************************************************************//**
+     * @brief Destructor. Stops the running analysis, if any, and joins the worker thread.
+     *
+     ********************************************************************************************/
+    ~AnalysisService();
+
+    AnalysisService(const AnalysisService&) = delete;
+    AnalysisService& operator=(const AnalysisService&) = delete;
+
+    /******************************************************************************************//**
+     * @brief Starts analyzing a position. The running analysis, if any, is cancelled.
+     *
+     * @param p_position The position to analyze.
+     *
+     ********************************************************************************************/
+    void Submit(const BoardSnapshot& p_position);
+
+    /******************************************************************************************//**
+     * @brief Cancels the running analysis, if any, and clears the latest result.
+     *
+     ********************************************************************************************/
+    void Cancel();
+
+    /******************************************************************************************//**
+     * @brief Gets the latest result for the position being analyzed.
+     *
+     * @return The latest result. It is empty (no scores) until the first iteration completes.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] SearchResult GetLatestResult() const;
+
+    /******************************************************************************************//**
+     * @brief Indicates if an analysis is pending or running.
+     *
+     * @return `true` if a position is being analyzed, `false` otherwise.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] bool IsRunning() const;
+
+private:
+
+    void Run();
+    void Publish(const SearchResult& p_result, size_t p_generation, bool p_isFinal);
+
+    const UpdateCallback m_onUpdate;
+    const SearchLimits m_limits;
+    const std::chrono::milliseconds m_minUpdateInterval;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_condition;
+
+    // All of these are protected by the mutex. The generation is incremented on every submit
+    // or cancel, so that the worker can tell if its results are still wanted:
+    std::optional<BoardSnapshot> m_pendingPosition;
+    SearchResult m_latestResult;
+    size_t m_generation = 0u;
+    bool m_isRunning = false;
+    bool m_isShuttingDown = false;
+    std::chrono::steady_clock::time_point m_lastUpdate;
+
+    std::atomic<bool> m_stop{false};
+    std::thread m_worker;
+};
+
+} // namespace cxmodel
+
+#endif // ANALYSISSERVICE_H_BC0E48AB_663E_40F6_BA85_CDC7EF755D90
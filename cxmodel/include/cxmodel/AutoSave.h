@@ -0,0 +1,98 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file AutoSave.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef AUTOSAVE_H_7818DA86_E304_481A_9A69_770AA332C3AA
+#define AUTOSAVE_H_7818DA86_E304_481A_9A69_770AA332C3AA
+
+#include <string>
+
+#include "ModelNotificationContext.h"
+#include "SavedGame.h"
+#include "Status.h"
+
+namespace cxmodel
+{
+    class Model;
+}
+
+namespace cxmodel
+{
+
+/**********************************************************************************************//**
+ * @brief Keeps a saved game in sync with the current game of a model.
+ *
+ * The file is created again for each new game. After that, each change to the moves only
+ * appends the new moves to it, or forgets the undone ones, so that a crash loses at most the
+ * move being saved.
+ *
+ *************************************************************************************************/
+class AutoSave : private IModelObserver
+{
+
+public:
+
+    /******************************************************************************************//**
+     * @brief Constructor. Nothing is saved until a new game is created.
+     *
+     * @param p_model   The model to save. It must outlive the auto save.
+     * @param p_path    The file path. An existing file is replaced when a game is saved.
+     *
+     ********************************************************************************************/
+    AutoSave(Model& p_model, std::string p_path);
+
+    /******************************************************************************************//**
+     * @brief Destructor. The saved game is left as is.
+     *
+     ********************************************************************************************/
+    ~AutoSave() override;
+
+    AutoSave(const AutoSave&) = delete;
+    AutoSave& operator=(const AutoSave&) = delete;
+
+    /******************************************************************************************//**
+     * @brief Gets the status of the last save.
+     *
+     * @return A success, or an error describing why the last save failed. On failure, nothing
+     *         is saved until the next game.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] const Status& GetStatus() const {return m_status;}
+
+private:
+
+    void Update(ModelNotificationContext p_context, ModelSubject* p_subject) override;
+
+    void Create();
+    void Synchronize();
+
+    Model& m_model;
+    const std::string m_path;
+    ModelSubject::Subscription m_subscription;
+
+    SavedGame m_savedGame;
+    Status m_status;
+};
+
+} // namespace cxmodel
+
+#endif // AUTOSAVE_H_7818DA86_E304_481A_9A69_770AA332C3AA
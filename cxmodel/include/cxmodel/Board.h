@@ -24,9 +24,10 @@
 #ifndef BOARD_H_22FBC1EE_999E_416C_B947_05B6CDF6DBB8
 #define BOARD_H_22FBC1EE_999E_416C_B947_05B6CDF6DBB8
 
-#include <memory>
+#include <memory_resource>
 #include <vector>
 
+#include "Disc.h"
 #include "IBoard.h"
 #include "IConnectXLimits.h"
 
@@ -51,12 +52,17 @@ public:
      *      The number of columns to include in the board.
      * @param p_modelAsLimits
      *      The model limits.
+     * @param p_resource
+     *      The memory resource the cells are allocated from. It must outlive the board.
 
      * @pre
      *      The number of rows and columns fall within the model limits.
      *
      *********************************************************************************************/
-    Board(size_t p_nbRows, size_t p_nbColumns, const IConnectXLimits& p_modelAsLimits);
+    Board(size_t p_nbRows,
+          size_t p_nbColumns,
+          const IConnectXLimits& p_modelAsLimits,
+          std::pmr::memory_resource* p_resource = std::pmr::get_default_resource());
 
     // cxmodel::IBoard:
     size_t GetNbRows() const override;
@@ -66,12 +72,17 @@ public:
     bool DropChip(size_t p_column, const IChip& p_chip, Position& p_droppedPosition) override;
     void ResetChip(Position& p_position) override;
     bool IsColumnFull(size_t p_column) const override;
+    [[nodiscard]] CanonicalPositionKey GetCanonicalKey() const override;
 
 private:
 
     void CheckInvariants() const;
+    void UpdateKeys(const Position& p_position, const IChip& p_chip);
 
-    using Grid = std::vector<std::vector<std::unique_ptr<IChip>>>;
+    [[nodiscard]] size_t GetIndex(const Position& p_position) const;
+
+    // Cells, row by row, from the bottom row:
+    using Grid = std::pmr::vector<Disc>;
 
     Grid m_grid;
     const size_t m_nbRows;
@@ -79,6 +90,10 @@ private:
 
     const IConnectXLimits& m_modelAsLimits;
 
+    // Keys of the board and of its mirror image:
+    PositionKey m_key = 0u;
+    PositionKey m_mirroredKey = 0u;
+
 };
 
 } // namespace cxmodel
@@ -0,0 +1,242 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file BoardSnapshot.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef BOARDSNAPSHOT_H_7A224A3E_51D9_4DB6_BD7F_AD45CA760656
+#define BOARDSNAPSHOT_H_7A224A3E_51D9_4DB6_BD7F_AD45CA760656
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "PlayerInformation.h"
+#include "PositionKey.h"
+
+namespace cxmodel
+{
+    class IBoard;
+}
+
+namespace cxmodel
+{
+
+/**********************************************************************************************//**
+ * @brief Compact copy of a game board, suited for searching.
+ *
+ * Unlike the game board, which stores chips, a snapshot only stores, for each position, the
+ * index of the player owning it. It also knows whose turn it is, so that drops can be made
+ * and undone quickly and without any allocation. Snapshots are self-contained: they can be
+ * copied and handed over to another thread.
+ *
+ *************************************************************************************************/
+class BoardSnapshot
+{
+
+public:
+
+    /** Player index returned for positions where no chip was dropped. */
+    static constexpr size_t NO_PLAYER = std::numeric_limits<size_t>::max();
+
+    /******************************************************************************************//**
+     * @brief Constructor. Creates an empty snapshot, where the first player is active.
+     *
+     * @param p_nbRows       The number of rows in the board.
+     * @param p_nbColumns    The number of columns in the board.
+     * @param p_inARowValue  The in-a-row value.
+     * @param p_nbPlayers    The number of players.
+     *
+     * @pre The number of rows and columns are greater than 0.
+     * @pre The in-a-row value is greater than 1.
+     * @pre The number of players is between 2 and 254.
+     *
+     ********************************************************************************************/
+    BoardSnapshot(size_t p_nbRows, size_t p_nbColumns, size_t p_inARowValue, size_t p_nbPlayers);
+
+    [[nodiscard]] size_t GetNbRows() const {return m_nbRows;}
+    [[nodiscard]] size_t GetNbColumns() const {return m_nbColumns;}
+    [[nodiscard]] size_t GetInARowValue() const {return m_inARowValue;}
+    [[nodiscard]] size_t GetNbPlayers() const {return m_nbPlayers;}
+    [[nodiscard]] size_t GetActivePlayerIndex() const {return m_activePlayerIndex;}
+    [[nodiscard]] size_t GetNbDrops() const {return m_nbDrops;}
+
+    /******************************************************************************************//**
+     * @brief Gets the index of the player owning a position.
+     *
+     * @param p_row    The position row (row 0 is the bottom row).
+     * @param p_column The position column.
+     *
+     * @pre The position is inside the board.
+     *
+     * @return The player index, or `NO_PLAYER` if the position is free.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] size_t GetPlayerIndex(size_t p_row, size_t p_column) const
+    {
+        const uint8_t cell = m_cells[p_column * m_nbRows + p_row];
+        return cell == EMPTY ? NO_PLAYER : cell - 1u;
+    }
+
+    /******************************************************************************************//**
+     * @brief Gets the number of chips in a column.
+     *
+     * @param p_column The column.
+     *
+     * @return The number of chips in the column.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] size_t GetColumnHeight(size_t p_column) const {return m_heights[p_column];}
+
+    /******************************************************************************************//**
+     * @brief Indicates if a column is full.
+     *
+     * @param p_column The column.
+     *
+     * @return `true` if no more chips can be dropped in the column, `false` otherwise.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] bool IsColumnFull(size_t p_column) const {return m_heights[p_column] >= m_nbRows;}
+
+    /******************************************************************************************//**
+     * @brief Indicates if the board is full.
+     *
+     * @return `true` if no more chips can be dropped, `false` otherwise.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] bool IsFull() const {return m_nbDrops == m_nbRows * m_nbColumns;}
+
+    /******************************************************************************************//**
+     * @brief Drops a chip for the active player. The next player then becomes active.
+     *
+     * @param p_column The column in which to drop.
+     *
+     * @pre The column is not full.
+     *
+     ********************************************************************************************/
+    void DropChip(size_t p_column);
+
+    /******************************************************************************************//**
+     * @brief Undoes the last drop made in a column. The previous player then becomes active.
+     *
+     * @param p_column The column in which the last drop was made.
+     *
+     * @pre The column is not empty.
+     *
+     ********************************************************************************************/
+    void UndoDrop(size_t p_column);
+
+    /******************************************************************************************//**
+     * @brief Places a chip without changing the active player.
+     *
+     * This is used to rebuild a position for which the drop order is unknown.
+     *
+     * @param p_column      The column in which to place the chip.
+     * @param p_playerIndex The index of the player owning the chip.
+     *
+     * @pre The column is not full.
+     * @pre The player index is smaller than the number of players.
+     *
+     ********************************************************************************************/
+    void PlaceChip(size_t p_column, size_t p_playerIndex);
+
+    /******************************************************************************************//**
+     * @brief Sets the active player.
+     *
+     * @param p_playerIndex The index of the player who will drop next.
+     *
+     * @pre The player index is smaller than the number of players.
+     *
+     ********************************************************************************************/
+    void SetActivePlayerIndex(size_t p_playerIndex);
+
+    /******************************************************************************************//**
+     * @brief Indicates if the top chip of a column is part of a winning line.
+     *
+     * This is meant to be called right after a drop, to know if it won the game.
+     *
+     * @param p_column The column in which the last drop was made.
+     *
+     * @pre The column is not empty.
+     *
+     * @return `true` if the top chip of the column completes at least in-a-row value chips of
+     *         the same player, in any direction, `false` otherwise.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] bool IsLastDropWinning(size_t p_column) const;
+
+    /******************************************************************************************//**
+     * @brief Gets the canonical key of the snapshot.
+     *
+     * Chips are identified by their owner's index, so that the keys do not depend on colors.
+     * They are maintained as chips are dropped, placed and undone.
+     *
+     * @return The canonical key.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] CanonicalPositionKey GetCanonicalKey() const {return MakeCanonicalPositionKey(m_key, m_mirroredKey);}
+
+private:
+
+    static constexpr uint8_t EMPTY = 0u;
+
+    void UpdateKeys(size_t p_row, size_t p_column, uint8_t p_cell);
+    [[nodiscard]] size_t CountInDirection(size_t p_row, size_t p_column, int p_rowStep, int p_columnStep, uint8_t p_cell) const;
+
+    size_t m_nbRows;
+    size_t m_nbColumns;
+    size_t m_inARowValue;
+    size_t m_nbPlayers;
+
+    size_t m_activePlayerIndex = 0u;
+    size_t m_nbDrops = 0u;
+
+    // Column major: position (row, column) is at index column * m_nbRows + row. A cell holds
+    // EMPTY, or the owning player index plus one:
+    std::vector<uint8_t> m_cells;
+    std::vector<uint8_t> m_heights;
+
+    PositionKey m_key = 0u;
+    PositionKey m_mirroredKey = 0u;
+};
+
+/**********************************************************************************************//**
+ * @brief Creates a snapshot of a game board.
+ *
+ * Each chip on the board is attributed to the player owning a chip of the same color.
+ *
+ * @param p_board             The game board.
+ * @param p_inARowValue       The in-a-row value.
+ * @param p_playerInformation The players, and who is active.
+ *
+ * @pre There are at least two players.
+ * @pre Each chip on the board belongs to one of the players.
+ *
+ * @return The snapshot.
+ *
+ *************************************************************************************************/
+[[nodiscard]] BoardSnapshot MakeBoardSnapshot(const IBoard& p_board,
+                                              size_t p_inARowValue,
+                                              const PlayerInformation& p_playerInformation);
+
+} // namespace cxmodel
+
+#endif // BOARDSNAPSHOT_H_7A224A3E_51D9_4DB6_BD7F_AD45CA760656
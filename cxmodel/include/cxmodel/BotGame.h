@@ -0,0 +1,89 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file BotGame.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef BOTGAME_H_5DED4AE1_687B_41AD_A942_890758E9403D
+#define BOTGAME_H_5DED4AE1_687B_41AD_A942_890758E9403D
+
+#include <cstddef>
+#include <optional>
+#include <string>
+
+#include "IConnectXAI.h"
+#include "IConnectXGameActions.h"
+#include "IConnectXGameInformation.h"
+
+namespace cxmodel
+{
+
+/**********************************************************************************************//**
+ * @brief Outcome of a game played by bots only.
+ *
+ *************************************************************************************************/
+struct BotGameOutcome final
+{
+    /** `false` if the game went on longer than the board allows, `true` otherwise. */
+    bool m_isOver = false;
+
+    /** The index of the winning player in the game's player list. Empty on a tie. */
+    std::optional<size_t> m_winnerIndex;
+
+    /** The number of chips dropped by the bots. */
+    size_t m_nbMoves = 0u;
+};
+
+/**********************************************************************************************//**
+ * @brief Makes the name of a bot.
+ *
+ * @param p_botIndex The index of the bot, starting at 0.
+ *
+ * @return The bot's name ("Bot 1" for index 0, and so on).
+ *
+ *************************************************************************************************/
+[[nodiscard]] std::string MakeBotName(size_t p_botIndex);
+
+/**********************************************************************************************//**
+ * @brief Lets the bots play the current game until it is won or tied.
+ *
+ * The game is not ended, so that its information (statistics, seed, ...) can still be read.
+ *
+ * @pre The current game has only bot players.
+ * @pre The players drop in the order of the game's player list.
+ *
+ * @param p_actions     The model's game actions.
+ * @param p_information The model's game information.
+ * @param p_ai          The model's AI.
+ * @param p_nbPlayers   The number of players in the current game.
+ * @param p_nbDrops     The number of chips already dropped in the current game.
+ *
+ * @return The outcome of the game.
+ *
+ *************************************************************************************************/
+[[nodiscard]] BotGameOutcome PlayBotGame(IConnectXGameActions& p_actions,
+                                         const IConnectXGameInformation& p_information,
+                                         const IConnectXAI& p_ai,
+                                         size_t p_nbPlayers,
+                                         size_t p_nbDrops = 0u);
+
+} // namespace cxmodel
+
+#endif // BOTGAME_H_5DED4AE1_687B_41AD_A942_890758E9403D
@@ -0,0 +1,124 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file BotSettings.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef BOTSETTINGS_H_876F6129_914F_421D_9A5B_61FD11EEAF86
+#define BOTSETTINGS_H_876F6129_914F_421D_9A5B_61FD11EEAF86
+
+#include <cstddef>
+#include <iosfwd>
+#include <optional>
+#include <string>
+
+#include "INextDropColumnComputationStrategy.h"
+
+namespace cxmodel
+{
+
+/**********************************************************************************************//**
+ * @brief Units in which a bot search budget is expressed.
+ *
+ *************************************************************************************************/
+enum class SearchBudgetType
+{
+    TIME,  ///< The budget is a number of milliseconds.
+    NODES, ///< The budget is a number of searched nodes.
+};
+
+/**********************************************************************************************//**
+ * @brief Settings for a bot player.
+ *
+ * Each bot player carries its own settings, which are used by the model to create the
+ * (long-lived) strategy computing the bot's moves. Strategies that do not search (for
+ * example, the random strategy) simply ignore the budget and hash size.
+ *
+ *************************************************************************************************/
+struct BotSettings final
+{
+    /** The algorithm used to compute the bot's moves. */
+    DropColumnComputation m_algorithm = DropColumnComputation::RANDOM;
+
+    /** The units in which the search budget is expressed. */
+    SearchBudgetType m_budgetType = SearchBudgetType::TIME;
+
+    /** The search budget, in the units of `m_budgetType`. Zero means the strategy default. */
+    size_t m_budget = 0u;
+
+    /** The size of the strategy's hash table, in megabytes. Zero means no hash table. */
+    size_t m_hashSizeInMB = 0u;
+};
+
+/** Hash table size, in megabytes, of alpha-beta bots made by `MakeBotSettings`. */
+constexpr size_t DEFAULT_BOT_HASH_SIZE_IN_MB = 16u;
+
+/**********************************************************************************************//**
+ * @brief Equal-to operator.
+ *
+ * @param p_lhs The left hand side bot settings.
+ * @param p_rhs The right hand side bot settings.
+ *
+ * @return `true` if all settings are the same, `false` otherwise.
+ *
+ *************************************************************************************************/
+bool operator==(const BotSettings& p_lhs, const BotSettings& p_rhs);
+
+/**********************************************************************************************//**
+ * @brief Not-equal-to operator.
+ *
+ * @param p_lhs The left hand side bot settings.
+ * @param p_rhs The right hand side bot settings.
+ *
+ * @return `true` if at least one setting differs, `false` otherwise.
+ *
+ *************************************************************************************************/
+bool operator!=(const BotSettings& p_lhs, const BotSettings& p_rhs);
+
+/**********************************************************************************************//**
+ * @brief Makes bot settings from a short description.
+ *
+ * A description is an algorithm name, optionally followed by a per move budget, for example
+ * "random", "alphabeta", "alphabeta:250ms" or "alphabeta:100000nodes". The hash size is not part
+ * of the description: alpha-beta bots get `DEFAULT_BOT_HASH_SIZE_IN_MB`.
+ *
+ * @param p_description The description.
+ *
+ * @return The bot settings, if the description is valid, nothing otherwise.
+ *
+ *************************************************************************************************/
+[[nodiscard]] std::optional<BotSettings> MakeBotSettings(const std::string& p_description);
+
+/**********************************************************************************************//**
+ * @brief Stream output operator.
+ *
+ * Writes the settings short description, as understood by `MakeBotSettings`.
+ *
+ * @param p_stream   The stream to write to.
+ * @param p_settings The settings to write.
+ *
+ * @return The stream, after the settings have been written.
+ *
+ *************************************************************************************************/
+std::ostream& operator<<(std::ostream& p_stream, const BotSettings& p_settings);
+
+} // namespace cxmodel
+
+#endif // BOTSETTINGS_H_876F6129_914F_421D_9A5B_61FD11EEAF86
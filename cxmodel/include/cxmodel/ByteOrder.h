@@ -0,0 +1,71 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file ByteOrder.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef BYTEORDER_H_699B7F0E_C709_433E_B6E7_F9E30BD0483E
+#define BYTEORDER_H_699B7F0E_C709_433E_B6E7_F9E30BD0483E
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cxmodel
+{
+
+/**********************************************************************************************//**
+ * @brief Writes a number in little endian order, so that files read the same on any machine.
+ *
+ * @param p_destination The first byte to write.
+ * @param p_value       The number. Only its lowest bytes are written.
+ * @param p_size        The number of bytes to write, at most 8.
+ *
+ *************************************************************************************************/
+inline void WriteLittleEndian(std::byte* p_destination, std::uint64_t p_value, size_t p_size)
+{
+    for(size_t index = 0u; index < p_size; ++index)
+    {
+        p_destination[index] = static_cast<std::byte>((p_value >> (8u * index)) & 0xFFu);
+    }
+}
+
+/**********************************************************************************************//**
+ * @brief Reads a number written by @c WriteLittleEndian.
+ *
+ * @param p_source  The first byte to read.
+ * @param p_size    The number of bytes to read, at most 8.
+ *
+ * @return The number.
+ *
+ *************************************************************************************************/
+[[nodiscard]] inline std::uint64_t ReadLittleEndian(const std::byte* p_source, size_t p_size)
+{
+    std::uint64_t value = 0u;
+    for(size_t index = 0u; index < p_size; ++index)
+    {
+        value |= std::to_integer<std::uint64_t>(p_source[index]) << (8u * index);
+    }
+
+    return value;
+}
+
+} // namespace cxmodel
+
+#endif // BYTEORDER_H_699B7F0E_C709_433E_B6E7_F9E30BD0483E
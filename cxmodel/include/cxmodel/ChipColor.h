@@ -24,6 +24,7 @@
 #ifndef CHIPCOLOR_H_B5759AA2_F394_4B95_900C_C9DEA836633B
 #define CHIPCOLOR_H_B5759AA2_F394_4B95_900C_C9DEA836633B
 
+#include <cstddef>
 #include <limits>
 
 #include "Color.h"
@@ -169,6 +170,27 @@ using ChipColor = Color<unsigned short>;
     return ChipColor{65535u, 41377u, 33410u};
 }
 
+/** The number of player colors, one for each player the game allows. */
+constexpr size_t NB_PLAYER_COLORS = 10u;
+
+/******************************************************************************************//**
+ * @brief Makes the default color of a player.
+ *
+ * Every player gets a different color, in order: red, blue, yellow, green, pink, orange,
+ * aqua, black, lilac and salmon.
+ *
+ * @pre
+ *      The player index is less than `NB_PLAYER_COLORS`.
+ *
+ * @param p_playerIndex
+ *      The index of the player, starting at 0.
+ *
+ * @return
+ *      The player's chip color.
+ *
+ *********************************************************************************************/
+[[nodiscard]] ChipColor MakePlayerColor(size_t p_playerIndex);
+
 /******************************************************************************************//**
  * @brief Factory method for creating chip colors from HSL values. Colors are opaque.
  *
@@ -24,6 +24,7 @@
 #ifndef COMMANDCREATENEWGAME_H_42E0AF3C_C0D0_44F7_B472_9F2E0E11216D
 #define COMMANDCREATENEWGAME_H_42E0AF3C_C0D0_44F7_B472_9F2E0E11216D
 
+#include <memory_resource>
 #include <vector>
 
 #include <cxlog/ILogger.h>
@@ -59,13 +60,16 @@ public:
      * @param p_players             The model's list of players.
      * @param p_inARowValue         The model's in-a-row value.
      * @param p_newGameInformation  The new game information from which to initialize a game.
+     * @param p_resource            The memory resource the new board is allocated from. It must
+     *                              outlive the board.
      *
      ********************************************************************************************/
     CommandCreateNewGame(const IConnectXLimits& p_modelAsLimits,
                          std::unique_ptr<IBoard>& p_board,
                          std::vector<std::shared_ptr<IPlayer>>& p_players,
                          size_t& p_inARowValue,
-                         NewGameInformation p_newGameInformation);
+                         NewGameInformation p_newGameInformation,
+                         std::pmr::memory_resource* p_resource = std::pmr::get_default_resource());
 
     [[nodiscard]] CommandCompletionStatus Execute() override;
     void Undo() override;
@@ -79,6 +83,7 @@ private:
     size_t& m_inARowValue;
 
     NewGameInformation m_newGameInformation;
+    std::pmr::memory_resource* const m_resource;
 
 };
 
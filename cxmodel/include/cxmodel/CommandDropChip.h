@@ -25,8 +25,10 @@
 #define COMMANDDROPCHIP_H_412DF355_E70F_413B_B531_63838B549644
 
 #include <memory>
+#include <memory_resource>
 #include <vector>
 
+#include "Disc.h"
 #include "IBoard.h"
 #include "ICommand.h"
 #include "ModelNotificationContext.h"
@@ -76,14 +78,18 @@ public:
      *      A collection of non-free positions.
      * @param p_logger
      *      A logger. It will log intersting information about the execution.
+     * @param p_resource
+     *      The memory resource the command's own storage is allocated from. It must outlive
+     *      the command.
      *
      ********************************************************************************************/
     CommandDropChip(IBoard& p_board,
                     PlayerInformation& p_playersInfo,
-                    std::unique_ptr<cxmodel::IChip>&& p_droppedChip,
+                    const cxmodel::IChip& p_droppedChip,
                     const size_t p_column,
-                    std::vector<IBoard::Position>& p_takenPositions,
-                    cxlog::ILogger& p_logger);
+                    std::pmr::vector<IBoard::Position>& p_takenPositions,
+                    cxlog::ILogger& p_logger,
+                    std::pmr::memory_resource* p_resource = std::pmr::get_default_resource());
 
     // ICommand:
     [[nodiscard]] CommandCompletionStatus Execute() override;
@@ -93,13 +99,16 @@ private:
 
     IBoard& m_board;
     PlayerInformation& m_playersInfo;
-    const std::unique_ptr<cxmodel::IChip> m_droppedChip;
+    const Disc m_droppedChip;
     const size_t m_column;
-    std::vector<IBoard::Position>& m_takenPositions;
+    std::pmr::vector<IBoard::Position>& m_takenPositions;
     cxlog::ILogger& m_logger;
 
     // Members stored for undoing the drop:
-    const PlayerInformation m_previousPlayerInformation;
+    // Only the indexes are kept: the players do not change while the game (and so the command)
+    // lives, and copying their list would allocate on every drop:
+    const size_t m_previousActivePlayerIndex;
+    const size_t m_previousNextPlayerIndex;
     const size_t m_previousColumn;
     IBoard::Position m_previousDropPosition;
 
@@ -24,6 +24,7 @@
 #ifndef COMMANDSTACK_H_EC172719_473B_49A4_9D9B_D99C30B208A7
 #define COMMANDSTACK_H_EC172719_473B_49A4_9D9B_D99C30B208A7
 
+#include <memory_resource>
 #include <vector>
 
 #include <cxmodel/ICommand.h>
@@ -36,7 +37,9 @@ namespace cxmodel
 /*********************************************************************************************//**
  * @brief A concrete command stack.
  *
- * A basic implementation of a command stack with only the most basic facilities.
+ * A basic implementation of a command stack with only the most basic facilities. Commands are
+ * kept in a circular buffer allocated once, at construction: when the stack is full, the oldest
+ * command is forgotten in constant time.
  *
  ************************************************************************************************/
 class CommandStack : public ICommandStack
@@ -49,9 +52,11 @@ public:
      *
      * @param p_capacity
      *      The number of commands the stack will accept to store before being considered full.
+     * @param p_resource
+     *      The memory resource the stack storage is allocated from. It must outlive the stack.
      *
      ************************************************************************************************/
-    CommandStack(const size_t p_capacity);
+    CommandStack(const size_t p_capacity, std::pmr::memory_resource* p_resource = std::pmr::get_default_resource());
 
     // cxmodel::ICommandStack:
     [[nodiscard]] CommandCompletionStatus Execute(std::unique_ptr<ICommand>&& p_newCommand) override;
@@ -69,17 +74,20 @@ public:
 
 private:
 
-    [[nodiscard]] size_t GetLastCommandPosition() const;
-    [[nodiscard]] bool NoCommandUndoed() const;
+    [[nodiscard]] size_t GetIndex(size_t p_position) const;
     [[nodiscard]] bool SomeCommandUndoed() const;
 
+    void ForgetUndoedCommands();
+    void ForgetOldestCommand();
+
     void CheckInvariants();
 
-    const std::size_t m_endPosition;
+    // Positions are counted from the oldest command, which is at m_first in the buffer:
+    std::size_t m_first;
+    std::size_t m_nbCommands;
     std::size_t m_currentPosition;
-    bool m_allCmdUndoed;
 
-    std::vector<std::unique_ptr<ICommand>> m_commands;
+    std::pmr::vector<std::unique_ptr<ICommand>> m_commands;
 };
 
 } // namespace cxmodel
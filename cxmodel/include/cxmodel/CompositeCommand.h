@@ -25,6 +25,7 @@
 #define COMPOSITECOMMAND_H_2BA36E20_1068_4C28_8551_8BD94851A994
 
 #include <memory>
+#include <memory_resource>
 #include <vector>
 
 #include "ICommand.h"
@@ -44,6 +45,15 @@ class CompositeCommand : public ICommand
 
 public:
 
+    /**********************************************************************************************//**
+     * @brief Constructor.
+     *
+     * @param p_resource
+     *      The memory resource the children list is allocated from. It must outlive the composite.
+     *
+     *************************************************************************************************/
+    explicit CompositeCommand(std::pmr::memory_resource* p_resource = std::pmr::get_default_resource());
+
     /**********************************************************************************************//**
      * @brief Adds a command to the composite. The composite takes ownership of the child.
      *
@@ -61,7 +71,7 @@ public:
 
 private:
 
-    std::vector<std::unique_ptr<ICommand>> m_children;
+    std::pmr::vector<std::unique_ptr<ICommand>> m_children;
 
 };
 
@@ -0,0 +1,310 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file GameArchive.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef GAMEARCHIVE_H_42C6738A_E842_480F_B11D_D3249B79868E
+#define GAMEARCHIVE_H_42C6738A_E842_480F_B11D_D3249B79868E
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "MappedFile.h"
+#include "PositionKey.h"
+#include "Status.h"
+
+namespace cxmodel
+{
+    class BoardSnapshot;
+}
+
+namespace cxmodel
+{
+
+/**********************************************************************************************//**
+ * @brief A finished game, as stored in a game archive.
+ *
+ *************************************************************************************************/
+struct ArchivedGame final
+{
+    /** The game seed. */
+    std::uint64_t m_seed = 0u;
+
+    /** Free text describing the game, for example its players and event. */
+    std::string m_description;
+
+    /** The columns of the drops, in order. */
+    std::vector<size_t> m_moves;
+};
+
+/**********************************************************************************************//**
+ * @brief A game in which a position was reached.
+ *
+ *************************************************************************************************/
+struct PositionOccurrence final
+{
+    /** The game identifier in the archive. */
+    std::uint64_t m_gameId = 0u;
+
+    /** The number of moves played when the position was reached. */
+    size_t m_ply = 0u;
+};
+
+/**********************************************************************************************//**
+ * @brief Outcomes of the archived games in which a column was played from a position, from
+ *        the point of view of the player who played it.
+ *
+ *************************************************************************************************/
+struct ColumnStatistics final
+{
+    /** The number of games won. */
+    size_t m_nbWins = 0u;
+
+    /** The number of games lost. */
+    size_t m_nbLosses = 0u;
+
+    /** The number of tied games. */
+    size_t m_nbTies = 0u;
+};
+
+/**********************************************************************************************//**
+ * @brief Computes the number of games in column statistics.
+ *
+ * @param p_statistics The column statistics.
+ *
+ * @return The number of games won, lost and tied.
+ *
+ *************************************************************************************************/
+[[nodiscard]] size_t GetNbGames(const ColumnStatistics& p_statistics);
+
+/**********************************************************************************************//**
+ * @brief Computes the ratio of games won in column statistics.
+ *
+ * @param p_statistics The column statistics.
+ *
+ * @return The number of games won over the number of games, between 0 and 1. If no game was
+ *         played, 0 is returned.
+ *
+ *************************************************************************************************/
+[[nodiscard]] double GetWinRate(const ColumnStatistics& p_statistics);
+
+/**********************************************************************************************//**
+ * @brief Append only archive of finished games, indexed by the positions they reached.
+ *
+ * The archive is a directory of segments. Each segment holds up to a fixed number of games, in
+ * two files:
+ *
+ *  - "segment-NNNNNN.games": the game records, appended as games are added. A record is only
+ *    counted once it is completely written, so an interrupted process loses at most the game
+ *    being added.
+ *  - "segment-NNNNNN.index": the position index of the segment, written when the segment is
+ *    sealed. For each position reached in each game, it holds the position's canonical key,
+ *    the game, the ply, the column played next and the game outcome for the player to move,
+ *    sorted by key.
+ *
+ * Index files are memory mapped and binary searched, so that the games reaching a position,
+ * and the outcome of each column played from it, are found without reading the games. Until
+ * its segment is sealed, the index of the last segment is kept in memory. When an archive is
+ * opened, the index of an unsealed segment is rebuilt from its games.
+ *
+ * All games of an archive are played on the same board, by the same number of players. Since
+ * positions are indexed by their canonical key, a position and its mirror share their games,
+ * and column statistics are given in the orientation of the queried position.
+ *
+ * @note The archive is not thread safe.
+ *
+ *************************************************************************************************/
+class GameArchive final
+{
+
+public:
+
+    /** The current format version, for both games and index files. */
+    static constexpr std::uint16_t FORMAT_VERSION = 1u;
+
+    /** The default number of games in a segment. */
+    static constexpr size_t DEFAULT_SEGMENT_CAPACITY = 65536u;
+
+    /******************************************************************************************//**
+     * @brief Constructor. No archive is open.
+     *
+     * @param p_nbRows              The number of rows in the board.
+     * @param p_nbColumns           The number of columns in the board.
+     * @param p_inARowValue         The in-a-row value.
+     * @param p_nbPlayers           The number of players.
+     * @param p_segmentCapacity     The number of games in a segment.
+     *
+     * @pre The board and players are valid for a @c BoardSnapshot, and there are less than
+     *      255 columns.
+     * @pre The segment capacity is greater than 0.
+     *
+     ********************************************************************************************/
+    GameArchive(size_t p_nbRows, size_t p_nbColumns, size_t p_inARowValue, size_t p_nbPlayers, size_t p_segmentCapacity = DEFAULT_SEGMENT_CAPACITY);
+
+    /******************************************************************************************//**
+     * @brief Opens an archive, or creates it if the directory holds none.
+     *
+     * @pre No archive is open.
+     *
+     * @param p_directory The archive directory. It is created if needed.
+     *
+     * @return A success, or an error describing why the archive could not be opened, for
+     *         example because its games were played on another board.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] Status Open(const std::string& p_directory);
+
+    /******************************************************************************************//**
+     * @brief Indicates if an archive is open.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] bool IsOpen() const {return !m_directory.empty();}
+
+    /******************************************************************************************//**
+     * @brief Gets the number of archived games. Game identifiers go from 0 to this number.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] std::uint64_t GetNbGames() const {return m_nbGames;}
+
+    /******************************************************************************************//**
+     * @brief Adds a game. Its identifier is the number of games before it was added.
+     *
+     * When the last segment is full, it is sealed, and a new segment is started.
+     *
+     * @pre An archive is open.
+     *
+     * @param p_game The game. It must be finished: won by its last move, or tied.
+     *
+     * @return A success, or an error describing why the game could not be added.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] Status Append(const ArchivedGame& p_game);
+
+    /******************************************************************************************//**
+     * @brief Writes the index of the last segment, if not done yet. Games added afterwards go
+     *        to a new segment.
+     *
+     * @pre An archive is open.
+     *
+     * @return A success, or an error describing why the index could not be written.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] Status Seal();
+
+    /******************************************************************************************//**
+     * @brief Reads an archived game.
+     *
+     * @pre The game identifier is less than the number of games.
+     *
+     * @param p_gameId The game identifier.
+     *
+     * @return The game.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] ArchivedGame ReadGame(std::uint64_t p_gameId) const;
+
+    /******************************************************************************************//**
+     * @brief Finds the games in which a position, or its mirror, was reached.
+     *
+     * @pre The position is on the archive board, with the archive number of players.
+     *
+     * @param p_position The position.
+     *
+     * @return The games, by increasing identifier.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] std::vector<PositionOccurrence> FindGames(const BoardSnapshot& p_position) const;
+
+    /******************************************************************************************//**
+     * @brief Computes, for each column, the outcome of the archived games in which it was
+     *        played from a position. This is what opening books are built from.
+     *
+     * @pre The position is on the archive board, with the archive number of players.
+     *
+     * @param p_position The position.
+     *
+     * @return The statistics of each column, indexed by column.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] std::vector<ColumnStatistics> ComputeColumnStatistics(const BoardSnapshot& p_position) const;
+
+private:
+
+    struct IndexEntry final
+    {
+        PositionKey m_key;
+        std::uint32_t m_gameIndex;
+        std::uint16_t m_ply;
+        std::uint8_t m_nextColumn;
+        std::uint8_t m_result;
+    };
+
+    struct Segment final
+    {
+        std::uint64_t m_firstGameId = 0u;
+        MappedFile m_games;
+        size_t m_usedSize = 0u;
+
+        // The offset of each game record:
+        std::vector<std::uint32_t> m_offsets;
+
+        // Only open once the segment is sealed:
+        MappedFile m_index;
+        size_t m_nbIndexEntries = 0u;
+    };
+
+    [[nodiscard]] static IndexEntry ReadEntry(const std::byte* p_source);
+    static void WriteEntry(std::byte* p_destination, const IndexEntry& p_entry);
+
+    [[nodiscard]] std::string MakeSegmentPath(size_t p_segmentIndex, const char* p_extension) const;
+
+    [[nodiscard]] Status OpenSegment(size_t p_segmentIndex);
+    [[nodiscard]] Status CreateSegment();
+    [[nodiscard]] Status WriteIndex(Segment& p_segment, size_t p_segmentIndex);
+
+    [[nodiscard]] Status IndexGame(const ArchivedGame& p_game, std::uint32_t p_gameIndex, std::vector<IndexEntry>& p_entries) const;
+
+    void SortPendingEntries() const;
+
+    template<typename Visitor>
+    void VisitEntries(PositionKey p_key, Visitor p_visitor) const;
+
+    const size_t m_nbRows;
+    const size_t m_nbColumns;
+    const size_t m_inARowValue;
+    const size_t m_nbPlayers;
+    const size_t m_segmentCapacity;
+
+    std::string m_directory;
+    std::vector<Segment> m_segments;
+    std::uint64_t m_nbGames = 0u;
+
+    // The index of the last segment, while it is not sealed. It is only sorted when queried,
+    // so that adding a game stays cheap:
+    mutable std::vector<IndexEntry> m_pendingEntries;
+    mutable bool m_arePendingEntriesSorted = true;
+};
+
+} // namespace cxmodel
+
+#endif // GAMEARCHIVE_H_42C6738A_E842_480F_B11D_D3249B79868E
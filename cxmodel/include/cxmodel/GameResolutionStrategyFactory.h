@@ -25,6 +25,7 @@
 #define GAMERESOLUTIONSTRATEGYFACTORY_H_CA3F96EF_84E2_4D20_BFF9_6D0FBB35DB44
 
 #include <memory>
+#include <memory_resource>
 #include <vector>
 
 #include "IBoard.h"
@@ -71,6 +72,8 @@ public:
      *      A list of all taken positions on the board.
      * @param p_resolution
      *      The wanted game resolution.
+     * @param p_resource
+     *      The memory resource the strategy is allocated from. It must outlive the strategy.
      *
      * @return
      *      The newly created game resolution strategy.
@@ -79,8 +82,9 @@ public:
     [[nodiscard]] static std::unique_ptr<cxmodel::IGameResolutionStrategy> Make(const IBoard& p_board,
                                                                                 size_t p_inARowValue,
                                                                                 const std::vector<std::shared_ptr<IPlayer>>& p_players,
-                                                                                const std::vector<IBoard::Position>& p_takenPositions,
-                                                                                GameResolution p_resolution);
+                                                                                const std::pmr::vector<IBoard::Position>& p_takenPositions,
+                                                                                GameResolution p_resolution,
+                                                                                std::pmr::memory_resource* p_resource = std::pmr::get_default_resource());
 
 };
 
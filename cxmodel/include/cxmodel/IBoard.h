@@ -24,7 +24,11 @@
 #ifndef IBOARD_H_0D53584F_433F_4007_86CD_A0CF3135BAF3
 #define IBOARD_H_0D53584F_433F_4007_86CD_A0CF3135BAF3
 
+#include <cstddef>
+
 #include "IChip.h"
+#include "MemoryResourceAllocated.h"
+#include "PositionKey.h"
 
 namespace cxmodel
 {
@@ -33,7 +37,7 @@ namespace cxmodel
  * @brief Interface for Connect X compliant game boards.
  *
  ************************************************************************************************/
-class IBoard
+class IBoard : public MemoryResourceAllocated
 {
 
 public:
@@ -207,6 +211,18 @@ public:
      **********************************************************************************************/
     virtual bool IsColumnFull(size_t p_column) const = 0;
 
+    /*******************************************************************************************//**
+     * @brief Gets the canonical key of the chips on the board.
+     *
+     * The key is the same for a board and its mirror image. It is maintained as chips are
+     * dropped and reset, so getting it is cheap.
+     *
+     * @return
+     *      The canonical key.
+     *
+     **********************************************************************************************/
+    [[nodiscard]] virtual CanonicalPositionKey GetCanonicalKey() const = 0;
+
 };
 
 /***********************************************************************************************//**
@@ -24,6 +24,8 @@
 #ifndef ICOMMAND_H_65CCB8C8_B685_4720_8172_C50ED8C4909D
 #define ICOMMAND_H_65CCB8C8_B685_4720_8172_C50ED8C4909D
 
+#include "MemoryResourceAllocated.h"
+
 namespace cxmodel
 {
     enum class CommandCompletionStatus;
@@ -40,7 +42,7 @@ namespace cxmodel
  * clients with different requests, queue or log requests, and support undoable operations."
  *
  ************************************************************************************************/
-class ICommand
+class ICommand : public MemoryResourceAllocated
 {
 
 public:
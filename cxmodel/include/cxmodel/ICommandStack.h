@@ -26,6 +26,8 @@
 
 #include <memory>
 
+#include "MemoryResourceAllocated.h"
+
 namespace cxmodel
 {
     enum class CommandCompletionStatus;
@@ -49,7 +51,7 @@ namespace cxmodel
  * @note This interface assumes that the implementation has a bounded capacity.
  *
  ************************************************************************************************/
-class ICommandStack
+class ICommandStack : public MemoryResourceAllocated
 {
 
 public:
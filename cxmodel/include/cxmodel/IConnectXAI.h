@@ -24,6 +24,10 @@
 #ifndef ICONNECTXAI_H_362BB63A_6179_4ADE_BE2B_42ACD69F9888
 #define ICONNECTXAI_H_362BB63A_6179_4ADE_BE2B_42ACD69F9888
 
+#include <cstddef>
+
+#include "SearchStatistics.h"
+
 namespace cxmodel
 {
 
@@ -69,6 +73,25 @@ public:
      *
      *********************************************************************************************/
     [[nodiscard]] virtual size_t GetCurrentBotTarget() const = 0;
+
+    /******************************************************************************************//**
+     * @brief Gets the statistics of the last bot target computation.
+     *
+     * @return
+     *      The statistics of the last computation, or all zero statistics if nothing was
+     *      computed in the current game.
+     *
+     *********************************************************************************************/
+    [[nodiscard]] virtual SearchStatistics GetLastSearchStatistics() const = 0;
+
+    /******************************************************************************************//**
+     * @brief Gets the statistics of all bot target computations of the current game.
+     *
+     * @return
+     *      The aggregated statistics of the current game.
+     *
+     *********************************************************************************************/
+    [[nodiscard]] virtual SearchStatistics GetGameSearchStatistics() const = 0;
 };
 
 } // namespace cxmodel
@@ -0,0 +1,117 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file IConnectXAnalysis.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef ICONNECTXANALYSIS_H_D0AA5670_B9CD_4305_BCA2_4D2A5547923E
+#define ICONNECTXANALYSIS_H_D0AA5670_B9CD_4305_BCA2_4D2A5547923E
+
+#include <functional>
+
+#include "Search.h"
+
+namespace cxmodel
+{
+
+/**********************************************************************************************//**
+ * @brief Interface to analyze the current Connect X position.
+ *
+ * While analysis is enabled, every column of the current position is scored in the background
+ * and the scores are refined over time. Any change to the position (a drop, an undo, a
+ * redo, ...) cancels the running analysis and starts a new one.
+ *
+ * Results are computed on a worker thread, but observers are only notified from the thread
+ * owning the model: when a new result is available, the worker calls the analysis updated
+ * callback, which must wake the owning thread up (for example, through a dispatcher). The
+ * owning thread then calls `ProcessAnalysisUpdate`, which notifies observers with
+ * `ModelNotificationContext::ANALYSIS_UPDATED`.
+ *
+ *************************************************************************************************/
+class IConnectXAnalysis
+{
+
+public:
+
+    /** Called, from the analysis thread, when a new analysis result is available. */
+    using AnalysisUpdatedCallback = std::function<void()>;
+
+    /******************************************************************************************//**
+     * @brief Destructor.
+     *
+     *********************************************************************************************/
+    virtual ~IConnectXAnalysis() = default;
+
+    /******************************************************************************************//**
+     * @brief Enables analysis and starts analyzing the current position.
+     *
+     *********************************************************************************************/
+    virtual void StartAnalysis() = 0;
+
+    /******************************************************************************************//**
+     * @brief Disables analysis and cancels the running analysis, if any.
+     *
+     *********************************************************************************************/
+    virtual void StopAnalysis() = 0;
+
+    /******************************************************************************************//**
+     * @brief Indicates if analysis is enabled.
+     *
+     * @return `true` if analysis is enabled, `false` otherwise.
+     *
+     *********************************************************************************************/
+    [[nodiscard]] virtual bool IsAnalysisEnabled() const = 0;
+
+    /******************************************************************************************//**
+     * @brief Gets the latest analysis of the current position.
+     *
+     * @return The scores of every column, from the point of view of the active player, and
+     *         the depth at which they were computed. Empty if no result is available yet.
+     *
+     *********************************************************************************************/
+    [[nodiscard]] virtual SearchResult GetAnalysis() const = 0;
+
+    /******************************************************************************************//**
+     * @brief Sets the callback waking the owning thread up when a new result is available.
+     *
+     * The callback must be thread safe, and must not use the model.
+     *
+     * @pre Analysis was never started.
+     *
+     * @param p_onAnalysisUpdated The callback. Can be empty, in which case the owning thread
+     *                            has to poll `ProcessAnalysisUpdate`.
+     *
+     *********************************************************************************************/
+    virtual void SetAnalysisUpdatedCallback(AnalysisUpdatedCallback p_onAnalysisUpdated) = 0;
+
+    /******************************************************************************************//**
+     * @brief Notifies observers if a new analysis result became available since the last call.
+     *
+     * Must be called from the thread owning the model.
+     *
+     * @return `true` if observers were notified, `false` otherwise.
+     *
+     *********************************************************************************************/
+    virtual bool ProcessAnalysisUpdate() = 0;
+};
+
+} // namespace cxmodel
+
+#endif // ICONNECTXANALYSIS_H_D0AA5670_B9CD_4305_BCA2_4D2A5547923E
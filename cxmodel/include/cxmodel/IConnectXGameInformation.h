@@ -24,6 +24,8 @@
 #ifndef IGAMEINFORMATION_H_9970E71B_B32B_4B39_8363_50B66B9CE1C3
 #define IGAMEINFORMATION_H_9970E71B_B32B_4B39_8363_50B66B9CE1C3
 
+#include <cstdint>
+
 namespace cxmodel
 {
     class IChip;
@@ -75,6 +77,17 @@ public:
      ********************************************************************************************/
     virtual size_t GetCurrentInARowValue() const = 0;
 
+    /******************************************************************************************//**
+     * @brief Gets the current game seed.
+     *
+     * Record it with the moves: playing the same moves in a new game created with the same
+     * seed replays the game, random bot moves included.
+     *
+     * @return The current game seed.
+     *
+     ********************************************************************************************/
+    virtual std::uint64_t GetSeed() const = 0;
+
     /******************************************************************************************//**
      * @brief Gets the active players (the one who's turn is the current).
      *
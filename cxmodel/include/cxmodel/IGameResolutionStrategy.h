@@ -24,6 +24,8 @@
 #ifndef IGAMERESOLUTIONSTRATEGY_H_E0ECD7E2_8D97_422F_9387_79D4DB55D3DC
 #define IGAMERESOLUTIONSTRATEGY_H_E0ECD7E2_8D97_422F_9387_79D4DB55D3DC
 
+#include "MemoryResourceAllocated.h"
+
 namespace cxmodel
 {
     class IPlayer;
@@ -38,7 +40,7 @@ namespace cxmodel
  * A game resolution is a way by which a game can be resolved (a win, a tie, etc).
  *
  ************************************************************************************************/
-class IGameResolutionStrategy
+class IGameResolutionStrategy : public MemoryResourceAllocated
 {
 
 public:
@@ -27,9 +27,13 @@
 #include <cstddef>
 #include <memory>
 
+#include "SearchStatistics.h"
+
 namespace cxmodel
 {
-    class IBoard;
+    class BoardSnapshot;
+    struct BotSettings;
+    class RandomNumberGenerator;
 }
 
 namespace cxmodel
@@ -41,12 +45,16 @@ namespace cxmodel
  *************************************************************************************************/
 enum class DropColumnComputation
 {
-    RANDOM, ///< Computes a random available column.
+    RANDOM,     ///< Computes a random available column.
+    ALPHA_BETA, ///< Searches for the best column, within the bot's budget.
 };
 
 /**********************************************************************************************//**
  * @brief Strategy for computing a next possible drop column.
  *
+ * A strategy instance may be kept alive for a whole game and asked to compute several moves.
+ * It is therefore allowed to keep state (for example, caches) between computations.
+ *
  *************************************************************************************************/
 class INextDropColumnComputationStrategy
 {
@@ -62,14 +70,26 @@ public:
     /******************************************************************************************//**
      * @brief Computes a next available drop column.
      *
-     * @param p_board The game board.
+     * @param p_position The game position. The column is computed for its active player.
      *
      * @return The computed column.
      *
      *********************************************************************************************/
-    [[nodiscard]] virtual size_t Compute(const cxmodel::IBoard& p_board) const = 0;
+    [[nodiscard]] virtual size_t Compute(const cxmodel::BoardSnapshot& p_position) = 0;
+
+    /******************************************************************************************//**
+     * @brief Gets the statistics of the last computation.
+     *
+     * @return The statistics of the last computation. Before any computation, all statistics
+     *         are zero.
+     *
+     *********************************************************************************************/
+    [[nodiscard]] virtual const SearchStatistics& GetStatistics() const = 0;
 };
 
+/** Search time, in milliseconds, of bots with no budget. */
+constexpr size_t DEFAULT_BOT_SEARCH_TIME_MS = 1000u;
+
 /**********************************************************************************************//**
  * @brief Creates a new drop column computation strategy.
  *
@@ -80,6 +100,35 @@ public:
  *************************************************************************************************/
 [[nodiscard]] std::unique_ptr<INextDropColumnComputationStrategy> NextDropColumnComputationStrategyCreate(DropColumnComputation p_algorithm);
 
+/**********************************************************************************************//**
+ * @brief Creates a new drop column computation strategy for a bot.
+ *
+ * @param p_botSettings The bot settings (algorithm, search budget, threads and hash size). For
+ *                      searching algorithms, a zero budget means a default budget of
+ *                      `DEFAULT_BOT_SEARCH_TIME_MS` milliseconds, since bots must always
+ *                      eventually play.
+ *
+ * Strategies drawing random numbers are seeded from the system entropy source, so they can't
+ * be replayed.
+ *
+ * @return The associated strategy.
+ *
+ *************************************************************************************************/
+[[nodiscard]] std::unique_ptr<INextDropColumnComputationStrategy> NextDropColumnComputationStrategyCreate(const BotSettings& p_botSettings);
+
+/**********************************************************************************************//**
+ * @brief Creates a new drop column computation strategy for a bot, with a given generator.
+ *
+ * @param p_botSettings           The bot settings (see above).
+ * @param p_randomNumberGenerator The generator from which strategies drawing random numbers
+ *                                draw. The strategy keeps its own copy.
+ *
+ * @return The associated strategy.
+ *
+ *************************************************************************************************/
+[[nodiscard]] std::unique_ptr<INextDropColumnComputationStrategy> NextDropColumnComputationStrategyCreate(const BotSettings& p_botSettings,
+                                                                                                         const RandomNumberGenerator& p_randomNumberGenerator);
+
 } // namespace cxmodel
 
 #endif // INEXTDROPCOLUMNCOMPUTATIONSTRATEGY_H_7F40031F_E940_4D58_B90F_3D8888274306
@@ -27,6 +27,7 @@
 #include <memory>
 #include <string>
 
+#include <cxmodel/BotSettings.h>
 #include <cxmodel/ChipColor.h>
 
 namespace cxmodel
@@ -86,6 +87,15 @@ public:
      *
      ********************************************************************************************/
     [[nodiscard]] virtual bool IsManaged() const = 0;
+
+    /******************************************************************************************//**
+     * @brief Get the player's bot settings.
+     *
+     * @return The settings used to compute the player's moves. For players not managed by
+     *         Connect X, default settings are returned and should be ignored.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] virtual const BotSettings& GetBotSettings() const = 0;
 };
 
 /**********************************************************************************************//**
@@ -97,6 +107,8 @@ public:
  *      The chip color associated with the player.
  * @param p_type
  *      The type of player.
+ * @param p_botSettings
+ *      The bot settings. Only used if the player is a bot.
  *
  * @pre The name must not be empty.
  * @pre The chip color must not be transparent.
@@ -108,7 +120,8 @@ public:
  *************************************************************************************************/
 [[nodiscard]] std::unique_ptr<cxmodel::IPlayer> CreatePlayer(const std::string& p_name,
                                                              const ChipColor& p_chipColor,
-                                                             PlayerType p_type);
+                                                             PlayerType p_type,
+                                                             const BotSettings& p_botSettings = {});
 
 /**********************************************************************************************//**
  * @brief Equal-to operator.
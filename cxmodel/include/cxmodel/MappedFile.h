@@ -0,0 +1,149 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file MappedFile.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef MAPPEDFILE_H_9B88F588_ACDB_4F19_869B_787F228B7924
+#define MAPPEDFILE_H_9B88F588_ACDB_4F19_869B_787F228B7924
+
+#include <cstddef>
+#include <string>
+
+#include "Status.h"
+
+namespace cxmodel
+{
+
+/*********************************************************************************************//**
+ * @brief A file mapped in memory, for reading and writing.
+ *
+ * The file content is accessed directly through memory, and the system pages it in and out as
+ * needed. Resizing the file remaps it, so pointers to its content must then be fetched again.
+ *
+ ************************************************************************************************/
+class MappedFile final
+{
+
+public:
+
+    /******************************************************************************************//**
+     * @brief Constructor. The file is not open.
+     *
+     ********************************************************************************************/
+    MappedFile() = default;
+
+    /******************************************************************************************//**
+     * @brief Destructor. Unmaps and closes the file.
+     *
+     ********************************************************************************************/
+    ~MappedFile();
+
+    MappedFile(MappedFile&& p_other) noexcept;
+    MappedFile& operator=(MappedFile&& p_other) noexcept;
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /******************************************************************************************//**
+     * @brief Creates an empty temporary file. The file is removed when it is closed.
+     *
+     * It is created in the @c TMPDIR directory, or in @c /tmp if @c TMPDIR is not set.
+     *
+     * @pre The file is not open.
+     *
+     * @return A success, or an error describing why the file could not be created.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] Status CreateTemporary();
+
+    /******************************************************************************************//**
+     * @brief Creates an empty file. An existing file is emptied.
+     *
+     * @pre The file is not open.
+     *
+     * @param p_path
+     *      The file path.
+     *
+     * @return A success, or an error describing why the file could not be created.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] Status Create(const std::string& p_path);
+
+    /******************************************************************************************//**
+     * @brief Opens an existing file, and maps all of it.
+     *
+     * @pre The file is not open.
+     *
+     * @param p_path
+     *      The file path.
+     *
+     * @return A success, or an error describing why the file could not be opened.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] Status Open(const std::string& p_path);
+
+    /******************************************************************************************//**
+     * @brief Resizes the file, and maps all of it.
+     *
+     * When the file grows, the new content is zeroed.
+     *
+     * @pre The file is open.
+     *
+     * @param p_size
+     *      The new size, in bytes.
+     *
+     * @return A success, or an error describing why the file could not be resized. On error,
+     *         the file keeps its previous size and mapping.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] Status Resize(size_t p_size);
+
+    /******************************************************************************************//**
+     * @brief Indicates if the file is open.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] bool IsOpen() const {return m_fd >= 0;}
+
+    /******************************************************************************************//**
+     * @brief Gets the file content, or @c nullptr if the file is empty.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] std::byte* GetData() {return m_data;}
+    [[nodiscard]] const std::byte* GetData() const {return m_data;}
+
+    /******************************************************************************************//**
+     * @brief Gets the file size, in bytes.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] size_t GetSize() const {return m_size;}
+
+private:
+
+    void Close();
+
+    int m_fd = -1;
+    std::byte* m_data = nullptr;
+    size_t m_size = 0u;
+};
+
+} // namespace cxmodel
+
+#endif // MAPPEDFILE_H_9B88F588_ACDB_4F19_869B_787F228B7924
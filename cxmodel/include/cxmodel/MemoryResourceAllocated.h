@@ -0,0 +1,100 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file MemoryResourceAllocated.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef MEMORYRESOURCEALLOCATED_H_1DC09277_2793_4AE4_B1A3_690237066360
+#define MEMORYRESOURCEALLOCATED_H_1DC09277_2793_4AE4_B1A3_690237066360
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace cxmodel
+{
+
+/*********************************************************************************************//**
+ * @brief Base for polymorphic types which can live in a memory resource.
+ *
+ * Objects are created with <tt>new(p_resource) T(...)</tt> and can then be owned as usual, for
+ * example through a @c std::unique_ptr to one of their interfaces: the resource is recorded in
+ * front of the object, so deleting it gives the memory back to the resource it came from. A
+ * plain @c new (and so @c std::make_unique) uses the default resource.
+ *
+ * This is how a model and all the objects it owns can be kept in a per session resource, which
+ * frees everything at once when it is destroyed.
+ *
+ * @note Over-aligned types are not supported.
+ *
+ ************************************************************************************************/
+class MemoryResourceAllocated
+{
+
+public:
+
+    /******************************************************************************************//**
+     * @brief Allocates an object from the default memory resource.
+     *
+     * @param p_size The object size, in bytes.
+     *
+     * @return The object's storage.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] static void* operator new(std::size_t p_size);
+
+    /******************************************************************************************//**
+     * @brief Allocates an object from a memory resource.
+     *
+     * @param p_size     The object size, in bytes.
+     * @param p_resource The memory resource to allocate from. It must outlive the object.
+     *
+     * @pre The memory resource is valid.
+     *
+     * @return The object's storage.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] static void* operator new(std::size_t p_size, std::pmr::memory_resource* p_resource);
+
+    /******************************************************************************************//**
+     * @brief Gives an object's storage back to the memory resource it was allocated from.
+     *
+     * @param p_object The object's storage.
+     *
+     ********************************************************************************************/
+    static void operator delete(void* p_object) noexcept;
+
+    /******************************************************************************************//**
+     * @brief Gives an object's storage back when its constructor throws.
+     *
+     * @param p_object   The object's storage.
+     * @param p_resource The memory resource it was allocated from.
+     *
+     ********************************************************************************************/
+    static void operator delete(void* p_object, std::pmr::memory_resource* p_resource) noexcept;
+
+protected:
+
+    ~MemoryResourceAllocated() = default;
+
+};
+
+} // namespace cxmodel
+
+#endif // MEMORYRESOURCEALLOCATED_H_1DC09277_2793_4AE4_B1A3_690237066360
@@ -24,22 +24,32 @@
 #ifndef MODEL_H_8CC20E7E_7466_4977_9435_7E09ADBD10FC
 #define MODEL_H_8CC20E7E_7466_4977_9435_7E09ADBD10FC
 
+#include <atomic>
 #include <string>
 #include <memory>
+#include <memory_resource>
+#include <optional>
+#include <vector>
 
 #include <cxlog/ILogger.h>
+#include "AnalysisService.h"
 #include "CompositeCommand.h"
 #include "IBoard.h"
 #include "ICommandStack.h"
 #include "IConnectXAI.h"
+#include "IConnectXAnalysis.h"
 #include "IConnectXGameActions.h"
 #include "IConnectXGameInformation.h"
 #include "IConnectXLimits.h"
 #include "IGameResolutionStrategy.h"
+#include "INextDropColumnComputationStrategy.h"
 #include "IUndoRedo.h"
 #include "IVersioning.h"
 #include "ModelNotificationContext.h"
+#include "ModelState.h"
+#include "MoveJournal.h"
 #include "PlayerInformation.h"
+#include "RandomNumberGenerator.h"
 
 namespace cxmodel
 {
@@ -60,7 +70,8 @@ class Model : public cxlog::ILogger,
               public IConnectXLimits,
               public IConnectXGameInformation,
               public IConnectXGameActions,
-              public IConnectXAI
+              public IConnectXAI,
+              public IConnectXAnalysis
 {
 
 public:
@@ -72,12 +83,42 @@ public:
      *      The command stack.
      * @param p_logger
      *      A logger. Used to log actions performed on the model as Connect X is run.
+     * @param p_resource
+     *      The memory resource the game board, the commands and the game records are allocated
+     *      from. It must outlive the model. Giving each model its own resource (and allocating
+     *      the command stack from it) keeps a game's data together, and releases it all at once
+     *      when the resource is destroyed. Players and bots are shared with other threads, so
+     *      they are not allocated from it.
      *
      * @pre
      *      The command stack is valid and empty.
      *
      ********************************************************************************************/
-    Model(std::unique_ptr<ICommandStack>&& p_cmdStack, cxlog::ILogger& p_logger);
+    Model(std::unique_ptr<ICommandStack>&& p_cmdStack,
+          cxlog::ILogger& p_logger,
+          std::pmr::memory_resource* p_resource = std::pmr::get_default_resource());
+
+    /******************************************************************************************//**
+     * @brief Constructor, for a model keeping its undo history in a move journal.
+     *
+     * Drops are then applied directly, instead of through commands, and recorded as a few
+     * bytes each in the journal. Nothing is allocated per drop, and the same memory holds a
+     * much longer history. Undoing and redoing works the same as with a command stack.
+     *
+     * @param p_moveJournal
+     *      The move journal.
+     * @param p_logger
+     *      A logger. Used to log actions performed on the model as Connect X is run.
+     * @param p_resource
+     *      The memory resource the game board and records are allocated from (see above).
+     *
+     * @pre
+     *      The move journal is empty.
+     *
+     ********************************************************************************************/
+    Model(MoveJournal&& p_moveJournal,
+          cxlog::ILogger& p_logger,
+          std::pmr::memory_resource* p_resource = std::pmr::get_default_resource());
     ~Model() override;
 
 ///@{ @name cxlog::ILogger
@@ -128,6 +169,7 @@ public:
     size_t GetCurrentGridHeight() const override;
     size_t GetCurrentGridWidth() const override;
     size_t GetCurrentInARowValue() const override;
+    std::uint64_t GetSeed() const override;
     const IPlayer& GetActivePlayer() const override;
     const IPlayer& GetNextPlayer() const override;
     const IChip& GetChip(size_t p_row, size_t p_column) const override;
@@ -151,27 +193,136 @@ public:
 
     void ComputeNextDropColumn(DropColumnComputation p_algorithm) override;
     [[nodiscard]] size_t GetCurrentBotTarget() const override;
+    [[nodiscard]] SearchStatistics GetLastSearchStatistics() const override;
+    [[nodiscard]] SearchStatistics GetGameSearchStatistics() const override;
+
+///@}
+
+///@{ @name IConnectXAnalysis
+
+    void StartAnalysis() override;
+    void StopAnalysis() override;
+    [[nodiscard]] bool IsAnalysisEnabled() const override;
+    [[nodiscard]] SearchResult GetAnalysis() const override;
+    void SetAnalysisUpdatedCallback(AnalysisUpdatedCallback p_onAnalysisUpdated) override;
+    bool ProcessAnalysisUpdate() override;
 
 ///@}
 
+    /******************************************************************************************//**
+     * @brief Drops chips in many columns at once, for example to load or replay a game.
+     *
+     * Each drop is made by the active player, and goes to the undo history as usual. Drops are
+     * neither notified nor logged one by one: once they are all made, the game is resolved,
+     * the bot target is computed, and observers are notified once, with
+     * @c ModelNotificationContext::MOVES_APPLIED (followed by @c GAME_WON or @c GAME_TIED if
+     * the game is over).
+     *
+     * A win is checked after each drop, since nothing can be dropped after it. An early tie
+     * is only checked after the last drop.
+     *
+     * @param p_columns
+     *      The columns to drop chips in, in order.
+     *
+     * @pre A game is running.
+     *
+     * @return The number of chips dropped. Drops stop at the first column which is invalid
+     *         or full, and at a win.
+     *
+     ********************************************************************************************/
+    size_t ApplyMoves(const std::vector<size_t>& p_columns);
+
+    /******************************************************************************************//**
+     * @brief Copies the state of the current game.
+     *
+     * @return The state, with version 0. Its board is empty if no game is running.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] ModelState MakeState() const;
+
+    /******************************************************************************************//**
+     * @brief Describes the current game, so that it can be created again.
+     *
+     * @pre A game is running.
+     *
+     * @return The game information, with the game seed. The players are shared with the model.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] NewGameInformation MakeNewGameInformation() const;
+
+    /******************************************************************************************//**
+     * @brief Gets the number of chips dropped in the current game.
+     *
+     * @return The number of chips dropped, undone drops excluded.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] size_t GetNbDrops() const;
+
+    /******************************************************************************************//**
+     * @brief Gets the column a chip was dropped in.
+     *
+     * @param p_index
+     *      The drop index, 0 for the first drop of the game.
+     *
+     * @pre The index is less than the number of drops.
+     *
+     * @return The column.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] size_t GetDropColumn(size_t p_index) const;
+
 private:
 
     void CheckInvariants();
 
+    [[nodiscard]] bool DropChipAsCommand(const cxmodel::IChip& p_chip, size_t p_column, bool p_isNotified);
+    [[nodiscard]] bool DropChipInJournal(const cxmodel::IChip& p_chip, size_t p_column, bool p_isNotified);
+    void ClearHistory();
+    void UndoFromJournal();
+    void RedoFromJournal();
+
+    void CreateBotStrategies();
+    void ComputeActiveBotDropColumn();
+    void RecordSearchStatistics(const SearchStatistics& p_statistics);
+    void ResetSearchStatistics();
+    void RestartAnalysis();
+
     cxlog::ILogger& m_logger;
+    std::pmr::memory_resource* const m_resource;
 
+    // Exactly one of them keeps the undo history:
     std::unique_ptr<ICommandStack> m_cmdStack;
     CompositeCommand* m_currentDropCommands;
+    std::optional<MoveJournal> m_moveJournal;
 
     std::unique_ptr<cxmodel::IBoard> m_board;
     PlayerInformation m_playersInfo;
     size_t m_inARowValue;
-    std::vector<IBoard::Position> m_takenPositions;
+    std::pmr::vector<IBoard::Position> m_takenPositions;
+
+    // Players draw from their own streams of the seed. The model generator (stream 0) seeds
+    // the strategies created on demand:
+    std::uint64_t m_seed{0u};
+    RandomNumberGenerator m_randomNumberGenerator{0u};
 
     std::unique_ptr<IGameResolutionStrategy> m_winResolutionStrategy;
     std::unique_ptr<IGameResolutionStrategy> m_tieResolutionStrategy;
 
+    // One strategy per player, kept for the whole game. Players not managed by Connect X
+    // have no strategy (null):
+    std::vector<std::unique_ptr<INextDropColumnComputationStrategy>> m_botStrategies;
     size_t m_botTarget{0u};
+    SearchStatistics m_lastSearchStatistics;
+    SearchStatistics m_gameSearchStatistics;
+
+    // Created on first use, so that no thread is started unless analysis is wanted:
+    std::unique_ptr<AnalysisService> m_analysisService;
+    bool m_isAnalysisEnabled{false};
+
+    // Set from the analysis thread, and cleared from the owning thread when observers are
+    // notified:
+    std::atomic<bool> m_isAnalysisUpdatePending{false};
+    AnalysisUpdatedCallback m_onAnalysisUpdated;
 };
 
 } // namespace cxmodel
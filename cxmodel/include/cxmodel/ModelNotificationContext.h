@@ -70,6 +70,12 @@ enum class ModelNotificationContext
 
     /** The current game was reinitialized by the user.*/
     GAME_REINITIALIZED,
+
+    /** A new analysis result is available (see IConnectXAnalysis).*/
+    ANALYSIS_UPDATED,
+
+    /** Many chips were dropped at once into the game board.*/
+    MOVES_APPLIED,
 };
 
 
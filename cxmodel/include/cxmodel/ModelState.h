@@ -0,0 +1,85 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file ModelState.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef MODELSTATE_H_59CDC9B0_9EB4_4C76_A483_BBDE1605D640
+#define MODELSTATE_H_59CDC9B0_9EB4_4C76_A483_BBDE1605D640
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "BoardSnapshot.h"
+#include "ChipColor.h"
+
+namespace cxmodel
+{
+
+/*********************************************************************************************//**
+ * @brief A player, as seen in a model state.
+ *
+ ************************************************************************************************/
+struct PlayerState final
+{
+    /** The player name. */
+    std::string m_name;
+
+    /** The color of the player chips. */
+    ChipColor m_chipColor;
+
+    /** Indicates if the player is a bot. */
+    bool m_isManaged;
+};
+
+/*********************************************************************************************//**
+ * @brief A self-contained copy of the state of a game.
+ *
+ * Unlike the model, a state is never modified once made. It can be handed over to, and read
+ * from, any thread.
+ *
+ ************************************************************************************************/
+struct ModelState final
+{
+    /** Incremented for each new state. A state with a greater version is more recent. */
+    std::uint64_t m_version = 0u;
+
+    /** The board, including whose turn it is. Empty if no game is running. */
+    std::optional<BoardSnapshot> m_board;
+
+    /** The players, in turn order. */
+    std::vector<PlayerState> m_players;
+
+    /** The columns chips were dropped in, from the first drop to the last. */
+    std::vector<size_t> m_moves;
+
+    /** Indicates if the game is won. The winner is the active player. */
+    bool m_isWon = false;
+
+    /** Indicates if the game is tied. */
+    bool m_isTie = false;
+};
+
+} // namespace cxmodel
+
+#endif // MODELSTATE_H_59CDC9B0_9EB4_4C76_A483_BBDE1605D640
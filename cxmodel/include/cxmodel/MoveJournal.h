@@ -0,0 +1,221 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file MoveJournal.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef MOVEJOURNAL_H_8BF582BA_1499_439F_B3CF_B8BFE6773658
+#define MOVEJOURNAL_H_8BF582BA_1499_439F_B3CF_B8BFE6773658
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include "MappedFile.h"
+
+namespace cxmodel
+{
+
+/*********************************************************************************************//**
+ * @brief Compact undo history of drops.
+ *
+ * Each drop takes one small entry (column, row and player), instead of a command object. The
+ * entries are stored in a ring buffer allocated once, at construction, so that recording a
+ * drop never allocates. When the journal is full, the oldest turn is forgotten.
+ *
+ * Optionally, the journal can be given a page file. It then never forgets drops: the ring buffer
+ * is a window on the whole history, and when it is full, its oldest half is written to the
+ * file. Undoing past the window reads that half back, and so on. Memory use does not depend on
+ * the game length, and an undo or a redo copies at most one window of entries.
+ *
+ * Drops are grouped in turns: a turn starts with a drop marked as such, and goes on with the
+ * drops that follow it (for example, the drops of bots answering a human drop). Undoing and
+ * redoing is done drop by drop, and it is up to the user to stop at turn starts.
+ *
+ ************************************************************************************************/
+class MoveJournal final
+{
+
+public:
+
+    /******************************************************************************************//**
+     * @brief A recorded drop.
+     *
+     ********************************************************************************************/
+    struct Entry final
+    {
+        /** The column in which the chip was dropped. */
+        std::uint8_t m_column;
+
+        /** The row in which the chip landed. */
+        std::uint8_t m_row;
+
+        /** The index of the player who dropped the chip. */
+        std::uint8_t m_playerIndex;
+
+        /** Indicates if the drop starts a turn. */
+        bool m_isTurnStart;
+    };
+
+    /** The largest column, row or player index an entry can hold. */
+    static constexpr size_t MAX_INDEX = UINT8_MAX;
+
+    /******************************************************************************************//**
+     * @brief Constructor.
+     *
+     * @param p_capacity
+     *      The number of drops the journal keeps.
+     * @param p_resource
+     *      The memory resource the entries are allocated from. It must outlive the journal.
+     *
+     * @pre The capacity is not zero.
+     *
+     ********************************************************************************************/
+    explicit MoveJournal(size_t p_capacity, std::pmr::memory_resource* p_resource = std::pmr::get_default_resource());
+
+    /******************************************************************************************//**
+     * @brief Constructor for a journal that pages old drops out to a file.
+     *
+     * If the page file can't grow anymore, the journal goes on without it, and forgets its
+     * oldest turns when full.
+     *
+     * @param p_capacity
+     *      The number of drops the journal keeps in memory.
+     * @param p_pageFile
+     *      An open, memory mapped, file. Its content is overwritten.
+     * @param p_resource
+     *      The memory resource the entries are allocated from. It must outlive the journal.
+     *
+     * @pre The capacity is even and not zero.
+     * @pre The page file is open.
+     *
+     ********************************************************************************************/
+    MoveJournal(size_t p_capacity, MappedFile&& p_pageFile, std::pmr::memory_resource* p_resource = std::pmr::get_default_resource());
+
+    /******************************************************************************************//**
+     * @brief Records a drop.
+     *
+     * Undone drops can't be redone afterwards. If the journal is full, the oldest turn is
+     * forgotten first. A drop that does not start a turn is only recorded if it belongs to a
+     * turn still in the journal.
+     *
+     * @param p_entry
+     *      The drop.
+     *
+     ********************************************************************************************/
+    void Record(const Entry& p_entry);
+
+    /******************************************************************************************//**
+     * @brief Forgets all drops.
+     *
+     ********************************************************************************************/
+    void Clear();
+
+    /******************************************************************************************//**
+     * @brief Undoes the last drop.
+     *
+     * @pre A drop can be undone.
+     *
+     * @return The undone drop.
+     *
+     ********************************************************************************************/
+    const Entry& Undo();
+
+    /******************************************************************************************//**
+     * @brief Redoes the last undone drop.
+     *
+     * @pre A drop can be redone.
+     *
+     * @return The redone drop.
+     *
+     ********************************************************************************************/
+    const Entry& Redo();
+
+    /******************************************************************************************//**
+     * @brief Indicates if a drop can be undone.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] bool CanUndo() const;
+
+    /******************************************************************************************//**
+     * @brief Indicates if a drop can be redone.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] bool CanRedo() const;
+
+    /******************************************************************************************//**
+     * @brief Gets the drop @c Redo would redo.
+     *
+     * @pre A drop can be redone.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] Entry GetNextRedo() const;
+
+    /******************************************************************************************//**
+     * @brief Indicates if old drops are paged out to a file, instead of being forgotten.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] bool IsPaged() const;
+
+    /******************************************************************************************//**
+     * @brief Gets the number of recorded drops, undone ones included.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] size_t GetNbEntries() const;
+
+    /******************************************************************************************//**
+     * @brief Gets the number of drops the journal keeps in memory.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] size_t GetCapacity() const;
+
+private:
+
+    [[nodiscard]] size_t GetIndex(size_t p_windowPosition) const;
+    [[nodiscard]] Entry GetEntry(size_t p_position) const;
+
+    void ForgetOldestTurn();
+    void ForgetPartialTurn();
+    [[nodiscard]] bool ReservePage(size_t p_nbEntries);
+    void PageOut(size_t p_position, size_t p_nbEntries);
+    void PageIn(size_t p_position, size_t p_nbEntries);
+    void PageOutOldest();
+    void PageInBefore();
+    void PageInAfter();
+
+    void CheckInvariants() const;
+
+    std::pmr::vector<Entry> m_entries;
+    MappedFile m_pageFile;
+
+    // Positions are counted from the first recorded drop. The buffer holds the drops from
+    // m_windowStart, at m_first, and the page file holds the others:
+    size_t m_first = 0u;
+    size_t m_windowStart = 0u;
+    size_t m_nbInWindow = 0u;
+    size_t m_oldest = 0u;
+    size_t m_nbEntries = 0u;
+    size_t m_nbDone = 0u;
+};
+
+} // namespace cxmodel
+
+#endif // MOVEJOURNAL_H_8BF582BA_1499_439F_B3CF_B8BFE6773658
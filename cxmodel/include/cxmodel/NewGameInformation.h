@@ -24,6 +24,8 @@
 #ifndef NEWGAMEINFORMATION_H_BE24FB43_1A63_4A5D_BA34_DA52C92DFB4A
 #define NEWGAMEINFORMATION_H_BE24FB43_1A63_4A5D_BA34_DA52C92DFB4A
 
+#include <cstdint>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -41,7 +43,7 @@ namespace cxmodel
  ************************************************************************************************/
 struct NewGameInformation final
 {
-    /** A list of Connect X players. */
+    /** A list of Connect X players. Bot players carry their own settings. */
     using Players = std::vector<std::shared_ptr<IPlayer>>;
 
     // Copying:
@@ -89,6 +91,11 @@ struct NewGameInformation final
 
     /** The list of players for the new game. */
     Players m_players;
+
+    /** The seed from which everything random in the game is drawn (for example, random bot
+        moves). Playing the same moves from the same seed replays the game. If there is none,
+        the model picks one. */
+    std::optional<std::uint64_t> m_seed;
 };
 
 /*********************************************************************************************//**
@@ -0,0 +1,119 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file Perft.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef PERFT_H_16B25FEE_08CB_4AB7_A1FD_2A420725618C
+#define PERFT_H_16B25FEE_08CB_4AB7_A1FD_2A420725618C
+
+#include <chrono>
+#include <cstddef>
+
+#include "BoardSnapshot.h"
+
+namespace cxmodel
+{
+
+/**********************************************************************************************//**
+ * @brief Result of a move path enumeration (perft).
+ *
+ *************************************************************************************************/
+struct PerftResult final
+{
+    /** The number of drop sequences of exactly the requested depth. */
+    size_t m_nbNodes = 0u;
+
+    /** The number of drop sequences, of any length up to the depth, ending with a win. */
+    size_t m_nbWins = 0u;
+
+    /** The number of drop sequences, of any length up to the depth, filling the board without a win. */
+    size_t m_nbTies = 0u;
+
+    /** The time spent enumerating. */
+    std::chrono::microseconds m_duration{0};
+};
+
+/**********************************************************************************************//**
+ * @brief Equal-to operator.
+ *
+ * Only the counts are compared, not the durations.
+ *
+ * @param p_lhs The left hand side result.
+ * @param p_rhs The right hand side result.
+ *
+ * @return `true` if all counts are the same, `false` otherwise.
+ *
+ *************************************************************************************************/
+bool operator==(const PerftResult& p_lhs, const PerftResult& p_rhs);
+
+/**********************************************************************************************//**
+ * @brief Not-equal-to operator.
+ *
+ * @param p_lhs The left hand side result.
+ * @param p_rhs The right hand side result.
+ *
+ * @return `true` if some count differs, `false` otherwise.
+ *
+ *************************************************************************************************/
+bool operator!=(const PerftResult& p_lhs, const PerftResult& p_rhs);
+
+/**********************************************************************************************//**
+ * @brief Computes the number of nodes enumerated per second.
+ *
+ * @param p_result The perft result.
+ *
+ * @return The number of nodes per second, or 0 if no time was spent.
+ *
+ *************************************************************************************************/
+[[nodiscard]] size_t GetNodesPerSecond(const PerftResult& p_result);
+
+/**********************************************************************************************//**
+ * @brief Enumerates all drop sequences from a position, using the board snapshot.
+ *
+ * Every legal drop sequence is followed up to the requested depth, except that nothing is
+ * dropped after a win, or once the board is full.
+ *
+ * @param p_position The position to start from.
+ * @param p_depth    The number of drops in the enumerated sequences.
+ *
+ * @return The counts. At depth 0, the only node is the position itself.
+ *
+ *************************************************************************************************/
+[[nodiscard]] PerftResult Perft(const BoardSnapshot& p_position, size_t p_depth);
+
+/**********************************************************************************************//**
+ * @brief Enumerates all drop sequences from a position, using the game board and rules.
+ *
+ * Same as `Perft`, but drops are made on a `Board` and wins are detected by the win resolution
+ * strategy the game uses. Since the model relies on them, their counts are the reference
+ * other implementations must match.
+ *
+ * @param p_position The position to start from.
+ * @param p_depth    The number of drops in the enumerated sequences.
+ *
+ * @return The counts. At depth 0, the only node is the position itself.
+ *
+ *************************************************************************************************/
+[[nodiscard]] PerftResult ReferencePerft(const BoardSnapshot& p_position, size_t p_depth);
+
+} // namespace cxmodel
+
+#endif // PERFT_H_16B25FEE_08CB_4AB7_A1FD_2A420725618C
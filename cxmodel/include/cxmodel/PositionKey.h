@@ -0,0 +1,140 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file PositionKey.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef POSITIONKEY_H_AABE1D18_0E93_4620_86EF_035F28E9F400
+#define POSITIONKEY_H_AABE1D18_0E93_4620_86EF_035F28E9F400
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace cxmodel
+{
+
+/**********************************************************************************************//**
+ * @brief Hash key identifying a position (Zobrist key).
+ *
+ * The key of a position is the exclusive or of one component per taken position, so that it
+ * can be updated incrementally: a component is xored in when a chip is added, and xored out
+ * when it is removed. An empty board has key 0.
+ *
+ *************************************************************************************************/
+using PositionKey = std::uint64_t;
+
+/**********************************************************************************************//**
+ * @brief Key of a position, independent of its horizontal orientation.
+ *
+ * A position and its mirror image (columns in reverse order) have the same value, so caches
+ * only need to store one of them. The canonical key is the smallest of the position key and
+ * the mirrored position key.
+ *
+ *************************************************************************************************/
+struct CanonicalPositionKey final
+{
+    /** The smallest of the position key and the mirrored position key. */
+    PositionKey m_key = 0u;
+
+    /** `true` if the key was taken from the mirrored position, `false` otherwise. */
+    bool m_isMirrored = false;
+};
+
+/**********************************************************************************************//**
+ * @brief Makes the key component for a chip at some position.
+ *
+ * Instead of a table of random numbers, each component is computed by scrambling its inputs
+ * with a strong 64-bit mixing function (SplitMix64). This gives the same quality of keys, for
+ * any board size and any kind of piece, without storage.
+ *
+ * @param p_row    The chip row.
+ * @param p_column The chip column.
+ * @param p_piece  A value identifying the chip owner (for example, a color or player index).
+ *
+ * @return The key component.
+ *
+ *************************************************************************************************/
+[[nodiscard]] constexpr PositionKey MakePositionKeyComponent(size_t p_row, size_t p_column, std::uint64_t p_piece)
+{
+    const auto mix = [](std::uint64_t p_value)
+    {
+        p_value += 0x9E3779B97F4A7C15u;
+        p_value = (p_value ^ (p_value >> 30u)) * 0xBF58476D1CE4E5B9u;
+        p_value = (p_value ^ (p_value >> 27u)) * 0x94D049BB133111EBu;
+        return p_value ^ (p_value >> 31u);
+    };
+
+    const std::uint64_t cell = (static_cast<std::uint64_t>(p_row) << 32u) | static_cast<std::uint64_t>(p_column);
+
+    return mix(mix(cell) ^ p_piece);
+}
+
+/**********************************************************************************************//**
+ * @brief Gets the column matching a column in the mirrored board.
+ *
+ * @param p_column    The column.
+ * @param p_nbColumns The number of columns in the board.
+ *
+ * @return The mirrored column.
+ *
+ *************************************************************************************************/
+[[nodiscard]] constexpr size_t MirrorColumn(size_t p_column, size_t p_nbColumns)
+{
+    return p_nbColumns - 1u - p_column;
+}
+
+/**********************************************************************************************//**
+ * @brief Makes a canonical key.
+ *
+ * @param p_key         The position key.
+ * @param p_mirroredKey The mirrored position key.
+ *
+ * @return The canonical key.
+ *
+ *************************************************************************************************/
+[[nodiscard]] constexpr CanonicalPositionKey MakeCanonicalPositionKey(PositionKey p_key, PositionKey p_mirroredKey)
+{
+    return {std::min(p_key, p_mirroredKey), p_mirroredKey < p_key};
+}
+
+/**********************************************************************************************//**
+ * @brief Remaps a column between the real and canonical orientations of a position.
+ *
+ * A column stored in a cache, under a canonical key, is in the canonical orientation. Before
+ * it is played, it must be remapped to the real orientation, and before it is stored, it must
+ * be remapped to the canonical orientation. Since mirroring twice changes nothing, this
+ * function does both.
+ *
+ * @param p_column       The column to remap.
+ * @param p_canonicalKey The canonical key of the position.
+ * @param p_nbColumns    The number of columns in the board.
+ *
+ * @return The remapped column.
+ *
+ *************************************************************************************************/
+[[nodiscard]] constexpr size_t RemapColumn(size_t p_column, const CanonicalPositionKey& p_canonicalKey, size_t p_nbColumns)
+{
+    return p_canonicalKey.m_isMirrored ? MirrorColumn(p_column, p_nbColumns) : p_column;
+}
+
+} // namespace cxmodel
+
+#endif // POSITIONKEY_H_AABE1D18_0E93_4620_86EF_035F28E9F400
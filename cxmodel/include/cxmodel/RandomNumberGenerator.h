@@ -0,0 +1,145 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file RandomNumberGenerator.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef RANDOMNUMBERGENERATOR_H_50FB2E6A_31B5_43DD_9B63_47916A3B4570
+#define RANDOMNUMBERGENERATOR_H_50FB2E6A_31B5_43DD_9B63_47916A3B4570
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace cxmodel
+{
+
+/**********************************************************************************************//**
+ * @brief Fast, seeded, pseudo-random number generator (xoshiro256**).
+ *
+ * The same seed always gives the same numbers, on every platform, so that games using it can
+ * be replayed from their seed. A seed gives many independent streams: stream @c n starts
+ * @c n*2^128 numbers into the sequence, so streams never overlap in practice.
+ *
+ * A generator is not thread-safe. Each thread (or each bot) should own its generator, made
+ * from its own stream.
+ *
+ * This satisfies the C++ @c UniformRandomBitGenerator requirements.
+ *
+ *************************************************************************************************/
+class RandomNumberGenerator final
+{
+
+public:
+
+    using result_type = std::uint64_t;
+
+    /******************************************************************************************//**
+     * @brief Constructor.
+     *
+     * @param p_seed        The seed. Any value is valid.
+     * @param p_streamIndex The stream, within the seed's sequence.
+     *
+     ********************************************************************************************/
+    explicit RandomNumberGenerator(std::uint64_t p_seed, std::uint64_t p_streamIndex = 0u);
+
+    /** @brief Gets the smallest generated number. */
+    [[nodiscard]] static constexpr result_type min() {return std::numeric_limits<result_type>::min();}
+
+    /** @brief Gets the largest generated number. */
+    [[nodiscard]] static constexpr result_type max() {return std::numeric_limits<result_type>::max();}
+
+    /******************************************************************************************//**
+     * @brief Generates the next number.
+     *
+     * @return A number, uniformly distributed over the whole range.
+     *
+     ********************************************************************************************/
+    result_type operator()();
+
+    /******************************************************************************************//**
+     * @brief Generates a number below some bound.
+     *
+     * Unlike the standard distributions, whose output depends on the standard library, the
+     * output only depends on the generator state.
+     *
+     * @pre The bound is not zero.
+     *
+     * @param p_bound The (excluded) upper bound.
+     *
+     * @return A number, uniformly distributed in [0, p_bound).
+     *
+     ********************************************************************************************/
+    [[nodiscard]] size_t Below(size_t p_bound);
+
+    /******************************************************************************************//**
+     * @brief Moves 2^128 numbers forward, to the start of the next stream.
+     *
+     ********************************************************************************************/
+    void Jump();
+
+private:
+
+    std::array<std::uint64_t, 4u> m_state;
+
+};
+
+/**********************************************************************************************//**
+ * @brief Makes a seed from the system entropy source.
+ *
+ * Use it only when no seed is given, and record the result if the run is to be replayed.
+ *
+ * @return A seed.
+ *
+ *************************************************************************************************/
+[[nodiscard]] std::uint64_t MakeRandomSeed();
+
+/**********************************************************************************************//**
+ * @brief Makes a seed from another seed and a value, for example a game index.
+ *
+ * Close values give unrelated seeds, so a series of games can be seeded from a single seed.
+ *
+ * @param p_seed  The seed.
+ * @param p_value The value.
+ *
+ * @return The combined seed.
+ *
+ *************************************************************************************************/
+[[nodiscard]] std::uint64_t MixSeed(std::uint64_t p_seed, std::uint64_t p_value);
+
+/**********************************************************************************************//**
+ * @brief Makes the generator of a player, for a game.
+ *
+ * Each player uses its own stream of the game seed. Anything drawing numbers for a player
+ * (for example, a random bot) should use this generator, so that games replay from their
+ * seed, whoever computes the moves.
+ *
+ * @param p_gameSeed    The game seed.
+ * @param p_playerIndex The player index, in turn order.
+ *
+ * @return The player's generator.
+ *
+ *************************************************************************************************/
+[[nodiscard]] RandomNumberGenerator MakePlayerRandomNumberGenerator(std::uint64_t p_gameSeed, size_t p_playerIndex);
+
+} // namespace cxmodel
+
+#endif // RANDOMNUMBERGENERATOR_H_50FB2E6A_31B5_43DD_9B63_47916A3B4570
@@ -0,0 +1,164 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file Replay.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef REPLAY_H_3D6A3FA2_5F55_49ED_84CE_5F7DE5AB7D1B
+#define REPLAY_H_3D6A3FA2_5F55_49ED_84CE_5F7DE5AB7D1B
+
+#include <cstddef>
+#include <vector>
+
+#include "BoardSnapshot.h"
+
+namespace cxmodel
+{
+    class SavedGame;
+}
+
+namespace cxmodel
+{
+
+/**********************************************************************************************//**
+ * @brief Plays a recorded game back, one ply at a time or by seeking to any ply.
+ *
+ * The board is kept as a snapshot. Stepping forward or back drops or undoes a single chip. To
+ * seek far away, a copy of the board is kept every keyframe interval plies: the nearest
+ * keyframe before the target is restored, and at most an interval of moves is replayed from
+ * it. Seeking thus costs the same for any game length, and playback never allocates.
+ *
+ *************************************************************************************************/
+class Replay final
+{
+
+public:
+
+    /** The default number of plies between keyframes. */
+    static constexpr size_t DEFAULT_KEYFRAME_INTERVAL = 32u;
+
+    /******************************************************************************************//**
+     * @brief Constructor. The replay starts at ply 0, before the first move.
+     *
+     * Moves are kept up to the first one that cannot be played, because its column is
+     * outside the board or full, or because the game was already won.
+     *
+     * @param p_nbRows              The number of rows in the board.
+     * @param p_nbColumns           The number of columns in the board.
+     * @param p_inARowValue         The in-a-row value.
+     * @param p_nbPlayers           The number of players.
+     * @param p_moves               The columns of the drops, in order.
+     * @param p_keyframeInterval    The number of plies between keyframes.
+     *
+     * @pre The board and players are valid for a @c BoardSnapshot.
+     * @pre The keyframe interval is greater than 0.
+     *
+     ********************************************************************************************/
+    Replay(size_t p_nbRows,
+           size_t p_nbColumns,
+           size_t p_inARowValue,
+           size_t p_nbPlayers,
+           std::vector<size_t> p_moves,
+           size_t p_keyframeInterval = DEFAULT_KEYFRAME_INTERVAL);
+
+    /******************************************************************************************//**
+     * @brief Gets the number of plies that can be played back.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] size_t GetNbPlies() const {return m_moves.size();}
+
+    /******************************************************************************************//**
+     * @brief Gets the current ply, that is the number of moves played on the board.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] size_t GetPly() const {return m_ply;}
+
+    /******************************************************************************************//**
+     * @brief Gets the column of a move.
+     *
+     * @param p_index The move index, 0 for the first move.
+     *
+     * @pre The index is less than the number of plies.
+     *
+     * @return The column.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] size_t GetMove(size_t p_index) const;
+
+    /******************************************************************************************//**
+     * @brief Gets the board, at the current ply.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] const BoardSnapshot& GetBoard() const {return m_board;}
+
+    /******************************************************************************************//**
+     * @brief Plays the next move.
+     *
+     * @return @c true if a move was played, @c false if the replay is at its last ply.
+     *
+     ********************************************************************************************/
+    bool StepForward();
+
+    /******************************************************************************************//**
+     * @brief Takes the last move back.
+     *
+     * @return @c true if a move was taken back, @c false if the replay is at ply 0.
+     *
+     ********************************************************************************************/
+    bool StepBack();
+
+    /******************************************************************************************//**
+     * @brief Moves the board to a ply.
+     *
+     * @param p_ply The ply.
+     *
+     * @pre The ply is at most the number of plies.
+     *
+     ********************************************************************************************/
+    void Seek(size_t p_ply);
+
+private:
+
+    std::vector<size_t> m_moves;
+    const size_t m_keyframeInterval;
+
+    // The board after 0, 1, 2, ... keyframe intervals of moves:
+    std::vector<BoardSnapshot> m_keyframes;
+
+    BoardSnapshot m_board;
+    size_t m_ply = 0u;
+};
+
+/**********************************************************************************************//**
+ * @brief Creates the replay of a saved game.
+ *
+ * @param p_savedGame           The saved game.
+ * @param p_keyframeInterval    The number of plies between keyframes.
+ *
+ * @pre The saved game is open.
+ *
+ * @return The replay, at ply 0.
+ *
+ *************************************************************************************************/
+[[nodiscard]] Replay MakeReplay(const SavedGame& p_savedGame, size_t p_keyframeInterval = Replay::DEFAULT_KEYFRAME_INTERVAL);
+
+} // namespace cxmodel
+
+#endif // REPLAY_H_3D6A3FA2_5F55_49ED_84CE_5F7DE5AB7D1B
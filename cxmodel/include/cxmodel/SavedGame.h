@@ -0,0 +1,228 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file SavedGame.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef SAVEDGAME_H_CCB6C422_9489_4135_844F_881557DF9AE5
+#define SAVEDGAME_H_CCB6C422_9489_4135_844F_881557DF9AE5
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "MappedFile.h"
+#include "NewGameInformation.h"
+#include "Status.h"
+
+namespace cxmodel
+{
+    class Model;
+}
+
+namespace cxmodel
+{
+
+/*********************************************************************************************//**
+ * @brief A game saved to a file, which moves can be appended to.
+ *
+ * The file is binary, and all numbers are little endian:
+ *
+ *   Offset  Size  Content
+ *   0       4     "CXSG"
+ *   4       2     Format version.
+ *   6       2     Header size, that is the offset of the first move.
+ *   8       4     Checksum of the game description (from offset 20 to the first move).
+ *   12      4     Number of moves.
+ *   16      4     Checksum of the moves.
+ *   20            Game description: grid height, grid width, in-a-row value and number of
+ *                 players (1 byte each), then the seed (8 bytes), then for each player its
+ *                 name length (1 byte), name, chip color (4 channels of 2 bytes), type
+ *                 (1 byte, 0 for a human and 1 for a bot), bot settings description length
+ *                 (1 byte) and bot settings description (see @c MakeBotSettings). The
+ *                 hash size of bots is a setting of the machine running the game, and is
+ *                 not saved.
+ *   Header        The moves, one byte each: the column of each drop, in order.
+ *
+ * Checksums are 32 bits FNV-1a hashes. The file is memory mapped. Appending a move only
+ * writes it and then the move count and checksum, so saving after each drop is cheap. Space
+ * for moves is reserved ahead, so the file can be longer than its moves: bytes after the last
+ * move are ignored. A move written before a crash, but not counted, is thus ignored too.
+ *
+ ************************************************************************************************/
+class SavedGame final
+{
+
+public:
+
+    /** The current format version. */
+    static constexpr std::uint16_t FORMAT_VERSION = 1u;
+
+    /******************************************************************************************//**
+     * @brief Constructor. No file is open.
+     *
+     ********************************************************************************************/
+    SavedGame() = default;
+
+    /******************************************************************************************//**
+     * @brief Creates a saved game, without moves. An existing file is replaced.
+     *
+     * @pre No file is open.
+     *
+     * @param p_path
+     *      The file path.
+     * @param p_gameInformation
+     *      The game to save. It must have a seed, and at most 255 rows, columns and players.
+     *
+     * @return A success, or an error describing why the file could not be created.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] Status Create(const std::string& p_path, const NewGameInformation& p_gameInformation);
+
+    /******************************************************************************************//**
+     * @brief Opens a saved game, and checks it.
+     *
+     * @pre No file is open.
+     *
+     * @param p_path
+     *      The file path.
+     *
+     * @return A success, or an error describing why the file could not be opened, or why it
+     *         is not a valid saved game.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] Status Open(const std::string& p_path);
+
+    /******************************************************************************************//**
+     * @brief Indicates if a file is open.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] bool IsOpen() const {return m_file.IsOpen();}
+
+    /******************************************************************************************//**
+     * @brief Reads the saved game description.
+     *
+     * @pre A file is open.
+     *
+     * @return The game information, from which the game can be created again.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] NewGameInformation ReadGameInformation() const;
+
+    /******************************************************************************************//**
+     * @brief Gets the number of saved moves.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] size_t GetNbMoves() const {return m_nbMoves;}
+
+    /******************************************************************************************//**
+     * @brief Gets a saved move.
+     *
+     * @pre The index is less than the number of moves.
+     *
+     * @param p_index
+     *      The move index, 0 for the first move.
+     *
+     * @return The column of the drop.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] size_t GetMove(size_t p_index) const;
+
+    /******************************************************************************************//**
+     * @brief Reads all saved moves.
+     *
+     * @return The columns of the drops, in order.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] std::vector<size_t> ReadMoves() const;
+
+    /******************************************************************************************//**
+     * @brief Appends a move.
+     *
+     * @pre A file is open.
+     * @pre The column is inside the saved game board.
+     *
+     * @param p_column
+     *      The column of the drop.
+     *
+     * @return A success, or an error describing why the move could not be saved.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] Status Append(size_t p_column);
+
+    /******************************************************************************************//**
+     * @brief Forgets the last moves, for example when they are undone.
+     *
+     * @pre A file is open.
+     * @pre The number of moves to keep is at most the number of moves.
+     *
+     * @param p_nbMoves
+     *      The number of moves to keep.
+     *
+     ********************************************************************************************/
+    void Truncate(size_t p_nbMoves);
+
+private:
+
+    void WriteMovesInformation();
+
+    MappedFile m_file;
+    size_t m_headerSize = 0u;
+    size_t m_nbColumns = 0u;
+    size_t m_nbMoves = 0u;
+    std::uint32_t m_movesChecksum = 0u;
+};
+
+/*********************************************************************************************//**
+ * @brief Saves the current game of a model.
+ *
+ * @pre A game is running in the model.
+ *
+ * @param p_model
+ *      The model.
+ * @param p_path
+ *      The file path. An existing file is replaced.
+ *
+ * @return A success, or an error describing why the game could not be saved.
+ *
+ ************************************************************************************************/
+[[nodiscard]] Status SaveGame(const Model& p_model, const std::string& p_path);
+
+/*********************************************************************************************//**
+ * @brief Loads a saved game in a model.
+ *
+ * A new game is created from the saved description, and the saved moves are applied in bulk
+ * (see @c Model::ApplyMoves). The game can then be continued.
+ *
+ * @param p_path
+ *      The file path.
+ * @param p_model
+ *      The model.
+ *
+ * @return A success, or an error describing why the game could not be loaded. When the saved
+ *         moves are not valid, the game is still created, with the valid moves.
+ *
+ ************************************************************************************************/
+[[nodiscard]] Status LoadGame(const std::string& p_path, Model& p_model);
+
+} // namespace cxmodel
+
+#endif // SAVEDGAME_H_CCB6C422_9489_4135_844F_881557DF9AE5
@@ -0,0 +1,159 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file Search.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef SEARCH_H_3AD7A796_B263_4356_A143_B258828D643B
+#define SEARCH_H_3AD7A796_B263_4356_A143_B258828D643B
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include "BoardSnapshot.h"
+#include "SearchStatistics.h"
+#include "TranspositionTable.h"
+
+namespace cxmodel
+{
+
+/** Score of a column in which no chip can be dropped. */
+constexpr int NO_SCORE = std::numeric_limits<int>::min();
+
+/** Score of an immediate win. Wins found deeper score one less per extra drop. */
+constexpr int WIN_SCORE = 1000000;
+
+/**********************************************************************************************//**
+ * @brief Limits under which a search is run.
+ *
+ * Zero means no limit, for all fields.
+ *
+ *************************************************************************************************/
+struct SearchLimits final
+{
+    /** The maximum number of drops to search ahead. */
+    size_t m_maxDepth = 0u;
+
+    /** The maximum number of searched nodes. */
+    size_t m_maxNodes = 0u;
+
+    /** The maximum search time. */
+    std::chrono::milliseconds m_maxTime{0};
+};
+
+/**********************************************************************************************//**
+ * @brief Result of a search.
+ *
+ * Scores are from the point of view of the player who was active at the root of the search:
+ * a positive score is good for that player. Scores at or above `WIN_SCORE - <number of
+ * positions>` are forced wins, and their opposites forced losses.
+ *
+ *************************************************************************************************/
+struct SearchResult final
+{
+    /** The score of each column, or `NO_SCORE` if the column is full. */
+    std::vector<int> m_columnScores;
+
+    /** The depth, in drops, of the last completed iteration. */
+    size_t m_depth = 0u;
+
+    /** The column with the best score. */
+    size_t m_bestColumn = 0u;
+
+    /** The statistics of the search, up to this result. */
+    SearchStatistics m_statistics;
+
+    /** `true` if searching deeper would not change the scores, `false` otherwise. */
+    bool m_isComplete = false;
+};
+
+/**********************************************************************************************//**
+ * @brief Anytime search scoring every column of a position.
+ *
+ * The search is an iterative deepening alpha-beta. With more than two players, it assumes all
+ * opponents play against the active player (paranoid search). After each completed iteration,
+ * a full result is available, so the search can be stopped at any time.
+ *
+ * A search can be given a transposition table, which is kept from one run to the next. Since
+ * scores are from the point of view of the root player, a search object with a table should
+ * always be run for the same player.
+ *
+ *************************************************************************************************/
+class Search
+{
+
+public:
+
+    /******************************************************************************************//**
+     * @brief Constructor.
+     *
+     * @param p_hashSizeInMB The size of the transposition table, in megabytes. Zero means no
+     *                       transposition table.
+     *
+     ********************************************************************************************/
+    explicit Search(size_t p_hashSizeInMB = 0u);
+
+    /** Called with the result of each completed iteration. */
+    using IterationCallback = std::function<void(const SearchResult&)>;
+
+    /******************************************************************************************//**
+     * @brief Scores every column of a position.
+     *
+     * @param p_position    The position to search.
+     * @param p_limits      The search limits.
+     * @param p_stop        When set (from any thread), the search stops as soon as possible.
+     * @param p_onIteration Called after each completed iteration. May be empty.
+     *
+     * @return The result of the last completed iteration. If no iteration could be completed,
+     *         all scores are `NO_SCORE` and the depth is 0.
+     *
+     ********************************************************************************************/
+    SearchResult Run(const BoardSnapshot& p_position,
+                     const SearchLimits& p_limits,
+                     const std::atomic<bool>& p_stop,
+                     const IterationCallback& p_onIteration = {});
+
+private:
+
+    [[nodiscard]] int AlphaBeta(size_t p_depth, size_t p_ply, int p_alpha, int p_beta);
+    [[nodiscard]] int Evaluate() const;
+    [[nodiscard]] bool ShouldStop();
+    [[nodiscard]] std::vector<size_t> ExtractPrincipalVariation(size_t p_bestColumn, size_t p_depth) const;
+
+    TranspositionTable m_table;
+
+    std::vector<size_t> m_columnOrder;
+    std::optional<BoardSnapshot> m_position;
+    size_t m_rootPlayerIndex = 0u;
+
+    SearchLimits m_limits;
+    const std::atomic<bool>* m_stop = nullptr;
+    std::chrono::steady_clock::time_point m_deadline;
+    SearchStatistics m_statistics;
+    bool m_isAborted = false;
+};
+
+} // namespace cxmodel
+
+#endif // SEARCH_H_3AD7A796_B263_4356_A143_B258828D643B
@@ -0,0 +1,124 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file SearchStatistics.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef SEARCHSTATISTICS_H_3F8AC251_E0FD_4AF5_91AD_1486545E200F
+#define SEARCHSTATISTICS_H_3F8AC251_E0FD_4AF5_91AD_1486545E200F
+
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+namespace cxmodel
+{
+
+/**********************************************************************************************//**
+ * @brief Report on the work done to compute one or more drop columns.
+ *
+ * Every drop column computation strategy fills such a report. Strategies that do not search
+ * (for example, the random strategy) only fill the fields that make sense to them and leave
+ * the others to zero.
+ *
+ *************************************************************************************************/
+struct SearchStatistics final
+{
+    /** The number of computations aggregated in this report. */
+    size_t m_nbComputations = 0u;
+
+    /** The number of searched nodes. */
+    size_t m_nbNodes = 0u;
+
+    /** The time spent computing. */
+    std::chrono::microseconds m_duration{0};
+
+    /** The depth, in drops, of the last completed iteration. */
+    size_t m_depth = 0u;
+
+    /** The deepest ply visited, in drops. */
+    size_t m_selectiveDepth = 0u;
+
+    /** The number of transposition table lookups. */
+    size_t m_nbTTProbes = 0u;
+
+    /** The number of transposition table lookups which found the position. */
+    size_t m_nbTTHits = 0u;
+
+    /** The number of alpha-beta cutoffs, including those caused by the transposition table. */
+    size_t m_nbCutoffs = 0u;
+
+    /** The expected drop columns, starting with the computed one. */
+    std::vector<size_t> m_principalVariation;
+};
+
+/**********************************************************************************************//**
+ * @brief Computes the number of nodes searched per second.
+ *
+ * @param p_statistics The search statistics.
+ *
+ * @return The number of nodes per second, or 0 if no time was spent.
+ *
+ *************************************************************************************************/
+[[nodiscard]] size_t GetNodesPerSecond(const SearchStatistics& p_statistics);
+
+/**********************************************************************************************//**
+ * @brief Computes the effective branching factor.
+ *
+ * The effective branching factor is the number of children a node would need to have, in a
+ * uniform tree as deep as the search, for the tree to hold as many nodes as were searched.
+ * The closer to 1, the better the pruning.
+ *
+ * @param p_statistics The search statistics.
+ *
+ * @return The effective branching factor, or 0 if no depth was reached.
+ *
+ *************************************************************************************************/
+[[nodiscard]] double GetBranchingFactor(const SearchStatistics& p_statistics);
+
+/**********************************************************************************************//**
+ * @brief Adds statistics to an aggregated report.
+ *
+ * Counters and durations are summed, depths are maxed out and the principal variation
+ * is the one of the added statistics.
+ *
+ * @param p_aggregate  The aggregated report.
+ * @param p_statistics The statistics to add to the aggregated report.
+ *
+ *************************************************************************************************/
+void Accumulate(SearchStatistics& p_aggregate, const SearchStatistics& p_statistics);
+
+/**********************************************************************************************//**
+ * @brief Stream output operator.
+ *
+ * Writes the statistics on a single line, in a format suited for logs.
+ *
+ * @param p_stream     The stream to write to.
+ * @param p_statistics The statistics to write.
+ *
+ * @return The stream, after the statistics have been written.
+ *
+ *************************************************************************************************/
+std::ostream& operator<<(std::ostream& p_stream, const SearchStatistics& p_statistics);
+
+} // namespace cxmodel
+
+#endif // SEARCHSTATISTICS_H_3F8AC251_E0FD_4AF5_91AD_1486545E200F
@@ -0,0 +1,165 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file SharedModel.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef SHAREDMODEL_H_FE132ADC_6AEB_42B8_AF26_121989BC987F
+#define SHAREDMODEL_H_FE132ADC_6AEB_42B8_AF26_121989BC987F
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "ModelNotificationContext.h"
+#include "ModelState.h"
+
+namespace cxmodel
+{
+    class Model;
+}
+
+namespace cxmodel
+{
+
+/**********************************************************************************************//**
+ * @brief Gives other threads access to a model.
+ *
+ * The model itself is not thread safe: it must only be used from the thread owning it. Other
+ * threads go through this facade instead:
+ *
+ *  - To change the model, they post actions. Actions are queued, and run on the owning thread
+ *    when it processes them.
+ *  - To read the model, they get its latest state. A new state is published, from the owning
+ *    thread, each time the model notifies a change to the game state. Readers share published
+ *    states, which are never modified: a reader never sees a change half made. Reading takes
+ *    no lock: a reader only retries if a new state was published while it was reading. Older
+ *    states are freed by their last reader.
+ *
+ * @note Analysis results and chip moves in the new disc area are not published, since they
+ *       change the game state in no way.
+ *
+ *************************************************************************************************/
+class SharedModel : private IModelObserver
+{
+
+public:
+
+    /** An action to run on the model. */
+    using Action = std::function<void(Model&)>;
+
+    /** Called, from the posting thread, when an action is posted. */
+    using PostedCallback = std::function<void()>;
+
+    /******************************************************************************************//**
+     * @brief Constructor. Publishes the current state of the model.
+     *
+     * Must be called from the thread owning the model.
+     *
+     * @param p_model       The model to share. It must outlive the facade.
+     * @param p_onPosted    Called when an action is posted, for example to wake the owning
+     *                      thread up. Can be empty.
+     *
+     ********************************************************************************************/
+    explicit SharedModel(Model& p_model, PostedCallback p_onPosted = {});
+
+    /******************************************************************************************//**
+     * @brief Destructor. Actions still queued are dropped.
+     *
+     * Must be called from the thread owning the model.
+     *
+     ********************************************************************************************/
+    ~SharedModel() override;
+
+    SharedModel(const SharedModel&) = delete;
+    SharedModel& operator=(const SharedModel&) = delete;
+
+    /******************************************************************************************//**
+     * @brief Queues an action on the model. Can be called from any thread.
+     *
+     * @param p_action The action.
+     *
+     * @pre The action is valid.
+     *
+     ********************************************************************************************/
+    void Post(Action p_action);
+
+    /******************************************************************************************//**
+     * @brief Runs the queued actions, in the order they were posted.
+     *
+     * Must be called from the thread owning the model. Actions posted while the queue is
+     * processed are left for the next call.
+     *
+     * @return The number of actions run.
+     *
+     ********************************************************************************************/
+    size_t ProcessPending();
+
+    /******************************************************************************************//**
+     * @brief Gets the latest published state. Can be called from any thread.
+     *
+     * @return The state. It stays valid, and unchanged, for as long as it is held.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] std::shared_ptr<const ModelState> GetState() const;
+
+private:
+
+    void Update(ModelNotificationContext p_context, ModelSubject* p_subject) override;
+
+    void Publish();
+
+    // A published state, and the number of readers copying it:
+    struct StateSlot final
+    {
+        std::shared_ptr<const ModelState> m_state;
+        mutable std::atomic<size_t> m_nbReaders{0u};
+    };
+
+    // Readers only hold a slot while copying its state, so the owning thread always finds a
+    // free one quickly:
+    static constexpr size_t NB_STATE_SLOTS = 4u;
+
+    Model& m_model;
+    ModelSubject::Subscription m_subscription;
+    const PostedCallback m_onPosted;
+
+    // Only used from the owning thread:
+    std::uint64_t m_version = 0u;
+    std::vector<Action> m_processing;
+
+    // Protected by the mutex:
+    std::mutex m_mutex;
+    std::vector<Action> m_pending;
+
+    // Published states. The owning thread only writes slots that are neither current nor
+    // being read:
+    std::array<StateSlot, NB_STATE_SLOTS> m_stateSlots;
+    std::atomic<size_t> m_currentStateSlot{0u};
+};
+
+} // namespace cxmodel
+
+#endif // SHAREDMODEL_H_FE132ADC_6AEB_42B8_AF26_121989BC987F
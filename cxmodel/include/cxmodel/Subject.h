@@ -25,6 +25,12 @@
 #define SUBJECT_H_520FD354_27E1_4AE7_9579_71016A78DC44
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <list>
+#include <memory_resource>
+#include <optional>
 #include <type_traits>
 #include <vector>
 
@@ -50,6 +56,16 @@ namespace cxmodel
  * For this to occur, the @c Notify() method must be called explicitly. Not calling @c Notify()
  * will result on subscribed observers not receiving a notification.
  *
+ * Notifications can also be deferred. While a @c NotificationBatch is alive on the subject,
+ * notifications are queued instead of sent. Each context is queued once, in the order it was
+ * first raised, and the queue is sent when the outermost batch ends. An operation raising the
+ * same notification many times thus updates the observers only once, and they see the state
+ * the whole operation leaves.
+ *
+ * Observers can subscribe to some contexts only, in which case they are not notified of the
+ * others. Attaching returns a subscription, through which the observer can be detached in
+ * constant time.
+ *
  * @tparam T A notification context. Must be an enum.
  *
  * @see cxmodel::IObserver
@@ -63,12 +79,158 @@ class Subject
 
 public:
 
+    /******************************************************************************************//**
+     * @brief Defers the notifications of a subject for as long as it lives.
+     *
+     * Batches can be nested. Queued notifications are sent when the outermost batch is
+     * destroyed.
+     *
+     ********************************************************************************************/
+    class NotificationBatch
+    {
+
+    public:
+
+        /**************************************************************************************//**
+         * @brief Constructor.
+         *
+         * @param p_subject The subject to defer the notifications of. It must outlive the batch.
+         *
+         ****************************************************************************************/
+        explicit NotificationBatch(Subject& p_subject);
+
+        /**************************************************************************************//**
+         * @brief Destructor. Sends the queued notifications if this is the outermost batch.
+         *
+         ****************************************************************************************/
+        ~NotificationBatch();
+
+        NotificationBatch(const NotificationBatch&) = delete;
+        NotificationBatch& operator=(const NotificationBatch&) = delete;
+
+    private:
+
+        Subject& m_subject;
+
+    };
+
+    /******************************************************************************************//**
+     * @brief A set of notification contexts.
+     *
+     * Contexts are stored as bits, so their underlying values must be less than 64.
+     *
+     ********************************************************************************************/
+    class ContextSet
+    {
+
+    public:
+
+        /**************************************************************************************//**
+         * @brief Gets the set of all contexts.
+         *
+         * @return The set of all contexts.
+         *
+         ****************************************************************************************/
+        [[nodiscard]] static ContextSet All();
+
+        /**************************************************************************************//**
+         * @brief Constructor.
+         *
+         * @param p_contexts The contexts in the set.
+         *
+         * @pre The underlying value of every context is less than 64.
+         *
+         ****************************************************************************************/
+        ContextSet(std::initializer_list<T> p_contexts);
+
+        /**************************************************************************************//**
+         * @brief Gets a copy of the set, without a context.
+         *
+         * @param p_context The context to leave out.
+         *
+         * @pre The underlying value of the context is less than 64.
+         *
+         * @return The set without the context.
+         *
+         ****************************************************************************************/
+        [[nodiscard]] ContextSet Without(T p_context) const;
+
+        /**************************************************************************************//**
+         * @brief Checks if a context is in the set.
+         *
+         * @param p_context The context to check.
+         *
+         * @return @c true if the context is in the set, @c false otherwise.
+         *
+         ****************************************************************************************/
+        [[nodiscard]] bool Contains(T p_context) const;
+
+    private:
+
+        explicit ContextSet(std::uint64_t p_mask);
+
+        [[nodiscard]] static std::uint64_t GetBit(T p_context);
+
+        std::uint64_t m_mask;
+
+    };
+
+private:
+
+    struct Subscriber
+    {
+        IObserver<T>* m_observer;
+        ContextSet m_contexts;
+    };
+
+    using Subscribers = std::pmr::list<Subscriber>;
+
+public:
+
+    /******************************************************************************************//**
+     * @brief The attachment of an observer to a subject.
+     *
+     * It can be used to detach the observer in constant time. A default constructed
+     * subscription is not attached.
+     *
+     ********************************************************************************************/
+    class Subscription
+    {
+
+    public:
+
+        /**************************************************************************************//**
+         * @brief Checks if the subscription is attached.
+         *
+         * @return @c true if the subscription was returned by an attach and has not been
+         *         detached since, @c false otherwise.
+         *
+         ****************************************************************************************/
+        [[nodiscard]] bool IsAttached() const;
+
+    private:
+
+        friend class Subject;
+
+        std::optional<typename Subscribers::iterator> m_position;
+
+    };
+
     /******************************************************************************************//**
      * @brief Default constructor.
      *
      ********************************************************************************************/
     Subject();
 
+    /******************************************************************************************//**
+     * @brief Constructor.
+     *
+     * @param p_resource The memory resource the observer list is allocated from. It must outlive
+     *                   the subject.
+     *
+     ********************************************************************************************/
+    explicit Subject(std::pmr::memory_resource* p_resource);
+
     /******************************************************************************************//**
      * @brief Default destructor.
      *
@@ -89,13 +251,31 @@ public:
      *
      * @param p_newObserver The observer to attach.
      *
+     * @return The subscription of the observer.
+     *
      * Once an observer is attached, its @c Update() method is automatically called whenever
      * @c Notify() is called from the subject.
      *
      * @warning Never call @c Update() directly from an observer. Always use @c Notify().
      *
      ********************************************************************************************/
-    void Attach(IObserver<T>* const p_newObserver);
+    Subscription Attach(IObserver<T>* const p_newObserver);
+
+    /******************************************************************************************//**
+     * @brief Attach an observer to the subject, for some contexts only.
+     *
+     * @pre The new observer has a valid address.
+     * @pre The new observer has not been previously attached.
+     *
+     * @post One more observer is attached to the subject.
+     *
+     * @param p_newObserver The observer to attach.
+     * @param p_contexts    The contexts the observer is notified of.
+     *
+     * @return The subscription of the observer.
+     *
+     ********************************************************************************************/
+    Subscription Attach(IObserver<T>* const p_newObserver, ContextSet p_contexts);
 
     /******************************************************************************************//**
      * @brief Detach a specific observer from the subject.
@@ -115,6 +295,20 @@ public:
      ********************************************************************************************/
     void Detatch(IObserver<T>* const p_oldObserver);
 
+    /******************************************************************************************//**
+     * @brief Detach the observer of a subscription, in constant time.
+     *
+     * @pre The subscription was returned by an attach to this subject, and its observer has
+     *      not been detached since.
+     *
+     * @post There is one less observer attached to the subject, and the subscription is no
+     *       longer attached.
+     *
+     * @param p_subscription The subscription of the observer to detach.
+     *
+     ********************************************************************************************/
+    void Detatch(Subscription& p_subscription);
+
     /******************************************************************************************//**
      * @brief Detach all observers.
      *
@@ -134,27 +328,109 @@ protected:
      * @param p_context The context in which the notification occurs.
      *
      * For each event that need notifying the observers, this method must be called explicitly.
-     * It will in turn update to state of all attached observers.
+     * It will in turn update to state of all attached observers. Inside a batch, the
+     * notification is queued instead.
      *
      ********************************************************************************************/
     void Notify(T p_context);
 
 private:
 
+    void Send(T p_context);
+
+    void BeginBatch();
+    void EndBatch();
+
     void CheckInvariants();
 
-    std::vector<cxmodel::IObserver<T>*> m_observers;
+    Subscribers m_subscribers;
+
+    size_t m_batchDepth = 0u;
+    size_t m_nbSent = 0u;
+    std::pmr::vector<T> m_pending;
 
 };
 
 } // namespace cxmodel
 
+template<typename T>
+cxmodel::Subject<T>::NotificationBatch::NotificationBatch(Subject& p_subject)
+: m_subject{p_subject}
+{
+    m_subject.BeginBatch();
+}
+
+template<typename T>
+cxmodel::Subject<T>::NotificationBatch::~NotificationBatch()
+{
+    m_subject.EndBatch();
+}
+
+template<typename T>
+cxmodel::Subject<T>::ContextSet::ContextSet(std::uint64_t p_mask)
+: m_mask{p_mask}
+{
+}
+
+template<typename T>
+cxmodel::Subject<T>::ContextSet::ContextSet(std::initializer_list<T> p_contexts)
+: m_mask{0u}
+{
+    for(const T context : p_contexts)
+    {
+        m_mask |= GetBit(context);
+    }
+}
+
+template<typename T>
+typename cxmodel::Subject<T>::ContextSet cxmodel::Subject<T>::ContextSet::All()
+{
+    return ContextSet{~std::uint64_t{0u}};
+}
+
+template<typename T>
+typename cxmodel::Subject<T>::ContextSet cxmodel::Subject<T>::ContextSet::Without(T p_context) const
+{
+    return ContextSet{m_mask & ~GetBit(p_context)};
+}
+
+template<typename T>
+bool cxmodel::Subject<T>::ContextSet::Contains(T p_context) const
+{
+    const auto index = static_cast<std::uint64_t>(p_context);
+
+    return index < 64u && (m_mask & (std::uint64_t{1u} << index)) != 0u;
+}
+
+template<typename T>
+std::uint64_t cxmodel::Subject<T>::ContextSet::GetBit(T p_context)
+{
+    const auto index = static_cast<std::uint64_t>(p_context);
+    IF_PRECONDITION_NOT_MET_DO(index < 64u, return 0u;);
+
+    return std::uint64_t{1u} << index;
+}
+
+template<typename T>
+bool cxmodel::Subject<T>::Subscription::IsAttached() const
+{
+    return m_position.has_value();
+}
+
 template<typename T>
 cxmodel::Subject<T>::Subject()
 {
     CheckInvariants();
 }
 
+template<typename T>
+cxmodel::Subject<T>::Subject(std::pmr::memory_resource* p_resource)
+: m_subscribers{p_resource}
+, m_pending{p_resource}
+{
+    CheckInvariants();
+}
+
 template<typename T>
 cxmodel::Subject<T>::~Subject()
 {
@@ -162,28 +438,38 @@ cxmodel::Subject<T>::~Subject()
 }
 
 template<typename T>
-void cxmodel::Subject<T>::Attach(cxmodel::IObserver<T>* const p_newObserver)
+typename cxmodel::Subject<T>::Subscription cxmodel::Subject<T>::Attach(cxmodel::IObserver<T>* const p_newObserver)
+{
+    return Attach(p_newObserver, ContextSet::All());
+}
+
+template<typename T>
+typename cxmodel::Subject<T>::Subscription cxmodel::Subject<T>::Attach(cxmodel::IObserver<T>* const p_newObserver, ContextSet p_contexts)
 {
     PRECONDITION(p_newObserver);
 
+    Subscription subscription;
+
     if(p_newObserver)
     {
-        const bool alreadyRegistered = std::any_of(m_observers.cbegin(),
-                                                   m_observers.cend(), [p_newObserver](cxmodel::IObserver<T>* const p_observer)
-                                                                      {
-                                                                          return p_observer == p_newObserver;
-                                                                      }
+        const bool alreadyRegistered = std::any_of(m_subscribers.cbegin(),
+                                                   m_subscribers.cend(), [p_newObserver](const Subscriber& p_subscriber)
+                                                                         {
+                                                                             return p_subscriber.m_observer == p_newObserver;
+                                                                         }
                                                    );
 
         PRECONDITION(!alreadyRegistered);
 
         if(!alreadyRegistered)
         {
-            m_observers.push_back(p_newObserver);
+            subscription.m_position = m_subscribers.insert(m_subscribers.end(), Subscriber{p_newObserver, p_contexts});
         }
     }
 
     CheckInvariants();
+
+    return subscription;
 }
 
 template<typename T>
@@ -193,21 +479,35 @@ void cxmodel::Subject<T>::Detatch(cxmodel::IObserver<T>* const p_oldObserver)
 
     if(p_oldObserver)
     {
-        const auto position = std::find(m_observers.cbegin(),
-                                        m_observers.cend(),
-                                        p_oldObserver);
+        const auto position = std::find_if(m_subscribers.cbegin(),
+                                           m_subscribers.cend(),
+                                           [p_oldObserver](const Subscriber& p_subscriber)
+                                           {
+                                               return p_subscriber.m_observer == p_oldObserver;
+                                           });
 
-        PRECONDITION(position != m_observers.cend());
+        PRECONDITION(position != m_subscribers.cend());
 
-        if(position != m_observers.end())
+        if(position != m_subscribers.cend())
         {
-            m_observers.erase(position);
+            m_subscribers.erase(position);
         }
     }
 
     CheckInvariants();
 }
 
+template<typename T>
+void cxmodel::Subject<T>::Detatch(Subscription& p_subscription)
+{
+    IF_PRECONDITION_NOT_MET_DO(p_subscription.IsAttached(), return;);
+
+    m_subscribers.erase(*p_subscription.m_position);
+    p_subscription.m_position.reset();
+
+    CheckInvariants();
+}
+
 template<typename T>
 void cxmodel::Subject<T>::DetatchAll()
 {
@@ -216,9 +516,9 @@ void cxmodel::Subject<T>::DetatchAll()
     // but all of them, regardless of who they are. This might, for example, be
     // called as some insurance that there really are no observers listed.
 
-    m_observers.clear();
+    m_subscribers.clear();
 
-    POSTCONDITION(m_observers.size() == 0);
+    POSTCONDITION(m_subscribers.size() == 0);
 
     CheckInvariants();
 }
@@ -226,25 +526,72 @@ void cxmodel::Subject<T>::DetatchAll()
 template<typename T>
 void cxmodel::Subject<T>::Notify(T p_context)
 {
-    for(const auto observer : m_observers)
+    if(m_batchDepth == 0u)
     {
-        if(observer)
+        Send(p_context);
+        return;
+    }
+
+    // Only the notifications not sent yet are merged, since observers notifying again while
+    // the queue is sent must be heard:
+    if(std::find(m_pending.cbegin() + m_nbSent, m_pending.cend(), p_context) == m_pending.cend())
+    {
+        m_pending.push_back(p_context);
+    }
+}
+
+template<typename T>
+void cxmodel::Subject<T>::Send(T p_context)
+{
+    for(const Subscriber& subscriber : m_subscribers)
+    {
+        if(subscriber.m_observer && subscriber.m_contexts.Contains(p_context))
         {
-            observer->Update(p_context, this);
+            subscriber.m_observer->Update(p_context, this);
         }
     }
 
     CheckInvariants();
 }
 
+template<typename T>
+void cxmodel::Subject<T>::BeginBatch()
+{
+    ++m_batchDepth;
+}
+
+template<typename T>
+void cxmodel::Subject<T>::EndBatch()
+{
+    IF_PRECONDITION_NOT_MET_DO(m_batchDepth > 0u, return;);
+
+    if(m_batchDepth > 1u)
+    {
+        --m_batchDepth;
+        return;
+    }
+
+    // The batch stays open while the queue is sent, so that notifications raised by the
+    // observers are sent in order, after the ones already queued:
+    while(m_nbSent < m_pending.size())
+    {
+        Send(m_pending[m_nbSent]);
+        ++m_nbSent;
+    }
+
+    m_pending.clear();
+    m_nbSent = 0u;
+    m_batchDepth = 0u;
+}
+
 template<typename T>
 void cxmodel::Subject<T>::CheckInvariants()
 {
-    INVARIANT(std::none_of(m_observers.cbegin(),
-                           m_observers.cend(),
-                           [](cxmodel::IObserver<T>* const p_observer)
+    INVARIANT(std::none_of(m_subscribers.cbegin(),
+                           m_subscribers.cend(),
+                           [](const Subscriber& p_subscriber)
                            {
-                                return p_observer == nullptr;
+                                return p_subscriber.m_observer == nullptr;
                            }));
 }
 
@@ -24,6 +24,7 @@
 #ifndef TIEGAMERESOLUTIONSTRATEGY_H_3571E08C_7D58_4402_AAFA_B0A3BD3FE53D
 #define TIEGAMERESOLUTIONSTRATEGY_H_3571E08C_7D58_4402_AAFA_B0A3BD3FE53D
 
+#include <memory_resource>
 #include <vector>
 
 #include "IGameResolutionStrategy.h"
@@ -67,7 +68,7 @@ public:
     TieGameResolutionStrategy(const IBoard& p_board,
                               size_t p_inARowValue,
                               const std::vector<std::shared_ptr<IPlayer>>& p_players,
-                              const std::vector<IBoard::Position>& p_takenPositions);
+                              const std::pmr::vector<IBoard::Position>& p_takenPositions);
 
     // cxmodel::IGameResolutionStrategy:
     bool Handle(const IPlayer& p_activePlayer) const override;
@@ -94,7 +95,7 @@ private:
     const IBoard& m_board;
     const int m_inARowValue;
     const std::vector<std::shared_ptr<IPlayer>>& m_players;
-    const std::vector<IBoard::Position>& m_takenPositions;
+    const std::pmr::vector<IBoard::Position>& m_takenPositions;
     const int m_nbRows;
     const int m_nbColumns;
 
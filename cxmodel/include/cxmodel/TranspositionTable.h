@@ -0,0 +1,140 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file TranspositionTable.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef TRANSPOSITIONTABLE_H_B7BB8242_83AC_497C_9B3A_FA2307FC7A2F
+#define TRANSPOSITIONTABLE_H_B7BB8242_83AC_497C_9B3A_FA2307FC7A2F
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "PositionKey.h"
+
+namespace cxmodel
+{
+
+/**********************************************************************************************//**
+ * @brief Kind of information a stored score gives about the real score of a position.
+ *
+ *************************************************************************************************/
+enum class ScoreBound : std::uint8_t
+{
+    EXACT, ///< The stored score is the real score.
+    LOWER, ///< The real score is at least the stored score.
+    UPPER, ///< The real score is at most the stored score.
+};
+
+/**********************************************************************************************//**
+ * @brief Search result stored for a position.
+ *
+ *************************************************************************************************/
+struct TranspositionTableEntry final
+{
+    /** The canonical key of the position. */
+    PositionKey m_key = 0u;
+
+    /** The score of the position. */
+    std::int32_t m_score = 0;
+
+    /** The depth, in drops, to which the position was searched. */
+    std::uint16_t m_depth = 0u;
+
+    /** The best column found, in the canonical orientation of the position. */
+    std::uint16_t m_bestColumn = 0u;
+
+    /** The kind of information given by the score. */
+    ScoreBound m_bound = ScoreBound::EXACT;
+
+    /** `true` if the entry holds a position, `false` if it is empty. */
+    bool m_isUsed = false;
+};
+
+/**********************************************************************************************//**
+ * @brief Fixed size cache of search results, indexed by position key.
+ *
+ * Since positions reached through different drop orders are the same, a search visits many
+ * positions more than once. Storing their results avoids searching them again, and their best
+ * column is a good first guess when they have to be searched deeper.
+ *
+ * When two positions fall in the same slot, the one searched deeper is kept.
+ *
+ *************************************************************************************************/
+class TranspositionTable final
+{
+
+public:
+
+    /******************************************************************************************//**
+     * @brief Constructor.
+     *
+     * @param p_sizeInMB The maximum size of the table, in megabytes. With a size of zero, the
+     *                   table stores nothing.
+     *
+     ********************************************************************************************/
+    explicit TranspositionTable(size_t p_sizeInMB);
+
+    /******************************************************************************************//**
+     * @brief Gets the number of entries the table can hold.
+     *
+     * @return The number of entries.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] size_t GetNbEntries() const;
+
+    /******************************************************************************************//**
+     * @brief Looks up a position.
+     *
+     * @param p_key The canonical key of the position.
+     *
+     * @return The entry stored for the position, or `nullptr` if the position is not stored.
+     *         The entry stays valid until the next call to `Store` or `Clear`.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] const TranspositionTableEntry* Probe(PositionKey p_key) const;
+
+    /******************************************************************************************//**
+     * @brief Stores a search result.
+     *
+     * The result replaces the one in its slot if the slot is empty, holds the same position,
+     * or holds a position searched at most as deep.
+     *
+     * @param p_entry The search result.
+     *
+     ********************************************************************************************/
+    void Store(const TranspositionTableEntry& p_entry);
+
+    /******************************************************************************************//**
+     * @brief Empties the table.
+     *
+     ********************************************************************************************/
+    void Clear();
+
+private:
+
+    std::vector<TranspositionTableEntry> m_entries;
+    size_t m_indexMask = 0u;
+};
+
+} // namespace cxmodel
+
+#endif // TRANSPOSITIONTABLE_H_B7BB8242_83AC_497C_9B3A_FA2307FC7A2F
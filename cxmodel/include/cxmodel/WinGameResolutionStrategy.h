@@ -24,6 +24,7 @@
 #ifndef WINGAMERESOLUTIONSTRATEGY_H_FADB6ACE_7D59_43BD_BC28_E9D29C1FD5B4
 #define WINGAMERESOLUTIONSTRATEGY_H_FADB6ACE_7D59_43BD_BC28_E9D29C1FD5B4
 
+#include <memory_resource>
 #include <vector>
 
 #include "IGameResolutionStrategy.h"
@@ -66,7 +67,7 @@ public:
     WinGameResolutionStrategy(const cxmodel::IBoard& p_board,
                               const size_t p_inARowValue,
                               const std::vector<std::shared_ptr<IPlayer>>& p_players,
-                              const std::vector<IBoard::Position>& p_takenPositions);
+                              const std::pmr::vector<IBoard::Position>& p_takenPositions);
 
     // cxmodel::IGameResolutionStrategy:
     bool Handle(const IPlayer& p_activePlayer) const override;
@@ -76,7 +77,7 @@ private:
     const cxmodel::IBoard& m_board;
     int m_inARowValue;
     const std::vector<std::shared_ptr<IPlayer>>& m_players;
-    const std::vector<IBoard::Position>& m_takenPositions;
+    const std::pmr::vector<IBoard::Position>& m_takenPositions;
 
     enum class GridValidationType
     {
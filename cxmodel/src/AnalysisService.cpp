@@ -0,0 +1,177 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file AnalysisService.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <cxinv/assertion.h>
+#include <cxmodel/AnalysisService.h>
+
+cxmodel::AnalysisService::AnalysisService(UpdateCallback p_onUpdate,
+                                          const SearchLimits& p_limits,
+                                          std::chrono::milliseconds p_minUpdateInterval)
+: m_onUpdate{std::move(p_onUpdate)}
+, m_limits{p_limits}
+, m_minUpdateInterval{p_minUpdateInterval}
+{
+    PRECONDITION(m_onUpdate);
+
+    // The worker is started last, once everything it uses is initialized:
+    m_worker = std::thread{&AnalysisService::Run, this};
+}
+
+cxmodel::AnalysisService::~AnalysisService()
+{
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_isShuttingDown = true;
+        m_stop = true;
+    }
+
+    m_condition.notify_all();
+
+    if(m_worker.joinable())
+    {
+        m_worker.join();
+    }
+}
+
+void cxmodel::AnalysisService::Submit(const BoardSnapshot& p_position)
+{
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_pendingPosition = p_position;
+        m_latestResult = {};
+        m_isRunning = true;
+        ++m_generation;
+
+        // Stops the running search, if any, so that the worker picks up the new position:
+        m_stop = true;
+    }
+
+    m_condition.notify_all();
+}
+
+void cxmodel::AnalysisService::Cancel()
+{
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_pendingPosition.reset();
+        m_latestResult = {};
+        m_isRunning = false;
+        ++m_generation;
+        m_stop = true;
+    }
+
+    m_condition.notify_all();
+}
+
+cxmodel::SearchResult cxmodel::AnalysisService::GetLatestResult() const
+{
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_latestResult;
+}
+
+bool cxmodel::AnalysisService::IsRunning() const
+{
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_isRunning;
+}
+
+void cxmodel::AnalysisService::Run()
+{
+    while(true)
+    {
+        std::optional<BoardSnapshot> position;
+        size_t generation = 0u;
+        {
+            std::unique_lock<std::mutex> lock{m_mutex};
+            m_condition.wait(lock, [this](){return m_isShuttingDown || m_pendingPosition.has_value();});
+
+            if(m_isShuttingDown)
+            {
+                return;
+            }
+
+            position = std::move(m_pendingPosition);
+            m_pendingPosition.reset();
+            generation = m_generation;
+            m_stop = false;
+        }
+
+        Search search;
+        const SearchResult result = search.Run(*position,
+                                               m_limits,
+                                               m_stop,
+                                               [this, generation](const SearchResult& p_result)
+                                               {
+                                                   Publish(p_result, generation, false);
+                                               });
+
+        Publish(result, generation, true);
+    }
+}
+
+void cxmodel::AnalysisService::Publish(const SearchResult& p_result, size_t p_generation, bool p_isFinal)
+{
+    {
+        std::unique_lock<std::mutex> lock{m_mutex};
+
+        // The position was replaced or the analysis cancelled since, nobody wants this
+        // result anymore:
+        if(p_generation != m_generation)
+        {
+            return;
+        }
+
+        m_latestResult = p_result;
+        if(p_isFinal)
+        {
+            m_isRunning = false;
+        }
+
+        if(std::chrono::steady_clock::now() - m_lastUpdate < m_minUpdateInterval)
+        {
+            if(!p_isFinal)
+            {
+                // A later iteration, or the final result, will be published:
+                return;
+            }
+
+            // The final result must not be lost. We wait until it can be published, unless
+            // the analysis is cancelled in the meantime:
+            const bool isCancelled = m_condition.wait_until(lock,
+                                                            m_lastUpdate + m_minUpdateInterval,
+                                                            [this, p_generation]()
+                                                            {
+                                                                return m_isShuttingDown || p_generation != m_generation;
+                                                            });
+            if(isCancelled)
+            {
+                return;
+            }
+        }
+
+        m_lastUpdate = std::chrono::steady_clock::now();
+    }
+
+    // The lock is released first, the callee may want the result:
+    m_onUpdate();
+}
@@ -0,0 +1,100 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file AutoSave.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <algorithm>
+
+#include <cxinv/assertion.h>
+#include <cxmodel/AutoSave.h>
+#include <cxmodel/Model.h>
+
+cxmodel::AutoSave::AutoSave(Model& p_model, std::string p_path)
+: m_model{p_model}
+, m_path{std::move(p_path)}
+, m_status{MakeSuccess()}
+{
+    // Only the contexts changing the saved moves are needed:
+    using Context = ModelNotificationContext;
+    m_subscription = m_model.Attach(this, {Context::CREATE_NEW_GAME,
+                                           Context::CHIP_DROPPED,
+                                           Context::UNDO_CHIP_DROPPED,
+                                           Context::REDO_CHIP_DROPPED,
+                                           Context::MOVES_APPLIED,
+                                           Context::GAME_REINITIALIZED});
+}
+
+cxmodel::AutoSave::~AutoSave()
+{
+    if(m_subscription.IsAttached())
+    {
+        m_model.Detatch(m_subscription);
+    }
+}
+
+void cxmodel::AutoSave::Update(ModelNotificationContext p_context, ModelSubject* p_subject)
+{
+    IF_PRECONDITION_NOT_MET_DO(p_subject == &m_model, return;);
+
+    if(p_context == ModelNotificationContext::CREATE_NEW_GAME)
+    {
+        Create();
+        return;
+    }
+
+    Synchronize();
+}
+
+void cxmodel::AutoSave::Create()
+{
+    m_savedGame = SavedGame{};
+    m_status = m_savedGame.Create(m_path, m_model.MakeNewGameInformation());
+
+    if(m_status.IsSuccess())
+    {
+        Synchronize();
+    }
+}
+
+void cxmodel::AutoSave::Synchronize()
+{
+    if(!m_savedGame.IsOpen() || !m_status.IsSuccess())
+    {
+        return;
+    }
+
+    // Notifications can be coalesced, so many moves may have been undone and replaced since
+    // the last save. The saved moves are kept up to the first one the game no longer has:
+    const size_t nbDrops = m_model.GetNbDrops();
+    size_t nbKept = 0u;
+    while(nbKept < std::min(m_savedGame.GetNbMoves(), nbDrops) && m_savedGame.GetMove(nbKept) == m_model.GetDropColumn(nbKept))
+    {
+        ++nbKept;
+    }
+
+    m_savedGame.Truncate(nbKept);
+
+    for(size_t index = nbKept; index < nbDrops; ++index)
+    {
+        m_status = m_savedGame.Append(m_model.GetDropColumn(index));
+        ON_ERROR(m_status, return;);
+    }
+}
@@ -28,17 +28,32 @@
 namespace
 {
 
-std::unique_ptr<cxmodel::IChip> NoChip()
+const cxmodel::Disc& NoChip()
 {
-    return std::make_unique<cxmodel::Disc>(cxmodel::Disc::MakeTransparentDisc());
+    static const cxmodel::Disc noChip = cxmodel::Disc::MakeTransparentDisc();
+
+    return noChip;
+}
+
+// Chips are told apart by their color only:
+std::uint64_t MakePiece(const cxmodel::IChip& p_chip)
+{
+    const cxmodel::ChipColor color = p_chip.GetColor();
+
+    return (static_cast<std::uint64_t>(color.R()) << 48u) |
+           (static_cast<std::uint64_t>(color.G()) << 32u) |
+           (static_cast<std::uint64_t>(color.B()) << 16u) |
+           static_cast<std::uint64_t>(color.A());
 }
 
 } // namespace
 
 cxmodel::Board::Board(size_t p_nbRows,
                       size_t p_nbColumns,
-                      const cxmodel::IConnectXLimits& p_modelAsLimits)
-: m_nbRows{p_nbRows}
+                      const cxmodel::IConnectXLimits& p_modelAsLimits,
+                      std::pmr::memory_resource* p_resource)
+: m_grid{p_resource}
+, m_nbRows{p_nbRows}
 , m_nbColumns{p_nbColumns}
 , m_modelAsLimits{p_modelAsLimits}
 {
@@ -48,16 +63,7 @@ cxmodel::Board::Board(size_t p_nbRows,
     PRECONDITION(p_nbColumns >= p_modelAsLimits.GetMinimumGridWidth());
     PRECONDITION(p_nbColumns <= p_modelAsLimits.GetMaximumGridWidth());
 
-    for(size_t row = 0; row < m_nbRows; ++row)
-    {
-        std::vector<std::unique_ptr<IChip>> chipRow;
-        m_grid.push_back(std::move(chipRow));
-
-        for(size_t column = 0; column < m_nbColumns; ++column)
-        {
-            m_grid[row].push_back(std::move(NoChip()));
-        }
-    }
+    m_grid.assign(m_nbRows * m_nbColumns, NoChip());
 
     CheckInvariants();
 }
@@ -79,10 +85,10 @@ size_t cxmodel::Board::GetNbPositions() const
 
 const cxmodel::IChip& cxmodel::Board::GetChip(const Position& p_position) const
 {
-    IF_PRECONDITION_NOT_MET_DO(p_position.m_row < m_nbRows, return *m_grid[0][0];);
-    IF_PRECONDITION_NOT_MET_DO(p_position.m_column < m_nbColumns, return *m_grid[0][0];);
+    IF_PRECONDITION_NOT_MET_DO(p_position.m_row < m_nbRows, return m_grid[0];);
+    IF_PRECONDITION_NOT_MET_DO(p_position.m_column < m_nbColumns, return m_grid[0];);
 
-    return *m_grid[p_position.m_row][p_position.m_column];
+    return m_grid[GetIndex(p_position)];
 }
 
 bool cxmodel::Board::DropChip(size_t p_column, const cxmodel::IChip& p_disc, Position& p_droppedPosition)
@@ -96,16 +102,15 @@ bool cxmodel::Board::DropChip(size_t p_column, const cxmodel::IChip& p_disc, Pos
 
     size_t rowSubscript = 0;
 
-    for(auto row = m_grid.begin(); row != m_grid.end(); ++row)
+    for(; rowSubscript < m_nbRows; ++rowSubscript)
     {
         const cxmodel::IChip& chip = GetChip({rowSubscript, p_column});
-        if(chip == *NoChip())
+        if(chip == NoChip())
         {
-            m_grid[rowSubscript][p_column] = std::move(std::make_unique<cxmodel::Disc>(p_disc.GetColor()));
+            m_grid[GetIndex({rowSubscript, p_column})] = cxmodel::Disc{p_disc.GetColor()};
+            UpdateKeys({rowSubscript, p_column}, p_disc);
             break;
         }
-
-        ++rowSubscript;
     }
 
     CheckInvariants();
@@ -119,34 +124,47 @@ void cxmodel::Board::ResetChip(Position& p_position)
 {
     PRECONDITION(p_position.m_row < GetNbRows());
     PRECONDITION(p_position.m_column < GetNbColumns());
-    PRECONDITION(GetChip(p_position) != *NoChip());
+    PRECONDITION(GetChip(p_position) != NoChip());
 
-    auto& chipToReset = m_grid[p_position.m_row][p_position.m_column];
-    IF_PRECONDITION_NOT_MET_DO(chipToReset, return;);
+    auto& chipToReset = m_grid[GetIndex(p_position)];
 
-    chipToReset->Reset();
+    // Xoring the same component again removes it from the keys:
+    UpdateKeys(p_position, chipToReset);
+
+    chipToReset.Reset();
 }
 
 bool cxmodel::Board::IsColumnFull(size_t p_column) const
 {
     PRECONDITION(p_column < m_nbColumns);
 
-    bool isPlayable = false;
-    size_t rowSubscript = m_nbRows - 1;
-
-    for(auto row = m_grid.rbegin(); row != m_grid.rend(); ++row)
+    for(size_t rowSubscript = m_nbRows; rowSubscript > 0u; --rowSubscript)
     {
-        const cxmodel::IChip& chip = GetChip({rowSubscript, p_column});
-        if(chip == *NoChip())
+        if(GetChip({rowSubscript - 1u, p_column}) == NoChip())
         {
-            isPlayable = true;
-            break;
+            return false;
         }
-
-        --rowSubscript;
     }
 
-    return !isPlayable;
+    return true;
+}
+
+cxmodel::CanonicalPositionKey cxmodel::Board::GetCanonicalKey() const
+{
+    return MakeCanonicalPositionKey(m_key, m_mirroredKey);
+}
+
+size_t cxmodel::Board::GetIndex(const Position& p_position) const
+{
+    return p_position.m_row * m_nbColumns + p_position.m_column;
+}
+
+void cxmodel::Board::UpdateKeys(const Position& p_position, const IChip& p_chip)
+{
+    const std::uint64_t piece = MakePiece(p_chip);
+
+    m_key ^= MakePositionKeyComponent(p_position.m_row, p_position.m_column, piece);
+    m_mirroredKey ^= MakePositionKeyComponent(p_position.m_row, MirrorColumn(p_position.m_column, m_nbColumns), piece);
 }
 
 void cxmodel::Board::CheckInvariants() const
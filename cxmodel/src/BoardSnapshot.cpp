@@ -0,0 +1,183 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file BoardSnapshot.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <cxinv/assertion.h>
+#include <cxmodel/BoardSnapshot.h>
+#include <cxmodel/ChipColor.h>
+#include <cxmodel/IBoard.h>
+#include <cxmodel/IChip.h>
+
+cxmodel::BoardSnapshot::BoardSnapshot(size_t p_nbRows, size_t p_nbColumns, size_t p_inARowValue, size_t p_nbPlayers)
+: m_nbRows{p_nbRows}
+, m_nbColumns{p_nbColumns}
+, m_inARowValue{p_inARowValue}
+, m_nbPlayers{p_nbPlayers}
+, m_cells(p_nbRows * p_nbColumns, EMPTY)
+, m_heights(p_nbColumns, 0u)
+{
+    PRECONDITION(p_nbRows > 0u);
+    PRECONDITION(p_nbRows <= std::numeric_limits<uint8_t>::max());
+    PRECONDITION(p_nbColumns > 0u);
+    PRECONDITION(p_inARowValue > 1u);
+    PRECONDITION(p_nbPlayers >= 2u);
+    PRECONDITION(p_nbPlayers < std::numeric_limits<uint8_t>::max());
+}
+
+void cxmodel::BoardSnapshot::DropChip(size_t p_column)
+{
+    PlaceChip(p_column, m_activePlayerIndex);
+
+    m_activePlayerIndex = (m_activePlayerIndex + 1u == m_nbPlayers) ? 0u : m_activePlayerIndex + 1u;
+}
+
+void cxmodel::BoardSnapshot::UndoDrop(size_t p_column)
+{
+    PRECONDITION(p_column < m_nbColumns);
+    PRECONDITION(m_heights[p_column] > 0u);
+
+    --m_heights[p_column];
+
+    uint8_t& cell = m_cells[p_column * m_nbRows + m_heights[p_column]];
+    UpdateKeys(m_heights[p_column], p_column, cell);
+    cell = EMPTY;
+    --m_nbDrops;
+
+    m_activePlayerIndex = (m_activePlayerIndex == 0u) ? m_nbPlayers - 1u : m_activePlayerIndex - 1u;
+}
+
+void cxmodel::BoardSnapshot::PlaceChip(size_t p_column, size_t p_playerIndex)
+{
+    PRECONDITION(p_column < m_nbColumns);
+    PRECONDITION(!IsColumnFull(p_column));
+    PRECONDITION(p_playerIndex < m_nbPlayers);
+
+    const uint8_t cell = static_cast<uint8_t>(p_playerIndex + 1u);
+    m_cells[p_column * m_nbRows + m_heights[p_column]] = cell;
+    UpdateKeys(m_heights[p_column], p_column, cell);
+    ++m_heights[p_column];
+    ++m_nbDrops;
+}
+
+void cxmodel::BoardSnapshot::SetActivePlayerIndex(size_t p_playerIndex)
+{
+    IF_PRECONDITION_NOT_MET_DO(p_playerIndex < m_nbPlayers, return;);
+
+    m_activePlayerIndex = p_playerIndex;
+}
+
+bool cxmodel::BoardSnapshot::IsLastDropWinning(size_t p_column) const
+{
+    PRECONDITION(p_column < m_nbColumns);
+    PRECONDITION(m_heights[p_column] > 0u);
+
+    const size_t row = m_heights[p_column] - 1u;
+    const uint8_t cell = m_cells[p_column * m_nbRows + row];
+
+    // Vertical (only downwards, since the chip is on top):
+    if(1u + CountInDirection(row, p_column, -1, 0, cell) >= m_inARowValue)
+    {
+        return true;
+    }
+
+    // Horizontal, then both diagonals:
+    constexpr int directions[3][2] = {{0, 1}, {1, 1}, {-1, 1}};
+    for(const auto& direction : directions)
+    {
+        const size_t count = 1u + CountInDirection(row, p_column, direction[0], direction[1], cell)
+                                + CountInDirection(row, p_column, -direction[0], -direction[1], cell);
+        if(count >= m_inARowValue)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void cxmodel::BoardSnapshot::UpdateKeys(size_t p_row, size_t p_column, uint8_t p_cell)
+{
+    m_key ^= MakePositionKeyComponent(p_row, p_column, p_cell);
+    m_mirroredKey ^= MakePositionKeyComponent(p_row, MirrorColumn(p_column, m_nbColumns), p_cell);
+}
+
+size_t cxmodel::BoardSnapshot::CountInDirection(size_t p_row, size_t p_column, int p_rowStep, int p_columnStep, uint8_t p_cell) const
+{
+    size_t count = 0u;
+
+    int row = static_cast<int>(p_row) + p_rowStep;
+    int column = static_cast<int>(p_column) + p_columnStep;
+
+    // There is no need to look further than a full line:
+    while(count + 1u < m_inARowValue &&
+          row >= 0 && row < static_cast<int>(m_nbRows) &&
+          column >= 0 && column < static_cast<int>(m_nbColumns) &&
+          m_cells[static_cast<size_t>(column) * m_nbRows + static_cast<size_t>(row)] == p_cell)
+    {
+        ++count;
+        row += p_rowStep;
+        column += p_columnStep;
+    }
+
+    return count;
+}
+
+cxmodel::BoardSnapshot cxmodel::MakeBoardSnapshot(const IBoard& p_board,
+                                                  size_t p_inARowValue,
+                                                  const PlayerInformation& p_playerInformation)
+{
+    const PlayersList& players = p_playerInformation.m_players;
+    PRECONDITION(players.size() >= 2u);
+
+    BoardSnapshot snapshot{p_board.GetNbRows(), p_board.GetNbColumns(), p_inARowValue, players.size()};
+
+    for(size_t column = 0u; column < p_board.GetNbColumns(); ++column)
+    {
+        for(size_t row = 0u; row < p_board.GetNbRows(); ++row)
+        {
+            const IChip& chip = p_board.GetChip({row, column});
+            if(chip.GetColor() == MakeTransparent())
+            {
+                // Chips are stacked from the bottom, so the rest of the column is empty:
+                break;
+            }
+
+            size_t owner = BoardSnapshot::NO_PLAYER;
+            for(size_t playerIndex = 0u; playerIndex < players.size(); ++playerIndex)
+            {
+                if(players[playerIndex] && players[playerIndex]->GetChip() == chip)
+                {
+                    owner = playerIndex;
+                    break;
+                }
+            }
+
+            IF_CONDITION_NOT_MET_DO(owner != BoardSnapshot::NO_PLAYER, continue;);
+
+            snapshot.PlaceChip(column, owner);
+        }
+    }
+
+    snapshot.SetActivePlayerIndex(p_playerInformation.m_activePlayerIndex);
+
+    return snapshot;
+}
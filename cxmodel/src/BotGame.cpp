@@ -0,0 +1,68 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file BotGame.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <cxinv/assertion.h>
+#include <cxmodel/BotGame.h>
+#include <cxmodel/IPlayer.h>
+
+std::string cxmodel::MakeBotName(size_t p_botIndex)
+{
+    return "Bot " + std::to_string(p_botIndex + 1u);
+}
+
+cxmodel::BotGameOutcome cxmodel::PlayBotGame(IConnectXGameActions& p_actions,
+                                             const IConnectXGameInformation& p_information,
+                                             const IConnectXAI& p_ai,
+                                             size_t p_nbPlayers,
+                                             size_t p_nbDrops)
+{
+    PRECONDITION(p_nbPlayers >= 2u);
+
+    // Every drop fills a position, so a game that goes on longer is stuck:
+    const size_t maxNbDrops = p_information.GetCurrentGridWidth() * p_information.GetCurrentGridHeight();
+
+    BotGameOutcome outcome;
+    while(!p_information.IsWon() && !p_information.IsTie())
+    {
+        if(p_nbDrops + outcome.m_nbMoves >= maxNbDrops)
+        {
+            return outcome;
+        }
+
+        p_actions.DropChip(p_information.GetActivePlayer().GetChip(), p_ai.GetCurrentBotTarget());
+        ++outcome.m_nbMoves;
+    }
+
+    outcome.m_isOver = true;
+
+    if(p_information.IsWon())
+    {
+        // Players drop in turn, and the winning drop is the last one:
+        const size_t nbDrops = p_nbDrops + outcome.m_nbMoves;
+        IF_CONDITION_NOT_MET_DO(nbDrops > 0u, return outcome;);
+
+        outcome.m_winnerIndex = (nbDrops - 1u) % p_nbPlayers;
+    }
+
+    return outcome;
+}
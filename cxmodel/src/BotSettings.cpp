@@ -0,0 +1,135 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file BotSettings.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <cstdlib>
+#include <ostream>
+
+#include <cxinv/assertion.h>
+#include <cxmodel/BotSettings.h>
+
+namespace
+{
+
+const std::string RANDOM_DESCRIPTION = "random";
+const std::string ALPHA_BETA_DESCRIPTION = "alphabeta";
+const std::string TIME_UNITS = "ms";
+const std::string NODES_UNITS = "nodes";
+
+} // namespace
+
+bool cxmodel::operator==(const cxmodel::BotSettings& p_lhs, const cxmodel::BotSettings& p_rhs)
+{
+    bool areEqual = true;
+
+    areEqual &= (p_lhs.m_algorithm == p_rhs.m_algorithm);
+    areEqual &= (p_lhs.m_budgetType == p_rhs.m_budgetType);
+    areEqual &= (p_lhs.m_budget == p_rhs.m_budget);
+    areEqual &= (p_lhs.m_hashSizeInMB == p_rhs.m_hashSizeInMB);
+
+    return areEqual;
+}
+
+bool cxmodel::operator!=(const cxmodel::BotSettings& p_lhs, const cxmodel::BotSettings& p_rhs)
+{
+    return !(p_lhs == p_rhs);
+}
+
+std::optional<cxmodel::BotSettings> cxmodel::MakeBotSettings(const std::string& p_description)
+{
+    const size_t separatorPosition = p_description.find(':');
+    const std::string algorithm = p_description.substr(0u, separatorPosition);
+
+    BotSettings settings;
+    if(algorithm == RANDOM_DESCRIPTION && separatorPosition == std::string::npos)
+    {
+        settings.m_algorithm = DropColumnComputation::RANDOM;
+        return settings;
+    }
+
+    if(algorithm != ALPHA_BETA_DESCRIPTION)
+    {
+        return std::nullopt;
+    }
+
+    settings.m_algorithm = DropColumnComputation::ALPHA_BETA;
+    settings.m_hashSizeInMB = DEFAULT_BOT_HASH_SIZE_IN_MB;
+    if(separatorPosition == std::string::npos)
+    {
+        return settings;
+    }
+
+    const std::string budget = p_description.substr(separatorPosition + 1u);
+    const size_t unitsPosition = budget.find_first_not_of("0123456789");
+    if(unitsPosition == 0u || unitsPosition == std::string::npos)
+    {
+        return std::nullopt;
+    }
+
+    const std::string units = budget.substr(unitsPosition);
+    if(units == TIME_UNITS)
+    {
+        settings.m_budgetType = SearchBudgetType::TIME;
+    }
+    else if(units == NODES_UNITS)
+    {
+        settings.m_budgetType = SearchBudgetType::NODES;
+    }
+    else
+    {
+        return std::nullopt;
+    }
+
+    settings.m_budget = std::strtoul(budget.substr(0u, unitsPosition).c_str(), nullptr, 10);
+    if(settings.m_budget == 0u)
+    {
+        return std::nullopt;
+    }
+
+    return settings;
+}
+
+std::ostream& cxmodel::operator<<(std::ostream& p_stream, const BotSettings& p_settings)
+{
+    switch(p_settings.m_algorithm)
+    {
+        case DropColumnComputation::RANDOM:
+            return p_stream << RANDOM_DESCRIPTION;
+
+        case DropColumnComputation::ALPHA_BETA:
+        {
+            p_stream << ALPHA_BETA_DESCRIPTION;
+            if(p_settings.m_budget > 0u)
+            {
+                p_stream << ':' << p_settings.m_budget << (p_settings.m_budgetType == SearchBudgetType::NODES ? NODES_UNITS : TIME_UNITS);
+            }
+
+            return p_stream;
+        }
+
+        default:
+            break;
+    }
+
+    ASSERT_ERROR_MSG("Unknown next drop column computation algorithm");
+    return p_stream;
+}
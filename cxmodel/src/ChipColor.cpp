@@ -21,6 +21,7 @@
  *
  *************************************************************************************************/
 
+#include <array>
 #include <cmath>
 
 #include <cxinv/assertion.h>
@@ -29,6 +30,17 @@
 namespace
 {
 
+constexpr std::array<cxmodel::ChipColor, cxmodel::NB_PLAYER_COLORS> PLAYER_COLORS = {cxmodel::MakeRed(),
+                                                                                     cxmodel::MakeBlue(),
+                                                                                     cxmodel::MakeYellow(),
+                                                                                     cxmodel::MakeGreen(),
+                                                                                     cxmodel::MakePink(),
+                                                                                     cxmodel::MakeOrange(),
+                                                                                     cxmodel::MakeAqua(),
+                                                                                     cxmodel::MakeBlack(),
+                                                                                     cxmodel::MakeLilac(),
+                                                                                     cxmodel::MakeSalmon()};
+
 enum class HSL
 {
     HUE,
@@ -200,3 +212,10 @@ double cxmodel::ComputeLuminosity(const ChipColor& p_color)
 {
     return ComputeHSLFromRGB(p_color, HSL::LUMINOSITY);
 }
+
+cxmodel::ChipColor cxmodel::MakePlayerColor(size_t p_playerIndex)
+{
+    IF_PRECONDITION_NOT_MET_DO(p_playerIndex < PLAYER_COLORS.size(), return MakeTransparent(););
+
+    return PLAYER_COLORS[p_playerIndex];
+}
@@ -33,13 +33,16 @@ cxmodel::CommandCreateNewGame::CommandCreateNewGame(const IConnectXLimits& p_mod
                                                     std::unique_ptr<IBoard>& p_board,
                                                     std::vector<std::shared_ptr<IPlayer>>& p_players,
                                                     size_t& p_inARowValue,
-                                                    NewGameInformation p_newGameInformation)
+                                                    NewGameInformation p_newGameInformation,
+                                                    std::pmr::memory_resource* p_resource)
  : m_modelAsLimits{p_modelAsLimits}
  , m_board{p_board}
  , m_modelPlayers{p_players}
  , m_inARowValue{p_inARowValue}
  , m_newGameInformation{std::move(p_newGameInformation)}
+ , m_resource{p_resource}
 {
+    PRECONDITION(m_resource);
     INVARIANT(m_newGameInformation.m_players.size() >= 2);
 }
 
@@ -51,7 +54,7 @@ cxmodel::CommandCompletionStatus cxmodel::CommandCreateNewGame::Execute()
     m_modelPlayers = std::move(m_newGameInformation.m_players);
 
     // Board:
-    m_board = std::make_unique<cxmodel::Board>(m_newGameInformation.m_gridHeight, m_newGameInformation.m_gridWidth, m_modelAsLimits);
+    m_board.reset(new(m_resource) cxmodel::Board(m_newGameInformation.m_gridHeight, m_newGameInformation.m_gridWidth, m_modelAsLimits, m_resource));
 
     // In-a-row value:
     m_inARowValue = m_newGameInformation.m_inARowValue;
@@ -51,28 +51,29 @@ void UpdatePlayerIndex(size_t& p_playerIndex, size_t p_nbOfPlayers)
 
 cxmodel::CommandDropChip::CommandDropChip(cxmodel::IBoard& p_board,
                                           cxmodel::PlayerInformation& p_playersInfo,
-                                          std::unique_ptr<cxmodel::IChip>&& p_droppedChip,
+                                          const cxmodel::IChip& p_droppedChip,
                                           const size_t p_column,
-                                          std::vector<IBoard::Position>& p_takenPositions,
-                                          cxlog::ILogger& p_logger)
- : m_board{p_board}
+                                          std::pmr::vector<IBoard::Position>& p_takenPositions,
+                                          cxlog::ILogger& p_logger,
+                                          std::pmr::memory_resource* p_resource)
+ : ModelSubject{p_resource}
+ , m_board{p_board}
  , m_playersInfo{p_playersInfo}
- , m_droppedChip{std::move(p_droppedChip)}
+ , m_droppedChip{p_droppedChip.GetColor()}
  , m_column{p_column}
  , m_takenPositions{p_takenPositions}
  , m_logger{p_logger}
- , m_previousPlayerInformation{p_playersInfo}
+ , m_previousActivePlayerIndex{p_playersInfo.m_activePlayerIndex}
+ , m_previousNextPlayerIndex{p_playersInfo.m_nextPlayerIndex}
  , m_previousColumn{p_column}
 {
     PRECONDITION(p_column < p_board.GetNbColumns());
-
-    POSTCONDITION(m_droppedChip);
 }
 
 cxmodel::CommandCompletionStatus cxmodel::CommandDropChip::Execute()
 {
     const auto activePlayer = m_playersInfo.m_players[m_playersInfo.m_activePlayerIndex];
-    if(!INL_PRECONDITION(activePlayer->GetChip() == *m_droppedChip))
+    if(!INL_PRECONDITION(activePlayer->GetChip() == m_droppedChip))
     {
         const IChip& activePlayerChip = activePlayer->GetChip();
         std::ostringstream logStream;
@@ -82,9 +83,9 @@ cxmodel::CommandCompletionStatus cxmodel::CommandDropChip::Execute()
         m_logger.Log(cxlog::VerbosityLevel::DEBUG, __FILE__, __FUNCTION__, __LINE__, logStream.str());
 
         logStream.str("");
-        logStream << "Dropped disc color: (" << m_droppedChip->GetColor().R() << ", "
-                                             << m_droppedChip->GetColor().G() << ", "
-                                             << m_droppedChip->GetColor().B() << ")";
+        logStream << "Dropped disc color: (" << m_droppedChip.GetColor().R() << ", "
+                                             << m_droppedChip.GetColor().G() << ", "
+                                             << m_droppedChip.GetColor().B() << ")";
         m_logger.Log(cxlog::VerbosityLevel::DEBUG, __FILE__, __FUNCTION__, __LINE__, logStream.str());
 
         return CommandCompletionStatus::FAILED_UNEXPECTED;;
@@ -98,10 +99,8 @@ cxmodel::CommandCompletionStatus cxmodel::CommandDropChip::Execute()
         return CommandCompletionStatus::FAILED_EXPECTED;;
     }
 
-    IF_CONDITION_NOT_MET_DO(m_droppedChip, return CommandCompletionStatus::FAILED_UNEXPECTED;);
-
     IBoard::Position droppedPosition;
-    IF_CONDITION_NOT_MET_DO(m_board.DropChip(m_column, *m_droppedChip, droppedPosition), return CommandCompletionStatus::FAILED_UNEXPECTED;);
+    IF_CONDITION_NOT_MET_DO(m_board.DropChip(m_column, m_droppedChip, droppedPosition), return CommandCompletionStatus::FAILED_UNEXPECTED;);
     m_previousDropPosition = droppedPosition;
 
     // Update player information:
@@ -125,9 +124,14 @@ cxmodel::CommandCompletionStatus cxmodel::CommandDropChip::Execute()
         return CommandCompletionStatus::SUCCESS;;
     }
 
-    std::ostringstream stream;
-    stream << activePlayer->GetName() << "'s chip dropped at (" << droppedPosition.m_row << ", " << droppedPosition.m_column << ")";
-    m_logger.Log(cxlog::VerbosityLevel::DEBUG, __FILE__, __FUNCTION__, __LINE__, stream.str());
+    // Formatting the message costs more than the drop itself, so it is skipped when it would
+    // be filtered out anyway:
+    if(m_logger.GetVerbosityLevel() >= cxlog::VerbosityLevel::DEBUG)
+    {
+        std::ostringstream stream;
+        stream << activePlayer->GetName() << "'s chip dropped at (" << droppedPosition.m_row << ", " << droppedPosition.m_column << ")";
+        m_logger.Log(cxlog::VerbosityLevel::DEBUG, __FILE__, __FUNCTION__, __LINE__, stream.str());
+    }
 
     // At this point, all successive calls to Execute are redos:
     m_isRedo = true;
@@ -140,7 +144,8 @@ cxmodel::CommandCompletionStatus cxmodel::CommandDropChip::Execute()
 void cxmodel::CommandDropChip::Undo()
 {
     // Put playersInfo back:
-    m_playersInfo = m_previousPlayerInformation;
+    m_playersInfo.m_activePlayerIndex = m_previousActivePlayerIndex;
+    m_playersInfo.m_nextPlayerIndex = m_previousNextPlayerIndex;
     
     // Erase the dropped position from the taken positions:
     m_takenPositions.erase(std::remove(m_takenPositions.begin(), m_takenPositions.end(), m_previousDropPosition),
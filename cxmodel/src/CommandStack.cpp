@@ -27,16 +27,15 @@
 #include <cxmodel/CommandCompletionStatus.h>
 #include <cxmodel/CommandStack.h>
 
-cxmodel::CommandStack::CommandStack(const size_t p_capacity)
- : m_endPosition{p_capacity - 1}
+cxmodel::CommandStack::CommandStack(const size_t p_capacity, std::pmr::memory_resource* p_resource)
+ : m_first{0}
+ , m_nbCommands{0}
  , m_currentPosition{0}
- , m_allCmdUndoed{false}
+ , m_commands{p_resource}
 {
     PRECONDITION(p_capacity > 1);
 
-    m_commands.reserve(p_capacity);
-
-    POSTCONDITION(m_endPosition > 1);
+    m_commands.resize(p_capacity);
 
     CheckInvariants();
 }
@@ -55,39 +54,24 @@ cxmodel::CommandCompletionStatus cxmodel::CommandStack::Execute(std::unique_ptr<
 
     // At this point we know the command execution was a success, so we add it to the stack
     // to later be undone, if ever necessary:
-    if(NoCommandUndoed())
-    {
-        if(IsFull())
-        {
-            // We remove the oldest command (front) and add the new one
-            // at the end (back):
-            m_commands.erase(m_commands.cbegin());
-            m_commands.push_back(std::move(p_newCommand));
-
-            // We remove one to make sure the new command can be executed:
-            m_currentPosition = m_commands.size() - 1;
-        }
-        else
-        {
-            m_commands.push_back(std::move(p_newCommand));
-        }
-    }
-    else if(SomeCommandUndoed())
+    if(SomeCommandUndoed())
     {
         // Some commands were undoed and never redoed before new ones
         // were added. In this case, we strip all previously undoed commands.
-        // We will forget about them and replace them by the new addedcommand:
-        m_commands.erase(m_commands.cbegin() + m_currentPosition,
-                         m_commands.cend());
-
-        m_currentPosition = m_commands.size();
-
-        // Add the new command:
-        m_commands.push_back(std::move(p_newCommand));
+        // We will forget about them and replace them by the new added command:
+        ForgetUndoedCommands();
+    }
+    else if(IsFull())
+    {
+        // We remove the oldest command to make room for the new one:
+        ForgetOldestCommand();
     }
 
+    m_commands[GetIndex(m_nbCommands)] = std::move(p_newCommand);
+    ++m_nbCommands;
+
     // At this point a new command was added:
-    ASSERT(m_currentPosition < m_commands.size());
+    ASSERT(m_currentPosition < m_nbCommands);
     ++m_currentPosition;
 
     CheckInvariants();
@@ -97,98 +81,109 @@ cxmodel::CommandCompletionStatus cxmodel::CommandStack::Execute(std::unique_ptr<
 
 void cxmodel::CommandStack::Clear()
 {
-    m_commands.clear();
+    for(size_t position = 0; position < m_nbCommands; ++position)
+    {
+        m_commands[GetIndex(position)].reset();
+    }
+
+    m_first = 0;
+    m_nbCommands = 0;
     m_currentPosition = 0;
-    m_allCmdUndoed = false;
 
-    POSTCONDITION(m_commands.size() == 0);
+    POSTCONDITION(IsEmpty());
 
     CheckInvariants();
 }
 
 void cxmodel::CommandStack::Undo()
 {
-    if(m_commands.empty())
+    if(!CanUndo())
     {
         return;
     }
 
-    if(m_currentPosition == 0)
-    {
-        return;
-    }
-
-    if(m_currentPosition > 0)
-    {
-        --m_currentPosition;
-        m_commands[m_currentPosition]->Undo();
-    }
+    --m_currentPosition;
+    m_commands[GetIndex(m_currentPosition)]->Undo();
 
     CheckInvariants();
 }
 
 void cxmodel::CommandStack::Redo()
 {
-    if(m_commands.empty())
+    if(!CanRedo())
     {
         return;
     }
 
-    if(m_currentPosition == m_commands.size())
-    {
-        return;
-    }
-
-    if(m_currentPosition < m_commands.size())
-    {
-        ++m_currentPosition;
-        m_commands[m_currentPosition - 1]->Execute();
-    }
+    ++m_currentPosition;
+    m_commands[GetIndex(m_currentPosition - 1)]->Execute();
 
     CheckInvariants();
 }
 
 bool cxmodel::CommandStack::CanUndo() const
 {
-    return !IsEmpty() && m_currentPosition > 0;
+    return m_currentPosition > 0;
 }
 
 bool cxmodel::CommandStack::CanRedo() const
 {
-    return !IsEmpty() && m_currentPosition < GetLastCommandPosition() + 1;
+    return SomeCommandUndoed();
 }
 
 bool cxmodel::CommandStack::IsEmpty() const
 {
-    return m_commands.empty();
+    return m_nbCommands == 0;
 }
 
 bool cxmodel::CommandStack::IsFull() const
 {
-    return m_endPosition == GetLastCommandPosition();
+    return m_nbCommands == m_commands.size();
 }
 
 size_t cxmodel::CommandStack::GetNbCommands() const
 {
-    return m_commands.size();
+    return m_nbCommands;
 }
 
-size_t cxmodel::CommandStack::GetLastCommandPosition() const
+size_t cxmodel::CommandStack::GetIndex(size_t p_position) const
 {
-    return m_commands.size() - 1;
+    const size_t index = m_first + p_position;
+
+    return index < m_commands.size() ? index : index - m_commands.size();
 }
 
-bool cxmodel::CommandStack::NoCommandUndoed() const
+bool cxmodel::CommandStack::SomeCommandUndoed() const
 {
-    return m_currentPosition == m_commands.size();
+    return m_currentPosition < m_nbCommands;
 }
 
-bool cxmodel::CommandStack::SomeCommandUndoed() const
+void cxmodel::CommandStack::ForgetUndoedCommands()
 {
-    return m_currentPosition < m_commands.size();
+    for(size_t position = m_currentPosition; position < m_nbCommands; ++position)
+    {
+        m_commands[GetIndex(position)].reset();
+    }
+
+    m_nbCommands = m_currentPosition;
+}
+
+void cxmodel::CommandStack::ForgetOldestCommand()
+{
+    PRECONDITION(m_nbCommands > 0);
+    PRECONDITION(m_currentPosition > 0);
+
+    m_commands[m_first].reset();
+    m_first = GetIndex(1);
+
+    --m_nbCommands;
+    --m_currentPosition;
 }
 
 void cxmodel::CommandStack::CheckInvariants()
 {
-    INVARIANT(m_endPosition > 1);
+    INVARIANT(m_commands.size() > 1);
+    INVARIANT(m_first < m_commands.size());
+    INVARIANT(m_nbCommands <= m_commands.size());
+    INVARIANT(m_currentPosition <= m_nbCommands);
 }
@@ -25,6 +25,11 @@
 #include <cxmodel/CommandCompletionStatus.h>
 #include <cxmodel/CompositeCommand.h>
 
+cxmodel::CompositeCommand::CompositeCommand(std::pmr::memory_resource* p_resource)
+: m_children{p_resource}
+{
+}
+
 void cxmodel::CompositeCommand::Add(std::unique_ptr<cxmodel::ICommand> p_child)
 {
     IF_PRECONDITION_NOT_MET_DO(p_child, return;);
@@ -0,0 +1,651 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file GameArchive.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <tuple>
+
+#include <cxinv/assertion.h>
+#include <cxmodel/BoardSnapshot.h>
+#include <cxmodel/ByteOrder.h>
+#include <cxmodel/GameArchive.h>
+
+namespace
+{
+
+constexpr char GAMES_MAGIC[] = {'C', 'X', 'G', 'A'};
+constexpr char INDEX_MAGIC[] = {'C', 'X', 'G', 'I'};
+
+constexpr const char* GAMES_EXTENSION = "games";
+constexpr const char* INDEX_EXTENSION = "index";
+
+// Games file header:
+constexpr size_t VERSION_OFFSET = 4u;
+constexpr size_t NB_ROWS_OFFSET = 6u;
+constexpr size_t NB_COLUMNS_OFFSET = 7u;
+constexpr size_t IN_A_ROW_VALUE_OFFSET = 8u;
+constexpr size_t NB_PLAYERS_OFFSET = 9u;
+constexpr size_t NB_GAMES_OFFSET = 12u;
+constexpr size_t USED_SIZE_OFFSET = 16u;
+constexpr size_t FIRST_GAME_ID_OFFSET = 24u;
+constexpr size_t GAMES_HEADER_SIZE = 32u;
+
+static_assert(USED_SIZE_OFFSET == NB_GAMES_OFFSET + 4u, "The game count and used size are written together.");
+
+// Room reserved in a new games file. It then grows geometrically:
+constexpr size_t INITIAL_GAMES_FILE_SIZE = 64u * 1024u;
+
+// Offsets in games files are stored on 4 bytes:
+constexpr size_t MAX_GAMES_FILE_SIZE = 0xFFFFFFFFu;
+
+// Game record: seed (8 bytes), description length (2 bytes), description, number of
+// moves (2 bytes) and moves (1 byte each):
+constexpr size_t RECORD_FIXED_SIZE = 12u;
+constexpr size_t MAX_DESCRIPTION_SIZE = 0xFFFFu;
+
+// Index file header, followed by the entries:
+constexpr size_t NB_ENTRIES_OFFSET = 8u;
+constexpr size_t INDEX_HEADER_SIZE = 16u;
+constexpr size_t ENTRY_SIZE = 16u;
+
+constexpr std::uint8_t NO_COLUMN = 0xFFu;
+
+// Game outcomes, for the player to move:
+constexpr std::uint8_t RESULT_WIN = 0u;
+constexpr std::uint8_t RESULT_LOSS = 1u;
+constexpr std::uint8_t RESULT_TIE = 2u;
+
+bool HasMagic(const cxmodel::MappedFile& p_file, const char (&p_magic)[4])
+{
+    return p_file.GetSize() >= sizeof(p_magic) && std::memcmp(p_file.GetData(), p_magic, sizeof(p_magic)) == 0;
+}
+
+cxmodel::ArchivedGame ReadRecord(const std::byte* p_record)
+{
+    cxmodel::ArchivedGame game;
+    game.m_seed = cxmodel::ReadLittleEndian(p_record, 8u);
+
+    const size_t descriptionSize = cxmodel::ReadLittleEndian(p_record + 8u, 2u);
+    game.m_description.assign(reinterpret_cast<const char*>(p_record + 10u), descriptionSize);
+
+    const std::byte* const moves = p_record + 10u + descriptionSize;
+    const size_t nbMoves = cxmodel::ReadLittleEndian(moves, 2u);
+    game.m_moves.resize(nbMoves);
+    std::transform(moves + 2u, moves + 2u + nbMoves, game.m_moves.begin(), [](std::byte p_move){return std::to_integer<size_t>(p_move);});
+
+    return game;
+}
+
+} // namespace
+
+size_t cxmodel::GetNbGames(const ColumnStatistics& p_statistics)
+{
+    return p_statistics.m_nbWins + p_statistics.m_nbLosses + p_statistics.m_nbTies;
+}
+
+double cxmodel::GetWinRate(const ColumnStatistics& p_statistics)
+{
+    const size_t nbGames = GetNbGames(p_statistics);
+    if(nbGames == 0u)
+    {
+        return 0.0;
+    }
+
+    return static_cast<double>(p_statistics.m_nbWins) / static_cast<double>(nbGames);
+}
+
+cxmodel::GameArchive::GameArchive(size_t p_nbRows, size_t p_nbColumns, size_t p_inARowValue, size_t p_nbPlayers, size_t p_segmentCapacity)
+: m_nbRows{p_nbRows}
+, m_nbColumns{p_nbColumns}
+, m_inARowValue{p_inARowValue}
+, m_nbPlayers{p_nbPlayers}
+, m_segmentCapacity{p_segmentCapacity > 0u ? p_segmentCapacity : 1u}
+{
+    PRECONDITION(p_nbRows > 0u);
+    PRECONDITION(p_nbRows <= 0xFFu);
+    PRECONDITION(p_nbColumns > 0u);
+    PRECONDITION(p_nbColumns < NO_COLUMN);
+    PRECONDITION(p_inARowValue > 1u);
+    PRECONDITION(p_inARowValue <= 0xFFu);
+    PRECONDITION(p_nbPlayers >= 2u);
+    PRECONDITION(p_nbPlayers < 0xFFu);
+    PRECONDITION(p_segmentCapacity > 0u);
+}
+
+cxmodel::Status cxmodel::GameArchive::Open(const std::string& p_directory)
+{
+    IF_PRECONDITION_NOT_MET_DO(!IsOpen(), return MakeError("An archive is already open."););
+    IF_PRECONDITION_NOT_MET_DO(!p_directory.empty(), return MakeError("Invalid archive directory."););
+
+    std::error_code error;
+    std::filesystem::create_directories(p_directory, error);
+    if(error)
+    {
+        return MakeError("The archive directory " + p_directory + " can't be created: " + error.message() + ".");
+    }
+
+    m_directory = p_directory;
+
+    for(size_t segmentIndex = 0u; std::filesystem::exists(MakeSegmentPath(segmentIndex, GAMES_EXTENSION)); ++segmentIndex)
+    {
+        const Status status = OpenSegment(segmentIndex);
+        if(!status.IsSuccess())
+        {
+            m_directory.clear();
+            m_segments.clear();
+            m_nbGames = 0u;
+            m_pendingEntries.clear();
+
+            return status;
+        }
+    }
+
+    return MakeSuccess();
+}
+
+cxmodel::Status cxmodel::GameArchive::Append(const ArchivedGame& p_game)
+{
+    IF_PRECONDITION_NOT_MET_DO(IsOpen(), return MakeError("No archive is open."););
+
+    if(p_game.m_description.size() > MAX_DESCRIPTION_SIZE)
+    {
+        return MakeError("The game description is too long to be archived.");
+    }
+
+    const size_t recordSize = RECORD_FIXED_SIZE + p_game.m_description.size() + p_game.m_moves.size();
+
+    // A game goes to a new segment when the last one is sealed, or has no room left:
+    bool needsSegment = m_segments.empty() || m_segments.back().m_index.IsOpen();
+    if(!needsSegment && m_segments.back().m_usedSize + recordSize > MAX_GAMES_FILE_SIZE)
+    {
+        const Status status = Seal();
+        ON_ERROR(status, return status;);
+
+        needsSegment = true;
+    }
+
+    const size_t gameIndex = needsSegment ? 0u : m_segments.back().m_offsets.size();
+    const size_t firstEntry = m_pendingEntries.size();
+    Status status = IndexGame(p_game, static_cast<std::uint32_t>(gameIndex), m_pendingEntries);
+    ON_ERROR(status, return status;);
+
+    m_arePendingEntriesSorted = false;
+
+    if(needsSegment)
+    {
+        status = CreateSegment();
+        ON_ERROR(status, m_pendingEntries.resize(firstEntry); return status;);
+    }
+
+    Segment& segment = m_segments.back();
+    if(segment.m_usedSize + recordSize > segment.m_games.GetSize())
+    {
+        status = segment.m_games.Resize(std::min(std::max(segment.m_usedSize + recordSize, 2u * segment.m_games.GetSize()), MAX_GAMES_FILE_SIZE));
+        ON_ERROR(status, m_pendingEntries.resize(firstEntry); return status;);
+    }
+
+    std::byte* const record = segment.m_games.GetData() + segment.m_usedSize;
+    WriteLittleEndian(record, p_game.m_seed, 8u);
+    WriteLittleEndian(record + 8u, p_game.m_description.size(), 2u);
+    std::memcpy(record + 10u, p_game.m_description.data(), p_game.m_description.size());
+
+    std::byte* const moves = record + 10u + p_game.m_description.size();
+    WriteLittleEndian(moves, p_game.m_moves.size(), 2u);
+    std::transform(p_game.m_moves.cbegin(), p_game.m_moves.cend(), moves + 2u, [](size_t p_move){return static_cast<std::byte>(p_move);});
+
+    segment.m_offsets.push_back(static_cast<std::uint32_t>(segment.m_usedSize));
+    segment.m_usedSize += recordSize;
+    ++m_nbGames;
+
+    // The record is only counted once written, and the count and size are written in one go,
+    // so that an interrupted process leaves a valid file:
+    std::byte counts[8];
+    WriteLittleEndian(counts, segment.m_offsets.size(), 4u);
+    WriteLittleEndian(counts + 4u, segment.m_usedSize, 4u);
+    std::memcpy(segment.m_games.GetData() + NB_GAMES_OFFSET, counts, sizeof(counts));
+
+    if(segment.m_offsets.size() >= m_segmentCapacity)
+    {
+        return Seal();
+    }
+
+    return MakeSuccess();
+}
+
+cxmodel::Status cxmodel::GameArchive::Seal()
+{
+    IF_PRECONDITION_NOT_MET_DO(IsOpen(), return MakeError("No archive is open."););
+
+    if(m_segments.empty() || m_segments.back().m_index.IsOpen())
+    {
+        return MakeSuccess();
+    }
+
+    return WriteIndex(m_segments.back(), m_segments.size() - 1u);
+}
+
+cxmodel::ArchivedGame cxmodel::GameArchive::ReadGame(std::uint64_t p_gameId) const
+{
+    IF_PRECONDITION_NOT_MET_DO(p_gameId < m_nbGames, return ArchivedGame{};);
+
+    const auto next = std::upper_bound(m_segments.cbegin(), m_segments.cend(), p_gameId, [](std::uint64_t p_id, const Segment& p_segment)
+    {
+        return p_id < p_segment.m_firstGameId;
+    });
+    ASSERT(next != m_segments.cbegin());
+
+    const Segment& segment = *std::prev(next);
+    return ReadRecord(segment.m_games.GetData() + segment.m_offsets[p_gameId - segment.m_firstGameId]);
+}
+
+std::vector<cxmodel::PositionOccurrence> cxmodel::GameArchive::FindGames(const BoardSnapshot& p_position) const
+{
+    std::vector<PositionOccurrence> occurrences;
+    IF_PRECONDITION_NOT_MET_DO(p_position.GetNbRows() == m_nbRows && p_position.GetNbColumns() == m_nbColumns && p_position.GetNbPlayers() == m_nbPlayers, return occurrences;);
+
+    VisitEntries(p_position.GetCanonicalKey().m_key, [&occurrences](std::uint64_t p_firstGameId, const IndexEntry& p_entry)
+    {
+        occurrences.push_back({p_firstGameId + p_entry.m_gameIndex, p_entry.m_ply});
+    });
+
+    return occurrences;
+}
+
+std::vector<cxmodel::ColumnStatistics> cxmodel::GameArchive::ComputeColumnStatistics(const BoardSnapshot& p_position) const
+{
+    IF_PRECONDITION_NOT_MET_DO(p_position.GetNbRows() == m_nbRows && p_position.GetNbColumns() == m_nbColumns && p_position.GetNbPlayers() == m_nbPlayers, return {};);
+
+    std::vector<ColumnStatistics> statistics(m_nbColumns);
+
+    // Columns are indexed in the canonical orientation, and are turned back to the position's:
+    const CanonicalPositionKey key = p_position.GetCanonicalKey();
+    VisitEntries(key.m_key, [this, &key, &statistics](std::uint64_t /*p_firstGameId*/, const IndexEntry& p_entry)
+    {
+        // The last position of a game has no next column:
+        if(p_entry.m_nextColumn >= m_nbColumns)
+        {
+            return;
+        }
+
+        ColumnStatistics& column = statistics[RemapColumn(p_entry.m_nextColumn, key, m_nbColumns)];
+        switch(p_entry.m_result)
+        {
+            case RESULT_WIN:
+                ++column.m_nbWins;
+                break;
+
+            case RESULT_LOSS:
+                ++column.m_nbLosses;
+                break;
+
+            default:
+                ++column.m_nbTies;
+                break;
+        }
+    });
+
+    return statistics;
+}
+
+cxmodel::GameArchive::IndexEntry cxmodel::GameArchive::ReadEntry(const std::byte* p_source)
+{
+    IndexEntry entry;
+    entry.m_key = ReadLittleEndian(p_source, 8u);
+    entry.m_gameIndex = static_cast<std::uint32_t>(ReadLittleEndian(p_source + 8u, 4u));
+    entry.m_ply = static_cast<std::uint16_t>(ReadLittleEndian(p_source + 12u, 2u));
+    entry.m_nextColumn = std::to_integer<std::uint8_t>(p_source[14u]);
+    entry.m_result = std::to_integer<std::uint8_t>(p_source[15u]);
+
+    return entry;
+}
+
+void cxmodel::GameArchive::WriteEntry(std::byte* p_destination, const IndexEntry& p_entry)
+{
+    WriteLittleEndian(p_destination, p_entry.m_key, 8u);
+    WriteLittleEndian(p_destination + 8u, p_entry.m_gameIndex, 4u);
+    WriteLittleEndian(p_destination + 12u, p_entry.m_ply, 2u);
+    p_destination[14u] = static_cast<std::byte>(p_entry.m_nextColumn);
+    p_destination[15u] = static_cast<std::byte>(p_entry.m_result);
+}
+
+std::string cxmodel::GameArchive::MakeSegmentPath(size_t p_segmentIndex, const char* p_extension) const
+{
+    std::ostringstream fileName;
+    fileName << "segment-" << std::setw(6) << std::setfill('0') << p_segmentIndex << '.' << p_extension;
+
+    return (std::filesystem::path{m_directory} / fileName.str()).string();
+}
+
+cxmodel::Status cxmodel::GameArchive::OpenSegment(size_t p_segmentIndex)
+{
+    const std::string gamesPath = MakeSegmentPath(p_segmentIndex, GAMES_EXTENSION);
+
+    Segment segment;
+    segment.m_firstGameId = m_nbGames;
+
+    Status status = segment.m_games.Open(gamesPath);
+    ON_ERROR(status, return status;);
+
+    const std::byte* const data = segment.m_games.GetData();
+    const size_t size = segment.m_games.GetSize();
+    if(size < GAMES_HEADER_SIZE || !HasMagic(segment.m_games, GAMES_MAGIC))
+    {
+        return MakeError(gamesPath + " is not an archive segment.");
+    }
+
+    const std::uint64_t version = ReadLittleEndian(data + VERSION_OFFSET, 2u);
+    if(version != FORMAT_VERSION)
+    {
+        return MakeError("Unsupported archive format version " + std::to_string(version) + ".");
+    }
+
+    const bool isSameBoard = ReadLittleEndian(data + NB_ROWS_OFFSET, 1u) == m_nbRows &&
+                             ReadLittleEndian(data + NB_COLUMNS_OFFSET, 1u) == m_nbColumns &&
+                             ReadLittleEndian(data + IN_A_ROW_VALUE_OFFSET, 1u) == m_inARowValue &&
+                             ReadLittleEndian(data + NB_PLAYERS_OFFSET, 1u) == m_nbPlayers;
+    if(!isSameBoard)
+    {
+        return MakeError("The archived games were played on another board.");
+    }
+
+    if(ReadLittleEndian(data + FIRST_GAME_ID_OFFSET, 8u) != m_nbGames)
+    {
+        return MakeError(gamesPath + " does not follow the previous segment.");
+    }
+
+    const size_t nbGames = ReadLittleEndian(data + NB_GAMES_OFFSET, 4u);
+    segment.m_usedSize = ReadLittleEndian(data + USED_SIZE_OFFSET, 4u);
+    if(segment.m_usedSize < GAMES_HEADER_SIZE || segment.m_usedSize > size)
+    {
+        return MakeError(gamesPath + " is truncated.");
+    }
+
+    // The records are located:
+    segment.m_offsets.reserve(nbGames);
+    size_t offset = GAMES_HEADER_SIZE;
+    for(size_t gameIndex = 0u; gameIndex < nbGames; ++gameIndex)
+    {
+        if(segment.m_usedSize - offset < RECORD_FIXED_SIZE)
+        {
+            return MakeError(gamesPath + " is corrupted.");
+        }
+
+        const size_t descriptionSize = ReadLittleEndian(data + offset + 8u, 2u);
+        if(segment.m_usedSize - offset < RECORD_FIXED_SIZE + descriptionSize)
+        {
+            return MakeError(gamesPath + " is corrupted.");
+        }
+
+        const size_t nbMoves = ReadLittleEndian(data + offset + 10u + descriptionSize, 2u);
+        if(segment.m_usedSize - offset < RECORD_FIXED_SIZE + descriptionSize + nbMoves)
+        {
+            return MakeError(gamesPath + " is corrupted.");
+        }
+
+        segment.m_offsets.push_back(static_cast<std::uint32_t>(offset));
+        offset += RECORD_FIXED_SIZE + descriptionSize + nbMoves;
+    }
+
+    if(offset != segment.m_usedSize)
+    {
+        return MakeError(gamesPath + " is corrupted.");
+    }
+
+    // The index is only used if it was completely written:
+    const std::string indexPath = MakeSegmentPath(p_segmentIndex, INDEX_EXTENSION);
+    if(std::filesystem::exists(indexPath))
+    {
+        MappedFile index;
+        if(index.Open(indexPath).IsSuccess() && index.GetSize() >= INDEX_HEADER_SIZE && HasMagic(index, INDEX_MAGIC) &&
+           ReadLittleEndian(index.GetData() + VERSION_OFFSET, 2u) == FORMAT_VERSION)
+        {
+            const size_t nbEntries = ReadLittleEndian(index.GetData() + NB_ENTRIES_OFFSET, 8u);
+            if(index.GetSize() == INDEX_HEADER_SIZE + nbEntries * ENTRY_SIZE)
+            {
+                segment.m_index = std::move(index);
+                segment.m_nbIndexEntries = nbEntries;
+            }
+        }
+    }
+
+    m_nbGames += nbGames;
+    m_segments.push_back(std::move(segment));
+
+    if(m_segments.back().m_index.IsOpen())
+    {
+        return MakeSuccess();
+    }
+
+    // Otherwise, the index is rebuilt from the games:
+    for(size_t gameIndex = 0u; gameIndex < nbGames; ++gameIndex)
+    {
+        status = IndexGame(ReadGame(m_segments.back().m_firstGameId + gameIndex), static_cast<std::uint32_t>(gameIndex), m_pendingEntries);
+        ON_ERROR(status, return MakeError(gamesPath + " holds an invalid game: " + status.GetMessage()););
+    }
+
+    m_arePendingEntriesSorted = false;
+
+    // Only the last segment can be left unsealed:
+    const bool isLast = !std::filesystem::exists(MakeSegmentPath(p_segmentIndex + 1u, GAMES_EXTENSION));
+    if(!isLast || nbGames >= m_segmentCapacity)
+    {
+        return WriteIndex(m_segments.back(), p_segmentIndex);
+    }
+
+    return MakeSuccess();
+}
+
+cxmodel::Status cxmodel::GameArchive::CreateSegment()
+{
+    const size_t segmentIndex = m_segments.size();
+
+    // An index left by an older archive in the same directory would not match the games:
+    std::error_code error;
+    std::filesystem::remove(MakeSegmentPath(segmentIndex, INDEX_EXTENSION), error);
+
+    Segment segment;
+    segment.m_firstGameId = m_nbGames;
+    segment.m_usedSize = GAMES_HEADER_SIZE;
+
+    Status status = segment.m_games.Create(MakeSegmentPath(segmentIndex, GAMES_EXTENSION));
+    ON_ERROR(status, return status;);
+
+    status = segment.m_games.Resize(INITIAL_GAMES_FILE_SIZE);
+    ON_ERROR(status, return status;);
+
+    std::byte* const data = segment.m_games.GetData();
+    std::memcpy(data, GAMES_MAGIC, sizeof(GAMES_MAGIC));
+    WriteLittleEndian(data + VERSION_OFFSET, FORMAT_VERSION, 2u);
+    WriteLittleEndian(data + NB_ROWS_OFFSET, m_nbRows, 1u);
+    WriteLittleEndian(data + NB_COLUMNS_OFFSET, m_nbColumns, 1u);
+    WriteLittleEndian(data + IN_A_ROW_VALUE_OFFSET, m_inARowValue, 1u);
+    WriteLittleEndian(data + NB_PLAYERS_OFFSET, m_nbPlayers, 1u);
+    WriteLittleEndian(data + NB_GAMES_OFFSET, 0u, 4u);
+    WriteLittleEndian(data + USED_SIZE_OFFSET, GAMES_HEADER_SIZE, 4u);
+    WriteLittleEndian(data + FIRST_GAME_ID_OFFSET, m_nbGames, 8u);
+
+    m_segments.push_back(std::move(segment));
+
+    return MakeSuccess();
+}
+
+cxmodel::Status cxmodel::GameArchive::WriteIndex(Segment& p_segment, size_t p_segmentIndex)
+{
+    SortPendingEntries();
+
+    MappedFile index;
+    Status status = index.Create(MakeSegmentPath(p_segmentIndex, INDEX_EXTENSION));
+    ON_ERROR(status, return status;);
+
+    status = index.Resize(INDEX_HEADER_SIZE + m_pendingEntries.size() * ENTRY_SIZE);
+    ON_ERROR(status, return status;);
+
+    std::byte* const data = index.GetData();
+    for(size_t entryIndex = 0u; entryIndex < m_pendingEntries.size(); ++entryIndex)
+    {
+        WriteEntry(data + INDEX_HEADER_SIZE + entryIndex * ENTRY_SIZE, m_pendingEntries[entryIndex]);
+    }
+
+    // The magic is written last, so that an index cut short is rebuilt when the archive is
+    // opened again:
+    WriteLittleEndian(data + VERSION_OFFSET, FORMAT_VERSION, 2u);
+    WriteLittleEndian(data + NB_ENTRIES_OFFSET, m_pendingEntries.size(), 8u);
+    std::memcpy(data, INDEX_MAGIC, sizeof(INDEX_MAGIC));
+
+    // The room reserved for more games is given back:
+    status = p_segment.m_games.Resize(p_segment.m_usedSize);
+    ON_ERROR(status, return status;);
+
+    p_segment.m_index = std::move(index);
+    p_segment.m_nbIndexEntries = m_pendingEntries.size();
+    m_pendingEntries.clear();
+
+    return MakeSuccess();
+}
+
+cxmodel::Status cxmodel::GameArchive::IndexGame(const ArchivedGame& p_game, std::uint32_t p_gameIndex, std::vector<IndexEntry>& p_entries) const
+{
+    const size_t firstEntry = p_entries.size();
+
+    // While the game is played, the result holds the player to move:
+    BoardSnapshot board{m_nbRows, m_nbColumns, m_inARowValue, m_nbPlayers};
+    size_t winner = BoardSnapshot::NO_PLAYER;
+    bool isOver = false;
+    for(size_t ply = 0u; ply <= p_game.m_moves.size(); ++ply)
+    {
+        const CanonicalPositionKey key = board.GetCanonicalKey();
+        const size_t player = board.GetActivePlayerIndex();
+
+        if(ply == p_game.m_moves.size())
+        {
+            p_entries.push_back({key.m_key, p_gameIndex, static_cast<std::uint16_t>(ply), NO_COLUMN, static_cast<std::uint8_t>(player)});
+            break;
+        }
+
+        const size_t column = p_game.m_moves[ply];
+        if(isOver || column >= m_nbColumns || board.IsColumnFull(column))
+        {
+            p_entries.resize(firstEntry);
+            return MakeError("Move " + std::to_string(ply + 1u) + " can't be played.");
+        }
+
+        p_entries.push_back({key.m_key, p_gameIndex, static_cast<std::uint16_t>(ply), static_cast<std::uint8_t>(RemapColumn(column, key, m_nbColumns)), static_cast<std::uint8_t>(player)});
+
+        board.DropChip(column);
+        if(board.IsLastDropWinning(column))
+        {
+            winner = player;
+            isOver = true;
+        }
+        else
+        {
+            isOver = board.IsFull();
+        }
+    }
+
+    if(!isOver)
+    {
+        p_entries.resize(firstEntry);
+        return MakeError("The game is not finished.");
+    }
+
+    std::for_each(p_entries.begin() + static_cast<std::ptrdiff_t>(firstEntry), p_entries.end(), [winner](IndexEntry& p_entry)
+    {
+        const size_t player = p_entry.m_result;
+        p_entry.m_result = winner == BoardSnapshot::NO_PLAYER ? RESULT_TIE : (winner == player ? RESULT_WIN : RESULT_LOSS);
+    });
+
+    return MakeSuccess();
+}
+
+void cxmodel::GameArchive::SortPendingEntries() const
+{
+    if(m_arePendingEntriesSorted)
+    {
+        return;
+    }
+
+    std::sort(m_pendingEntries.begin(), m_pendingEntries.end(), [](const IndexEntry& p_lhs, const IndexEntry& p_rhs)
+    {
+        return std::tie(p_lhs.m_key, p_lhs.m_gameIndex, p_lhs.m_ply) < std::tie(p_rhs.m_key, p_rhs.m_gameIndex, p_rhs.m_ply);
+    });
+
+    m_arePendingEntriesSorted = true;
+}
+
+template<typename Visitor>
+void cxmodel::GameArchive::VisitEntries(PositionKey p_key, Visitor p_visitor) const
+{
+    for(const Segment& segment : m_segments)
+    {
+        if(segment.m_index.IsOpen())
+        {
+            // The mapped entries are binary searched in place:
+            const std::byte* const entries = segment.m_index.GetData() + INDEX_HEADER_SIZE;
+            size_t first = 0u;
+            size_t count = segment.m_nbIndexEntries;
+            while(count > 0u)
+            {
+                const size_t half = count / 2u;
+                if(ReadLittleEndian(entries + (first + half) * ENTRY_SIZE, 8u) < p_key)
+                {
+                    first += half + 1u;
+                    count -= half + 1u;
+                }
+                else
+                {
+                    count = half;
+                }
+            }
+
+            for(size_t entryIndex = first; entryIndex < segment.m_nbIndexEntries; ++entryIndex)
+            {
+                const IndexEntry entry = ReadEntry(entries + entryIndex * ENTRY_SIZE);
+                if(entry.m_key != p_key)
+                {
+                    break;
+                }
+
+                p_visitor(segment.m_firstGameId, entry);
+            }
+        }
+        else
+        {
+            SortPendingEntries();
+
+            auto entry = std::lower_bound(m_pendingEntries.cbegin(), m_pendingEntries.cend(), p_key, [](const IndexEntry& p_entry, PositionKey p_searchedKey)
+            {
+                return p_entry.m_key < p_searchedKey;
+            });
+
+            for(; entry != m_pendingEntries.cend() && entry->m_key == p_key; ++entry)
+            {
+                p_visitor(segment.m_firstGameId, *entry);
+            }
+        }
+    }
+}
@@ -48,10 +48,11 @@ public:
 std::unique_ptr<cxmodel::IGameResolutionStrategy> cxmodel::GameResolutionStrategyFactory::Make(const IBoard& p_board,
                                                                                                size_t p_inARowValue,
                                                                                                const std::vector<std::shared_ptr<IPlayer>>& p_players,
-                                                                                               const std::vector<IBoard::Position>& p_takenPositions,
-                                                                                               GameResolution p_resolution)
+                                                                                               const std::pmr::vector<IBoard::Position>& p_takenPositions,
+                                                                                               GameResolution p_resolution,
+                                                                                               std::pmr::memory_resource* p_resource)
 {
-    std::unique_ptr<IGameResolutionStrategy> strategy = std::make_unique<NoGameResolutionStrategy>();
+    std::unique_ptr<IGameResolutionStrategy> strategy{new(p_resource) NoGameResolutionStrategy{}};
     ASSERT(strategy);
 
     IF_PRECONDITION_NOT_MET_DO(p_inARowValue >= 2u, return strategy;);
@@ -62,13 +63,13 @@ std::unique_ptr<cxmodel::IGameResolutionStrategy> cxmodel::GameResolutionStrateg
     {
         case GameResolution::WIN:
         {
-            strategy = std::make_unique<WinGameResolutionStrategy>(p_board, p_inARowValue, p_players, p_takenPositions);
+            strategy.reset(new(p_resource) WinGameResolutionStrategy(p_board, p_inARowValue, p_players, p_takenPositions));
             break;
         }
 
         case GameResolution::TIE:
         {
-            strategy = std::make_unique<TieGameResolutionStrategy>(p_board, p_inARowValue, p_players, p_takenPositions);
+            strategy.reset(new(p_resource) TieGameResolutionStrategy(p_board, p_inARowValue, p_players, p_takenPositions));
             break;
         }
 
@@ -22,11 +22,15 @@
  *************************************************************************************************/
 
 #include <algorithm>
-#include <random>
+#include <atomic>
+#include <chrono>
 
 #include <cxinv/assertion.h>
-#include <cxmodel/IBoard.h>
+#include <cxmodel/BoardSnapshot.h>
+#include <cxmodel/BotSettings.h>
 #include <cxmodel/INextDropColumnComputationStrategy.h>
+#include <cxmodel/RandomNumberGenerator.h>
+#include <cxmodel/Search.h>
 
 /**************************************************************************************************
  * @brief No next drop column computation strategy.
@@ -43,16 +47,32 @@ public:
      * @return The computed column.
      *
      *********************************************************************************************/
-    [[nodiscard]] size_t Compute(const cxmodel::IBoard& /*p_board*/) const override
+    [[nodiscard]] size_t Compute(const cxmodel::BoardSnapshot& /*p_position*/) override
     {
         return 0u;
     }
+
+    /**********************************************************************************************
+     * @brief Gets the statistics of the last computation.
+     *
+     * @return All zero statistics.
+     *
+     *********************************************************************************************/
+    [[nodiscard]] const cxmodel::SearchStatistics& GetStatistics() const override
+    {
+        return m_statistics;
+    }
+
+private:
+
+    cxmodel::SearchStatistics m_statistics;
 };
 
 /**************************************************************************************************
  * @brief Random next drop column strategy.
  *
- * A random column is chosen amongst the available columns in the board.
+ * A random column is chosen amongst the available columns in the board. The strategy draws from
+ * its own generator, so a seeded strategy always picks the same columns for the same positions.
  *
  *************************************************************************************************/
 class RandomNextDropColumnComputationStrategy : public cxmodel::INextDropColumnComputationStrategy
@@ -63,58 +83,215 @@ public:
     /**********************************************************************************************
      * @brief Constructor.
      *
+     * @param p_randomNumberGenerator The generator from which columns are drawn.
+     *
      *********************************************************************************************/
-    RandomNextDropColumnComputationStrategy() = default;
+    explicit RandomNextDropColumnComputationStrategy(const cxmodel::RandomNumberGenerator& p_randomNumberGenerator);
 
     /**********************************************************************************************
      * @brief Computes a next available drop column.
      *
-     * @param p_board The game board.
+     * @param p_position The game position.
      *
      * @return The computed column.
      *
      *********************************************************************************************/
-    [[nodiscard]] size_t Compute(const cxmodel::IBoard& p_board) const override;
+    [[nodiscard]] size_t Compute(const cxmodel::BoardSnapshot& p_position) override;
+
+    /**********************************************************************************************
+     * @brief Gets the statistics of the last computation.
+     *
+     * Only the time and the computed column (as principal variation) are reported, since
+     * nothing is searched.
+     *
+     * @return The statistics of the last computation.
+     *
+     *********************************************************************************************/
+    [[nodiscard]] const cxmodel::SearchStatistics& GetStatistics() const override;
+
+private:
+
+    [[nodiscard]] size_t PickColumn(const cxmodel::BoardSnapshot& p_position);
+
+    cxmodel::RandomNumberGenerator m_randomNumberGenerator;
+    cxmodel::SearchStatistics m_statistics;
 };
 
-size_t RandomNextDropColumnComputationStrategy::Compute(const cxmodel::IBoard& p_board) const
+RandomNextDropColumnComputationStrategy::RandomNextDropColumnComputationStrategy(const cxmodel::RandomNumberGenerator& p_randomNumberGenerator)
+: m_randomNumberGenerator{p_randomNumberGenerator}
+{
+}
+
+size_t RandomNextDropColumnComputationStrategy::Compute(const cxmodel::BoardSnapshot& p_position)
 {
-    // List all the available column indexes:
-    std::vector<size_t> allColumnIndexes;
-    for(size_t column = 0u; column < p_board.GetNbColumns(); ++column)
+    const auto start = std::chrono::steady_clock::now();
+
+    const size_t column = PickColumn(p_position);
+
+    m_statistics = {};
+    m_statistics.m_nbComputations = 1u;
+    m_statistics.m_duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    m_statistics.m_principalVariation = {column};
+
+    return column;
+}
+
+const cxmodel::SearchStatistics& RandomNextDropColumnComputationStrategy::GetStatistics() const
+{
+    return m_statistics;
+}
+
+size_t RandomNextDropColumnComputationStrategy::PickColumn(const cxmodel::BoardSnapshot& p_position)
+{
+    // Count the available columns:
+    size_t nbAvailableColumns = 0u;
+    for(size_t column = 0u; column < p_position.GetNbColumns(); ++column)
     {
-        allColumnIndexes.push_back(column);
+        nbAvailableColumns += p_position.IsColumnFull(column) ? 0u : 1u;
     }
 
-    // Filter to get only the remaining columns:
-    std::vector<size_t> availableColumnIndexes;
-    std::copy_if(allColumnIndexes.cbegin(),
-                 allColumnIndexes.cend(),
-                 std::back_inserter(availableColumnIndexes),
-                 [&p_board](size_t p_index)
-                 {
-                     return !p_board.IsColumnFull(p_index);
-                 });
+    IF_CONDITION_NOT_MET_DO(nbAvailableColumns > 0u, return 0u;);
 
-    IF_CONDITION_NOT_MET_DO(availableColumnIndexes.size() > 0u, return 0u;);
+    // From this set of available columns, pick one at random:
+    size_t availableColumnIndex = m_randomNumberGenerator.Below(nbAvailableColumns);
+    for(size_t column = 0u; column < p_position.GetNbColumns(); ++column)
+    {
+        if(!p_position.IsColumnFull(column))
+        {
+            if(availableColumnIndex == 0u)
+            {
+                return column;
+            }
 
-    // From this set of available column indexes, pick one at random:
-    std::random_device randomDevice;
-    std::mt19937 randomNumberGenerator(randomDevice());
-    std::uniform_int_distribution<size_t> distribution(0u, availableColumnIndexes.size() - 1u);
+            --availableColumnIndex;
+        }
+    }
 
-    const size_t columnIndex = distribution(randomNumberGenerator);
-    IF_CONDITION_NOT_MET_DO(columnIndex < availableColumnIndexes.size(), return 0u;);
+    ASSERT_ERROR_MSG("No available column");
+    return 0u;
+}
 
-    return availableColumnIndexes[columnIndex];
+/**************************************************************************************************
+ * @brief Alpha-beta next drop column strategy.
+ *
+ * The best column is searched for within a time or node budget. The search, and its
+ * transposition table, are kept from one computation to the next, so results found while
+ * computing a move help computing the following ones.
+ *
+ *************************************************************************************************/
+class AlphaBetaNextDropColumnComputationStrategy : public cxmodel::INextDropColumnComputationStrategy
+{
+
+public:
+
+    /**********************************************************************************************
+     * @brief Constructor.
+     *
+     * @param p_botSettings The bot settings.
+     *
+     *********************************************************************************************/
+    explicit AlphaBetaNextDropColumnComputationStrategy(const cxmodel::BotSettings& p_botSettings);
+
+    /**********************************************************************************************
+     * @brief Computes a next available drop column.
+     *
+     * @param p_position The game position.
+     *
+     * @return The computed column.
+     *
+     *********************************************************************************************/
+    [[nodiscard]] size_t Compute(const cxmodel::BoardSnapshot& p_position) override;
+
+    /**********************************************************************************************
+     * @brief Gets the statistics of the last computation.
+     *
+     * @return The statistics of the last computation.
+     *
+     *********************************************************************************************/
+    [[nodiscard]] const cxmodel::SearchStatistics& GetStatistics() const override;
+
+private:
+
+    cxmodel::Search m_search;
+    cxmodel::SearchLimits m_limits;
+    cxmodel::SearchStatistics m_statistics;
+    std::atomic<bool> m_stop{false};
+};
+
+AlphaBetaNextDropColumnComputationStrategy::AlphaBetaNextDropColumnComputationStrategy(const cxmodel::BotSettings& p_botSettings)
+: m_search{p_botSettings.m_hashSizeInMB}
+{
+    if(p_botSettings.m_budget == 0u)
+    {
+        m_limits.m_maxTime = std::chrono::milliseconds{cxmodel::DEFAULT_BOT_SEARCH_TIME_MS};
+    }
+    else if(p_botSettings.m_budgetType == cxmodel::SearchBudgetType::NODES)
+    {
+        m_limits.m_maxNodes = p_botSettings.m_budget;
+    }
+    else
+    {
+        m_limits.m_maxTime = std::chrono::milliseconds{p_botSettings.m_budget};
+    }
+}
+
+size_t AlphaBetaNextDropColumnComputationStrategy::Compute(const cxmodel::BoardSnapshot& p_position)
+{
+    IF_CONDITION_NOT_MET_DO(!p_position.IsFull(), return 0u;);
+
+    const cxmodel::SearchResult result = m_search.Run(p_position, m_limits, m_stop);
+    m_statistics = result.m_statistics;
+
+    if(result.m_depth > 0u)
+    {
+        return result.m_bestColumn;
+    }
+
+    // Not even one iteration could be completed within the budget, any available column
+    // will do:
+    for(size_t column = 0u; column < p_position.GetNbColumns(); ++column)
+    {
+        if(!p_position.IsColumnFull(column))
+        {
+            m_statistics.m_principalVariation = {column};
+            return column;
+        }
+    }
+
+    ASSERT_ERROR_MSG("No available column");
+    return 0u;
+}
+
+const cxmodel::SearchStatistics& AlphaBetaNextDropColumnComputationStrategy::GetStatistics() const
+{
+    return m_statistics;
 }
 
 std::unique_ptr<cxmodel::INextDropColumnComputationStrategy> cxmodel::NextDropColumnComputationStrategyCreate(DropColumnComputation p_algorithm)
 {
-    switch(p_algorithm)
+    BotSettings settings;
+    settings.m_algorithm = p_algorithm;
+
+    return NextDropColumnComputationStrategyCreate(settings);
+}
+
+std::unique_ptr<cxmodel::INextDropColumnComputationStrategy> cxmodel::NextDropColumnComputationStrategyCreate(const BotSettings& p_botSettings)
+{
+    return NextDropColumnComputationStrategyCreate(p_botSettings, RandomNumberGenerator{MakeRandomSeed()});
+}
+
+std::unique_ptr<cxmodel::INextDropColumnComputationStrategy> cxmodel::NextDropColumnComputationStrategyCreate(const BotSettings& p_botSettings,
+                                                                                                               const RandomNumberGenerator& p_randomNumberGenerator)
+{
+    switch(p_botSettings.m_algorithm)
     {
         case DropColumnComputation::RANDOM:
-            return std::make_unique<RandomNextDropColumnComputationStrategy>();
+            // The random strategy does not search, so the budget and hash size are not
+            // relevant to it:
+            return std::make_unique<RandomNextDropColumnComputationStrategy>(p_randomNumberGenerator);
+
+        case DropColumnComputation::ALPHA_BETA:
+            return std::make_unique<AlphaBetaNextDropColumnComputationStrategy>(p_botSettings);
 
         default:
             break;
@@ -49,10 +49,12 @@ public:
     [[nodiscard]] std::string GetName() const override {return {};}
     [[nodiscard]] const IChip& GetChip() const override {return *m_chip;}
     [[nodiscard]] bool IsManaged() const override {return false;}
+    [[nodiscard]] const BotSettings& GetBotSettings() const override {return m_botSettings;}
 
 private:
 
      std::unique_ptr<IChip> m_chip;
+     BotSettings m_botSettings;
 
 };
 
@@ -96,6 +98,7 @@ public:
     [[nodiscard]] std::string GetName() const override {return m_name;};
     [[nodiscard]] const IChip& GetChip() const override {return *m_chip;};
     [[nodiscard]] bool IsManaged() const override = 0;
+    [[nodiscard]] const BotSettings& GetBotSettings() const override = 0;
 
 private:
 
@@ -132,6 +135,11 @@ public:
 
     // cxmodel::IPlayer:
     [[nodiscard]] bool IsManaged() const override {return false;}
+    [[nodiscard]] const BotSettings& GetBotSettings() const override {return m_botSettings;}
+
+private:
+
+    BotSettings m_botSettings;
 
 };
 
@@ -152,17 +160,24 @@ public:
      *
      * @pre The player name is not empty.
      *
-     * @param p_name      The player name.
-     * @param p_chipColor The player's chip color.
+     * @param p_name        The player name.
+     * @param p_chipColor   The player's chip color.
+     * @param p_botSettings The settings used to compute the player's moves.
      *
      ********************************************************************************************/
-    BotPlayer(const std::string& p_name, const ChipColor& p_chipColor)
+    BotPlayer(const std::string& p_name, const ChipColor& p_chipColor, const BotSettings& p_botSettings)
     : Player(p_name, p_chipColor)
+    , m_botSettings{p_botSettings}
     {
     }
 
     // cxmodel::IPlayer:
     [[nodiscard]] bool IsManaged() const override {return true;}
+    [[nodiscard]] const BotSettings& GetBotSettings() const override {return m_botSettings;}
+
+private:
+
+    BotSettings m_botSettings;
 
 };
 
@@ -170,7 +185,8 @@ public:
 
 [[nodiscard]] std::unique_ptr<cxmodel::IPlayer> cxmodel::CreatePlayer(const std::string& p_name,
                                                                       const ChipColor& p_chipColor,
-                                                                      PlayerType p_type)
+                                                                      PlayerType p_type,
+                                                                      const BotSettings& p_botSettings)
 {
     std::unique_ptr<cxmodel::IPlayer> player = std::make_unique<NoPlayer>();
 
@@ -182,7 +198,7 @@ public:
             return std::make_unique<HumanPlayer>(p_name, p_chipColor);
 
         case cxmodel::PlayerType::BOT:
-            return std::make_unique<BotPlayer>(p_name, p_chipColor);
+            return std::make_unique<BotPlayer>(p_name, p_chipColor, p_botSettings);
 
         default:
             ASSERT_ERROR_MSG("Unknown player type.");
@@ -0,0 +1,204 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file MappedFile.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cxinv/assertion.h>
+#include <cxmodel/MappedFile.h>
+
+namespace
+{
+
+std::string MakeSystemError(const std::string& p_action)
+{
+    return p_action + ": " + std::strerror(errno);
+}
+
+} // namespace
+
+cxmodel::MappedFile::~MappedFile()
+{
+    Close();
+}
+
+cxmodel::MappedFile::MappedFile(MappedFile&& p_other) noexcept
+: m_fd{std::exchange(p_other.m_fd, -1)}
+, m_data{std::exchange(p_other.m_data, nullptr)}
+, m_size{std::exchange(p_other.m_size, 0u)}
+{
+}
+
+cxmodel::MappedFile& cxmodel::MappedFile::operator=(MappedFile&& p_other) noexcept
+{
+    if(this != &p_other)
+    {
+        Close();
+
+        m_fd = std::exchange(p_other.m_fd, -1);
+        m_data = std::exchange(p_other.m_data, nullptr);
+        m_size = std::exchange(p_other.m_size, 0u);
+    }
+
+    return *this;
+}
+
+cxmodel::Status cxmodel::MappedFile::CreateTemporary()
+{
+    IF_PRECONDITION_NOT_MET_DO(!IsOpen(), return MakeError("The file is already open."););
+
+    const char* directory = std::getenv("TMPDIR");
+    const std::string pattern = std::string{directory && *directory ? directory : "/tmp"} + "/connectx-XXXXXX";
+
+    std::vector<char> path(pattern.cbegin(), pattern.cend());
+    path.push_back('\0');
+
+    m_fd = ::mkstemp(path.data());
+    if(m_fd < 0)
+    {
+        return MakeError(MakeSystemError("mkstemp"));
+    }
+
+    // The file has no name, so it goes away with its descriptor:
+    ::unlink(path.data());
+    ::fcntl(m_fd, F_SETFD, FD_CLOEXEC);
+
+    return MakeSuccess();
+}
+
+cxmodel::Status cxmodel::MappedFile::Create(const std::string& p_path)
+{
+    IF_PRECONDITION_NOT_MET_DO(!IsOpen(), return MakeError("The file is already open."););
+
+    m_fd = ::open(p_path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if(m_fd < 0)
+    {
+        return MakeError(MakeSystemError("open " + p_path));
+    }
+
+    return MakeSuccess();
+}
+
+cxmodel::Status cxmodel::MappedFile::Open(const std::string& p_path)
+{
+    IF_PRECONDITION_NOT_MET_DO(!IsOpen(), return MakeError("The file is already open."););
+
+    m_fd = ::open(p_path.c_str(), O_RDWR | O_CLOEXEC);
+    if(m_fd < 0)
+    {
+        return MakeError(MakeSystemError("open " + p_path));
+    }
+
+    struct stat status;
+    if(::fstat(m_fd, &status) != 0)
+    {
+        const Status error = MakeError(MakeSystemError("fstat " + p_path));
+        Close();
+
+        return error;
+    }
+
+    if(status.st_size > 0)
+    {
+        void* data = ::mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+        if(data == MAP_FAILED)
+        {
+            const Status error = MakeError(MakeSystemError("mmap " + p_path));
+            Close();
+
+            return error;
+        }
+
+        m_data = static_cast<std::byte*>(data);
+        m_size = static_cast<size_t>(status.st_size);
+    }
+
+    return MakeSuccess();
+}
+
+cxmodel::Status cxmodel::MappedFile::Resize(size_t p_size)
+{
+    IF_PRECONDITION_NOT_MET_DO(IsOpen(), return MakeError("The file is not open."););
+
+    if(p_size == m_size)
+    {
+        return MakeSuccess();
+    }
+
+    void* data = nullptr;
+    if(p_size > 0u)
+    {
+        if(::ftruncate(m_fd, static_cast<off_t>(p_size)) != 0)
+        {
+            return MakeError(MakeSystemError("ftruncate"));
+        }
+
+        data = ::mmap(nullptr, p_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+        if(data == MAP_FAILED)
+        {
+            const Status error = MakeError(MakeSystemError("mmap"));
+            (void)::ftruncate(m_fd, static_cast<off_t>(m_size));
+
+            return error;
+        }
+    }
+    else if(::ftruncate(m_fd, 0) != 0)
+    {
+        return MakeError(MakeSystemError("ftruncate"));
+    }
+
+    if(m_data)
+    {
+        ::munmap(m_data, m_size);
+    }
+
+    m_data = static_cast<std::byte*>(data);
+    m_size = p_size;
+
+    return MakeSuccess();
+}
+
+void cxmodel::MappedFile::Close()
+{
+    if(m_data)
+    {
+        ::munmap(m_data, m_size);
+        m_data = nullptr;
+    }
+
+    if(m_fd >= 0)
+    {
+        ::close(m_fd);
+        m_fd = -1;
+    }
+
+    m_size = 0u;
+}
@@ -0,0 +1,78 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file MemoryResourceAllocated.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <new>
+
+#include <cxinv/assertion.h>
+#include <cxmodel/MemoryResourceAllocated.h>
+
+namespace
+{
+
+// Stored in front of each object, so that it can be deallocated without knowing where it
+// was allocated from:
+struct alignas(std::max_align_t) AllocationHeader
+{
+    std::pmr::memory_resource* m_resource;
+    std::size_t m_size;
+};
+
+AllocationHeader* GetHeader(void* p_object)
+{
+    return static_cast<AllocationHeader*>(p_object) - 1;
+}
+
+} // namespace
+
+void* cxmodel::MemoryResourceAllocated::operator new(std::size_t p_size)
+{
+    return operator new(p_size, std::pmr::get_default_resource());
+}
+
+void* cxmodel::MemoryResourceAllocated::operator new(std::size_t p_size, std::pmr::memory_resource* p_resource)
+{
+    IF_PRECONDITION_NOT_MET_DO(p_resource, throw std::bad_alloc{};);
+
+    const std::size_t size = sizeof(AllocationHeader) + p_size;
+    void* const storage = p_resource->allocate(size, alignof(AllocationHeader));
+
+    AllocationHeader* const header = new(storage) AllocationHeader{p_resource, size};
+
+    return header + 1;
+}
+
+void cxmodel::MemoryResourceAllocated::operator delete(void* p_object) noexcept
+{
+    if(!p_object)
+    {
+        return;
+    }
+
+    const AllocationHeader header = *GetHeader(p_object);
+    header.m_resource->deallocate(GetHeader(p_object), header.m_size, alignof(AllocationHeader));
+}
+
+void cxmodel::MemoryResourceAllocated::operator delete(void* p_object, std::pmr::memory_resource* /*p_resource*/) noexcept
+{
+    operator delete(p_object);
+}
@@ -27,6 +27,8 @@
 #include <cxinv/assertion.h>
 
 #include <cxmodel/Board.h>
+#include <cxmodel/BotSettings.h>
+#include <cxmodel/BoardSnapshot.h>
 #include <cxmodel/CommandCompletionStatus.h>
 #include <cxmodel/CommandCreateNewGame.h>
 #include <cxmodel/CommandDropChip.h>
@@ -57,6 +59,25 @@ constexpr size_t NUMBER_OF_PLAYERS_MAX = 10u;
 
 const cxmodel::Disc NO_DISC{cxmodel::MakeTransparent()};
 
+// Analysis searches as deep as it can, but gives up after some time to avoid keeping a core
+// busy while nobody plays. Results are published at most 10 times per second:
+constexpr size_t ANALYSIS_MAX_TIME_MS = 30000u;
+constexpr size_t ANALYSIS_MIN_UPDATE_INTERVAL_MS = 100u;
+
+// Entries of the move journal must be able to hold any position and player:
+static_assert(GRID_MAX_HEIGHT - 1u <= cxmodel::MoveJournal::MAX_INDEX);
+static_assert(GRID_MAX_WIDTH - 1u <= cxmodel::MoveJournal::MAX_INDEX);
+static_assert(NUMBER_OF_PLAYERS_MAX - 1u <= cxmodel::MoveJournal::MAX_INDEX);
+
+// Players drop in turn, so the next player always follows the active one:
+void SetActivePlayerIndex(cxmodel::PlayerInformation& p_playersInfo, size_t p_playerIndex)
+{
+    const size_t nbPlayers = p_playersInfo.m_players.size();
+
+    p_playersInfo.m_activePlayerIndex = p_playerIndex % nbPlayers;
+    p_playersInfo.m_nextPlayerIndex = (p_playerIndex + 1u) % nbPlayers;
+}
+
 const cxmodel::IPlayer& GetDefaultActivePlayer()
 {
     static auto player = CreatePlayer("Woops (active)!", {0, 0, 0, 0}, cxmodel::PlayerType::HUMAN);
@@ -71,13 +92,18 @@ const cxmodel::IPlayer& GetDefaultNextPlayer()
 
 } // namespace
 
-cxmodel::Model::Model(std::unique_ptr<ICommandStack>&& p_cmdStack, cxlog::ILogger& p_logger)
+cxmodel::Model::Model(std::unique_ptr<ICommandStack>&& p_cmdStack,
+                      cxlog::ILogger& p_logger,
+                      std::pmr::memory_resource* p_resource)
  : m_logger{p_logger}
+ , m_resource{p_resource}
  , m_cmdStack{std::move(p_cmdStack)}
  , m_currentDropCommands{nullptr}
  , m_playersInfo{{}, 0u, 1u}
  , m_inARowValue{4u}
+ , m_takenPositions{p_resource}
 {
+    PRECONDITION(m_resource);
     PRECONDITION(m_cmdStack);
 
     if(m_cmdStack)
@@ -88,8 +114,28 @@ cxmodel::Model::Model(std::unique_ptr<ICommandStack>&& p_cmdStack, cxlog::ILogge
     CheckInvariants();
 }
 
+cxmodel::Model::Model(MoveJournal&& p_moveJournal,
+                      cxlog::ILogger& p_logger,
+                      std::pmr::memory_resource* p_resource)
+ : m_logger{p_logger}
+ , m_resource{p_resource}
+ , m_currentDropCommands{nullptr}
+ , m_moveJournal{std::move(p_moveJournal)}
+ , m_playersInfo{{}, 0u, 1u}
+ , m_inARowValue{4u}
+ , m_takenPositions{p_resource}
+{
+    PRECONDITION(m_resource);
+    PRECONDITION(m_moveJournal->GetNbEntries() == 0u);
+
+    CheckInvariants();
+}
+
 cxmodel::Model::~Model()
 {
+    // The analysis thread calls back into the model, so it is stopped first:
+    m_analysisService.reset();
+
     DetatchAll();
 }
 
@@ -169,7 +215,10 @@ void cxmodel::Model::CreateNewGame(NewGameInformation p_gameInformation)
     //                            return !p_player.GetName().empty();
     //                         }));
 
-    std::unique_ptr<ICommand> command = std::make_unique<CommandCreateNewGame>(*this, m_board, m_playersInfo.m_players, m_inARowValue, std::move(p_gameInformation));
+    m_seed = p_gameInformation.m_seed ? *p_gameInformation.m_seed : MakeRandomSeed();
+    m_randomNumberGenerator = RandomNumberGenerator{m_seed};
+
+    std::unique_ptr<ICommand> command{new(m_resource) CommandCreateNewGame(*this, m_board, m_playersInfo.m_players, m_inARowValue, std::move(p_gameInformation), m_resource)};
     IF_CONDITION_NOT_MET_DO(command, return;);
     command->Execute();
 
@@ -177,13 +226,23 @@ void cxmodel::Model::CreateNewGame(NewGameInformation p_gameInformation)
 
     IF_CONDITION_NOT_MET_DO(m_board, return;);
 
-    m_winResolutionStrategy = GameResolutionStrategyFactory::Make(*m_board, m_inARowValue, m_playersInfo.m_players, m_takenPositions, GameResolution::WIN);
+    // The record never grows past the board size, so no drop has to allocate:
+    m_takenPositions.reserve(m_board->GetNbPositions());
+
+    m_winResolutionStrategy = GameResolutionStrategyFactory::Make(*m_board, m_inARowValue, m_playersInfo.m_players, m_takenPositions, GameResolution::WIN, m_resource);
     IF_CONDITION_NOT_MET_DO(m_winResolutionStrategy, return;);
 
-    m_tieResolutionStrategy = GameResolutionStrategyFactory::Make(*m_board, m_inARowValue, m_playersInfo.m_players, m_takenPositions, GameResolution::TIE);
+    m_tieResolutionStrategy = GameResolutionStrategyFactory::Make(*m_board, m_inARowValue, m_playersInfo.m_players, m_takenPositions, GameResolution::TIE, m_resource);
     IF_CONDITION_NOT_MET_DO(m_tieResolutionStrategy, return;);
 
-    ComputeNextDropColumn(DropColumnComputation::RANDOM);
+    CreateBotStrategies();
+
+    // The previous target may not fit the new board:
+    m_botTarget = 0u;
+    ResetSearchStatistics();
+    ComputeActiveBotDropColumn();
+
+    RestartAnalysis();
 
     Notify(ModelNotificationContext::CREATE_NEW_GAME);
 
@@ -192,7 +251,8 @@ void cxmodel::Model::CreateNewGame(NewGameInformation p_gameInformation)
     stream << "New game created: " <<
               "In-a-row value=" << m_inARowValue <<
               ", Grid dimensions=(W" << m_board->GetNbColumns() << ", H" << m_board->GetNbRows() << ")"
-              ", Number of players=" << m_playersInfo.m_players.size();
+              ", Number of players=" << m_playersInfo.m_players.size() <<
+              ", Seed=" << m_seed;
 
     Log(cxlog::VerbosityLevel::DEBUG, __FILE__, __FUNCTION__, __LINE__, stream.str());
 
@@ -204,33 +264,88 @@ void cxmodel::Model::DropChip(const cxmodel::IChip& p_chip, size_t p_column)
     IF_PRECONDITION_NOT_MET_DO(m_board, return;);
     IF_PRECONDITION_NOT_MET_DO(p_column < m_board->GetNbColumns(), return;);
 
+    // Observers are notified once the drop is fully resolved:
+    const NotificationBatch batch{*this};
+
     // Before executing the drop, we take a copy of these indexes for later usage:
     const size_t activePlayerIndexBefore = m_playersInfo.m_activePlayerIndex;
     const size_t nextPlayerIndexBefore = m_playersInfo.m_nextPlayerIndex;
 
+    const bool isExecuted = m_moveJournal ? DropChipInJournal(p_chip, p_column, true) : DropChipAsCommand(p_chip, p_column, true);
+    IF_CONDITION_NOT_MET_DO(isExecuted, return;);
+
+    // The position changed, the previous analysis is obsolete:
+    RestartAnalysis();
+
+    // Won and tie checks come next. They are not part of the command because they never
+    // have to be rechecked once the initial drop is done. Undoing or redoing a drop can
+    // never lead to a win or a tie if the initial drop didn't.
+    if(IsWon())
+    {
+        // In the case of a win, we must revert the next player -> active player update, since
+        // the next player will never be able to play:
+        m_playersInfo.m_activePlayerIndex = activePlayerIndexBefore;
+        m_playersInfo.m_nextPlayerIndex = nextPlayerIndexBefore;
+
+        Notify(ModelNotificationContext::GAME_WON);
+
+        Log(cxlog::VerbosityLevel::DEBUG, __FILE__, __FUNCTION__, __LINE__, "Game won by : " + GetActivePlayer().GetName());
+
+        CheckInvariants();
+
+        return;
+    }
+
+    if(IsTie())
+    {
+        // In the case of a tie, we must revert the next player -> active player update, since
+        // the next player will never be able to play:
+        m_playersInfo.m_activePlayerIndex = activePlayerIndexBefore;
+        m_playersInfo.m_nextPlayerIndex = nextPlayerIndexBefore;
+
+        Notify(ModelNotificationContext::GAME_TIED);
+
+        Log(cxlog::VerbosityLevel::DEBUG, __FILE__, __FUNCTION__, __LINE__, "Game tied!");
+
+        CheckInvariants();
+
+        return;
+    }
+
+    ComputeActiveBotDropColumn();
+
+    CheckInvariants();
+}
+
+bool cxmodel::Model::DropChipAsCommand(const cxmodel::IChip& p_chip, size_t p_column, bool p_isNotified)
+{
     // We create the command and execute the drop:
-    auto command = std::make_unique<CommandDropChip>(*m_board,
-                                                     m_playersInfo,
-                                                     std::make_unique<cxmodel::Disc>(p_chip.GetColor()),
-                                                     p_column,
-                                                     m_takenPositions,
-                                                     m_logger);
-    IF_CONDITION_NOT_MET_DO(command, return;);                                                                          
-    command->Attach(this);
+    std::unique_ptr<CommandDropChip> command{new(m_resource) CommandDropChip(*m_board,
+                                                                             m_playersInfo,
+                                                                             p_chip,
+                                                                             p_column,
+                                                                             m_takenPositions,
+                                                                             m_logger,
+                                                                             m_resource)};
+    IF_CONDITION_NOT_MET_DO(command, return false;);
+    if(p_isNotified)
+    {
+        command->Attach(this);
+    }
 
     // We save this condition for later because once the command is executed,
     // the next player is not the same:
     const bool shouldResetDropCommands = !GetNextPlayer().IsManaged();
     if(!GetActivePlayer().IsManaged())
     {
-        auto dropCommands = std::make_unique<CompositeCommand>();
-        IF_CONDITION_NOT_MET_DO(dropCommands, return;);
+        std::unique_ptr<CompositeCommand> dropCommands{new(m_resource) CompositeCommand(m_resource)};
+        IF_CONDITION_NOT_MET_DO(dropCommands, return false;);
 
         dropCommands->Add(std::move(command));
 
         m_currentDropCommands = dropCommands.get();
 
-        IF_CONDITION_NOT_MET_DO(m_cmdStack->Execute(std::move(dropCommands)) <= CommandCompletionStatus::FAILED_EXPECTED, return;);
+        IF_CONDITION_NOT_MET_DO(m_cmdStack->Execute(std::move(dropCommands)) <= CommandCompletionStatus::FAILED_EXPECTED, return false;);
 
         if(shouldResetDropCommands)
         {
@@ -239,7 +354,7 @@ void cxmodel::Model::DropChip(const cxmodel::IChip& p_chip, size_t p_column)
     }
     else
     {
-        IF_CONDITION_NOT_MET_DO(command->Execute() == CommandCompletionStatus::SUCCESS, return;);
+        IF_CONDITION_NOT_MET_DO(command->Execute() == CommandCompletionStatus::SUCCESS, return false;);
 
         if(m_currentDropCommands)
         {
@@ -252,44 +367,185 @@ void cxmodel::Model::DropChip(const cxmodel::IChip& p_chip, size_t p_column)
         }
     }
 
-    // Won and tie checks come next. They are not part of the command because they never
-    // have to be rechecked once the initial drop is done. Undoing or redoing a drop can
-    // never lead to a win or a tie if the initial drop didn't.
-    if(IsWon())
+    return true;
+}
+
+bool cxmodel::Model::DropChipInJournal(const cxmodel::IChip& p_chip, size_t p_column, bool p_isNotified)
+{
+    const size_t activePlayerIndex = m_playersInfo.m_activePlayerIndex;
+    IF_CONDITION_NOT_MET_DO(activePlayerIndex < m_playersInfo.m_players.size() && m_playersInfo.m_players[activePlayerIndex], return false;);
+
+    const IPlayer& activePlayer = *m_playersInfo.m_players[activePlayerIndex];
+    IF_PRECONDITION_NOT_MET_DO(activePlayer.GetChip() == p_chip, return false;);
+
+    if(m_board->IsColumnFull(p_column))
     {
-        // In the case of a win, we must revert the next player -> active player update, since
-        // the next player will never be able to play:
-        m_playersInfo.m_activePlayerIndex = activePlayerIndexBefore;
-        m_playersInfo.m_nextPlayerIndex = nextPlayerIndexBefore;
+        Log(cxlog::VerbosityLevel::DEBUG, __FILE__, __FUNCTION__, __LINE__, "Chip drop failed for " + activePlayer.GetName());
+        Notify(ModelNotificationContext::CHIP_DROPPED_FAILED);
 
-        Notify(ModelNotificationContext::GAME_WON);
+        return true;
+    }
 
-        Log(cxlog::VerbosityLevel::DEBUG, __FILE__, __FUNCTION__, __LINE__, "Game won by : " + GetActivePlayer().GetName());
+    IBoard::Position droppedPosition;
+    IF_CONDITION_NOT_MET_DO(m_board->DropChip(p_column, p_chip, droppedPosition), return false;);
+    m_takenPositions.push_back(droppedPosition);
 
-        CheckInvariants();
+    // A human drop starts a turn, which the drops of the bots answering it are part of:
+    m_moveJournal->Record({static_cast<std::uint8_t>(droppedPosition.m_column),
+                           static_cast<std::uint8_t>(droppedPosition.m_row),
+                           static_cast<std::uint8_t>(activePlayerIndex),
+                           !activePlayer.IsManaged()});
 
-        return;
+    SetActivePlayerIndex(m_playersInfo, activePlayerIndex + 1u);
+
+    if(!p_isNotified)
+    {
+        return true;
     }
 
-    if(IsTie())
+    if(GetVerbosityLevel() >= cxlog::VerbosityLevel::DEBUG)
     {
-        // In the case of a tie, we must revert the next player -> active player update, since
-        // the next player will never be able to play:
-        m_playersInfo.m_activePlayerIndex = activePlayerIndexBefore;
-        m_playersInfo.m_nextPlayerIndex = nextPlayerIndexBefore;
+        std::ostringstream stream;
+        stream << activePlayer.GetName() << "'s chip dropped at (" << droppedPosition.m_row << ", " << droppedPosition.m_column << ")";
+        Log(cxlog::VerbosityLevel::DEBUG, __FILE__, __FUNCTION__, __LINE__, stream.str());
+    }
 
-        Notify(ModelNotificationContext::GAME_TIED);
+    Notify(ModelNotificationContext::CHIP_DROPPED);
 
-        Log(cxlog::VerbosityLevel::DEBUG, __FILE__, __FUNCTION__, __LINE__, "Game tied!");
+    return true;
+}
 
-        CheckInvariants();
+size_t cxmodel::Model::ApplyMoves(const std::vector<size_t>& p_columns)
+{
+    IF_PRECONDITION_NOT_MET_DO(m_board, return 0u;);
 
-        return;
+    if(p_columns.empty() || IsWon() || IsTie())
+    {
+        return 0u;
+    }
+
+    size_t nbApplied = 0u;
+    size_t lastActivePlayerIndex = m_playersInfo.m_activePlayerIndex;
+    bool isWon = false;
+    for(const size_t column : p_columns)
+    {
+        if(column >= m_board->GetNbColumns() || m_board->IsColumnFull(column))
+        {
+            break;
+        }
+
+        lastActivePlayerIndex = m_playersInfo.m_activePlayerIndex;
+
+        const IChip& chip = GetActivePlayer().GetChip();
+        const bool isExecuted = m_moveJournal ? DropChipInJournal(chip, column, false) : DropChipAsCommand(chip, column, false);
+        IF_CONDITION_NOT_MET_DO(isExecuted, break;);
+        ++nbApplied;
+
+        // The win check only looks around the last drop, so it is cheap enough for every drop:
+        isWon = IsWon();
+        if(isWon)
+        {
+            break;
+        }
+    }
+
+    if(nbApplied == 0u)
+    {
+        return 0u;
     }
 
-    ComputeNextDropColumn(DropColumnComputation::RANDOM);
+    RestartAnalysis();
+
+    if(GetVerbosityLevel() >= cxlog::VerbosityLevel::DEBUG)
+    {
+        std::ostringstream stream;
+        stream << nbApplied << " chips dropped at once";
+        Log(cxlog::VerbosityLevel::DEBUG, __FILE__, __FUNCTION__, __LINE__, stream.str());
+    }
+
+    // As for a single drop, the last player to drop stays active when the game is over:
+    const bool isTie = !isWon && IsTie();
+    if(isWon || isTie)
+    {
+        SetActivePlayerIndex(m_playersInfo, lastActivePlayerIndex);
+    }
+    else
+    {
+        ComputeActiveBotDropColumn();
+    }
+
+    Notify(ModelNotificationContext::MOVES_APPLIED);
+
+    if(isWon)
+    {
+        Notify(ModelNotificationContext::GAME_WON);
+        Log(cxlog::VerbosityLevel::DEBUG, __FILE__, __FUNCTION__, __LINE__, "Game won by : " + GetActivePlayer().GetName());
+    }
+    else if(isTie)
+    {
+        Notify(ModelNotificationContext::GAME_TIED);
+        Log(cxlog::VerbosityLevel::DEBUG, __FILE__, __FUNCTION__, __LINE__, "Game tied!");
+    }
 
     CheckInvariants();
+
+    return nbApplied;
+}
+
+cxmodel::ModelState cxmodel::Model::MakeState() const
+{
+    ModelState state;
+
+    if(!m_board || m_playersInfo.m_players.size() < 2u)
+    {
+        return state;
+    }
+
+    state.m_board = MakeBoardSnapshot(*m_board, m_inARowValue, m_playersInfo);
+
+    state.m_players.reserve(m_playersInfo.m_players.size());
+    for(const auto& player : m_playersInfo.m_players)
+    {
+        IF_CONDITION_NOT_MET_DO(player, return ModelState{};);
+        state.m_players.push_back({player->GetName(), player->GetChip().GetColor(), player->IsManaged()});
+    }
+
+    state.m_moves.reserve(m_takenPositions.size());
+    for(const IBoard::Position& position : m_takenPositions)
+    {
+        state.m_moves.push_back(position.m_column);
+    }
+
+    state.m_isWon = IsWon();
+    state.m_isTie = !state.m_isWon && IsTie();
+
+    return state;
+}
+
+cxmodel::NewGameInformation cxmodel::Model::MakeNewGameInformation() const
+{
+    NewGameInformation gameInformation;
+    IF_PRECONDITION_NOT_MET_DO(m_board, return gameInformation;);
+
+    gameInformation.m_gridHeight = m_board->GetNbRows();
+    gameInformation.m_gridWidth = m_board->GetNbColumns();
+    gameInformation.m_inARowValue = m_inARowValue;
+    gameInformation.m_players = m_playersInfo.m_players;
+    gameInformation.m_seed = m_seed;
+
+    return gameInformation;
+}
+
+size_t cxmodel::Model::GetNbDrops() const
+{
+    return m_takenPositions.size();
+}
+
+size_t cxmodel::Model::GetDropColumn(size_t p_index) const
+{
+    IF_PRECONDITION_NOT_MET_DO(p_index < m_takenPositions.size(), return 0u;);
+
+    return m_takenPositions[p_index].m_column;
 }
 
 void cxmodel::Model::MoveLeftOneColumn()
@@ -312,9 +568,8 @@ void cxmodel::Model::MoveRightOneColumn()
 
 void cxmodel::Model::EndCurrentGame()
 {
-    // Clear the command stack:
-    IF_CONDITION_NOT_MET_DO(m_cmdStack, return;);
-    m_cmdStack->Clear();
+    // Clear the undo history:
+    ClearHistory();
 
     // Clean the game board:
     IF_CONDITION_NOT_MET_DO(m_board, return;);
@@ -329,6 +584,24 @@ void cxmodel::Model::EndCurrentGame()
     // Reset the position record:
     m_takenPositions.clear();
 
+    m_seed = 0u;
+    m_randomNumberGenerator = RandomNumberGenerator{m_seed};
+
+    // Release the bot strategies:
+    if(m_gameSearchStatistics.m_nbComputations > 0u)
+    {
+        std::ostringstream stream;
+        stream << "Game bot search statistics: " << m_gameSearchStatistics;
+        Log(cxlog::VerbosityLevel::DEBUG, __FILE__, __FUNCTION__, __LINE__, stream.str());
+    }
+
+    m_botStrategies.clear();
+    m_botTarget = 0u;
+    ResetSearchStatistics();
+
+    // There is nothing left to analyze:
+    RestartAnalysis();
+
     Notify(ModelNotificationContext::GAME_ENDED);
 
     Log(cxlog::VerbosityLevel::DEBUG, __FILE__, __FUNCTION__, __LINE__, "Game ended.");
@@ -336,9 +609,8 @@ void cxmodel::Model::EndCurrentGame()
 
 void cxmodel::Model::ReinitializeCurrentGame()
 {
-    // Clear the command stack:
-    IF_CONDITION_NOT_MET_DO(m_cmdStack, return;);
-    m_cmdStack->Clear();
+    // Clear the undo history:
+    ClearHistory();
 
     // Clean the game board:
     IF_CONDITION_NOT_MET_DO(m_board, return;);
@@ -346,7 +618,7 @@ void cxmodel::Model::ReinitializeCurrentGame()
     const size_t boardHeight = m_board->GetNbRows();
     const size_t boardWidth = m_board->GetNbColumns();
 
-    m_board = std::make_unique<Board>(boardHeight, boardWidth, *this);
+    m_board.reset(new(m_resource) Board(boardHeight, boardWidth, *this, m_resource));
     IF_CONDITION_NOT_MET_DO(m_board, return;);
 
     // Reset the position record:
@@ -358,13 +630,24 @@ void cxmodel::Model::ReinitializeCurrentGame()
 
     // The win resolution strategy has to be recreated, as the old reference to the board
     // was destroyed upon assignement:
-    m_winResolutionStrategy = GameResolutionStrategyFactory::Make(*m_board, m_inARowValue, m_playersInfo.m_players, m_takenPositions, GameResolution::WIN);
+    m_winResolutionStrategy = GameResolutionStrategyFactory::Make(*m_board, m_inARowValue, m_playersInfo.m_players, m_takenPositions, GameResolution::WIN, m_resource);
     IF_CONDITION_NOT_MET_DO(m_winResolutionStrategy, return;);
 
     // Same thing for the tie resolution strategy:
-    m_tieResolutionStrategy = GameResolutionStrategyFactory::Make(*m_board, m_inARowValue, m_playersInfo.m_players, m_takenPositions, GameResolution::TIE);
+    m_tieResolutionStrategy = GameResolutionStrategyFactory::Make(*m_board, m_inARowValue, m_playersInfo.m_players, m_takenPositions, GameResolution::TIE, m_resource);
     IF_CONDITION_NOT_MET_DO(m_tieResolutionStrategy, return;);
 
+    // The bot strategies are created again, so that they draw the same numbers as when the
+    // game was created, and the game replays from its seed:
+    m_randomNumberGenerator = RandomNumberGenerator{m_seed};
+    CreateBotStrategies();
+
+    m_botTarget = 0u;
+    ResetSearchStatistics();
+    ComputeActiveBotDropColumn();
+
+    RestartAnalysis();
+
     Notify(ModelNotificationContext::GAME_REINITIALIZED);
 
     Log(cxlog::VerbosityLevel::DEBUG, __FILE__, __FUNCTION__, __LINE__, "Game reinitialized.");
@@ -389,6 +672,11 @@ size_t cxmodel::Model::GetCurrentInARowValue() const
     return m_inARowValue;
 }
 
+std::uint64_t cxmodel::Model::GetSeed() const
+{
+    return m_seed;
+}
+
 const cxmodel::IPlayer& cxmodel::Model::GetActivePlayer() const
 {
     IF_CONDITION_NOT_MET_DO(m_playersInfo.m_players.size() >= 2, return GetDefaultActivePlayer(););
@@ -432,9 +720,20 @@ bool cxmodel::Model::IsTie() const
 
 void cxmodel::Model::Undo()
 {
-    IF_CONDITION_NOT_MET_DO(m_cmdStack, return;);
+    // Undoing a turn undoes all of its drops, but observers are notified once:
+    const NotificationBatch batch{*this};
+
+    if(m_moveJournal)
+    {
+        UndoFromJournal();
+    }
+    else
+    {
+        IF_CONDITION_NOT_MET_DO(m_cmdStack, return;);
+        m_cmdStack->Undo();
+    }
 
-    m_cmdStack->Undo();
+    RestartAnalysis();
 
     Log(cxlog::VerbosityLevel::DEBUG, __FILE__, __FUNCTION__, __LINE__, "Last action undoed.");
 
@@ -443,9 +742,19 @@ void cxmodel::Model::Undo()
 
 void cxmodel::Model::Redo()
 {
-    IF_CONDITION_NOT_MET_DO(m_cmdStack, return;);
+    const NotificationBatch batch{*this};
+
+    if(m_moveJournal)
+    {
+        RedoFromJournal();
+    }
+    else
+    {
+        IF_CONDITION_NOT_MET_DO(m_cmdStack, return;);
+        m_cmdStack->Redo();
+    }
 
-    m_cmdStack->Redo();
+    RestartAnalysis();
 
     Log(cxlog::VerbosityLevel::DEBUG, __FILE__, __FUNCTION__, __LINE__, "Last action redoed.");
 
@@ -454,6 +763,11 @@ void cxmodel::Model::Redo()
 
 bool cxmodel::Model::CanUndo() const
 {
+    if(m_moveJournal)
+    {
+        return m_moveJournal->CanUndo();
+    }
+
     IF_CONDITION_NOT_MET_DO(m_cmdStack, return false;);
 
     return m_cmdStack->CanUndo();
@@ -461,11 +775,74 @@ bool cxmodel::Model::CanUndo() const
 
 bool cxmodel::Model::CanRedo() const
 {
+    if(m_moveJournal)
+    {
+        return m_moveJournal->CanRedo();
+    }
+
     IF_CONDITION_NOT_MET_DO(m_cmdStack, return false;);
 
     return m_cmdStack->CanRedo();
 }
 
+void cxmodel::Model::ClearHistory()
+{
+    if(m_moveJournal)
+    {
+        m_moveJournal->Clear();
+        return;
+    }
+
+    IF_CONDITION_NOT_MET_DO(m_cmdStack, return;);
+    m_cmdStack->Clear();
+}
+
+void cxmodel::Model::UndoFromJournal()
+{
+    IF_CONDITION_NOT_MET_DO(m_board, return;);
+
+    // Drops are undone back to the start of the last turn:
+    bool isTurnStart = false;
+    while(!isTurnStart && m_moveJournal->CanUndo())
+    {
+        const MoveJournal::Entry& entry = m_moveJournal->Undo();
+        isTurnStart = entry.m_isTurnStart;
+
+        IBoard::Position position{entry.m_row, entry.m_column};
+        IF_CONDITION_NOT_MET_DO(!m_takenPositions.empty() && m_takenPositions.back() == position, return;);
+        m_takenPositions.pop_back();
+        m_board->ResetChip(position);
+
+        SetActivePlayerIndex(m_playersInfo, entry.m_playerIndex);
+
+        Notify(ModelNotificationContext::UNDO_CHIP_DROPPED);
+    }
+}
+
+void cxmodel::Model::RedoFromJournal()
+{
+    IF_CONDITION_NOT_MET_DO(m_board, return;);
+
+    // Drops are redone up to the start of the next turn:
+    bool isTurnStart = true;
+    while(m_moveJournal->CanRedo() && (isTurnStart || !m_moveJournal->GetNextRedo().m_isTurnStart))
+    {
+        isTurnStart = false;
+
+        const MoveJournal::Entry& entry = m_moveJournal->Redo();
+        IF_CONDITION_NOT_MET_DO(entry.m_playerIndex < m_playersInfo.m_players.size(), return;);
+
+        IBoard::Position position;
+        IF_CONDITION_NOT_MET_DO(m_board->DropChip(entry.m_column, m_playersInfo.m_players[entry.m_playerIndex]->GetChip(), position), return;);
+        ASSERT(position.m_row == entry.m_row);
+        m_takenPositions.push_back(position);
+
+        SetActivePlayerIndex(m_playersInfo, entry.m_playerIndex + 1u);
+
+        Notify(ModelNotificationContext::REDO_CHIP_DROPPED);
+    }
+}
+
 void cxmodel::Model::Log(const cxlog::VerbosityLevel p_verbosityLevel, const std::string& p_fileName, const std::string& p_functionName, const size_t p_lineNumber, const std::string& p_message)
 {
     m_logger.Log(p_verbosityLevel, p_fileName, p_functionName, p_lineNumber, p_message);
@@ -487,10 +864,16 @@ cxlog::VerbosityLevel cxmodel::Model::GetVerbosityLevel() const
 
 void cxmodel::Model::ComputeNextDropColumn(DropColumnComputation p_algorithm)
 {
-    auto strategy = NextDropColumnComputationStrategyCreate(p_algorithm);
+    IF_CONDITION_NOT_MET_DO(m_board, return;);
+
+    BotSettings settings;
+    settings.m_algorithm = p_algorithm;
+
+    auto strategy = NextDropColumnComputationStrategyCreate(settings, RandomNumberGenerator{m_randomNumberGenerator()});
     IF_CONDITION_NOT_MET_DO(strategy, return;);
 
-    m_botTarget = strategy->Compute(*m_board);
+    m_botTarget = strategy->Compute(MakeBoardSnapshot(*m_board, m_inARowValue, m_playersInfo));
+    RecordSearchStatistics(strategy->GetStatistics());
 
     CheckInvariants();
 }
@@ -500,9 +883,178 @@ size_t cxmodel::Model::GetCurrentBotTarget() const
     return m_botTarget;
 }
 
+cxmodel::SearchStatistics cxmodel::Model::GetLastSearchStatistics() const
+{
+    return m_lastSearchStatistics;
+}
+
+cxmodel::SearchStatistics cxmodel::Model::GetGameSearchStatistics() const
+{
+    return m_gameSearchStatistics;
+}
+
+void cxmodel::Model::CreateBotStrategies()
+{
+    m_botStrategies.clear();
+
+    for(size_t playerIndex = 0u; playerIndex < m_playersInfo.m_players.size(); ++playerIndex)
+    {
+        const auto& player = m_playersInfo.m_players[playerIndex];
+        if(player && player->IsManaged())
+        {
+            m_botStrategies.push_back(NextDropColumnComputationStrategyCreate(player->GetBotSettings(), MakePlayerRandomNumberGenerator(m_seed, playerIndex)));
+            ASSERT(m_botStrategies.back());
+        }
+        else
+        {
+            m_botStrategies.emplace_back(nullptr);
+        }
+    }
+
+    POSTCONDITION(m_botStrategies.size() == m_playersInfo.m_players.size());
+}
+
+void cxmodel::Model::ComputeActiveBotDropColumn()
+{
+    IF_CONDITION_NOT_MET_DO(m_board, return;);
+
+    // Only bots need a target:
+    if(!GetActivePlayer().IsManaged())
+    {
+        return;
+    }
+
+    const size_t activePlayerIndex = m_playersInfo.m_activePlayerIndex;
+    IF_CONDITION_NOT_MET_DO(activePlayerIndex < m_botStrategies.size(), return;);
+
+    const auto& strategy = m_botStrategies[activePlayerIndex];
+    IF_CONDITION_NOT_MET_DO(strategy, return;);
+
+    m_botTarget = strategy->Compute(MakeBoardSnapshot(*m_board, m_inARowValue, m_playersInfo));
+    RecordSearchStatistics(strategy->GetStatistics());
+
+    CheckInvariants();
+}
+
+void cxmodel::Model::RecordSearchStatistics(const SearchStatistics& p_statistics)
+{
+    m_lastSearchStatistics = p_statistics;
+    Accumulate(m_gameSearchStatistics, p_statistics);
+
+    if(GetVerbosityLevel() >= cxlog::VerbosityLevel::DEBUG)
+    {
+        std::ostringstream stream;
+        stream << "Bot target " << m_botTarget << " computed: " << p_statistics;
+        Log(cxlog::VerbosityLevel::DEBUG, __FILE__, __FUNCTION__, __LINE__, stream.str());
+    }
+}
+
+void cxmodel::Model::ResetSearchStatistics()
+{
+    m_lastSearchStatistics = {};
+    m_gameSearchStatistics = {};
+}
+
+void cxmodel::Model::StartAnalysis()
+{
+    m_isAnalysisEnabled = true;
+
+    if(!m_analysisService)
+    {
+        SearchLimits limits;
+        limits.m_maxTime = std::chrono::milliseconds{ANALYSIS_MAX_TIME_MS};
+
+        // Observers are not notified from the analysis thread, which only flags the update
+        // and wakes the owning thread up:
+        const auto onUpdate = [this]()
+        {
+            m_isAnalysisUpdatePending.store(true, std::memory_order_release);
+
+            if(m_onAnalysisUpdated)
+            {
+                m_onAnalysisUpdated();
+            }
+        };
+
+        m_analysisService = std::make_unique<AnalysisService>(onUpdate,
+                                                              limits,
+                                                              std::chrono::milliseconds{ANALYSIS_MIN_UPDATE_INTERVAL_MS});
+        IF_CONDITION_NOT_MET_DO(m_analysisService, return;);
+    }
+
+    RestartAnalysis();
+
+    Log(cxlog::VerbosityLevel::DEBUG, __FILE__, __FUNCTION__, __LINE__, "Analysis started.");
+}
+
+void cxmodel::Model::StopAnalysis()
+{
+    m_isAnalysisEnabled = false;
+
+    if(m_analysisService)
+    {
+        m_analysisService->Cancel();
+    }
+
+    Log(cxlog::VerbosityLevel::DEBUG, __FILE__, __FUNCTION__, __LINE__, "Analysis stopped.");
+}
+
+bool cxmodel::Model::IsAnalysisEnabled() const
+{
+    return m_isAnalysisEnabled;
+}
+
+cxmodel::SearchResult cxmodel::Model::GetAnalysis() const
+{
+    if(!m_analysisService)
+    {
+        return {};
+    }
+
+    return m_analysisService->GetLatestResult();
+}
+
+void cxmodel::Model::SetAnalysisUpdatedCallback(AnalysisUpdatedCallback p_onAnalysisUpdated)
+{
+    // The callback is read from the analysis thread, so it can't change once it runs:
+    IF_PRECONDITION_NOT_MET_DO(!m_analysisService, return;);
+
+    m_onAnalysisUpdated = std::move(p_onAnalysisUpdated);
+}
+
+bool cxmodel::Model::ProcessAnalysisUpdate()
+{
+    if(!m_isAnalysisUpdatePending.exchange(false, std::memory_order_acquire))
+    {
+        return false;
+    }
+
+    Notify(ModelNotificationContext::ANALYSIS_UPDATED);
+
+    return true;
+}
+
+// Never waits for the running analysis: it is only asked to stop.
+void cxmodel::Model::RestartAnalysis()
+{
+    if(!m_analysisService)
+    {
+        return;
+    }
+
+    const bool canAnalyze = m_isAnalysisEnabled && m_board && m_playersInfo.m_players.size() >= 2u && !IsWon() && !IsTie();
+    if(!canAnalyze)
+    {
+        m_analysisService->Cancel();
+        return;
+    }
+
+    m_analysisService->Submit(MakeBoardSnapshot(*m_board, m_inARowValue, m_playersInfo));
+}
+
 void cxmodel::Model::CheckInvariants()
 {
-    INVARIANT(m_cmdStack);
+    INVARIANT(m_cmdStack || m_moveJournal);
 
     if(m_board)
     {
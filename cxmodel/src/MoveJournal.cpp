@@ -0,0 +1,320 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file MoveJournal.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+
+#include <cxinv/assertion.h>
+#include <cxmodel/MoveJournal.h>
+
+namespace
+{
+
+// The page file grows by at least this many entries at once:
+constexpr size_t PAGE_FILE_MIN_GROWTH = 4096u;
+
+} // namespace
+
+cxmodel::MoveJournal::MoveJournal(size_t p_capacity, std::pmr::memory_resource* p_resource)
+: m_entries(p_capacity, Entry{}, p_resource)
+{
+    PRECONDITION(p_capacity > 0u);
+}
+
+cxmodel::MoveJournal::MoveJournal(size_t p_capacity, MappedFile&& p_pageFile, std::pmr::memory_resource* p_resource)
+: m_entries(p_capacity, Entry{}, p_resource)
+, m_pageFile{std::move(p_pageFile)}
+{
+    PRECONDITION(p_capacity > 0u);
+    PRECONDITION(p_capacity % 2u == 0u);
+    PRECONDITION(m_pageFile.IsOpen());
+}
+
+void cxmodel::MoveJournal::Record(const Entry& p_entry)
+{
+    IF_PRECONDITION_NOT_MET_DO(!m_entries.empty(), return;);
+
+    // Undone drops are forgotten:
+    m_nbEntries = m_nbDone;
+    m_nbInWindow = m_nbDone - m_windowStart;
+
+    // Drops out of a recorded turn (for example, bots dropping before any human) can't be
+    // undone on their own:
+    if(!p_entry.m_isTurnStart && m_nbEntries == m_oldest)
+    {
+        return;
+    }
+
+    // Room is made in the page file before any drop can be paged out to it. If there is none,
+    // the drops already paged out are lost. The window moves by halves of the buffer, whatever
+    // the turns, so the partial turn it may start with is lost as well:
+    if(IsPaged() && !ReservePage(m_nbEntries + 1u))
+    {
+        m_pageFile = MappedFile{};
+        ForgetPartialTurn();
+
+        // The turn being recorded was cut, so it can't be kept:
+        if(!p_entry.m_isTurnStart && m_nbEntries == m_oldest)
+        {
+            return;
+        }
+    }
+
+    if(m_nbInWindow == m_entries.size())
+    {
+        if(IsPaged())
+        {
+            PageOutOldest();
+        }
+        else
+        {
+            ForgetOldestTurn();
+
+            // The turn being recorded fills the whole journal, so it can't be kept:
+            if(m_nbEntries == m_oldest && !p_entry.m_isTurnStart)
+            {
+                return;
+            }
+        }
+    }
+
+    m_entries[GetIndex(m_nbInWindow)] = p_entry;
+    ++m_nbInWindow;
+    ++m_nbEntries;
+    m_nbDone = m_nbEntries;
+
+    CheckInvariants();
+}
+
+void cxmodel::MoveJournal::Clear()
+{
+    m_first = 0u;
+    m_windowStart = 0u;
+    m_nbInWindow = 0u;
+    m_oldest = 0u;
+    m_nbEntries = 0u;
+    m_nbDone = 0u;
+}
+
+const cxmodel::MoveJournal::Entry& cxmodel::MoveJournal::Undo()
+{
+    IF_PRECONDITION_NOT_MET_DO(CanUndo(), return m_entries[m_first];);
+
+    if(m_nbDone == m_windowStart)
+    {
+        PageInBefore();
+    }
+
+    --m_nbDone;
+
+    CheckInvariants();
+
+    return m_entries[GetIndex(m_nbDone - m_windowStart)];
+}
+
+const cxmodel::MoveJournal::Entry& cxmodel::MoveJournal::Redo()
+{
+    IF_PRECONDITION_NOT_MET_DO(CanRedo(), return m_entries[m_first];);
+
+    if(m_nbDone == m_windowStart + m_nbInWindow)
+    {
+        PageInAfter();
+    }
+
+    const Entry& entry = m_entries[GetIndex(m_nbDone - m_windowStart)];
+    ++m_nbDone;
+
+    CheckInvariants();
+
+    return entry;
+}
+
+bool cxmodel::MoveJournal::CanUndo() const
+{
+    return m_nbDone > m_oldest;
+}
+
+bool cxmodel::MoveJournal::CanRedo() const
+{
+    return m_nbDone < m_nbEntries;
+}
+
+cxmodel::MoveJournal::Entry cxmodel::MoveJournal::GetNextRedo() const
+{
+    IF_PRECONDITION_NOT_MET_DO(CanRedo(), return m_entries[m_first];);
+
+    return GetEntry(m_nbDone);
+}
+
+bool cxmodel::MoveJournal::IsPaged() const
+{
+    return m_pageFile.IsOpen();
+}
+
+size_t cxmodel::MoveJournal::GetNbEntries() const
+{
+    return m_nbEntries - m_oldest;
+}
+
+size_t cxmodel::MoveJournal::GetCapacity() const
+{
+    return m_entries.size();
+}
+
+size_t cxmodel::MoveJournal::GetIndex(size_t p_windowPosition) const
+{
+    const size_t index = m_first + p_windowPosition;
+
+    return index < m_entries.size() ? index : index - m_entries.size();
+}
+
+cxmodel::MoveJournal::Entry cxmodel::MoveJournal::GetEntry(size_t p_position) const
+{
+    if(p_position >= m_windowStart && p_position < m_windowStart + m_nbInWindow)
+    {
+        return m_entries[GetIndex(p_position - m_windowStart)];
+    }
+
+    Entry entry;
+    ASSERT((p_position + 1u) * sizeof(Entry) <= m_pageFile.GetSize());
+    std::memcpy(&entry, m_pageFile.GetData() + p_position * sizeof(Entry), sizeof(Entry));
+
+    return entry;
+}
+
+void cxmodel::MoveJournal::ForgetOldestTurn()
+{
+    // A turn is only undone as a whole, so its drops are forgotten together:
+    m_first = GetIndex(1u);
+    ++m_windowStart;
+    --m_nbInWindow;
+
+    ForgetPartialTurn();
+}
+
+void cxmodel::MoveJournal::ForgetPartialTurn()
+{
+    while(m_nbInWindow > 0u && !m_entries[m_first].m_isTurnStart)
+    {
+        m_first = GetIndex(1u);
+        ++m_windowStart;
+        --m_nbInWindow;
+    }
+
+    m_oldest = m_windowStart;
+}
+
+bool cxmodel::MoveJournal::ReservePage(size_t p_nbEntries)
+{
+    const size_t size = p_nbEntries * sizeof(Entry);
+    if(size <= m_pageFile.GetSize())
+    {
+        return true;
+    }
+
+    const size_t newSize = std::max({size, 2u * m_pageFile.GetSize(), PAGE_FILE_MIN_GROWTH * sizeof(Entry)});
+
+    return m_pageFile.Resize(newSize).IsSuccess();
+}
+
+void cxmodel::MoveJournal::PageOut(size_t p_position, size_t p_nbEntries)
+{
+    ASSERT((p_position + p_nbEntries) * sizeof(Entry) <= m_pageFile.GetSize());
+
+    for(size_t position = p_position; position < p_position + p_nbEntries; ++position)
+    {
+        std::memcpy(m_pageFile.GetData() + position * sizeof(Entry), &m_entries[GetIndex(position - m_windowStart)], sizeof(Entry));
+    }
+}
+
+void cxmodel::MoveJournal::PageIn(size_t p_position, size_t p_nbEntries)
+{
+    ASSERT((p_position + p_nbEntries) * sizeof(Entry) <= m_pageFile.GetSize());
+
+    for(size_t position = p_position; position < p_position + p_nbEntries; ++position)
+    {
+        std::memcpy(&m_entries[GetIndex(position - m_windowStart)], m_pageFile.GetData() + position * sizeof(Entry), sizeof(Entry));
+    }
+}
+
+// The window moves by halves of the buffer, so that each page in or out is followed by many
+// drops, undos or redos without one:
+void cxmodel::MoveJournal::PageOutOldest()
+{
+    const size_t half = m_entries.size() / 2u;
+    ASSERT(m_nbInWindow >= half);
+
+    PageOut(m_windowStart, half);
+
+    m_first = GetIndex(half);
+    m_windowStart += half;
+    m_nbInWindow -= half;
+}
+
+void cxmodel::MoveJournal::PageInBefore()
+{
+    IF_CONDITION_NOT_MET_DO(IsPaged(), return;);
+
+    const size_t half = m_entries.size() / 2u;
+    ASSERT(m_windowStart >= half);
+
+    // The newest drops, which are all undone, make room:
+    const size_t nbKept = m_entries.size() - half;
+    if(m_nbInWindow > nbKept)
+    {
+        PageOut(m_windowStart + nbKept, m_nbInWindow - nbKept);
+        m_nbInWindow = nbKept;
+    }
+
+    m_first = GetIndex(nbKept);
+    m_windowStart -= half;
+    m_nbInWindow += half;
+
+    PageIn(m_windowStart, half);
+}
+
+void cxmodel::MoveJournal::PageInAfter()
+{
+    IF_CONDITION_NOT_MET_DO(IsPaged(), return;);
+
+    const size_t half = m_entries.size() / 2u;
+    if(m_nbInWindow > m_entries.size() - half)
+    {
+        PageOutOldest();
+    }
+
+    const size_t position = m_windowStart + m_nbInWindow;
+    const size_t nbEntries = std::min(half, m_nbEntries - position);
+    m_nbInWindow += nbEntries;
+
+    PageIn(position, nbEntries);
+}
+
+void cxmodel::MoveJournal::CheckInvariants() const
+{
+    INVARIANT(m_oldest <= m_windowStart);
+    INVARIANT(m_windowStart <= m_nbDone);
+    INVARIANT(m_nbDone <= m_windowStart + m_nbInWindow);
+    INVARIANT(m_windowStart + m_nbInWindow <= m_nbEntries);
+    INVARIANT(m_nbInWindow <= m_entries.size());
+}
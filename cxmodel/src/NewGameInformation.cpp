@@ -31,6 +31,7 @@ cxmodel::NewGameInformation::NewGameInformation(NewGameInformation&& p_other)
     m_inARowValue = p_other.m_inARowValue;
 
     m_players = std::move(p_other.m_players);
+    m_seed = p_other.m_seed;
 }
 
 cxmodel::NewGameInformation& cxmodel::NewGameInformation::operator=(NewGameInformation&& p_other)
@@ -40,6 +41,7 @@ cxmodel::NewGameInformation& cxmodel::NewGameInformation::operator=(NewGameInfor
     m_inARowValue = p_other.m_inARowValue;
 
     m_players = std::move(p_other.m_players);
+    m_seed = p_other.m_seed;
 
     return *this;
 }
@@ -51,6 +53,7 @@ bool cxmodel::operator==(const cxmodel::NewGameInformation& p_lhs, const cxmodel
     areEqual &= (p_lhs.m_gridWidth == p_rhs.m_gridWidth);
     areEqual &= (p_lhs.m_gridHeight == p_rhs.m_gridHeight);
     areEqual &= (p_lhs.m_inARowValue == p_rhs.m_inARowValue);
+    areEqual &= (p_lhs.m_seed == p_rhs.m_seed);
 
     areEqual &= (p_lhs.m_players.size() == p_rhs.m_players.size());
 
@@ -65,6 +68,7 @@ bool cxmodel::operator==(const cxmodel::NewGameInformation& p_lhs, const cxmodel
     for(size_t i = 0u; i < p_lhs.m_players.size(); ++i)
     {
         areEqual &= (*lhsPlayers[i] == *rhsPlayers[i]);
+        areEqual &= (lhsPlayers[i]->GetBotSettings() == rhsPlayers[i]->GetBotSettings());
     }
 
     return areEqual;
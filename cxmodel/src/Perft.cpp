@@ -0,0 +1,248 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file Perft.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <limits>
+#include <memory>
+#include <string>
+#include <memory_resource>
+#include <vector>
+
+#include <cxinv/assertion.h>
+#include <cxmodel/Board.h>
+#include <cxmodel/ChipColor.h>
+#include <cxmodel/GameResolutionStrategyFactory.h>
+#include <cxmodel/IConnectXLimits.h>
+#include <cxmodel/IPlayer.h>
+#include <cxmodel/Perft.h>
+
+namespace
+{
+
+/**************************************************************************************************
+ * @brief Limits accepting any board.
+ *
+ * The positions to enumerate come from a snapshot, which was already validated when its game
+ * was created.
+ *
+ *************************************************************************************************/
+class NoLimits : public cxmodel::IConnectXLimits
+{
+
+public:
+
+    size_t GetMinimumGridHeight() const override {return 1u;}
+    size_t GetMinimumGridWidth() const override {return 1u;}
+    size_t GetMinimumInARowValue() const override {return 2u;}
+    size_t GetMaximumGridHeight() const override {return std::numeric_limits<size_t>::max();}
+    size_t GetMaximumGridWidth() const override {return std::numeric_limits<size_t>::max();}
+    size_t GetMaximumInARowValue() const override {return std::numeric_limits<size_t>::max();}
+    size_t GetMinimumNumberOfPlayers() const override {return 2u;}
+    size_t GetMaximumNumberOfPlayers() const override {return cxmodel::NB_PLAYER_COLORS;}
+};
+
+void SnapshotPerft(cxmodel::BoardSnapshot& p_position, size_t p_depth, cxmodel::PerftResult& p_result)
+{
+    for(size_t column = 0u; column < p_position.GetNbColumns(); ++column)
+    {
+        if(p_position.IsColumnFull(column))
+        {
+            continue;
+        }
+
+        p_position.DropChip(column);
+
+        const bool isWin = p_position.IsLastDropWinning(column);
+        const bool isTie = !isWin && p_position.IsFull();
+        p_result.m_nbWins += isWin ? 1u : 0u;
+        p_result.m_nbTies += isTie ? 1u : 0u;
+
+        if(p_depth == 1u)
+        {
+            ++p_result.m_nbNodes;
+        }
+        else if(!isWin && !isTie)
+        {
+            SnapshotPerft(p_position, p_depth - 1u, p_result);
+        }
+
+        p_position.UndoDrop(column);
+    }
+}
+
+/**************************************************************************************************
+ * @brief Drop sequence enumerator using the game board and rules.
+ *
+ *************************************************************************************************/
+class BoardPerft
+{
+
+public:
+
+    BoardPerft(const cxmodel::BoardSnapshot& p_position);
+
+    void Run(size_t p_depth, cxmodel::PerftResult& p_result);
+
+private:
+
+    NoLimits m_limits;
+    cxmodel::Board m_board;
+    std::vector<std::shared_ptr<cxmodel::IPlayer>> m_players;
+    std::pmr::vector<cxmodel::IBoard::Position> m_takenPositions;
+    std::unique_ptr<cxmodel::IGameResolutionStrategy> m_winResolutionStrategy;
+    size_t m_activePlayerIndex;
+};
+
+BoardPerft::BoardPerft(const cxmodel::BoardSnapshot& p_position)
+: m_board{p_position.GetNbRows(), p_position.GetNbColumns(), m_limits}
+, m_activePlayerIndex{p_position.GetActivePlayerIndex()}
+{
+    PRECONDITION(p_position.GetNbPlayers() <= cxmodel::NB_PLAYER_COLORS);
+
+    for(size_t playerIndex = 0u; playerIndex < p_position.GetNbPlayers(); ++playerIndex)
+    {
+        m_players.push_back(cxmodel::CreatePlayer("Player " + std::to_string(playerIndex + 1u),
+                                                  cxmodel::MakePlayerColor(playerIndex),
+                                                  cxmodel::PlayerType::HUMAN));
+    }
+
+    // Replay the position. Only the last drop matters to the win resolution strategy, so the
+    // original drop order is not needed:
+    for(size_t column = 0u; column < p_position.GetNbColumns(); ++column)
+    {
+        for(size_t row = 0u; row < p_position.GetColumnHeight(column); ++row)
+        {
+            const size_t owner = p_position.GetPlayerIndex(row, column);
+            IF_CONDITION_NOT_MET_DO(owner < m_players.size(), continue;);
+
+            cxmodel::IBoard::Position position;
+            m_board.DropChip(column, m_players[owner]->GetChip(), position);
+            m_takenPositions.push_back(position);
+        }
+    }
+
+    m_winResolutionStrategy = cxmodel::GameResolutionStrategyFactory::Make(m_board,
+                                                                            p_position.GetInARowValue(),
+                                                                            m_players,
+                                                                            m_takenPositions,
+                                                                            cxmodel::GameResolution::WIN);
+    POSTCONDITION(m_winResolutionStrategy);
+}
+
+void BoardPerft::Run(size_t p_depth, cxmodel::PerftResult& p_result)
+{
+    const cxmodel::IPlayer& activePlayer = *m_players[m_activePlayerIndex];
+    const size_t activePlayerIndexBefore = m_activePlayerIndex;
+
+    for(size_t column = 0u; column < m_board.GetNbColumns(); ++column)
+    {
+        if(m_board.IsColumnFull(column))
+        {
+            continue;
+        }
+
+        cxmodel::IBoard::Position position;
+        m_board.DropChip(column, activePlayer.GetChip(), position);
+        m_takenPositions.push_back(position);
+
+        const bool isWin = m_winResolutionStrategy->Handle(activePlayer);
+        const bool isTie = !isWin && m_takenPositions.size() == m_board.GetNbPositions();
+        p_result.m_nbWins += isWin ? 1u : 0u;
+        p_result.m_nbTies += isTie ? 1u : 0u;
+
+        if(p_depth == 1u)
+        {
+            ++p_result.m_nbNodes;
+        }
+        else if(!isWin && !isTie)
+        {
+            m_activePlayerIndex = (m_activePlayerIndex + 1u) % m_players.size();
+            Run(p_depth - 1u, p_result);
+            m_activePlayerIndex = activePlayerIndexBefore;
+        }
+
+        m_takenPositions.pop_back();
+        m_board.ResetChip(position);
+    }
+}
+
+template<typename Enumerate>
+cxmodel::PerftResult TimedPerft(const cxmodel::BoardSnapshot& p_position, size_t p_depth, Enumerate p_enumerate)
+{
+    cxmodel::PerftResult result;
+
+    // Nothing can be dropped in a full board, and only the position itself is at depth 0:
+    if(p_depth == 0u || p_position.IsFull())
+    {
+        result.m_nbNodes = (p_depth == 0u) ? 1u : 0u;
+        return result;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    p_enumerate(result);
+    result.m_duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    return result;
+}
+
+} // namespace
+
+bool cxmodel::operator==(const PerftResult& p_lhs, const PerftResult& p_rhs)
+{
+    return p_lhs.m_nbNodes == p_rhs.m_nbNodes &&
+           p_lhs.m_nbWins == p_rhs.m_nbWins &&
+           p_lhs.m_nbTies == p_rhs.m_nbTies;
+}
+
+bool cxmodel::operator!=(const PerftResult& p_lhs, const PerftResult& p_rhs)
+{
+    return !(p_lhs == p_rhs);
+}
+
+size_t cxmodel::GetNodesPerSecond(const PerftResult& p_result)
+{
+    const auto nbMicroseconds = p_result.m_duration.count();
+    if(nbMicroseconds <= 0)
+    {
+        return 0u;
+    }
+
+    return static_cast<size_t>((static_cast<double>(p_result.m_nbNodes) * 1000000.0) / static_cast<double>(nbMicroseconds));
+}
+
+cxmodel::PerftResult cxmodel::Perft(const BoardSnapshot& p_position, size_t p_depth)
+{
+    return TimedPerft(p_position, p_depth, [&p_position, p_depth](PerftResult& p_result)
+                                           {
+                                               BoardSnapshot position = p_position;
+                                               SnapshotPerft(position, p_depth, p_result);
+                                           });
+}
+
+cxmodel::PerftResult cxmodel::ReferencePerft(const BoardSnapshot& p_position, size_t p_depth)
+{
+    return TimedPerft(p_position, p_depth, [&p_position, p_depth](PerftResult& p_result)
+                                           {
+                                               BoardPerft perft{p_position};
+                                               perft.Run(p_depth, p_result);
+                                           });
+}
@@ -0,0 +1,142 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file RandomNumberGenerator.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <random>
+
+#include <cxinv/assertion.h>
+#include <cxmodel/RandomNumberGenerator.h>
+
+namespace
+{
+
+constexpr std::uint64_t RotateLeft(std::uint64_t p_value, unsigned int p_shift)
+{
+    return (p_value << p_shift) | (p_value >> (64u - p_shift));
+}
+
+// Spreads a seed over the generator state. See https://prng.di.unimi.it/splitmix64.c
+std::uint64_t SplitMix64(std::uint64_t& p_state)
+{
+    std::uint64_t value = (p_state += 0x9E3779B97F4A7C15u);
+    value = (value ^ (value >> 30u)) * 0xBF58476D1CE4E5B9u;
+    value = (value ^ (value >> 27u)) * 0x94D049BB133111EBu;
+
+    return value ^ (value >> 31u);
+}
+
+} // namespace
+
+cxmodel::RandomNumberGenerator::RandomNumberGenerator(std::uint64_t p_seed, std::uint64_t p_streamIndex)
+{
+    // The state must not be all zeros, which SplitMix64 never produces for four successive
+    // outputs:
+    std::uint64_t seed = p_seed;
+    for(std::uint64_t& word : m_state)
+    {
+        word = SplitMix64(seed);
+    }
+
+    for(std::uint64_t streamIndex = 0u; streamIndex < p_streamIndex; ++streamIndex)
+    {
+        Jump();
+    }
+}
+
+cxmodel::RandomNumberGenerator::result_type cxmodel::RandomNumberGenerator::operator()()
+{
+    // See https://prng.di.unimi.it/xoshiro256starstar.c
+    const std::uint64_t result = RotateLeft(m_state[1] * 5u, 7u) * 9u;
+    const std::uint64_t shifted = m_state[1] << 17u;
+
+    m_state[2] ^= m_state[0];
+    m_state[3] ^= m_state[1];
+    m_state[1] ^= m_state[2];
+    m_state[0] ^= m_state[3];
+
+    m_state[2] ^= shifted;
+    m_state[3] = RotateLeft(m_state[3], 45u);
+
+    return result;
+}
+
+size_t cxmodel::RandomNumberGenerator::Below(size_t p_bound)
+{
+    IF_PRECONDITION_NOT_MET_DO(p_bound > 0u, return 0u;);
+
+    // Numbers below the threshold would make the smallest results more likely, so they are
+    // drawn again (this is rare for small bounds):
+    const std::uint64_t bound = p_bound;
+    const std::uint64_t threshold = (0u - bound) % bound;
+
+    std::uint64_t value = (*this)();
+    while(value < threshold)
+    {
+        value = (*this)();
+    }
+
+    return static_cast<size_t>(value % bound);
+}
+
+void cxmodel::RandomNumberGenerator::Jump()
+{
+    static constexpr std::array<std::uint64_t, 4u> JUMP = {0x180EC6D33CFD0ABAu, 0xD5A61266F0C9392Cu, 0xA9582618E03FC9AAu, 0x39ABDC4529B1661Cu};
+
+    std::array<std::uint64_t, 4u> state = {0u, 0u, 0u, 0u};
+    for(const std::uint64_t word : JUMP)
+    {
+        for(unsigned int bit = 0u; bit < 64u; ++bit)
+        {
+            if(word & (std::uint64_t{1u} << bit))
+            {
+                for(size_t index = 0u; index < state.size(); ++index)
+                {
+                    state[index] ^= m_state[index];
+                }
+            }
+
+            (*this)();
+        }
+    }
+
+    m_state = state;
+}
+
+std::uint64_t cxmodel::MakeRandomSeed()
+{
+    std::random_device randomDevice;
+
+    return (static_cast<std::uint64_t>(randomDevice()) << 32u) ^ static_cast<std::uint64_t>(randomDevice());
+}
+
+std::uint64_t cxmodel::MixSeed(std::uint64_t p_seed, std::uint64_t p_value)
+{
+    std::uint64_t state = p_seed ^ SplitMix64(p_value);
+
+    return SplitMix64(state);
+}
+
+cxmodel::RandomNumberGenerator cxmodel::MakePlayerRandomNumberGenerator(std::uint64_t p_gameSeed, size_t p_playerIndex)
+{
+    // Stream 0 is left to the game itself:
+    return RandomNumberGenerator{p_gameSeed, p_playerIndex + 1u};
+}
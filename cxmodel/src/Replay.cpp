@@ -0,0 +1,143 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file Replay.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <cxinv/assertion.h>
+#include <cxmodel/Replay.h>
+#include <cxmodel/SavedGame.h>
+
+cxmodel::Replay::Replay(size_t p_nbRows,
+                        size_t p_nbColumns,
+                        size_t p_inARowValue,
+                        size_t p_nbPlayers,
+                        std::vector<size_t> p_moves,
+                        size_t p_keyframeInterval)
+: m_moves{std::move(p_moves)}
+, m_keyframeInterval{p_keyframeInterval > 0u ? p_keyframeInterval : 1u}
+, m_board{p_nbRows, p_nbColumns, p_inARowValue, p_nbPlayers}
+{
+    PRECONDITION(p_keyframeInterval > 0u);
+
+    // The whole game is played once, to find its last valid move and take the keyframes:
+    m_keyframes.reserve(m_moves.size() / m_keyframeInterval + 1u);
+    m_keyframes.push_back(m_board);
+
+    BoardSnapshot board = m_board;
+    size_t nbValidMoves = 0u;
+    for(const size_t column : m_moves)
+    {
+        if(column >= p_nbColumns || board.IsColumnFull(column))
+        {
+            break;
+        }
+
+        board.DropChip(column);
+        ++nbValidMoves;
+
+        if(nbValidMoves % m_keyframeInterval == 0u)
+        {
+            m_keyframes.push_back(board);
+        }
+
+        if(board.IsLastDropWinning(column))
+        {
+            break;
+        }
+    }
+
+    m_moves.resize(nbValidMoves);
+}
+
+size_t cxmodel::Replay::GetMove(size_t p_index) const
+{
+    IF_PRECONDITION_NOT_MET_DO(p_index < m_moves.size(), return 0u;);
+
+    return m_moves[p_index];
+}
+
+bool cxmodel::Replay::StepForward()
+{
+    if(m_ply == m_moves.size())
+    {
+        return false;
+    }
+
+    m_board.DropChip(m_moves[m_ply]);
+    ++m_ply;
+
+    return true;
+}
+
+bool cxmodel::Replay::StepBack()
+{
+    if(m_ply == 0u)
+    {
+        return false;
+    }
+
+    --m_ply;
+    m_board.UndoDrop(m_moves[m_ply]);
+
+    return true;
+}
+
+void cxmodel::Replay::Seek(size_t p_ply)
+{
+    IF_PRECONDITION_NOT_MET_DO(p_ply <= m_moves.size(), return;);
+
+    // The board is restored from the keyframe only when stepping would take more moves. The
+    // keyframe is copied into the existing board, which has the same size, so no memory is
+    // allocated:
+    const size_t nbSteps = p_ply > m_ply ? p_ply - m_ply : m_ply - p_ply;
+    if(nbSteps > p_ply % m_keyframeInterval)
+    {
+        const size_t keyframeIndex = p_ply / m_keyframeInterval;
+        ASSERT(keyframeIndex < m_keyframes.size());
+
+        m_board = m_keyframes[keyframeIndex];
+        m_ply = keyframeIndex * m_keyframeInterval;
+    }
+
+    while(m_ply < p_ply)
+    {
+        StepForward();
+    }
+
+    while(m_ply > p_ply)
+    {
+        StepBack();
+    }
+}
+
+cxmodel::Replay cxmodel::MakeReplay(const SavedGame& p_savedGame, size_t p_keyframeInterval)
+{
+    PRECONDITION(p_savedGame.IsOpen());
+
+    const NewGameInformation gameInformation = p_savedGame.ReadGameInformation();
+
+    return Replay{gameInformation.m_gridHeight,
+                  gameInformation.m_gridWidth,
+                  gameInformation.m_inARowValue,
+                  gameInformation.m_players.size(),
+                  p_savedGame.ReadMoves(),
+                  p_keyframeInterval};
+}
@@ -0,0 +1,463 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file SavedGame.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+
+#include <cxinv/assertion.h>
+#include <cxmodel/BotSettings.h>
+#include <cxmodel/ByteOrder.h>
+#include <cxmodel/Model.h>
+#include <cxmodel/SavedGame.h>
+
+namespace
+{
+
+constexpr char MAGIC[] = {'C', 'X', 'S', 'G'};
+
+constexpr size_t VERSION_OFFSET = 4u;
+constexpr size_t HEADER_SIZE_OFFSET = 6u;
+constexpr size_t DESCRIPTION_CHECKSUM_OFFSET = 8u;
+constexpr size_t NB_MOVES_OFFSET = 12u;
+constexpr size_t MOVES_CHECKSUM_OFFSET = 16u;
+constexpr size_t DESCRIPTION_OFFSET = 20u;
+
+static_assert(MOVES_CHECKSUM_OFFSET == NB_MOVES_OFFSET + 4u, "The move count and checksum are written together.");
+
+constexpr std::uint8_t HUMAN_PLAYER = 0u;
+constexpr std::uint8_t BOT_PLAYER = 1u;
+
+constexpr std::uint32_t FNV_OFFSET_BASIS = 2166136261u;
+constexpr std::uint32_t FNV_PRIME = 16777619u;
+
+std::uint32_t Hash(std::uint32_t p_hash, const std::byte* p_data, size_t p_size)
+{
+    for(size_t index = 0u; index < p_size; ++index)
+    {
+        p_hash = (p_hash ^ std::to_integer<std::uint32_t>(p_data[index])) * FNV_PRIME;
+    }
+
+    return p_hash;
+}
+
+// Builds the game description:
+class DescriptionWriter
+{
+
+public:
+
+    void Write(std::uint64_t p_value, size_t p_size)
+    {
+        m_bytes.resize(m_bytes.size() + p_size);
+        cxmodel::WriteLittleEndian(m_bytes.data() + m_bytes.size() - p_size, p_value, p_size);
+    }
+
+    void Write(const std::string& p_text)
+    {
+        Write(p_text.size(), 1u);
+        std::transform(p_text.cbegin(), p_text.cend(), std::back_inserter(m_bytes), [](char p_character){return static_cast<std::byte>(p_character);});
+    }
+
+    const std::vector<std::byte>& GetBytes() const {return m_bytes;}
+
+private:
+
+    std::vector<std::byte> m_bytes;
+
+};
+
+// Reads the game description. Reading past its end fails, and makes all later reads fail:
+class DescriptionReader
+{
+
+public:
+
+    DescriptionReader(const std::byte* p_data, size_t p_size)
+    : m_data{p_data}
+    , m_size{p_size}
+    {
+    }
+
+    bool Read(std::uint64_t& p_value, size_t p_size)
+    {
+        if(!m_isValid || m_size - m_position < p_size)
+        {
+            m_isValid = false;
+            return false;
+        }
+
+        p_value = cxmodel::ReadLittleEndian(m_data + m_position, p_size);
+        m_position += p_size;
+
+        return true;
+    }
+
+    bool Read(std::string& p_text)
+    {
+        std::uint64_t length = 0u;
+        if(!Read(length, 1u) || m_size - m_position < length)
+        {
+            m_isValid = false;
+            return false;
+        }
+
+        p_text.assign(reinterpret_cast<const char*>(m_data + m_position), length);
+        m_position += length;
+
+        return true;
+    }
+
+    bool IsAtEnd() const {return m_isValid && m_position == m_size;}
+
+private:
+
+    const std::byte* m_data;
+    size_t m_size;
+    size_t m_position = 0u;
+    bool m_isValid = true;
+
+};
+
+cxmodel::Status ReadDescription(const std::byte* p_data, size_t p_size, cxmodel::NewGameInformation& p_gameInformation)
+{
+    DescriptionReader reader{p_data, p_size};
+
+    std::uint64_t gridHeight = 0u;
+    std::uint64_t gridWidth = 0u;
+    std::uint64_t inARowValue = 0u;
+    std::uint64_t nbPlayers = 0u;
+    std::uint64_t seed = 0u;
+    if(!reader.Read(gridHeight, 1u) || !reader.Read(gridWidth, 1u) || !reader.Read(inARowValue, 1u) || !reader.Read(nbPlayers, 1u) || !reader.Read(seed, 8u))
+    {
+        return cxmodel::MakeError("The saved game description is truncated.");
+    }
+
+    if(gridHeight == 0u || gridWidth == 0u || inARowValue < 2u || nbPlayers < 2u)
+    {
+        return cxmodel::MakeError("The saved game description is invalid.");
+    }
+
+    cxmodel::NewGameInformation gameInformation;
+    gameInformation.m_gridHeight = gridHeight;
+    gameInformation.m_gridWidth = gridWidth;
+    gameInformation.m_inARowValue = inARowValue;
+    gameInformation.m_seed = seed;
+
+    for(size_t playerIndex = 0u; playerIndex < nbPlayers; ++playerIndex)
+    {
+        std::string name;
+        std::uint64_t red = 0u;
+        std::uint64_t green = 0u;
+        std::uint64_t blue = 0u;
+        std::uint64_t alpha = 0u;
+        std::uint64_t type = 0u;
+        std::string botDescription;
+        if(!reader.Read(name) || !reader.Read(red, 2u) || !reader.Read(green, 2u) || !reader.Read(blue, 2u) || !reader.Read(alpha, 2u) || !reader.Read(type, 1u) || !reader.Read(botDescription))
+        {
+            return cxmodel::MakeError("The saved game players are truncated.");
+        }
+
+        const std::optional<cxmodel::BotSettings> botSettings = type == BOT_PLAYER ? cxmodel::MakeBotSettings(botDescription) : cxmodel::BotSettings{};
+        if(name.empty() || type > BOT_PLAYER || !botSettings)
+        {
+            return cxmodel::MakeError("The saved game player " + std::to_string(playerIndex + 1u) + " is invalid.");
+        }
+
+        const cxmodel::ChipColor color{static_cast<unsigned short>(red), static_cast<unsigned short>(green), static_cast<unsigned short>(blue), static_cast<unsigned short>(alpha)};
+        gameInformation.m_players.push_back(cxmodel::CreatePlayer(name, color, type == BOT_PLAYER ? cxmodel::PlayerType::BOT : cxmodel::PlayerType::HUMAN, *botSettings));
+    }
+
+    if(!reader.IsAtEnd())
+    {
+        return cxmodel::MakeError("The saved game description is too long.");
+    }
+
+    p_gameInformation = std::move(gameInformation);
+
+    return cxmodel::MakeSuccess();
+}
+
+} // namespace
+
+cxmodel::Status cxmodel::SavedGame::Create(const std::string& p_path, const NewGameInformation& p_gameInformation)
+{
+    IF_PRECONDITION_NOT_MET_DO(!IsOpen(), return MakeError("A saved game is already open."););
+    IF_PRECONDITION_NOT_MET_DO(p_gameInformation.m_seed, return MakeError("The game has no seed."););
+
+    if(p_gameInformation.m_gridHeight > 255u || p_gameInformation.m_gridWidth > 255u || p_gameInformation.m_inARowValue > 255u || p_gameInformation.m_players.size() > 255u)
+    {
+        return MakeError("The game is too large to be saved.");
+    }
+
+    DescriptionWriter description;
+    description.Write(p_gameInformation.m_gridHeight, 1u);
+    description.Write(p_gameInformation.m_gridWidth, 1u);
+    description.Write(p_gameInformation.m_inARowValue, 1u);
+    description.Write(p_gameInformation.m_players.size(), 1u);
+    description.Write(*p_gameInformation.m_seed, 8u);
+
+    for(const auto& player : p_gameInformation.m_players)
+    {
+        IF_CONDITION_NOT_MET_DO(player, return MakeError("Invalid player."););
+
+        std::string botDescription;
+        if(player->IsManaged())
+        {
+            std::ostringstream stream;
+            stream << player->GetBotSettings();
+            botDescription = stream.str();
+        }
+
+        const std::string name = player->GetName();
+        if(name.size() > 255u || botDescription.size() > 255u)
+        {
+            return MakeError("The player " + name + " is too long to be saved.");
+        }
+
+        const ChipColor color = player->GetChip().GetColor();
+        description.Write(name);
+        description.Write(color.R(), 2u);
+        description.Write(color.G(), 2u);
+        description.Write(color.B(), 2u);
+        description.Write(color.A(), 2u);
+        description.Write(player->IsManaged() ? BOT_PLAYER : HUMAN_PLAYER, 1u);
+        description.Write(botDescription);
+    }
+
+    const size_t headerSize = DESCRIPTION_OFFSET + description.GetBytes().size();
+    if(headerSize > 0xFFFFu)
+    {
+        return MakeError("The game description is too long to be saved.");
+    }
+
+    // Room is made for every drop the board can take, so that moves are never appended
+    // to a remapped file:
+    const size_t nbColumns = p_gameInformation.m_gridWidth;
+    const size_t capacity = p_gameInformation.m_gridHeight * nbColumns;
+
+    MappedFile file;
+    Status status = file.Create(p_path);
+    ON_ERROR(status, return status;);
+
+    status = file.Resize(headerSize + capacity);
+    ON_ERROR(status, return status;);
+
+    std::byte* const data = file.GetData();
+    std::memcpy(data, MAGIC, sizeof(MAGIC));
+    WriteLittleEndian(data + VERSION_OFFSET, FORMAT_VERSION, 2u);
+    WriteLittleEndian(data + HEADER_SIZE_OFFSET, headerSize, 2u);
+    WriteLittleEndian(data + DESCRIPTION_CHECKSUM_OFFSET, Hash(FNV_OFFSET_BASIS, description.GetBytes().data(), description.GetBytes().size()), 4u);
+    std::memcpy(data + DESCRIPTION_OFFSET, description.GetBytes().data(), description.GetBytes().size());
+
+    m_file = std::move(file);
+    m_headerSize = headerSize;
+    m_nbColumns = nbColumns;
+    m_nbMoves = 0u;
+    m_movesChecksum = FNV_OFFSET_BASIS;
+    WriteMovesInformation();
+
+    return MakeSuccess();
+}
+
+cxmodel::Status cxmodel::SavedGame::Open(const std::string& p_path)
+{
+    IF_PRECONDITION_NOT_MET_DO(!IsOpen(), return MakeError("A saved game is already open."););
+
+    MappedFile file;
+    Status status = file.Open(p_path);
+    ON_ERROR(status, return status;);
+
+    const std::byte* const data = file.GetData();
+    const size_t size = file.GetSize();
+    if(size < DESCRIPTION_OFFSET || std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0)
+    {
+        return MakeError(p_path + " is not a saved game.");
+    }
+
+    const std::uint64_t version = ReadLittleEndian(data + VERSION_OFFSET, 2u);
+    if(version != FORMAT_VERSION)
+    {
+        return MakeError("Unsupported saved game format version " + std::to_string(version) + ".");
+    }
+
+    const size_t headerSize = ReadLittleEndian(data + HEADER_SIZE_OFFSET, 2u);
+    if(headerSize < DESCRIPTION_OFFSET || headerSize > size)
+    {
+        return MakeError("The saved game header is truncated.");
+    }
+
+    if(ReadLittleEndian(data + DESCRIPTION_CHECKSUM_OFFSET, 4u) != Hash(FNV_OFFSET_BASIS, data + DESCRIPTION_OFFSET, headerSize - DESCRIPTION_OFFSET))
+    {
+        return MakeError("The saved game description is corrupted.");
+    }
+
+    NewGameInformation gameInformation;
+    status = ReadDescription(data + DESCRIPTION_OFFSET, headerSize - DESCRIPTION_OFFSET, gameInformation);
+    ON_ERROR(status, return status;);
+
+    const size_t nbMoves = ReadLittleEndian(data + NB_MOVES_OFFSET, 4u);
+    if(nbMoves > size - headerSize)
+    {
+        return MakeError("The saved game moves are truncated.");
+    }
+
+    const std::byte* const moves = data + headerSize;
+    const std::uint32_t movesChecksum = Hash(FNV_OFFSET_BASIS, moves, nbMoves);
+    if(ReadLittleEndian(data + MOVES_CHECKSUM_OFFSET, 4u) != movesChecksum)
+    {
+        return MakeError("The saved game moves are corrupted.");
+    }
+
+    const size_t nbColumns = gameInformation.m_gridWidth;
+    if(std::any_of(moves, moves + nbMoves, [nbColumns](std::byte p_move){return std::to_integer<size_t>(p_move) >= nbColumns;}))
+    {
+        return MakeError("The saved game moves are invalid.");
+    }
+
+    m_file = std::move(file);
+    m_headerSize = headerSize;
+    m_nbColumns = nbColumns;
+    m_nbMoves = nbMoves;
+    m_movesChecksum = movesChecksum;
+
+    return MakeSuccess();
+}
+
+cxmodel::NewGameInformation cxmodel::SavedGame::ReadGameInformation() const
+{
+    NewGameInformation gameInformation;
+    IF_PRECONDITION_NOT_MET_DO(IsOpen(), return gameInformation;);
+
+    // The description was checked when the file was opened or created:
+    const Status status = ReadDescription(m_file.GetData() + DESCRIPTION_OFFSET, m_headerSize - DESCRIPTION_OFFSET, gameInformation);
+    ASSERT(status.IsSuccess());
+
+    return gameInformation;
+}
+
+size_t cxmodel::SavedGame::GetMove(size_t p_index) const
+{
+    IF_PRECONDITION_NOT_MET_DO(p_index < m_nbMoves, return 0u;);
+
+    return std::to_integer<size_t>(m_file.GetData()[m_headerSize + p_index]);
+}
+
+std::vector<size_t> cxmodel::SavedGame::ReadMoves() const
+{
+    std::vector<size_t> moves(m_nbMoves);
+
+    if(m_nbMoves > 0u)
+    {
+        const std::byte* const first = m_file.GetData() + m_headerSize;
+        std::transform(first, first + m_nbMoves, moves.begin(), [](std::byte p_move){return std::to_integer<size_t>(p_move);});
+    }
+
+    return moves;
+}
+
+cxmodel::Status cxmodel::SavedGame::Append(size_t p_column)
+{
+    IF_PRECONDITION_NOT_MET_DO(IsOpen(), return MakeError("No saved game is open."););
+    IF_PRECONDITION_NOT_MET_DO(p_column < m_nbColumns, return MakeError("Invalid column."););
+
+    // Files created elsewhere may have no room left:
+    if(m_headerSize + m_nbMoves == m_file.GetSize())
+    {
+        const Status status = m_file.Resize(m_file.GetSize() + std::max<size_t>(m_nbMoves, m_nbColumns));
+        ON_ERROR(status, return status;);
+    }
+
+    // The move is written before it is counted, so that a crash in between leaves a valid
+    // file, without the move:
+    std::byte* const move = m_file.GetData() + m_headerSize + m_nbMoves;
+    *move = static_cast<std::byte>(p_column);
+
+    m_movesChecksum = Hash(m_movesChecksum, move, 1u);
+    ++m_nbMoves;
+    WriteMovesInformation();
+
+    return MakeSuccess();
+}
+
+void cxmodel::SavedGame::Truncate(size_t p_nbMoves)
+{
+    IF_PRECONDITION_NOT_MET_DO(IsOpen(), return;);
+    IF_PRECONDITION_NOT_MET_DO(p_nbMoves <= m_nbMoves, return;);
+
+    m_nbMoves = p_nbMoves;
+    m_movesChecksum = Hash(FNV_OFFSET_BASIS, m_file.GetData() + m_headerSize, m_nbMoves);
+    WriteMovesInformation();
+}
+
+void cxmodel::SavedGame::WriteMovesInformation()
+{
+    // The count and checksum are written in one go, so that they always match:
+    std::byte movesInformation[8];
+    WriteLittleEndian(movesInformation, m_nbMoves, 4u);
+    WriteLittleEndian(movesInformation + 4u, m_movesChecksum, 4u);
+
+    std::memcpy(m_file.GetData() + NB_MOVES_OFFSET, movesInformation, sizeof(movesInformation));
+}
+
+cxmodel::Status cxmodel::SaveGame(const Model& p_model, const std::string& p_path)
+{
+    SavedGame savedGame;
+    Status status = savedGame.Create(p_path, p_model.MakeNewGameInformation());
+    ON_ERROR(status, return status;);
+
+    for(size_t index = 0u; index < p_model.GetNbDrops(); ++index)
+    {
+        status = savedGame.Append(p_model.GetDropColumn(index));
+        ON_ERROR(status, return status;);
+    }
+
+    return MakeSuccess();
+}
+
+cxmodel::Status cxmodel::LoadGame(const std::string& p_path, Model& p_model)
+{
+    SavedGame savedGame;
+    const Status status = savedGame.Open(p_path);
+    ON_ERROR(status, return status;);
+
+    NewGameInformation gameInformation = savedGame.ReadGameInformation();
+    const bool isWithinLimits = gameInformation.m_gridHeight >= p_model.GetMinimumGridHeight() && gameInformation.m_gridHeight <= p_model.GetMaximumGridHeight() &&
+                                gameInformation.m_gridWidth >= p_model.GetMinimumGridWidth() && gameInformation.m_gridWidth <= p_model.GetMaximumGridWidth() &&
+                                gameInformation.m_inARowValue >= p_model.GetMinimumInARowValue() && gameInformation.m_inARowValue <= p_model.GetMaximumInARowValue() &&
+                                gameInformation.m_players.size() >= p_model.GetMinimumNumberOfPlayers() && gameInformation.m_players.size() <= p_model.GetMaximumNumberOfPlayers();
+    if(!isWithinLimits)
+    {
+        return MakeError("The saved game is outside of the game limits.");
+    }
+
+    p_model.CreateNewGame(std::move(gameInformation));
+
+    const size_t nbApplied = p_model.ApplyMoves(savedGame.ReadMoves());
+    if(nbApplied != savedGame.GetNbMoves())
+    {
+        return MakeError("Only " + std::to_string(nbApplied) + " of the " + std::to_string(savedGame.GetNbMoves()) + " saved moves could be applied.");
+    }
+
+    return MakeSuccess();
+}
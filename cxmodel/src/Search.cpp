@@ -0,0 +1,468 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file Search.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+#include <cxinv/assertion.h>
+#include <cxmodel/Search.h>
+
+namespace
+{
+
+constexpr int INFINITE_SCORE = cxmodel::WIN_SCORE + 1;
+
+constexpr size_t NO_COLUMN = std::numeric_limits<size_t>::max();
+
+// Checking the clock is costly, so it is only done once every so many nodes:
+constexpr size_t NODES_BETWEEN_CLOCK_CHECKS = 1024u;
+
+// Center columns take part in more lines, so they are searched first:
+std::vector<size_t> MakeCenterFirstColumnOrder(size_t p_nbColumns)
+{
+    std::vector<size_t> order(p_nbColumns);
+    for(size_t index = 0u; index < p_nbColumns; ++index)
+    {
+        order[index] = index;
+    }
+
+    const double center = (static_cast<double>(p_nbColumns) - 1.0) / 2.0;
+    std::stable_sort(order.begin(), order.end(), [center](size_t p_lhs, size_t p_rhs)
+                                                 {
+                                                     const double lhsDistance = std::abs(static_cast<double>(p_lhs) - center);
+                                                     const double rhsDistance = std::abs(static_cast<double>(p_rhs) - center);
+                                                     return lhsDistance < rhsDistance;
+                                                 });
+
+    return order;
+}
+
+bool IsForcedResult(int p_score, size_t p_nbPositions)
+{
+    return p_score != cxmodel::NO_SCORE && std::abs(p_score) >= cxmodel::WIN_SCORE - static_cast<int>(p_nbPositions);
+}
+
+// Win scores depend on the ply at which they are found. In the transposition table, they are
+// stored relative to the position instead, since the position can be reached at other plies:
+int ToTableScore(int p_score, size_t p_ply, size_t p_nbPositions)
+{
+    if(!IsForcedResult(p_score, p_nbPositions))
+    {
+        return p_score;
+    }
+
+    return p_score > 0 ? p_score + static_cast<int>(p_ply) : p_score - static_cast<int>(p_ply);
+}
+
+int FromTableScore(int p_score, size_t p_ply, size_t p_nbPositions)
+{
+    if(!IsForcedResult(p_score, p_nbPositions))
+    {
+        return p_score;
+    }
+
+    return p_score > 0 ? p_score - static_cast<int>(p_ply) : p_score + static_cast<int>(p_ply);
+}
+
+} // namespace
+
+cxmodel::Search::Search(size_t p_hashSizeInMB)
+: m_table{p_hashSizeInMB}
+{
+}
+
+cxmodel::SearchResult cxmodel::Search::Run(const BoardSnapshot& p_position,
+                                           const SearchLimits& p_limits,
+                                           const std::atomic<bool>& p_stop,
+                                           const IterationCallback& p_onIteration)
+{
+    m_position = p_position;
+    m_rootPlayerIndex = p_position.GetActivePlayerIndex();
+    m_columnOrder = MakeCenterFirstColumnOrder(p_position.GetNbColumns());
+
+    m_limits = p_limits;
+    m_stop = &p_stop;
+    const auto start = std::chrono::steady_clock::now();
+    m_deadline = start + p_limits.m_maxTime;
+    m_statistics = {};
+    m_statistics.m_nbComputations = 1u;
+    m_isAborted = false;
+
+    const auto updateStatistics = [this, &start](SearchResult& p_result)
+    {
+        m_statistics.m_duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        m_statistics.m_depth = p_result.m_depth;
+        m_statistics.m_principalVariation = ExtractPrincipalVariation(p_result.m_bestColumn, p_result.m_depth);
+        p_result.m_statistics = m_statistics;
+    };
+
+    const size_t nbColumns = p_position.GetNbColumns();
+    const size_t nbPositions = p_position.GetNbRows() * nbColumns;
+    const size_t nbRemainingDrops = nbPositions - p_position.GetNbDrops();
+
+    SearchResult result;
+    result.m_columnScores.assign(nbColumns, NO_SCORE);
+    result.m_isComplete = (nbRemainingDrops == 0u);
+
+    size_t maxDepth = nbRemainingDrops;
+    if(p_limits.m_maxDepth > 0u)
+    {
+        maxDepth = std::min(maxDepth, p_limits.m_maxDepth);
+    }
+
+    for(size_t depth = 1u; depth <= maxDepth; ++depth)
+    {
+        SearchResult iteration;
+        iteration.m_columnScores.assign(nbColumns, NO_SCORE);
+        iteration.m_depth = depth;
+
+        for(const size_t column : m_columnOrder)
+        {
+            if(m_position->IsColumnFull(column))
+            {
+                continue;
+            }
+
+            m_position->DropChip(column);
+
+            int score = WIN_SCORE - 1;
+            if(!m_position->IsLastDropWinning(column))
+            {
+                score = AlphaBeta(depth - 1u, 1u, -INFINITE_SCORE, INFINITE_SCORE);
+            }
+
+            m_position->UndoDrop(column);
+
+            if(m_isAborted)
+            {
+                break;
+            }
+
+            iteration.m_columnScores[column] = score;
+        }
+
+        if(m_isAborted)
+        {
+            break;
+        }
+
+        iteration.m_bestColumn = static_cast<size_t>(std::distance(iteration.m_columnScores.cbegin(),
+                                                                   std::max_element(iteration.m_columnScores.cbegin(),
+                                                                                    iteration.m_columnScores.cend())));
+
+        // Once every column leads to a forced result, searching deeper is useless:
+        iteration.m_isComplete = (depth == nbRemainingDrops) ||
+                                 std::all_of(iteration.m_columnScores.cbegin(),
+                                             iteration.m_columnScores.cend(),
+                                             [nbPositions](int p_score)
+                                             {
+                                                 return p_score == NO_SCORE || IsForcedResult(p_score, nbPositions);
+                                             });
+
+        result = std::move(iteration);
+        updateStatistics(result);
+
+        if(p_onIteration)
+        {
+            p_onIteration(result);
+        }
+
+        if(result.m_isComplete)
+        {
+            break;
+        }
+    }
+
+    updateStatistics(result);
+    m_stop = nullptr;
+
+    return result;
+}
+
+int cxmodel::Search::AlphaBeta(size_t p_depth, size_t p_ply, int p_alpha, int p_beta)
+{
+    ++m_statistics.m_nbNodes;
+    m_statistics.m_selectiveDepth = std::max(m_statistics.m_selectiveDepth, p_ply);
+
+    if(ShouldStop())
+    {
+        m_isAborted = true;
+        return 0;
+    }
+
+    if(m_position->IsFull())
+    {
+        // Nobody won, it's a tie:
+        return 0;
+    }
+
+    if(p_depth == 0u)
+    {
+        return Evaluate();
+    }
+
+    const size_t nbColumns = m_position->GetNbColumns();
+    const size_t nbPositions = m_position->GetNbRows() * nbColumns;
+    const CanonicalPositionKey key = m_position->GetCanonicalKey();
+
+    // A stored result may be enough to answer, or at least narrow the window. If not, its
+    // best column is searched first, since it is likely to be the best again:
+    size_t hashColumn = NO_COLUMN;
+    if(m_table.GetNbEntries() > 0u)
+    {
+        ++m_statistics.m_nbTTProbes;
+
+        const TranspositionTableEntry* entry = m_table.Probe(key.m_key);
+        if(entry)
+        {
+            ++m_statistics.m_nbTTHits;
+            hashColumn = RemapColumn(entry->m_bestColumn, key, nbColumns);
+
+            if(entry->m_depth >= p_depth)
+            {
+                const int score = FromTableScore(entry->m_score, p_ply, nbPositions);
+                switch(entry->m_bound)
+                {
+                    case ScoreBound::EXACT:
+                        return score;
+                    case ScoreBound::LOWER:
+                        p_alpha = std::max(p_alpha, score);
+                        break;
+                    case ScoreBound::UPPER:
+                        p_beta = std::min(p_beta, score);
+                        break;
+                }
+
+                if(p_alpha >= p_beta)
+                {
+                    ++m_statistics.m_nbCutoffs;
+                    return score;
+                }
+            }
+        }
+    }
+
+    const int alpha = p_alpha;
+    const int beta = p_beta;
+
+    // The active player maximizes the score only if it is the root player. All other
+    // players are assumed to play against the root player:
+    const bool isRootPlayer = (m_position->GetActivePlayerIndex() == m_rootPlayerIndex);
+    const int winScore = WIN_SCORE - static_cast<int>(p_ply) - 1;
+
+    int bestScore = isRootPlayer ? -INFINITE_SCORE : INFINITE_SCORE;
+    size_t bestColumn = NO_COLUMN;
+
+    // Index 0 is for the hash column, the others follow the usual order:
+    for(size_t index = 0u; index <= m_columnOrder.size(); ++index)
+    {
+        const size_t column = (index == 0u) ? hashColumn : m_columnOrder[index - 1u];
+        if(column == NO_COLUMN || (index > 0u && column == hashColumn) || m_position->IsColumnFull(column))
+        {
+            continue;
+        }
+
+        m_position->DropChip(column);
+
+        int score;
+        if(m_position->IsLastDropWinning(column))
+        {
+            score = isRootPlayer ? winScore : -winScore;
+        }
+        else
+        {
+            score = AlphaBeta(p_depth - 1u, p_ply + 1u, p_alpha, p_beta);
+        }
+
+        m_position->UndoDrop(column);
+
+        if(m_isAborted)
+        {
+            return 0;
+        }
+
+        const bool isBetter = isRootPlayer ? (score > bestScore) : (score < bestScore);
+        if(isBetter)
+        {
+            bestScore = score;
+            bestColumn = column;
+        }
+
+        if(isRootPlayer)
+        {
+            p_alpha = std::max(p_alpha, score);
+        }
+        else
+        {
+            p_beta = std::min(p_beta, score);
+        }
+
+        if(p_alpha >= p_beta)
+        {
+            ++m_statistics.m_nbCutoffs;
+            break;
+        }
+    }
+
+    TranspositionTableEntry entry;
+    entry.m_key = key.m_key;
+    entry.m_score = ToTableScore(bestScore, p_ply, nbPositions);
+    entry.m_depth = static_cast<std::uint16_t>(std::min<size_t>(p_depth, std::numeric_limits<std::uint16_t>::max()));
+    entry.m_bestColumn = static_cast<std::uint16_t>(RemapColumn(bestColumn, key, nbColumns));
+    entry.m_bound = (bestScore <= alpha) ? ScoreBound::UPPER : ((bestScore >= beta) ? ScoreBound::LOWER : ScoreBound::EXACT);
+    m_table.Store(entry);
+
+    return bestScore;
+}
+
+// Counts, for every line of in-a-row value positions on the board, the chips of the only
+// player present in it (if any). Lines owned by the root player add to the score, lines
+// owned by an opponent subtract from it. Lines closer to completion weigh more.
+int cxmodel::Search::Evaluate() const
+{
+    const BoardSnapshot& position = *m_position;
+
+    const int nbRows = static_cast<int>(position.GetNbRows());
+    const int nbColumns = static_cast<int>(position.GetNbColumns());
+    const int inARow = static_cast<int>(position.GetInARowValue());
+
+    constexpr int directions[4][2] = {{0, 1}, {1, 0}, {1, 1}, {-1, 1}};
+
+    int score = 0;
+    for(const auto& direction : directions)
+    {
+        const int rowStep = direction[0];
+        const int columnStep = direction[1];
+
+        for(int column = 0; column < nbColumns; ++column)
+        {
+            const int lastColumn = column + (inARow - 1) * columnStep;
+            if(lastColumn >= nbColumns)
+            {
+                break;
+            }
+
+            for(int row = 0; row < nbRows; ++row)
+            {
+                const int lastRow = row + (inARow - 1) * rowStep;
+                if(lastRow < 0 || lastRow >= nbRows)
+                {
+                    continue;
+                }
+
+                size_t owner = BoardSnapshot::NO_PLAYER;
+                int nbChips = 0;
+                bool isShared = false;
+                for(int index = 0; index < inARow && !isShared; ++index)
+                {
+                    const size_t player = position.GetPlayerIndex(static_cast<size_t>(row + index * rowStep),
+                                                                  static_cast<size_t>(column + index * columnStep));
+                    if(player == BoardSnapshot::NO_PLAYER)
+                    {
+                        continue;
+                    }
+
+                    if(owner == BoardSnapshot::NO_PLAYER)
+                    {
+                        owner = player;
+                    }
+
+                    isShared = (player != owner);
+                    ++nbChips;
+                }
+
+                if(isShared || nbChips == 0)
+                {
+                    continue;
+                }
+
+                const int weight = nbChips * nbChips;
+                score += (owner == m_rootPlayerIndex) ? weight : -weight;
+            }
+        }
+    }
+
+    return score;
+}
+
+bool cxmodel::Search::ShouldStop()
+{
+    if(m_stop && m_stop->load(std::memory_order_relaxed))
+    {
+        return true;
+    }
+
+    const size_t nbNodes = m_statistics.m_nbNodes;
+    if(m_limits.m_maxNodes > 0u && nbNodes > m_limits.m_maxNodes)
+    {
+        return true;
+    }
+
+    if(m_limits.m_maxTime.count() > 0 && (nbNodes % NODES_BETWEEN_CLOCK_CHECKS) == 0u)
+    {
+        return std::chrono::steady_clock::now() >= m_deadline;
+    }
+
+    return false;
+}
+
+// Follows the best columns stored in the transposition table, from the position after the
+// best root column. Without a table, only the best root column is known.
+std::vector<size_t> cxmodel::Search::ExtractPrincipalVariation(size_t p_bestColumn, size_t p_depth) const
+{
+    std::vector<size_t> principalVariation;
+    if(p_depth == 0u || !m_position || m_position->IsColumnFull(p_bestColumn))
+    {
+        return principalVariation;
+    }
+
+    BoardSnapshot position = *m_position;
+
+    size_t column = p_bestColumn;
+    while(principalVariation.size() < p_depth)
+    {
+        position.DropChip(column);
+        principalVariation.push_back(column);
+
+        if(position.IsLastDropWinning(column) || position.IsFull())
+        {
+            break;
+        }
+
+        const CanonicalPositionKey key = position.GetCanonicalKey();
+        const TranspositionTableEntry* entry = m_table.Probe(key.m_key);
+        if(!entry)
+        {
+            break;
+        }
+
+        column = RemapColumn(entry->m_bestColumn, key, position.GetNbColumns());
+        if(column >= position.GetNbColumns() || position.IsColumnFull(column))
+        {
+            break;
+        }
+    }
+
+    return principalVariation;
+}
@@ -0,0 +1,94 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file SearchStatistics.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+#include <cxmodel/SearchStatistics.h>
+
+size_t cxmodel::GetNodesPerSecond(const SearchStatistics& p_statistics)
+{
+    const auto nbMicroseconds = p_statistics.m_duration.count();
+    if(nbMicroseconds <= 0)
+    {
+        return 0u;
+    }
+
+    return static_cast<size_t>((static_cast<double>(p_statistics.m_nbNodes) * 1000000.0) / static_cast<double>(nbMicroseconds));
+}
+
+double cxmodel::GetBranchingFactor(const SearchStatistics& p_statistics)
+{
+    if(p_statistics.m_depth == 0u || p_statistics.m_nbNodes == 0u)
+    {
+        return 0.0;
+    }
+
+    // For aggregated reports, the nodes are averaged over the computations, so that the
+    // factor stays comparable to the one of a single computation:
+    const double nbComputations = static_cast<double>(std::max<size_t>(p_statistics.m_nbComputations, 1u));
+    const double nbNodes = static_cast<double>(p_statistics.m_nbNodes) / nbComputations;
+
+    return std::pow(nbNodes, 1.0 / static_cast<double>(p_statistics.m_depth));
+}
+
+void cxmodel::Accumulate(SearchStatistics& p_aggregate, const SearchStatistics& p_statistics)
+{
+    p_aggregate.m_nbComputations += p_statistics.m_nbComputations;
+    p_aggregate.m_nbNodes += p_statistics.m_nbNodes;
+    p_aggregate.m_duration += p_statistics.m_duration;
+    p_aggregate.m_depth = std::max(p_aggregate.m_depth, p_statistics.m_depth);
+    p_aggregate.m_selectiveDepth = std::max(p_aggregate.m_selectiveDepth, p_statistics.m_selectiveDepth);
+    p_aggregate.m_nbTTProbes += p_statistics.m_nbTTProbes;
+    p_aggregate.m_nbTTHits += p_statistics.m_nbTTHits;
+    p_aggregate.m_nbCutoffs += p_statistics.m_nbCutoffs;
+    p_aggregate.m_principalVariation = p_statistics.m_principalVariation;
+}
+
+std::ostream& cxmodel::operator<<(std::ostream& p_stream, const SearchStatistics& p_statistics)
+{
+    // Formatted aside, to leave the caller's stream flags untouched:
+    std::ostringstream branchingFactor;
+    branchingFactor << std::fixed << std::setprecision(2) << GetBranchingFactor(p_statistics);
+
+    p_stream << "computations=" << p_statistics.m_nbComputations <<
+                ", nodes=" << p_statistics.m_nbNodes <<
+                ", time=" << p_statistics.m_duration.count() << "us" <<
+                ", nps=" << GetNodesPerSecond(p_statistics) <<
+                ", depth=" << p_statistics.m_depth <<
+                ", seldepth=" << p_statistics.m_selectiveDepth <<
+                ", tt probes=" << p_statistics.m_nbTTProbes <<
+                ", tt hits=" << p_statistics.m_nbTTHits <<
+                ", cutoffs=" << p_statistics.m_nbCutoffs <<
+                ", branching factor=" << branchingFactor.str() <<
+                ", pv=";
+
+    for(size_t index = 0u; index < p_statistics.m_principalVariation.size(); ++index)
+    {
+        p_stream << (index == 0u ? "" : " ") << p_statistics.m_principalVariation[index];
+    }
+
+    return p_stream;
+}
@@ -0,0 +1,143 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file SharedModel.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <thread>
+
+#include <cxinv/assertion.h>
+#include <cxmodel/Model.h>
+#include <cxmodel/SharedModel.h>
+
+cxmodel::SharedModel::SharedModel(Model& p_model, PostedCallback p_onPosted)
+: m_model{p_model}
+, m_onPosted{std::move(p_onPosted)}
+{
+    Publish();
+
+    // Only contexts changing the game state are published:
+    m_subscription = m_model.Attach(this, {ModelNotificationContext::CREATE_NEW_GAME,
+                                           ModelNotificationContext::CHIP_DROPPED,
+                                           ModelNotificationContext::UNDO_CHIP_DROPPED,
+                                           ModelNotificationContext::REDO_CHIP_DROPPED,
+                                           ModelNotificationContext::GAME_WON,
+                                           ModelNotificationContext::GAME_TIED,
+                                           ModelNotificationContext::GAME_ENDED,
+                                           ModelNotificationContext::GAME_REINITIALIZED,
+                                           ModelNotificationContext::MOVES_APPLIED});
+}
+
+cxmodel::SharedModel::~SharedModel()
+{
+    if(m_subscription.IsAttached())
+    {
+        m_model.Detatch(m_subscription);
+    }
+}
+
+void cxmodel::SharedModel::Post(Action p_action)
+{
+    IF_PRECONDITION_NOT_MET_DO(p_action, return;);
+
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_pending.push_back(std::move(p_action));
+    }
+
+    if(m_onPosted)
+    {
+        m_onPosted();
+    }
+}
+
+size_t cxmodel::SharedModel::ProcessPending()
+{
+    // The queue is swapped out, so that actions run without the lock held. Posting threads
+    // thus never wait for the model:
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_processing.swap(m_pending);
+    }
+
+    for(const Action& action : m_processing)
+    {
+        action(m_model);
+    }
+
+    const size_t nbProcessed = m_processing.size();
+    m_processing.clear();
+
+    return nbProcessed;
+}
+
+std::shared_ptr<const cxmodel::ModelState> cxmodel::SharedModel::GetState() const
+{
+    // A reader first announces itself on the current slot, then checks that the slot is still
+    // the current one. If it is, the owning thread leaves the slot alone until the reader is
+    // done. If it is not, a new state was published in the meantime, and the reader retries.
+    // Both steps, and the owning thread's publishing, must be sequentially consistent for the
+    // owning thread to see the reader:
+    while(true)
+    {
+        const size_t slotIndex = m_currentStateSlot.load();
+        const StateSlot& slot = m_stateSlots[slotIndex];
+
+        slot.m_nbReaders.fetch_add(1u);
+        const bool isCurrent = (m_currentStateSlot.load() == slotIndex);
+
+        std::shared_ptr<const ModelState> state = isCurrent ? slot.m_state : nullptr;
+        slot.m_nbReaders.fetch_sub(1u, std::memory_order_release);
+
+        if(isCurrent)
+        {
+            return state;
+        }
+    }
+}
+
+void cxmodel::SharedModel::Update(ModelNotificationContext /*p_context*/, ModelSubject* p_subject)
+{
+    IF_CONDITION_NOT_MET_DO(p_subject, return;);
+
+    Publish();
+}
+
+void cxmodel::SharedModel::Publish()
+{
+    auto state = std::make_shared<ModelState>(m_model.MakeState());
+    state->m_version = ++m_version;
+
+    const size_t currentSlotIndex = m_currentStateSlot.load(std::memory_order_relaxed);
+    size_t slotIndex = (currentSlotIndex + 1u) % NB_STATE_SLOTS;
+    while(m_stateSlots[slotIndex].m_nbReaders.load() != 0u)
+    {
+        slotIndex = (slotIndex + 1u) % NB_STATE_SLOTS;
+        if(slotIndex == currentSlotIndex)
+        {
+            slotIndex = (slotIndex + 1u) % NB_STATE_SLOTS;
+            std::this_thread::yield();
+        }
+    }
+
+    // The state replaced in the slot is freed by its last reader, if any is still holding it:
+    m_stateSlots[slotIndex].m_state = std::move(state);
+    m_currentStateSlot.store(slotIndex);
+}
@@ -53,7 +53,7 @@ const cxmodel::Disc NO_CHIP = cxmodel::Disc::MakeTransparentDisc();
 cxmodel::TieGameResolutionStrategy::TieGameResolutionStrategy(const IBoard& p_board,
                                                               size_t p_inARowValue,
                                                               const std::vector<std::shared_ptr<IPlayer>>& p_players,
-                                                              const std::vector<IBoard::Position>& p_takenPositions)
+                                                              const std::pmr::vector<IBoard::Position>& p_takenPositions)
 : m_board{p_board}
 , m_inARowValue(p_inARowValue) , m_players{p_players}
 , m_takenPositions{p_takenPositions}
@@ -0,0 +1,91 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file TranspositionTable.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <algorithm>
+
+#include <cxinv/assertion.h>
+#include <cxmodel/TranspositionTable.h>
+
+cxmodel::TranspositionTable::TranspositionTable(size_t p_sizeInMB)
+{
+    const size_t maxNbEntries = (p_sizeInMB * 1024u * 1024u) / sizeof(TranspositionTableEntry);
+    if(maxNbEntries == 0u)
+    {
+        return;
+    }
+
+    // A power of two number of entries lets keys be mapped to slots with a mask:
+    size_t nbEntries = 1u;
+    while(nbEntries * 2u <= maxNbEntries)
+    {
+        nbEntries *= 2u;
+    }
+
+    m_entries.resize(nbEntries);
+    m_indexMask = nbEntries - 1u;
+
+    POSTCONDITION(m_entries.size() * sizeof(TranspositionTableEntry) <= p_sizeInMB * 1024u * 1024u);
+}
+
+size_t cxmodel::TranspositionTable::GetNbEntries() const
+{
+    return m_entries.size();
+}
+
+const cxmodel::TranspositionTableEntry* cxmodel::TranspositionTable::Probe(PositionKey p_key) const
+{
+    if(m_entries.empty())
+    {
+        return nullptr;
+    }
+
+    const TranspositionTableEntry& entry = m_entries[p_key & m_indexMask];
+    if(!entry.m_isUsed || entry.m_key != p_key)
+    {
+        return nullptr;
+    }
+
+    return &entry;
+}
+
+void cxmodel::TranspositionTable::Store(const TranspositionTableEntry& p_entry)
+{
+    if(m_entries.empty())
+    {
+        return;
+    }
+
+    TranspositionTableEntry& slot = m_entries[p_entry.m_key & m_indexMask];
+    if(slot.m_isUsed && slot.m_key != p_entry.m_key && slot.m_depth > p_entry.m_depth)
+    {
+        return;
+    }
+
+    slot = p_entry;
+    slot.m_isUsed = true;
+}
+
+void cxmodel::TranspositionTable::Clear()
+{
+    std::fill(m_entries.begin(), m_entries.end(), TranspositionTableEntry{});
+}
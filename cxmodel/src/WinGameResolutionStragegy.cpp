@@ -42,7 +42,7 @@ const cxmodel::Disc NO_CHIP = cxmodel::Disc::MakeTransparentDisc();
 cxmodel::WinGameResolutionStrategy::WinGameResolutionStrategy(const cxmodel::IBoard& p_board,
                                                               const size_t p_inARowValue,
                                                               const std::vector<std::shared_ptr<IPlayer>>& p_players,
-                                                              const std::vector<IBoard::Position>& p_takenPositions)
+                                                              const std::pmr::vector<IBoard::Position>& p_takenPositions)
  : m_board{p_board}
  , m_inARowValue{-1}
  , m_players{p_players}
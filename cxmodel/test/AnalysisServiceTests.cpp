@@ -0,0 +1,149 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file AnalysisServiceTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <condition_variable>
+#include <mutex>
+
+#include <gtest/gtest.h>
+
+#include <cxmodel/AnalysisService.h>
+
+namespace
+{
+
+constexpr std::chrono::milliseconds NO_UPDATE_INTERVAL{0};
+constexpr std::chrono::seconds TEST_TIMEOUT{10};
+
+// Counts update calls, which come from the worker thread:
+class UpdateCounter
+{
+
+public:
+
+    void OnUpdate()
+    {
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            ++m_nbUpdates;
+        }
+
+        m_condition.notify_all();
+    }
+
+    bool WaitForUpdates(size_t p_nbUpdates)
+    {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        return m_condition.wait_for(lock, TEST_TIMEOUT, [this, p_nbUpdates](){return m_nbUpdates >= p_nbUpdates;});
+    }
+
+    size_t GetNbUpdates()
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        return m_nbUpdates;
+    }
+
+private:
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    size_t m_nbUpdates = 0u;
+};
+
+cxmodel::SearchLimits MakeDepthLimit(size_t p_depth)
+{
+    cxmodel::SearchLimits limits;
+    limits.m_maxDepth = p_depth;
+
+    return limits;
+}
+
+} // namespace
+
+TEST(AnalysisService, /*DISABLED_*/Constructor_NoSubmit_NotRunningAndNoResult)
+{
+    UpdateCounter counter;
+    cxmodel::AnalysisService service{[&counter](){counter.OnUpdate();}, MakeDepthLimit(2u), NO_UPDATE_INTERVAL};
+
+    ASSERT_FALSE(service.IsRunning());
+    ASSERT_EQ(service.GetLatestResult().m_depth, 0u);
+    ASSERT_TRUE(service.GetLatestResult().m_columnScores.empty());
+    ASSERT_EQ(counter.GetNbUpdates(), 0u);
+}
+
+TEST(AnalysisService, /*DISABLED_*/Submit_Position_EveryIterationPublished)
+{
+    UpdateCounter counter;
+    cxmodel::AnalysisService service{[&counter](){counter.OnUpdate();}, MakeDepthLimit(3u), NO_UPDATE_INTERVAL};
+
+    service.Submit(cxmodel::BoardSnapshot{6u, 7u, 4u, 2u});
+
+    // One update per iteration, and one for the final result:
+    ASSERT_TRUE(counter.WaitForUpdates(4u));
+
+    const cxmodel::SearchResult result = service.GetLatestResult();
+    ASSERT_EQ(result.m_depth, 3u);
+    ASSERT_EQ(result.m_columnScores.size(), 7u);
+    ASSERT_FALSE(service.IsRunning());
+}
+
+TEST(AnalysisService, /*DISABLED_*/Submit_LongUpdateInterval_FinalResultStillPublished)
+{
+    UpdateCounter counter;
+    cxmodel::AnalysisService service{[&counter](){counter.OnUpdate();}, MakeDepthLimit(3u), std::chrono::milliseconds{200}};
+
+    service.Submit(cxmodel::BoardSnapshot{6u, 7u, 4u, 2u});
+
+    // The iterations complete much faster than the update interval, so only the first
+    // one and the final result are published:
+    ASSERT_TRUE(counter.WaitForUpdates(2u));
+    ASSERT_EQ(service.GetLatestResult().m_depth, 3u);
+    ASSERT_EQ(counter.GetNbUpdates(), 2u);
+}
+
+TEST(AnalysisService, /*DISABLED_*/Cancel_RunningAnalysis_StoppedAndResultCleared)
+{
+    UpdateCounter counter;
+    cxmodel::AnalysisService service{[&counter](){counter.OnUpdate();}, {}, NO_UPDATE_INTERVAL};
+
+    // Without limits, the empty board cannot be fully analyzed in a reasonable time:
+    service.Submit(cxmodel::BoardSnapshot{6u, 7u, 4u, 2u});
+    ASSERT_TRUE(service.IsRunning());
+    ASSERT_TRUE(counter.WaitForUpdates(1u));
+
+    service.Cancel();
+
+    ASSERT_FALSE(service.IsRunning());
+    ASSERT_TRUE(service.GetLatestResult().m_columnScores.empty());
+}
+
+TEST(AnalysisService, /*DISABLED_*/Destructor_RunningAnalysis_DoesNotHang)
+{
+    UpdateCounter counter;
+    {
+        cxmodel::AnalysisService service{[&counter](){counter.OnUpdate();}, {}, NO_UPDATE_INTERVAL};
+        service.Submit(cxmodel::BoardSnapshot{6u, 7u, 4u, 2u});
+        ASSERT_TRUE(counter.WaitForUpdates(1u));
+    }
+
+    SUCCEED();
+}
@@ -0,0 +1,264 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file BoardSnapshotTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <cxmodel/Board.h>
+#include <cxmodel/BoardSnapshot.h>
+#include <cxmodel/Disc.h>
+#include <cxmodel/IPlayer.h>
+
+#include "ConnectXLimitsModelMock.h"
+
+namespace
+{
+
+// Drops, in order, in the given columns:
+void DropChips(cxmodel::BoardSnapshot& p_snapshot, const std::vector<size_t>& p_columns)
+{
+    for(const size_t column : p_columns)
+    {
+        p_snapshot.DropChip(column);
+    }
+}
+
+} // namespace
+
+TEST(BoardSnapshot, /*DISABLED_*/Constructor_ValidDimensions_EmptySnapshotCreated)
+{
+    const cxmodel::BoardSnapshot snapshot{6u, 7u, 4u, 2u};
+
+    ASSERT_EQ(snapshot.GetNbRows(), 6u);
+    ASSERT_EQ(snapshot.GetNbColumns(), 7u);
+    ASSERT_EQ(snapshot.GetInARowValue(), 4u);
+    ASSERT_EQ(snapshot.GetNbPlayers(), 2u);
+    ASSERT_EQ(snapshot.GetActivePlayerIndex(), 0u);
+    ASSERT_EQ(snapshot.GetNbDrops(), 0u);
+    ASSERT_FALSE(snapshot.IsFull());
+
+    for(size_t column = 0u; column < 7u; ++column)
+    {
+        ASSERT_EQ(snapshot.GetColumnHeight(column), 0u);
+        for(size_t row = 0u; row < 6u; ++row)
+        {
+            ASSERT_EQ(snapshot.GetPlayerIndex(row, column), cxmodel::BoardSnapshot::NO_PLAYER);
+        }
+    }
+}
+
+TEST(BoardSnapshot, /*DISABLED_*/DropChip_ThreePlayers_ChipsOwnedByActivePlayersInTurn)
+{
+    cxmodel::BoardSnapshot snapshot{6u, 7u, 4u, 3u};
+
+    DropChips(snapshot, {2u, 2u, 2u, 2u});
+
+    ASSERT_EQ(snapshot.GetPlayerIndex(0u, 2u), 0u);
+    ASSERT_EQ(snapshot.GetPlayerIndex(1u, 2u), 1u);
+    ASSERT_EQ(snapshot.GetPlayerIndex(2u, 2u), 2u);
+    ASSERT_EQ(snapshot.GetPlayerIndex(3u, 2u), 0u);
+    ASSERT_EQ(snapshot.GetColumnHeight(2u), 4u);
+    ASSERT_EQ(snapshot.GetNbDrops(), 4u);
+    ASSERT_EQ(snapshot.GetActivePlayerIndex(), 1u);
+}
+
+TEST(BoardSnapshot, /*DISABLED_*/UndoDrop_AfterDrops_PreviousStateRecovered)
+{
+    cxmodel::BoardSnapshot snapshot{6u, 7u, 4u, 3u};
+
+    DropChips(snapshot, {0u, 1u});
+    snapshot.UndoDrop(1u);
+    snapshot.UndoDrop(0u);
+
+    ASSERT_EQ(snapshot.GetPlayerIndex(0u, 0u), cxmodel::BoardSnapshot::NO_PLAYER);
+    ASSERT_EQ(snapshot.GetPlayerIndex(0u, 1u), cxmodel::BoardSnapshot::NO_PLAYER);
+    ASSERT_EQ(snapshot.GetNbDrops(), 0u);
+    ASSERT_EQ(snapshot.GetActivePlayerIndex(), 0u);
+
+    // Undoing past the first player wraps around to the last player:
+    snapshot.PlaceChip(3u, 0u);
+    snapshot.UndoDrop(3u);
+    ASSERT_EQ(snapshot.GetActivePlayerIndex(), 2u);
+}
+
+TEST(BoardSnapshot, /*DISABLED_*/IsColumnFull_FullColumn_ReturnsTrue)
+{
+    cxmodel::BoardSnapshot snapshot{6u, 7u, 4u, 2u};
+
+    DropChips(snapshot, {3u, 3u, 3u, 3u, 3u});
+    ASSERT_FALSE(snapshot.IsColumnFull(3u));
+
+    snapshot.DropChip(3u);
+    ASSERT_TRUE(snapshot.IsColumnFull(3u));
+}
+
+TEST(BoardSnapshot, /*DISABLED_*/IsFull_AllPositionsTaken_ReturnsTrue)
+{
+    cxmodel::BoardSnapshot snapshot{6u, 7u, 4u, 2u};
+
+    for(size_t column = 0u; column < 7u; ++column)
+    {
+        for(size_t row = 0u; row < 6u; ++row)
+        {
+            ASSERT_FALSE(snapshot.IsFull());
+            snapshot.DropChip(column);
+        }
+    }
+
+    ASSERT_TRUE(snapshot.IsFull());
+}
+
+TEST(BoardSnapshot, /*DISABLED_*/IsLastDropWinning_Horizontal_ReturnsTrue)
+{
+    cxmodel::BoardSnapshot snapshot{6u, 7u, 4u, 2u};
+
+    // First player plays 0, 1, 2, 3 on the bottom row, with the middle drop last:
+    DropChips(snapshot, {0u, 0u, 1u, 1u, 3u, 3u});
+    ASSERT_FALSE(snapshot.IsLastDropWinning(3u));
+
+    snapshot.DropChip(2u);
+    ASSERT_TRUE(snapshot.IsLastDropWinning(2u));
+}
+
+TEST(BoardSnapshot, /*DISABLED_*/IsLastDropWinning_Vertical_ReturnsTrue)
+{
+    cxmodel::BoardSnapshot snapshot{6u, 7u, 4u, 2u};
+
+    DropChips(snapshot, {0u, 1u, 0u, 1u, 0u, 1u});
+    ASSERT_FALSE(snapshot.IsLastDropWinning(1u));
+
+    snapshot.DropChip(0u);
+    ASSERT_TRUE(snapshot.IsLastDropWinning(0u));
+}
+
+TEST(BoardSnapshot, /*DISABLED_*/IsLastDropWinning_Diagonals_ReturnsTrue)
+{
+    // Upward:
+    {
+        cxmodel::BoardSnapshot snapshot{6u, 7u, 4u, 2u};
+        snapshot.PlaceChip(0u, 0u);
+        snapshot.PlaceChip(1u, 1u);
+        snapshot.PlaceChip(1u, 0u);
+        snapshot.PlaceChip(2u, 1u);
+        snapshot.PlaceChip(2u, 1u);
+        snapshot.PlaceChip(2u, 0u);
+        snapshot.PlaceChip(3u, 1u);
+        snapshot.PlaceChip(3u, 1u);
+        snapshot.PlaceChip(3u, 1u);
+        snapshot.PlaceChip(3u, 0u);
+
+        ASSERT_TRUE(snapshot.IsLastDropWinning(3u));
+    }
+
+    // Downward, with three in-a-row:
+    {
+        cxmodel::BoardSnapshot snapshot{6u, 7u, 3u, 2u};
+        snapshot.PlaceChip(4u, 1u);
+        snapshot.PlaceChip(4u, 1u);
+        snapshot.PlaceChip(4u, 0u);
+        snapshot.PlaceChip(5u, 1u);
+        snapshot.PlaceChip(5u, 0u);
+        snapshot.PlaceChip(6u, 0u);
+
+        ASSERT_TRUE(snapshot.IsLastDropWinning(6u));
+        ASSERT_TRUE(snapshot.IsLastDropWinning(4u));
+    }
+}
+
+TEST(BoardSnapshot, /*DISABLED_*/IsLastDropWinning_LineOfOtherPlayers_ReturnsFalse)
+{
+    cxmodel::BoardSnapshot snapshot{6u, 7u, 4u, 3u};
+
+    snapshot.PlaceChip(0u, 0u);
+    snapshot.PlaceChip(1u, 0u);
+    snapshot.PlaceChip(2u, 1u);
+    snapshot.PlaceChip(3u, 0u);
+
+    ASSERT_FALSE(snapshot.IsLastDropWinning(3u));
+}
+
+TEST(BoardSnapshot, /*DISABLED_*/MakeBoardSnapshot_BoardWithChips_SnapshotMatchesBoard)
+{
+    const ConnectXLimitsModelMock limits;
+    cxmodel::Board board{6u, 7u, limits};
+
+    cxmodel::PlayerInformation players{{cxmodel::CreatePlayer("P1", cxmodel::MakeRed(), cxmodel::PlayerType::HUMAN),
+                                        cxmodel::CreatePlayer("P2", cxmodel::MakeBlue(), cxmodel::PlayerType::BOT),
+                                        cxmodel::CreatePlayer("P3", cxmodel::MakeYellow(), cxmodel::PlayerType::HUMAN)},
+                                       2u,
+                                       0u};
+
+    cxmodel::IBoard::Position unused;
+    board.DropChip(1u, cxmodel::Disc{cxmodel::MakeRed()}, unused);
+    board.DropChip(1u, cxmodel::Disc{cxmodel::MakeYellow()}, unused);
+    board.DropChip(5u, cxmodel::Disc{cxmodel::MakeBlue()}, unused);
+
+    const cxmodel::BoardSnapshot snapshot = cxmodel::MakeBoardSnapshot(board, 4u, players);
+
+    ASSERT_EQ(snapshot.GetNbRows(), 6u);
+    ASSERT_EQ(snapshot.GetNbColumns(), 7u);
+    ASSERT_EQ(snapshot.GetInARowValue(), 4u);
+    ASSERT_EQ(snapshot.GetNbPlayers(), 3u);
+    ASSERT_EQ(snapshot.GetNbDrops(), 3u);
+    ASSERT_EQ(snapshot.GetActivePlayerIndex(), 2u);
+
+    ASSERT_EQ(snapshot.GetPlayerIndex(0u, 1u), 0u);
+    ASSERT_EQ(snapshot.GetPlayerIndex(1u, 1u), 2u);
+    ASSERT_EQ(snapshot.GetPlayerIndex(0u, 5u), 1u);
+    ASSERT_EQ(snapshot.GetColumnHeight(0u), 0u);
+}
+
+TEST(BoardSnapshot, /*DISABLED_*/GetCanonicalKey_Transposition_SameKey)
+{
+    cxmodel::BoardSnapshot snapshot{6u, 7u, 4u, 2u};
+    cxmodel::BoardSnapshot transposed{6u, 7u, 4u, 2u};
+
+    // Same chips, dropped in a different order:
+    DropChips(snapshot, {0u, 1u, 2u, 3u});
+    DropChips(transposed, {2u, 3u, 0u, 1u});
+
+    ASSERT_EQ(snapshot.GetCanonicalKey().m_key, transposed.GetCanonicalKey().m_key);
+}
+
+TEST(BoardSnapshot, /*DISABLED_*/GetCanonicalKey_MirroredSnapshots_SameKey)
+{
+    cxmodel::BoardSnapshot snapshot{6u, 7u, 4u, 2u};
+    cxmodel::BoardSnapshot mirrored{6u, 7u, 4u, 2u};
+
+    DropChips(snapshot, {0u, 0u, 4u});
+    DropChips(mirrored, {6u, 6u, 2u});
+
+    ASSERT_EQ(snapshot.GetCanonicalKey().m_key, mirrored.GetCanonicalKey().m_key);
+    ASSERT_NE(snapshot.GetCanonicalKey().m_isMirrored, mirrored.GetCanonicalKey().m_isMirrored);
+}
+
+TEST(BoardSnapshot, /*DISABLED_*/GetCanonicalKey_DropThenUndo_EmptyKeyRecovered)
+{
+    cxmodel::BoardSnapshot snapshot{6u, 7u, 4u, 2u};
+
+    DropChips(snapshot, {3u, 2u});
+    ASSERT_NE(snapshot.GetCanonicalKey().m_key, 0u);
+
+    snapshot.UndoDrop(2u);
+    snapshot.UndoDrop(3u);
+    ASSERT_EQ(snapshot.GetCanonicalKey().m_key, 0u);
+}
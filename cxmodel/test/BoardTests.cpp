@@ -312,3 +312,68 @@ TEST_F(BoardTestFixtureStdErrStreamRedirector, /*DISABLED_*/GetChip_InputPositio
     ASSERT_EQ(board->GetChip({0, board->GetNbColumns()}), RED_CHIP);
     ASSERT_PRECONDITION_FAILED(*this);
 }
+
+TEST_F(BoardTestFixture, /*DISABLED_*/GetCanonicalKey_EmptyBoard_KeyIsZero)
+{
+    const auto board = GetClassicBoard();
+
+    ASSERT_EQ(board->GetCanonicalKey().m_key, 0u);
+    ASSERT_FALSE(board->GetCanonicalKey().m_isMirrored);
+}
+
+TEST_F(BoardTestFixture, /*DISABLED_*/GetCanonicalKey_MirroredBoards_SameKey)
+{
+    const auto board = GetClassicBoard();
+    const auto mirroredBoard = GetClassicBoard();
+
+    const cxmodel::Disc RED_CHIP{cxmodel::MakeRed()};
+    const cxmodel::Disc BLUE_CHIP{cxmodel::MakeBlue()};
+
+    cxmodel::IBoard::Position dummy;
+    board->DropChip(0u, RED_CHIP, dummy);
+    board->DropChip(1u, BLUE_CHIP, dummy);
+    board->DropChip(1u, RED_CHIP, dummy);
+
+    mirroredBoard->DropChip(6u, RED_CHIP, dummy);
+    mirroredBoard->DropChip(5u, BLUE_CHIP, dummy);
+    mirroredBoard->DropChip(5u, RED_CHIP, dummy);
+
+    const cxmodel::CanonicalPositionKey key = board->GetCanonicalKey();
+    const cxmodel::CanonicalPositionKey mirroredKey = mirroredBoard->GetCanonicalKey();
+
+    ASSERT_NE(key.m_key, 0u);
+    ASSERT_EQ(key.m_key, mirroredKey.m_key);
+    ASSERT_NE(key.m_isMirrored, mirroredKey.m_isMirrored);
+
+    // A column cached for one board is remapped to the matching column of the other:
+    const size_t canonicalColumn = cxmodel::RemapColumn(1u, key, 7u);
+    ASSERT_EQ(cxmodel::RemapColumn(canonicalColumn, mirroredKey, 7u), 5u);
+}
+
+TEST_F(BoardTestFixture, /*DISABLED_*/GetCanonicalKey_DifferentColors_DifferentKeys)
+{
+    const auto board = GetClassicBoard();
+    const auto otherBoard = GetClassicBoard();
+
+    cxmodel::IBoard::Position dummy;
+    board->DropChip(3u, cxmodel::Disc{cxmodel::MakeRed()}, dummy);
+    otherBoard->DropChip(3u, cxmodel::Disc{cxmodel::MakeBlue()}, dummy);
+
+    ASSERT_NE(board->GetCanonicalKey().m_key, otherBoard->GetCanonicalKey().m_key);
+}
+
+TEST_F(BoardTestFixture, /*DISABLED_*/GetCanonicalKey_DropThenReset_PreviousKeyRecovered)
+{
+    const auto board = GetClassicBoard();
+
+    cxmodel::IBoard::Position position;
+    board->DropChip(2u, cxmodel::Disc{cxmodel::MakeRed()}, position);
+    const cxmodel::CanonicalPositionKey keyBefore = board->GetCanonicalKey();
+
+    board->DropChip(2u, cxmodel::Disc{cxmodel::MakeBlue()}, position);
+    ASSERT_NE(board->GetCanonicalKey().m_key, keyBefore.m_key);
+
+    board->ResetChip(position);
+    ASSERT_EQ(board->GetCanonicalKey().m_key, keyBefore.m_key);
+    ASSERT_EQ(board->GetCanonicalKey().m_isMirrored, keyBefore.m_isMirrored);
+}
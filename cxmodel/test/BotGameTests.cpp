@@ -0,0 +1,109 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file BotGameTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <cxunit/DisableStdStreamsRAII.h>
+#include <cxmodel/BotGame.h>
+#include <cxmodel/BotSettings.h>
+#include <cxmodel/Model.h>
+#include <cxmodel/NewGameInformation.h>
+
+#include "LoggerMock.h"
+
+namespace
+{
+
+cxmodel::NewGameInformation MakeTwoBotsGameInformation(const std::string& p_botDescription, std::uint64_t p_seed)
+{
+    cxmodel::NewGameInformation newGameInfo;
+    newGameInfo.m_gridWidth = 7u;
+    newGameInfo.m_gridHeight = 6u;
+    newGameInfo.m_inARowValue = 4u;
+    newGameInfo.m_seed = p_seed;
+
+    const cxmodel::BotSettings settings = *cxmodel::MakeBotSettings(p_botDescription);
+    newGameInfo.m_players.push_back(cxmodel::CreatePlayer(cxmodel::MakeBotName(0u), cxmodel::MakeRed(), cxmodel::PlayerType::BOT, settings));
+    newGameInfo.m_players.push_back(cxmodel::CreatePlayer(cxmodel::MakeBotName(1u), cxmodel::MakeBlue(), cxmodel::PlayerType::BOT, settings));
+
+    return newGameInfo;
+}
+
+} // namespace
+
+TEST(BotGame, /*DISABLED_*/MakeBotName_FirstBot_NumberedFromOne)
+{
+    ASSERT_EQ(cxmodel::MakeBotName(0u), "Bot 1");
+    ASSERT_EQ(cxmodel::MakeBotName(9u), "Bot 10");
+}
+
+TEST(BotGame, /*DISABLED_*/PlayBotGame_RandomBots_GamePlayedToTheEnd)
+{
+    LoggerMock logger;
+    cxmodel::Model model{cxmodel::MoveJournal{200u}, logger};
+
+    for(std::uint64_t seed = 1u; seed <= 20u; ++seed)
+    {
+        model.CreateNewGame(MakeTwoBotsGameInformation("random", seed));
+
+        const cxmodel::BotGameOutcome outcome = cxmodel::PlayBotGame(model, model, model, 2u);
+
+        ASSERT_TRUE(outcome.m_isOver);
+        ASSERT_EQ(outcome.m_nbMoves, model.GetNbDrops());
+        ASSERT_EQ(outcome.m_winnerIndex.has_value(), model.IsWon());
+        if(outcome.m_winnerIndex)
+        {
+            // On a win, the active player is the winner:
+            ASSERT_EQ(model.GetActivePlayer().GetName(), cxmodel::MakeBotName(*outcome.m_winnerIndex));
+        }
+
+        model.EndCurrentGame();
+    }
+}
+
+TEST(BotGame, /*DISABLED_*/PlayBotGame_AfterOpening_OpeningDropsCounted)
+{
+    LoggerMock logger;
+    cxmodel::Model model{cxmodel::MoveJournal{200u}, logger};
+    model.CreateNewGame(MakeTwoBotsGameInformation("alphabeta:1000nodes", 1u));
+
+    // The first bot has three chips in column 0, and wins on its next drop:
+    const size_t nbOpeningDrops = model.ApplyMoves({0u, 1u, 0u, 1u, 0u, 1u});
+
+    const cxmodel::BotGameOutcome outcome = cxmodel::PlayBotGame(model, model, model, 2u, nbOpeningDrops);
+
+    ASSERT_TRUE(outcome.m_isOver);
+    ASSERT_EQ(outcome.m_nbMoves, 1u);
+    ASSERT_EQ(outcome.m_winnerIndex, 0u);
+}
+
+TEST(BotGame, /*DISABLED_*/PlayBotGame_LessThanTwoPlayers_AssertionFailed)
+{
+    LoggerMock logger;
+    cxmodel::Model model{cxmodel::MoveJournal{200u}, logger};
+    model.CreateNewGame(MakeTwoBotsGameInformation("random", 1u));
+
+    cxunit::DisableStdStreamsRAII streamDisabler;
+    static_cast<void>(cxmodel::PlayBotGame(model, model, model, 1u));
+    ASSERT_PRECONDITION_FAILED(streamDisabler);
+}
@@ -0,0 +1,144 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file BotSettingsTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include <cxmodel/BotSettings.h>
+
+TEST(BotSettings, /*DISABLED_*/Constructor_Default_RandomWithoutLimits)
+{
+    const cxmodel::BotSettings settings;
+
+    ASSERT_TRUE(settings.m_algorithm == cxmodel::DropColumnComputation::RANDOM);
+    ASSERT_TRUE(settings.m_budgetType == cxmodel::SearchBudgetType::TIME);
+    ASSERT_TRUE(settings.m_budget == 0u);
+    ASSERT_TRUE(settings.m_hashSizeInMB == 0u);
+}
+
+TEST(BotSettings, /*DISABLED_*/OperatorEqual_TwoSameSettings_ReturnsTrue)
+{
+    cxmodel::BotSettings lhs;
+    lhs.m_budgetType = cxmodel::SearchBudgetType::NODES;
+    lhs.m_budget = 100000u;
+    lhs.m_hashSizeInMB = 16u;
+
+    const cxmodel::BotSettings rhs = lhs;
+
+    ASSERT_TRUE(lhs == rhs);
+    ASSERT_FALSE(lhs != rhs);
+}
+
+TEST(BotSettings, /*DISABLED_*/OperatorEqual_DifferentBudgetType_ReturnsFalse)
+{
+    cxmodel::BotSettings lhs;
+    cxmodel::BotSettings rhs;
+    rhs.m_budgetType = cxmodel::SearchBudgetType::NODES;
+
+    ASSERT_FALSE(lhs == rhs);
+    ASSERT_TRUE(lhs != rhs);
+}
+
+TEST(BotSettings, /*DISABLED_*/OperatorEqual_DifferentBudget_ReturnsFalse)
+{
+    cxmodel::BotSettings lhs;
+    cxmodel::BotSettings rhs;
+    rhs.m_budget = 500u;
+
+    ASSERT_FALSE(lhs == rhs);
+    ASSERT_TRUE(lhs != rhs);
+}
+
+TEST(BotSettings, /*DISABLED_*/OperatorEqual_DifferentHashSize_ReturnsFalse)
+{
+    cxmodel::BotSettings lhs;
+    cxmodel::BotSettings rhs;
+    rhs.m_hashSizeInMB = 32u;
+
+    ASSERT_FALSE(lhs == rhs);
+    ASSERT_TRUE(lhs != rhs);
+}
+
+TEST(BotSettings, /*DISABLED_*/MakeBotSettings_Random_RandomSettings)
+{
+    const std::optional<cxmodel::BotSettings> settings = cxmodel::MakeBotSettings("random");
+
+    ASSERT_TRUE(settings.has_value());
+    ASSERT_TRUE(*settings == cxmodel::BotSettings{});
+}
+
+TEST(BotSettings, /*DISABLED_*/MakeBotSettings_AlphaBetaWithoutBudget_DefaultBudget)
+{
+    const std::optional<cxmodel::BotSettings> settings = cxmodel::MakeBotSettings("alphabeta");
+
+    ASSERT_TRUE(settings.has_value());
+    ASSERT_TRUE(settings->m_algorithm == cxmodel::DropColumnComputation::ALPHA_BETA);
+    ASSERT_TRUE(settings->m_budget == 0u);
+    ASSERT_TRUE(settings->m_hashSizeInMB == cxmodel::DEFAULT_BOT_HASH_SIZE_IN_MB);
+}
+
+TEST(BotSettings, /*DISABLED_*/MakeBotSettings_AlphaBetaWithTimeBudget_TimeBudget)
+{
+    const std::optional<cxmodel::BotSettings> settings = cxmodel::MakeBotSettings("alphabeta:250ms");
+
+    ASSERT_TRUE(settings.has_value());
+    ASSERT_TRUE(settings->m_algorithm == cxmodel::DropColumnComputation::ALPHA_BETA);
+    ASSERT_TRUE(settings->m_budgetType == cxmodel::SearchBudgetType::TIME);
+    ASSERT_TRUE(settings->m_budget == 250u);
+}
+
+TEST(BotSettings, /*DISABLED_*/MakeBotSettings_AlphaBetaWithNodesBudget_NodesBudget)
+{
+    const std::optional<cxmodel::BotSettings> settings = cxmodel::MakeBotSettings("alphabeta:100000nodes");
+
+    ASSERT_TRUE(settings.has_value());
+    ASSERT_TRUE(settings->m_budgetType == cxmodel::SearchBudgetType::NODES);
+    ASSERT_TRUE(settings->m_budget == 100000u);
+}
+
+TEST(BotSettings, /*DISABLED_*/MakeBotSettings_InvalidDescriptions_Nothing)
+{
+    ASSERT_FALSE(cxmodel::MakeBotSettings("").has_value());
+    ASSERT_FALSE(cxmodel::MakeBotSettings("minimax").has_value());
+    ASSERT_FALSE(cxmodel::MakeBotSettings("random:10ms").has_value());
+    ASSERT_FALSE(cxmodel::MakeBotSettings("alphabeta:").has_value());
+    ASSERT_FALSE(cxmodel::MakeBotSettings("alphabeta:10").has_value());
+    ASSERT_FALSE(cxmodel::MakeBotSettings("alphabeta:ms").has_value());
+    ASSERT_FALSE(cxmodel::MakeBotSettings("alphabeta:0ms").has_value());
+    ASSERT_FALSE(cxmodel::MakeBotSettings("alphabeta:10s").has_value());
+    ASSERT_FALSE(cxmodel::MakeBotSettings("alphabeta:10ms:5nodes").has_value());
+}
+
+TEST(BotSettings, /*DISABLED_*/StreamOutputOperator_ValidSettings_SameAsDescription)
+{
+    for(const std::string description : {"random", "alphabeta", "alphabeta:250ms", "alphabeta:100000nodes"})
+    {
+        const std::optional<cxmodel::BotSettings> settings = cxmodel::MakeBotSettings(description);
+        ASSERT_TRUE(settings.has_value());
+
+        std::ostringstream stream;
+        stream << *settings;
+        ASSERT_EQ(stream.str(), description);
+    }
+}
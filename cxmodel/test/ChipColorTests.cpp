@@ -23,6 +23,7 @@
 
 #include <gtest/gtest.h>
 
+#include <cxunit/DisableStdStreamsRAII.h>
 #include <cxmodel/ChipColor.h>
 
 TEST(ChipColor, /*DISABLED_*/MakeFromHSLA_RedFromHSLA_RedReturned)
@@ -96,3 +97,27 @@ TEST(ChipColor, /*DISABLED*/ColorFactories_CompileTime_ColorsReturned)
     static_assert(cxmodel::MakeLilac() == cxmodel::ChipColor{31611u, 15163u, 65535u});
     static_assert(cxmodel::MakeSalmon() == cxmodel::ChipColor{65535u, 41377u, 33410u});
 }
+
+TEST(ChipColor, /*DISABLED_*/MakePlayerColor_EveryPlayer_DifferentColors)
+{
+    ASSERT_TRUE(cxmodel::MakePlayerColor(0u) == cxmodel::MakeRed());
+    ASSERT_TRUE(cxmodel::MakePlayerColor(1u) == cxmodel::MakeBlue());
+    ASSERT_TRUE(cxmodel::MakePlayerColor(cxmodel::NB_PLAYER_COLORS - 1u) == cxmodel::MakeSalmon());
+
+    for(size_t first = 0u; first < cxmodel::NB_PLAYER_COLORS; ++first)
+    {
+        for(size_t second = first + 1u; second < cxmodel::NB_PLAYER_COLORS; ++second)
+        {
+            ASSERT_TRUE(cxmodel::MakePlayerColor(first) != cxmodel::MakePlayerColor(second));
+        }
+    }
+}
+
+TEST(ChipColor, /*DISABLED_*/MakePlayerColor_TooManyPlayers_AssertionFailed)
+{
+    cxunit::DisableStdStreamsRAII streamDisabler;
+    const cxmodel::ChipColor color = cxmodel::MakePlayerColor(cxmodel::NB_PLAYER_COLORS);
+
+    ASSERT_PRECONDITION_FAILED(streamDisabler);
+    ASSERT_TRUE(color == cxmodel::MakeTransparent());
+}
@@ -94,13 +94,13 @@ TEST_F(CommandDropChipTestFixture, /*DISABLED_*/Execute_EmptyRowAndTwoPlayers_Al
 
     ASSERT_TRUE(droppedDisc == playerInfo.m_players[playerInfo.m_activePlayerIndex]->GetChip());
 
-    std::vector<cxmodel::IBoard::Position> takenPositions;
+    std::pmr::vector<cxmodel::IBoard::Position> takenPositions;
     ASSERT_TRUE(takenPositions.empty());
 
     // The command is created and executed:
     const auto cmd = std::make_unique<cxmodel::CommandDropChip>(board,
                                                                 playerInfo,
-                                                                std::make_unique<cxmodel::Disc>(droppedDisc),
+                                                                droppedDisc,
                                                                 0u,
                                                                 takenPositions,
                                                                 GetLogger());
@@ -135,13 +135,13 @@ TEST_F(CommandDropChipTestFixture, /*DISABLED_*/Execute_EmptyRowAndThreePlayers_
 
     ASSERT_TRUE(droppedDisc == playerInfo.m_players[playerInfo.m_activePlayerIndex]->GetChip());
 
-    std::vector<cxmodel::IBoard::Position> takenPositions;
+    std::pmr::vector<cxmodel::IBoard::Position> takenPositions;
     ASSERT_TRUE(takenPositions.empty());
 
     // The command is created and executed:
     const auto cmd = std::make_unique<cxmodel::CommandDropChip>(board,
                                                                 playerInfo,
-                                                                std::make_unique<cxmodel::Disc>(droppedDisc),
+                                                                droppedDisc,
                                                                 0u,
                                                                 takenPositions,
                                                                 GetLogger());
@@ -180,13 +180,13 @@ TEST_F(CommandDropChipTestFixture, /*DISABLED_*/Execute_RowNotFull_AllDataUpdate
 
     ASSERT_TRUE(droppedDisc == playerInfo.m_players[playerInfo.m_activePlayerIndex]->GetChip());
 
-    std::vector<cxmodel::IBoard::Position> takenPositions;
+    std::pmr::vector<cxmodel::IBoard::Position> takenPositions;
     ASSERT_TRUE(takenPositions.empty());
 
     // The command is created and executed:
     const auto cmd = std::make_unique<cxmodel::CommandDropChip>(board,
                                                                 playerInfo,
-                                                                std::make_unique<cxmodel::Disc>(droppedDisc),
+                                                                droppedDisc,
                                                                 5u,
                                                                 takenPositions,
                                                                 GetLogger());
@@ -230,13 +230,13 @@ TEST_F(CommandDropChipTestFixture, /*DISABLED_*/Execute_RowFull_NoDataUpdated)
 
     ASSERT_TRUE(droppedDisc == playerInfo.m_players[playerInfo.m_activePlayerIndex]->GetChip());
 
-    std::vector<cxmodel::IBoard::Position> takenPositions;
+    std::pmr::vector<cxmodel::IBoard::Position> takenPositions;
     ASSERT_TRUE(takenPositions.empty());
 
     // The command is created and executed:
     const auto cmd = std::make_unique<cxmodel::CommandDropChip>(board,
                                                                 playerInfo,
-                                                                std::make_unique<cxmodel::Disc>(droppedDisc),
+                                                                droppedDisc,
                                                                 6u,
                                                                 takenPositions,
                                                                 GetLogger());
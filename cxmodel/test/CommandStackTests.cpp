@@ -139,6 +139,63 @@ TEST_F(CommandStackTestFixture, /*DISABLED_*/Execute_TooManyValidCommands_LastCo
     ASSERT_EQ(result, 400.0);
 }
 
+TEST_F(CommandStackTestFixture, /*DISABLED_*/Execute_ManyMoreCommandsThanCapacity_OnlyLastCommandsUndoable)
+{
+    double result{0.0};
+
+    const size_t nbCommands = 3 * GetCommandStackSize() + 50;
+    for(size_t index = 0; index < nbCommands; ++index)
+    {
+        GetCommandStack()->Execute(std::make_unique<CommandAddTwoMock>(result));
+    }
+
+    ASSERT_TRUE(GetCommandStack()->IsFull());
+    ASSERT_EQ(result, 2.0 * nbCommands);
+
+    // Only the commands still in the stack are undone:
+    size_t nbUndoes = 0;
+    while(GetCommandStack()->CanUndo())
+    {
+        GetCommandStack()->Undo();
+        ++nbUndoes;
+    }
+
+    ASSERT_EQ(nbUndoes, GetCommandStackSize());
+    ASSERT_EQ(result, 2.0 * (nbCommands - GetCommandStackSize()));
+
+    // And they are all redone, in order:
+    while(GetCommandStack()->CanRedo())
+    {
+        GetCommandStack()->Redo();
+    }
+
+    ASSERT_EQ(result, 2.0 * nbCommands);
+}
+
+TEST_F(CommandStackTestFixture, /*DISABLED_*/Execute_FullStackWithUndoedCommands_UndoedCommandsReplaced)
+{
+    double result{0.0};
+
+    for(size_t index = 0; index < GetCommandStackSize() + 10; ++index)
+    {
+        GetCommandStack()->Execute(std::make_unique<CommandAddTwoMock>(result));
+    }
+
+    GetCommandStack()->Undo();
+    GetCommandStack()->Undo();
+
+    // The undoed commands are forgotten, the older ones are kept:
+    GetCommandStack()->Execute(std::make_unique<CommandTimesThreeMock>(result));
+
+    ASSERT_FALSE(GetCommandStack()->CanRedo());
+    ASSERT_EQ(GetCommandStack()->GetNbCommands(), GetCommandStackSize() - 1);
+    ASSERT_EQ(result, 3.0 * 2.0 * (GetCommandStackSize() + 8));
+
+    GetCommandStack()->Undo();
+    GetCommandStack()->Undo();
+    ASSERT_EQ(result, 2.0 * (GetCommandStackSize() + 7));
+}
+
 TEST_F(CommandStackTestFixture, /*DISABLED_*/Clear_SingleCommand_CommandCleared)
 {
     double result{0.0};
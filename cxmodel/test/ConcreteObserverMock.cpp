@@ -30,6 +30,8 @@
 
 ConcreteObserverMock::ConcreteObserverMock()
  : m_data{0}
+ , m_nbUpdates{0}
+ , m_lastContext{cxmodel::ModelNotificationContext::CREATE_NEW_GAME}
 {
 }
 
@@ -38,8 +40,21 @@ int ConcreteObserverMock::GetData() const
     return m_data;
 }
 
-void ConcreteObserverMock::Update(cxmodel::ModelNotificationContext, cxmodel::ModelSubject* p_subject)
+int ConcreteObserverMock::GetNbUpdates() const
 {
+    return m_nbUpdates;
+}
+
+cxmodel::ModelNotificationContext ConcreteObserverMock::GetLastContext() const
+{
+    return m_lastContext;
+}
+
+void ConcreteObserverMock::Update(cxmodel::ModelNotificationContext p_context, cxmodel::ModelSubject* p_subject)
+{
+    ++m_nbUpdates;
+    m_lastContext = p_context;
+
     ConcreteSubjectMock* subject = static_cast<ConcreteSubjectMock*>(p_subject);
 
     ASSERT_TRUE(subject != nullptr);
@@ -34,12 +34,16 @@ public:
     ConcreteObserverMock();
 
     int GetData() const;
+    int GetNbUpdates() const;
+    cxmodel::ModelNotificationContext GetLastContext() const;
 
     void Update(cxmodel::ModelNotificationContext p_context, cxmodel::ModelSubject* p_subject) override;
 
 private:
 
     int m_data;
+    int m_nbUpdates;
+    cxmodel::ModelNotificationContext m_lastContext;
 
 };
 
@@ -39,3 +39,8 @@ void ConcreteSubjectMock::IncrementData()
 
     Notify(cxmodel::ModelNotificationContext::CREATE_NEW_GAME);
 }
+
+void ConcreteSubjectMock::NotifyContext(cxmodel::ModelNotificationContext p_context)
+{
+    Notify(p_context);
+}
@@ -36,6 +36,7 @@ public:
 
     int GetData() const;
     void IncrementData();
+    void NotifyContext(cxmodel::ModelNotificationContext p_context);
 
 private:
 
@@ -0,0 +1,299 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file GameArchiveTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <filesystem>
+
+#include <gtest/gtest.h>
+
+#include <cxunit/DisableStdStreamsRAII.h>
+#include <cxmodel/BoardSnapshot.h>
+#include <cxmodel/GameArchive.h>
+
+namespace
+{
+
+// Won by the first player, vertically in the first column:
+const std::vector<size_t> FIRST_COLUMN_WIN{0u, 1u, 0u, 1u, 0u, 1u, 0u};
+
+// The same game, mirrored:
+const std::vector<size_t> LAST_COLUMN_WIN{6u, 5u, 6u, 5u, 6u, 5u, 6u};
+
+// Won by the second player, vertically in the second column:
+const std::vector<size_t> SECOND_PLAYER_WIN{0u, 1u, 2u, 1u, 2u, 1u, 3u, 1u};
+
+// Columns are filled two by two, so that no one wins:
+const std::vector<size_t> TIE{0u, 1u, 0u, 1u, 0u, 1u, 1u, 0u, 1u, 0u, 1u, 0u,
+                              2u, 3u, 2u, 3u, 2u, 3u, 3u, 2u, 3u, 2u, 3u, 2u,
+                              4u, 5u, 4u, 5u, 4u, 5u, 5u, 4u, 5u, 4u, 5u, 4u,
+                              6u, 6u, 6u, 6u, 6u, 6u};
+
+// A directory removed, with its contents, when the test ends:
+class TemporaryDirectory final
+{
+
+public:
+
+    explicit TemporaryDirectory(const std::string& p_name)
+    : m_path{(std::filesystem::temp_directory_path() / p_name).string()}
+    {
+        std::filesystem::remove_all(m_path);
+    }
+
+    ~TemporaryDirectory()
+    {
+        std::error_code error;
+        std::filesystem::remove_all(m_path, error);
+    }
+
+    const std::string& GetPath() const {return m_path;}
+
+private:
+
+    const std::string m_path;
+
+};
+
+cxmodel::ArchivedGame MakeGame(const std::vector<size_t>& p_moves, std::uint64_t p_seed = 0u)
+{
+    return {p_seed, "Game " + std::to_string(p_seed), p_moves};
+}
+
+cxmodel::BoardSnapshot MakePosition(const std::vector<size_t>& p_moves)
+{
+    cxmodel::BoardSnapshot position{6u, 7u, 4u, 2u};
+    for(const size_t column : p_moves)
+    {
+        position.DropChip(column);
+    }
+
+    return position;
+}
+
+std::vector<std::uint64_t> GetGameIds(const std::vector<cxmodel::PositionOccurrence>& p_occurrences)
+{
+    std::vector<std::uint64_t> gameIds;
+    for(const auto& occurrence : p_occurrences)
+    {
+        gameIds.push_back(occurrence.m_gameId);
+    }
+
+    return gameIds;
+}
+
+} // namespace
+
+TEST(GameArchive, /*DISABLED_*/Open_NewDirectory_EmptyArchiveOpen)
+{
+    const TemporaryDirectory directory{"cxmodel_archive_new"};
+
+    cxmodel::GameArchive archive{6u, 7u, 4u, 2u};
+    ASSERT_TRUE(archive.Open(directory.GetPath()).IsSuccess());
+    ASSERT_TRUE(archive.IsOpen());
+    ASSERT_EQ(archive.GetNbGames(), 0u);
+    ASSERT_TRUE(archive.FindGames(MakePosition({})).empty());
+}
+
+TEST(GameArchive, /*DISABLED_*/Append_FinishedGames_GamesReadBack)
+{
+    const TemporaryDirectory directory{"cxmodel_archive_append"};
+
+    cxmodel::GameArchive archive{6u, 7u, 4u, 2u};
+    ASSERT_TRUE(archive.Open(directory.GetPath()).IsSuccess());
+    ASSERT_TRUE(archive.Append(MakeGame(FIRST_COLUMN_WIN, 1u)).IsSuccess());
+    ASSERT_TRUE(archive.Append(MakeGame(TIE, 2u)).IsSuccess());
+    ASSERT_EQ(archive.GetNbGames(), 2u);
+
+    const cxmodel::ArchivedGame game = archive.ReadGame(1u);
+    ASSERT_EQ(game.m_seed, 2u);
+    ASSERT_EQ(game.m_description, "Game 2");
+    ASSERT_EQ(game.m_moves, TIE);
+}
+
+TEST(GameArchive, /*DISABLED_*/Append_UnfinishedGame_ErrorReturned)
+{
+    const TemporaryDirectory directory{"cxmodel_archive_unfinished"};
+
+    cxmodel::GameArchive archive{6u, 7u, 4u, 2u};
+    ASSERT_TRUE(archive.Open(directory.GetPath()).IsSuccess());
+    ASSERT_FALSE(archive.Append(MakeGame({0u, 1u, 0u})).IsSuccess());
+    ASSERT_EQ(archive.GetNbGames(), 0u);
+    ASSERT_TRUE(archive.FindGames(MakePosition({})).empty());
+}
+
+TEST(GameArchive, /*DISABLED_*/Append_MoveAfterWin_ErrorReturned)
+{
+    const TemporaryDirectory directory{"cxmodel_archive_afterwin"};
+
+    std::vector<size_t> moves = FIRST_COLUMN_WIN;
+    moves.push_back(3u);
+
+    cxmodel::GameArchive archive{6u, 7u, 4u, 2u};
+    ASSERT_TRUE(archive.Open(directory.GetPath()).IsSuccess());
+    ASSERT_FALSE(archive.Append(MakeGame(moves)).IsSuccess());
+    ASSERT_EQ(archive.GetNbGames(), 0u);
+}
+
+TEST(GameArchive, /*DISABLED_*/Append_NoArchiveOpen_AssertionFailed)
+{
+    cxunit::DisableStdStreamsRAII streamDisabler;
+
+    cxmodel::GameArchive archive{6u, 7u, 4u, 2u};
+    ASSERT_FALSE(archive.Append(MakeGame(FIRST_COLUMN_WIN)).IsSuccess());
+
+    ASSERT_PRECONDITION_FAILED(streamDisabler);
+}
+
+TEST(GameArchive, /*DISABLED_*/FindGames_PositionAndMirror_BothGamesFound)
+{
+    const TemporaryDirectory directory{"cxmodel_archive_find"};
+
+    cxmodel::GameArchive archive{6u, 7u, 4u, 2u};
+    ASSERT_TRUE(archive.Open(directory.GetPath()).IsSuccess());
+    ASSERT_TRUE(archive.Append(MakeGame(FIRST_COLUMN_WIN)).IsSuccess());
+    ASSERT_TRUE(archive.Append(MakeGame(SECOND_PLAYER_WIN)).IsSuccess());
+    ASSERT_TRUE(archive.Append(MakeGame(LAST_COLUMN_WIN)).IsSuccess());
+
+    ASSERT_EQ(GetGameIds(archive.FindGames(MakePosition({}))), (std::vector<std::uint64_t>{0u, 1u, 2u}));
+    ASSERT_EQ(GetGameIds(archive.FindGames(MakePosition({0u, 1u}))), (std::vector<std::uint64_t>{0u, 1u, 2u}));
+    ASSERT_EQ(GetGameIds(archive.FindGames(MakePosition({0u, 1u, 0u}))), (std::vector<std::uint64_t>{0u, 2u}));
+
+    const auto occurrences = archive.FindGames(MakePosition({6u, 5u, 6u}));
+    ASSERT_EQ(occurrences.size(), 2u);
+    ASSERT_EQ(occurrences[1].m_ply, 3u);
+
+    ASSERT_TRUE(archive.FindGames(MakePosition({3u})).empty());
+}
+
+TEST(GameArchive, /*DISABLED_*/ComputeColumnStatistics_ArchivedGames_OutcomesForPlayerToMove)
+{
+    const TemporaryDirectory directory{"cxmodel_archive_statistics"};
+
+    cxmodel::GameArchive archive{6u, 7u, 4u, 2u};
+    ASSERT_TRUE(archive.Open(directory.GetPath()).IsSuccess());
+    ASSERT_TRUE(archive.Append(MakeGame(FIRST_COLUMN_WIN)).IsSuccess());
+    ASSERT_TRUE(archive.Append(MakeGame(SECOND_PLAYER_WIN)).IsSuccess());
+    ASSERT_TRUE(archive.Append(MakeGame(LAST_COLUMN_WIN)).IsSuccess());
+    ASSERT_TRUE(archive.Append(MakeGame(TIE)).IsSuccess());
+
+    // From the empty board, the first player played the first column three times:
+    const auto fromStart = archive.ComputeColumnStatistics(MakePosition({}));
+    ASSERT_EQ(fromStart.size(), 7u);
+    ASSERT_EQ(fromStart[0].m_nbWins, 1u);
+    ASSERT_EQ(fromStart[0].m_nbLosses, 1u);
+    ASSERT_EQ(fromStart[0].m_nbTies, 1u);
+    ASSERT_EQ(fromStart[6].m_nbWins, 1u);
+    ASSERT_EQ(cxmodel::GetNbGames(fromStart[3]), 0u);
+    ASSERT_DOUBLE_EQ(cxmodel::GetWinRate(fromStart[0]), 1.0 / 3.0);
+
+    // After a drop in the first column, the mirrored game is found too, with its columns
+    // mirrored back. The second player is to move:
+    const auto afterFirstDrop = archive.ComputeColumnStatistics(MakePosition({0u}));
+    ASSERT_EQ(afterFirstDrop[1].m_nbWins, 1u);
+    ASSERT_EQ(afterFirstDrop[1].m_nbLosses, 2u);
+    ASSERT_EQ(afterFirstDrop[1].m_nbTies, 1u);
+    ASSERT_EQ(cxmodel::GetNbGames(afterFirstDrop[5]), 0u);
+
+    // The final position has no next column:
+    const auto atEnd = archive.ComputeColumnStatistics(MakePosition(FIRST_COLUMN_WIN));
+    for(const auto& column : atEnd)
+    {
+        ASSERT_EQ(cxmodel::GetNbGames(column), 0u);
+    }
+}
+
+TEST(GameArchive, /*DISABLED_*/Append_SegmentFull_NewSegmentsCreated)
+{
+    const TemporaryDirectory directory{"cxmodel_archive_segments"};
+
+    cxmodel::GameArchive archive{6u, 7u, 4u, 2u, 2u};
+    ASSERT_TRUE(archive.Open(directory.GetPath()).IsSuccess());
+    for(std::uint64_t seed = 0u; seed < 5u; ++seed)
+    {
+        ASSERT_TRUE(archive.Append(MakeGame(seed % 2u == 0u ? FIRST_COLUMN_WIN : LAST_COLUMN_WIN, seed)).IsSuccess());
+    }
+
+    ASSERT_TRUE(std::filesystem::exists(directory.GetPath() + "/segment-000001.index"));
+    ASSERT_TRUE(std::filesystem::exists(directory.GetPath() + "/segment-000002.games"));
+    ASSERT_FALSE(std::filesystem::exists(directory.GetPath() + "/segment-000002.index"));
+
+    ASSERT_EQ(archive.ReadGame(3u).m_seed, 3u);
+    ASSERT_EQ(GetGameIds(archive.FindGames(MakePosition({0u, 1u, 0u}))), (std::vector<std::uint64_t>{0u, 1u, 2u, 3u, 4u}));
+}
+
+TEST(GameArchive, /*DISABLED_*/Open_ExistingArchive_GamesAndIndexReloaded)
+{
+    const TemporaryDirectory directory{"cxmodel_archive_reopen"};
+
+    {
+        cxmodel::GameArchive archive{6u, 7u, 4u, 2u};
+        ASSERT_TRUE(archive.Open(directory.GetPath()).IsSuccess());
+        ASSERT_TRUE(archive.Append(MakeGame(FIRST_COLUMN_WIN, 10u)).IsSuccess());
+        ASSERT_TRUE(archive.Seal().IsSuccess());
+
+        // This one is left unsealed:
+        ASSERT_TRUE(archive.Append(MakeGame(SECOND_PLAYER_WIN, 11u)).IsSuccess());
+    }
+
+    cxmodel::GameArchive archive{6u, 7u, 4u, 2u};
+    ASSERT_TRUE(archive.Open(directory.GetPath()).IsSuccess());
+    ASSERT_EQ(archive.GetNbGames(), 2u);
+    ASSERT_EQ(archive.ReadGame(1u).m_seed, 11u);
+    ASSERT_EQ(GetGameIds(archive.FindGames(MakePosition({0u, 1u}))), (std::vector<std::uint64_t>{0u, 1u}));
+
+    ASSERT_TRUE(archive.Append(MakeGame(TIE, 12u)).IsSuccess());
+    ASSERT_EQ(GetGameIds(archive.FindGames(MakePosition({0u, 1u}))), (std::vector<std::uint64_t>{0u, 1u, 2u}));
+}
+
+TEST(GameArchive, /*DISABLED_*/Open_IndexCutShort_IndexRebuilt)
+{
+    const TemporaryDirectory directory{"cxmodel_archive_rebuild"};
+
+    {
+        cxmodel::GameArchive archive{6u, 7u, 4u, 2u, 1u};
+        ASSERT_TRUE(archive.Open(directory.GetPath()).IsSuccess());
+        ASSERT_TRUE(archive.Append(MakeGame(FIRST_COLUMN_WIN)).IsSuccess());
+        ASSERT_TRUE(archive.Append(MakeGame(LAST_COLUMN_WIN)).IsSuccess());
+    }
+
+    std::filesystem::resize_file(directory.GetPath() + "/segment-000000.index", 20u);
+
+    cxmodel::GameArchive archive{6u, 7u, 4u, 2u, 1u};
+    ASSERT_TRUE(archive.Open(directory.GetPath()).IsSuccess());
+    ASSERT_EQ(GetGameIds(archive.FindGames(MakePosition({0u}))), (std::vector<std::uint64_t>{0u, 1u}));
+    ASSERT_GT(std::filesystem::file_size(directory.GetPath() + "/segment-000000.index"), 20u);
+}
+
+TEST(GameArchive, /*DISABLED_*/Open_OtherBoard_ErrorReturned)
+{
+    const TemporaryDirectory directory{"cxmodel_archive_otherboard"};
+
+    {
+        cxmodel::GameArchive archive{6u, 7u, 4u, 2u};
+        ASSERT_TRUE(archive.Open(directory.GetPath()).IsSuccess());
+        ASSERT_TRUE(archive.Append(MakeGame(FIRST_COLUMN_WIN)).IsSuccess());
+    }
+
+    cxmodel::GameArchive archive{7u, 8u, 4u, 2u};
+    ASSERT_FALSE(archive.Open(directory.GetPath()).IsSuccess());
+    ASSERT_FALSE(archive.IsOpen());
+}
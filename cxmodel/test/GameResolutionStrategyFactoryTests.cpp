@@ -46,6 +46,7 @@ public:
     bool DropChip(size_t /*p_column*/, const cxmodel::IChip& /*p_chip*/, cxmodel::IBoard::Position& /*p_droppedPosition*/) override {return true;}
     void ResetChip(Position& /*p_position*/) override {}
     bool IsColumnFull(size_t /*p_column*/) const override {return false;}
+    cxmodel::CanonicalPositionKey GetCanonicalKey() const override {return {};}
 
 private:
 
@@ -63,7 +64,7 @@ TEST(GameResolutionStrategyFactory, Make_WinGameResolution_WinStrategyReturned)
         cxmodel::CreatePlayer("First", cxmodel::MakeRed(), cxmodel::PlayerType::HUMAN),
         cxmodel::CreatePlayer("Second", cxmodel::MakeBlue(), cxmodel::PlayerType::HUMAN)
     };
-    std::vector<cxmodel::IBoard::Position> positions;
+    std::pmr::vector<cxmodel::IBoard::Position> positions;
 
     // We create the strategy:
     auto strategy = cxmodel::GameResolutionStrategyFactory::Make(board, 4u, players, positions, cxmodel::GameResolution::WIN);
@@ -80,7 +81,7 @@ TEST(GameResolutionStrategyFactory, Make_TieGameResolution_TieStrategyReturned)
         cxmodel::CreatePlayer("First", cxmodel::MakeRed(), cxmodel::PlayerType::HUMAN),
         cxmodel::CreatePlayer("Second", cxmodel::MakeBlue(), cxmodel::PlayerType::HUMAN)
     };
-    std::vector<cxmodel::IBoard::Position> positions;
+    std::pmr::vector<cxmodel::IBoard::Position> positions;
 
     // We create the strategy:
     auto strategy = cxmodel::GameResolutionStrategyFactory::Make(board, 4u, players, positions, cxmodel::GameResolution::TIE);
@@ -99,7 +100,7 @@ TEST(GameResolutionStrategyFactory, Make_InARowTooSmall_AssertsAndNoStrategyRetu
         cxmodel::CreatePlayer("First", cxmodel::MakeRed(), cxmodel::PlayerType::HUMAN),
         cxmodel::CreatePlayer("Second", cxmodel::MakeBlue(), cxmodel::PlayerType::HUMAN)
     };
-    std::vector<cxmodel::IBoard::Position> positions;
+    std::pmr::vector<cxmodel::IBoard::Position> positions;
 
     // We create the strategy:
     auto strategy = cxmodel::GameResolutionStrategyFactory::Make(board, 0u, players, positions, cxmodel::GameResolution::WIN);
@@ -119,7 +120,7 @@ TEST(GameResolutionStrategyFactory, Make_InARowTooBig_AssertsAndNoStrategyReturn
         cxmodel::CreatePlayer("First", cxmodel::MakeRed(), cxmodel::PlayerType::HUMAN),
         cxmodel::CreatePlayer("Second", cxmodel::MakeBlue(), cxmodel::PlayerType::HUMAN)
     };
-    std::vector<cxmodel::IBoard::Position> positions;
+    std::pmr::vector<cxmodel::IBoard::Position> positions;
 
     // We create the strategy:
     auto strategy = cxmodel::GameResolutionStrategyFactory::Make(board, std::numeric_limits<size_t>::max() + 1u, players, positions, cxmodel::GameResolution::WIN);
@@ -138,7 +139,7 @@ TEST(GameResolutionStrategyFactory, Make_NotEnoughPlayers_AssertsAndNoStrategyRe
     std::vector<std::shared_ptr<cxmodel::IPlayer>> players{
         cxmodel::CreatePlayer("First", cxmodel::MakeRed(), cxmodel::PlayerType::HUMAN),
     };
-    std::vector<cxmodel::IBoard::Position> positions;
+    std::pmr::vector<cxmodel::IBoard::Position> positions;
 
     // We create the strategy:
     auto strategy = cxmodel::GameResolutionStrategyFactory::Make(board, 4u, players, positions, cxmodel::GameResolution::WIN);
@@ -79,8 +79,8 @@ struct BoardConfigurationData
     {
     }
 
-    size_t m_nbRows;     // The number of rows of the board that was used in the game.
-    size_t m_nbColumns;  // The number of rows of the board that was used in the game.
+    size_t m_nbRows = 0u;     // The number of rows of the board that was used in the game.
+    size_t m_nbColumns = 0u;  // The number of rows of the board that was used in the game.
     Moves m_moves;       // The list of player moves resulting in the game.
 };
 
@@ -277,7 +277,7 @@ BoardConfigurationData ExtractBoardConfigurationData(const std::string& p_asciiG
 void DropChipInternal(size_t p_column,
                       const cxmodel::IChip& p_chip,
                       cxmodel::IBoard& p_board,
-                      std::vector<cxmodel::IBoard::Position>& p_takenPositions)
+                      std::pmr::vector<cxmodel::IBoard::Position>& p_takenPositions)
 {
     cxmodel::IBoard::Position position;
     ASSERT_TRUE(p_board.DropChip(p_column, p_chip, position));
@@ -325,7 +325,7 @@ bool ValidateGameInternal(const std::vector<std::shared_ptr<cxmodel::IPlayer>>&
 
     // Game creation:
     cxmodel::Board board{p_boardData.m_nbRows, p_boardData.m_nbColumns, p_model};
-    std::vector<cxmodel::IBoard::Position> takenPositions;
+    std::pmr::vector<cxmodel::IBoard::Position> takenPositions;
     EXPECT_TRUE(takenPositions.empty());
 
     cxmodel::WinGameResolutionStrategy winStrategy{board, inARow, p_players, takenPositions};
@@ -24,32 +24,29 @@
 #include <gtest/gtest.h>
 
 #include <cxunit/DisableStdStreamsRAII.h>
-#include <cxmodel/Board.h>
-#include <cxmodel/Disc.h>
+#include <cxmodel/BoardSnapshot.h>
+#include <cxmodel/BotSettings.h>
 #include <cxmodel/INextDropColumnComputationStrategy.h>
-
-#include "ConnectXLimitsModelMock.h"
+#include <cxmodel/RandomNumberGenerator.h>
 
 namespace
 {
 
-void FillColumn(size_t p_column, cxmodel::IBoard& p_board, const cxmodel::IChip& p_chip)
+void FillColumn(size_t p_column, cxmodel::BoardSnapshot& p_board, size_t p_playerIndex)
 {
     for(size_t row = 0u; row < p_board.GetNbRows(); ++row)
     {
-        cxmodel::IBoard::Position unused;
-        p_board.DropChip(p_column, p_chip, unused);
-
+        p_board.PlaceChip(p_column, p_playerIndex);
     }
 
     ASSERT_TRUE(p_board.IsColumnFull(p_column));
 }
 
-void FillBoard(cxmodel::IBoard& p_board, const cxmodel::IChip& p_chip)
+void FillBoard(cxmodel::BoardSnapshot& p_board, size_t p_playerIndex)
 {
     for(size_t column = 0u; column < p_board.GetNbColumns(); ++column)
     {
-        FillColumn(column, p_board, p_chip);
+        FillColumn(column, p_board, p_playerIndex);
     }
 }
 
@@ -57,12 +54,22 @@ size_t ComputeColumn()
 {
     const auto strategy = cxmodel::NextDropColumnComputationStrategyCreate(cxmodel::DropColumnComputation::RANDOM);
 
-    const ConnectXLimitsModelMock modelMock;
-    const cxmodel::Board board{6u, 7u, modelMock};
+    const cxmodel::BoardSnapshot board{6u, 7u, 4u, 2u};
 
     return strategy->Compute(board);
 }
 
+cxmodel::BotSettings MakeAlphaBetaSettings(size_t p_nbNodes, size_t p_hashSizeInMB)
+{
+    cxmodel::BotSettings settings;
+    settings.m_algorithm = cxmodel::DropColumnComputation::ALPHA_BETA;
+    settings.m_budgetType = cxmodel::SearchBudgetType::NODES;
+    settings.m_budget = p_nbNodes;
+    settings.m_hashSizeInMB = p_hashSizeInMB;
+
+    return settings;
+}
+
 bool DoesIndexAppearEnough(size_t p_indexUnderTest,
                            const std::vector<size_t>& p_allIndexes,
                            const size_t p_nbOfRepetitions,
@@ -102,11 +109,23 @@ TEST(INextDropColumnComputationStrategy, /*DISABLED_*/NextDropColumnComputationS
     ASSERT_TRUE(strategy);
 
     // Call "Compute" on it:
-    ConnectXLimitsModelMock modelMock;
-    cxmodel::Board unused{6u, 7u, modelMock};
+    const cxmodel::BoardSnapshot unused{6u, 7u, 4u, 2u};
     ASSERT_TRUE(strategy->Compute(unused) == 0u);
 }
 
+TEST(INextDropColumnComputationStrategy, /*DISABLED_*/NextDropColumnComputationStrategyCreate_BotSettings_ReturnsValidStrategy)
+{
+    cxmodel::BotSettings settings;
+    settings.m_budgetType = cxmodel::SearchBudgetType::NODES;
+    settings.m_budget = 1000u;
+
+    const auto strategy = cxmodel::NextDropColumnComputationStrategyCreate(settings);
+    ASSERT_TRUE(strategy);
+
+    const cxmodel::BoardSnapshot board{6u, 7u, 4u, 2u};
+    ASSERT_TRUE(strategy->Compute(board) < 7u);
+}
+
 // ************************************************************************************************
 //                                             RANDOM
 // ************************************************************************************************
@@ -114,8 +133,7 @@ TEST(INextDropColumnComputationStrategy, /*DISABLED_*/Compute_RandomAndAvailable
 {
     const auto strategy = cxmodel::NextDropColumnComputationStrategyCreate(cxmodel::DropColumnComputation::RANDOM);
 
-    ConnectXLimitsModelMock modelMock;
-    cxmodel::Board board{6u, 7u, modelMock};
+    const cxmodel::BoardSnapshot board{6u, 7u, 4u, 2u};
 
     const size_t result = strategy->Compute(board);
 
@@ -126,17 +144,14 @@ TEST(INextDropColumnComputationStrategy, /*DISABLED_*/Compute_RandomAndOneAvaila
 {
     const auto strategy = cxmodel::NextDropColumnComputationStrategyCreate(cxmodel::DropColumnComputation::RANDOM);
 
-    ConnectXLimitsModelMock modelMock;
-    cxmodel::Board board{6u, 7u, modelMock};
+    cxmodel::BoardSnapshot board{6u, 7u, 4u, 2u};
 
-    cxmodel::Disc chip{cxmodel::MakeRed()};
-    cxmodel::IBoard::Position unused;
-    FillColumn(0u, board, chip);
-    FillColumn(2u, board, chip);
-    FillColumn(3u, board, chip);
-    FillColumn(4u, board, chip);
-    FillColumn(5u, board, chip);
-    FillColumn(6u, board, chip);
+    FillColumn(0u, board, 0u);
+    FillColumn(2u, board, 0u);
+    FillColumn(3u, board, 0u);
+    FillColumn(4u, board, 0u);
+    FillColumn(5u, board, 0u);
+    FillColumn(6u, board, 0u);
 
     const size_t result = strategy->Compute(board);
 
@@ -147,12 +162,9 @@ TEST(INextDropColumnComputationStrategy, /*DISABLED_*/Compute_RandomAndNoAvailab
 {
     const auto strategy = cxmodel::NextDropColumnComputationStrategyCreate(cxmodel::DropColumnComputation::RANDOM);
 
-    ConnectXLimitsModelMock modelMock;
-    cxmodel::Board board{6u, 7u, modelMock};
+    cxmodel::BoardSnapshot board{6u, 7u, 4u, 2u};
 
-    cxmodel::Disc chip{cxmodel::MakeRed()};
-    cxmodel::IBoard::Position unused;
-    FillBoard(board, chip);
+    FillBoard(board, 0u);
 
     cxunit::DisableStdStreamsRAII streamDisabler;
     const size_t result = strategy->Compute(board);
@@ -161,6 +173,30 @@ TEST(INextDropColumnComputationStrategy, /*DISABLED_*/Compute_RandomAndNoAvailab
     ASSERT_TRUE(result == 0u);
 }
 
+TEST(INextDropColumnComputationStrategy, /*DISABLED_*/GetStatistics_RandomBeforeCompute_AllZero)
+{
+    const auto strategy = cxmodel::NextDropColumnComputationStrategyCreate(cxmodel::DropColumnComputation::RANDOM);
+
+    const cxmodel::SearchStatistics& statistics = strategy->GetStatistics();
+
+    ASSERT_EQ(statistics.m_nbComputations, 0u);
+    ASSERT_TRUE(statistics.m_principalVariation.empty());
+}
+
+TEST(INextDropColumnComputationStrategy, /*DISABLED_*/GetStatistics_RandomAfterCompute_ComputedColumnReported)
+{
+    const auto strategy = cxmodel::NextDropColumnComputationStrategyCreate(cxmodel::DropColumnComputation::RANDOM);
+
+    const cxmodel::BoardSnapshot board{6u, 7u, 4u, 2u};
+    const size_t result = strategy->Compute(board);
+
+    const cxmodel::SearchStatistics& statistics = strategy->GetStatistics();
+    ASSERT_EQ(statistics.m_nbComputations, 1u);
+    ASSERT_EQ(statistics.m_nbNodes, 0u);
+    ASSERT_EQ(statistics.m_depth, 0u);
+    ASSERT_EQ(statistics.m_principalVariation, std::vector<size_t>{result});
+}
+
 // In this test, we want to make sure the user experience truly feels random by running the
 // test multiple times and measuring the frequence of each occurence. In an ideal world,
 // all columns would have equal frequences of occurence.
@@ -192,3 +228,89 @@ TEST(INextDropColumnComputationStrategy, /*DISABLED_*/Compute_Random_ReturnsWell
     ASSERT_TRUE(DoesIndexAppearEnough(6u, allColumnIndexes, COLUMN_NB_REPETITIONS, TOLERANCE_ON_RANDOM));
                 
 }
+
+TEST(INextDropColumnComputationStrategy, /*DISABLED_*/Compute_RandomWithSameGenerator_SameColumns)
+{
+    const cxmodel::RandomNumberGenerator generator{42u};
+    const auto first = cxmodel::NextDropColumnComputationStrategyCreate(cxmodel::BotSettings{}, generator);
+    const auto second = cxmodel::NextDropColumnComputationStrategyCreate(cxmodel::BotSettings{}, generator);
+
+    const cxmodel::BoardSnapshot board{6u, 7u, 4u, 2u};
+    for(size_t repetition = 0u; repetition < 20u; ++repetition)
+    {
+        ASSERT_EQ(first->Compute(board), second->Compute(board));
+    }
+}
+
+// ************************************************************************************************
+//                                           ALPHA_BETA
+// ************************************************************************************************
+TEST(INextDropColumnComputationStrategy, /*DISABLED_*/NextDropColumnComputationStrategyCreate_AlphaBeta_ReturnsValidStrategy)
+{
+    const auto strategy = cxmodel::NextDropColumnComputationStrategyCreate(cxmodel::DropColumnComputation::ALPHA_BETA);
+    ASSERT_TRUE(strategy);
+}
+
+TEST(INextDropColumnComputationStrategy, /*DISABLED_*/Compute_AlphaBetaAndImmediateWin_ReturnsWinningColumn)
+{
+    const auto strategy = cxmodel::NextDropColumnComputationStrategyCreate(MakeAlphaBetaSettings(10000u, 1u));
+
+    // The first player has three chips on the bottom row, in columns 0 to 2:
+    cxmodel::BoardSnapshot board{6u, 7u, 4u, 2u};
+    for(const size_t column : {0u, 0u, 1u, 1u, 2u, 2u})
+    {
+        board.DropChip(column);
+    }
+
+    ASSERT_EQ(strategy->Compute(board), 3u);
+}
+
+TEST(INextDropColumnComputationStrategy, /*DISABLED_*/Compute_AlphaBetaAndOneAvailableColumn_ReturnsAvailableColumn)
+{
+    const auto strategy = cxmodel::NextDropColumnComputationStrategyCreate(MakeAlphaBetaSettings(10000u, 0u));
+
+    cxmodel::BoardSnapshot board{6u, 7u, 4u, 2u};
+    FillColumn(0u, board, 0u);
+    FillColumn(1u, board, 1u);
+    FillColumn(2u, board, 0u);
+    FillColumn(4u, board, 1u);
+    FillColumn(5u, board, 0u);
+    FillColumn(6u, board, 1u);
+
+    ASSERT_EQ(strategy->Compute(board), 3u);
+}
+
+TEST(INextDropColumnComputationStrategy, /*DISABLED_*/GetStatistics_AlphaBetaAfterCompute_SearchReported)
+{
+    const auto strategy = cxmodel::NextDropColumnComputationStrategyCreate(MakeAlphaBetaSettings(20000u, 1u));
+
+    const cxmodel::BoardSnapshot board{6u, 7u, 4u, 2u};
+    const size_t result = strategy->Compute(board);
+
+    const cxmodel::SearchStatistics& statistics = strategy->GetStatistics();
+    ASSERT_EQ(statistics.m_nbComputations, 1u);
+    ASSERT_GT(statistics.m_nbNodes, 0u);
+    ASSERT_GT(statistics.m_depth, 1u);
+    ASSERT_GE(statistics.m_selectiveDepth, statistics.m_depth - 1u);
+    ASSERT_GT(statistics.m_nbTTProbes, 0u);
+    ASSERT_GT(statistics.m_nbCutoffs, 0u);
+    ASSERT_FALSE(statistics.m_principalVariation.empty());
+    ASSERT_EQ(statistics.m_principalVariation.front(), result);
+}
+
+TEST(INextDropColumnComputationStrategy, /*DISABLED_*/Compute_AlphaBetaTwice_TranspositionTableKept)
+{
+    const auto strategy = cxmodel::NextDropColumnComputationStrategyCreate(MakeAlphaBetaSettings(20000u, 1u));
+
+    const cxmodel::BoardSnapshot board{6u, 7u, 4u, 2u};
+    ASSERT_LT(strategy->Compute(board), 7u);
+    const cxmodel::SearchStatistics first = strategy->GetStatistics();
+
+    ASSERT_LT(strategy->Compute(board), 7u);
+    const cxmodel::SearchStatistics second = strategy->GetStatistics();
+
+    // The second search starts from the results of the first one, so it gets at least
+    // as deep with the same budget:
+    ASSERT_GE(second.m_depth, first.m_depth);
+    ASSERT_GT(second.m_nbTTHits, first.m_nbTTHits);
+}
@@ -45,6 +45,32 @@ TEST(IPlayer, CreatePlayer_BotPlayer_ValidManagedPlayerCreated)
     ASSERT_TRUE(botPlayer->IsManaged());
 }
 
+TEST(IPlayer, CreatePlayer_BotPlayerWithSettings_SettingsKept)
+{
+    cxmodel::BotSettings settings;
+    settings.m_budgetType = cxmodel::SearchBudgetType::NODES;
+    settings.m_budget = 50000u;
+    settings.m_hashSizeInMB = 8u;
+
+    const auto botPlayer = CreatePlayer("JohnBot", cxmodel::MakeRed(), cxmodel::PlayerType::BOT, settings);
+    ASSERT_TRUE(botPlayer);
+
+    ASSERT_TRUE(botPlayer->IsManaged());
+    ASSERT_TRUE(botPlayer->GetBotSettings() == settings);
+}
+
+TEST(IPlayer, CreatePlayer_HumanPlayerWithSettings_SettingsIgnored)
+{
+    cxmodel::BotSettings settings;
+    settings.m_budget = 1000u;
+
+    const auto humanPlayer = CreatePlayer("John", cxmodel::MakeRed(), cxmodel::PlayerType::HUMAN, settings);
+    ASSERT_TRUE(humanPlayer);
+
+    ASSERT_FALSE(humanPlayer->IsManaged());
+    ASSERT_TRUE(humanPlayer->GetBotSettings() == cxmodel::BotSettings{});
+}
+
 TEST(IPlayer, CreatePlayer_InvalidPlayerType_InvalidPlayerCreated)
 {
     const auto invalidPlayerType = static_cast<cxmodel::PlayerType>(-1);
@@ -0,0 +1,155 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file MappedFileTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include <cxunit/DisableStdStreamsRAII.h>
+#include <cxunit/TemporaryFile.h>
+#include <cxmodel/MappedFile.h>
+
+TEST(MappedFile, /*DISABLED_*/Constructor_Default_FileNotOpen)
+{
+    const cxmodel::MappedFile file;
+
+    ASSERT_FALSE(file.IsOpen());
+    ASSERT_EQ(file.GetData(), nullptr);
+    ASSERT_EQ(file.GetSize(), 0u);
+}
+
+TEST(MappedFile, /*DISABLED_*/CreateTemporary_NotOpen_EmptyFileOpen)
+{
+    cxmodel::MappedFile file;
+
+    ASSERT_TRUE(file.CreateTemporary().IsSuccess());
+    ASSERT_TRUE(file.IsOpen());
+    ASSERT_EQ(file.GetSize(), 0u);
+}
+
+TEST(MappedFile, /*DISABLED_*/CreateTemporary_AlreadyOpen_AssertionFailed)
+{
+    cxmodel::MappedFile file;
+    ASSERT_TRUE(file.CreateTemporary().IsSuccess());
+
+    cxunit::DisableStdStreamsRAII streamDisabler;
+    ASSERT_FALSE(file.CreateTemporary().IsSuccess());
+    ASSERT_ASSERTION_FAILED(streamDisabler);
+}
+
+TEST(MappedFile, /*DISABLED_*/Resize_Grow_ContentKeptAndNewContentZeroed)
+{
+    cxmodel::MappedFile file;
+    ASSERT_TRUE(file.CreateTemporary().IsSuccess());
+
+    ASSERT_TRUE(file.Resize(16u).IsSuccess());
+    ASSERT_EQ(file.GetSize(), 16u);
+    std::memset(file.GetData(), 0x2A, 16u);
+
+    ASSERT_TRUE(file.Resize(100000u).IsSuccess());
+    ASSERT_EQ(file.GetSize(), 100000u);
+    ASSERT_TRUE(std::all_of(file.GetData(), file.GetData() + 16u, [](std::byte p_byte){return p_byte == std::byte{0x2A};}));
+    ASSERT_TRUE(std::all_of(file.GetData() + 16u, file.GetData() + 100000u, [](std::byte p_byte){return p_byte == std::byte{0};}));
+}
+
+TEST(MappedFile, /*DISABLED_*/Resize_Zero_FileEmptied)
+{
+    cxmodel::MappedFile file;
+    ASSERT_TRUE(file.CreateTemporary().IsSuccess());
+    ASSERT_TRUE(file.Resize(16u).IsSuccess());
+
+    ASSERT_TRUE(file.Resize(0u).IsSuccess());
+
+    ASSERT_TRUE(file.IsOpen());
+    ASSERT_EQ(file.GetData(), nullptr);
+    ASSERT_EQ(file.GetSize(), 0u);
+}
+
+TEST(MappedFile, /*DISABLED_*/Resize_NotOpen_AssertionFailed)
+{
+    cxmodel::MappedFile file;
+
+    cxunit::DisableStdStreamsRAII streamDisabler;
+    ASSERT_FALSE(file.Resize(16u).IsSuccess());
+    ASSERT_ASSERTION_FAILED(streamDisabler);
+}
+
+TEST(MappedFile, /*DISABLED_*/MoveConstructor_OpenFile_FileMoved)
+{
+    cxmodel::MappedFile file;
+    ASSERT_TRUE(file.CreateTemporary().IsSuccess());
+    ASSERT_TRUE(file.Resize(16u).IsSuccess());
+    file.GetData()[3] = std::byte{7};
+
+    const cxmodel::MappedFile moved{std::move(file)};
+
+    ASSERT_TRUE(moved.IsOpen());
+    ASSERT_EQ(moved.GetSize(), 16u);
+    ASSERT_EQ(moved.GetData()[3], std::byte{7});
+}
+
+TEST(MappedFile, /*DISABLED_*/Create_NewPath_EmptyFileOpen)
+{
+    const cxunit::TemporaryFile path{"cxmodel-mappedfile-create"};
+    cxmodel::MappedFile file;
+
+    ASSERT_TRUE(file.Create(path.GetPath()).IsSuccess());
+    ASSERT_TRUE(file.IsOpen());
+    ASSERT_EQ(file.GetSize(), 0u);
+}
+
+TEST(MappedFile, /*DISABLED_*/Create_InvalidPath_ErrorReturned)
+{
+    cxmodel::MappedFile file;
+
+    ASSERT_FALSE(file.Create("/no/such/directory/file").IsSuccess());
+    ASSERT_FALSE(file.IsOpen());
+}
+
+TEST(MappedFile, /*DISABLED_*/Open_WrittenFile_ContentMapped)
+{
+    const cxunit::TemporaryFile path{"cxmodel-mappedfile-open"};
+    {
+        cxmodel::MappedFile file;
+        ASSERT_TRUE(file.Create(path.GetPath()).IsSuccess());
+        ASSERT_TRUE(file.Resize(3u).IsSuccess());
+        std::memcpy(file.GetData(), "abc", 3u);
+    }
+
+    cxmodel::MappedFile file;
+    ASSERT_TRUE(file.Open(path.GetPath()).IsSuccess());
+    ASSERT_EQ(file.GetSize(), 3u);
+    ASSERT_EQ(std::memcmp(file.GetData(), "abc", 3u), 0);
+    ASSERT_EQ(path.Read(), "abc");
+}
+
+TEST(MappedFile, /*DISABLED_*/Open_MissingFile_ErrorReturned)
+{
+    const cxunit::TemporaryFile path{"cxmodel-mappedfile-missing"};
+    cxmodel::MappedFile file;
+
+    ASSERT_FALSE(file.Open(path.GetPath()).IsSuccess());
+    ASSERT_FALSE(file.IsOpen());
+}
@@ -0,0 +1,183 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file MemoryResourceAllocatedTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <memory>
+#include <memory_resource>
+
+#include <gtest/gtest.h>
+
+#include <cxmodel/CommandStack.h>
+#include <cxmodel/MemoryResourceAllocated.h>
+#include <cxmodel/Model.h>
+#include <cxmodel/NewGameInformation.h>
+
+#include "LoggerMock.h"
+
+namespace
+{
+
+// Counts what is allocated through it, and forwards to the heap:
+class CountingMemoryResource final : public std::pmr::memory_resource
+{
+
+public:
+
+    size_t m_nbAllocations = 0u;
+    size_t m_nbBytesInUse = 0u;
+
+private:
+
+    void* do_allocate(size_t p_bytes, size_t p_alignment) override
+    {
+        ++m_nbAllocations;
+        m_nbBytesInUse += p_bytes;
+
+        return std::pmr::new_delete_resource()->allocate(p_bytes, p_alignment);
+    }
+
+    void do_deallocate(void* p_memory, size_t p_bytes, size_t p_alignment) override
+    {
+        m_nbBytesInUse -= p_bytes;
+
+        std::pmr::new_delete_resource()->deallocate(p_memory, p_bytes, p_alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& p_other) const noexcept override
+    {
+        return this == &p_other;
+    }
+
+};
+
+class IValue : public cxmodel::MemoryResourceAllocated
+{
+
+public:
+
+    virtual ~IValue() = default;
+
+    [[nodiscard]] virtual int Get() const = 0;
+
+};
+
+class Value : public IValue
+{
+
+public:
+
+    explicit Value(int p_value) : m_value{p_value} {}
+
+    [[nodiscard]] int Get() const override {return m_value;}
+
+private:
+
+    int m_value;
+    char m_padding[100];
+
+};
+
+class ThrowingValue : public IValue
+{
+
+public:
+
+    ThrowingValue() {throw std::runtime_error{"Construction failed."};}
+
+    [[nodiscard]] int Get() const override {return 0;}
+
+};
+
+} // namespace
+
+TEST(MemoryResourceAllocated, New_WithResource_AllocatedFromResource)
+{
+    CountingMemoryResource resource;
+
+    std::unique_ptr<IValue> value{new(&resource) Value{3}};
+
+    ASSERT_EQ(3, value->Get());
+    ASSERT_EQ(1u, resource.m_nbAllocations);
+    ASSERT_GE(resource.m_nbBytesInUse, sizeof(Value));
+}
+
+TEST(MemoryResourceAllocated, Delete_ThroughInterface_MemoryGivenBackToResource)
+{
+    CountingMemoryResource resource;
+
+    std::unique_ptr<IValue> value{new(&resource) Value{3}};
+    value.reset();
+
+    ASSERT_EQ(1u, resource.m_nbAllocations);
+    ASSERT_EQ(0u, resource.m_nbBytesInUse);
+}
+
+TEST(MemoryResourceAllocated, New_ConstructorThrows_MemoryGivenBackToResource)
+{
+    CountingMemoryResource resource;
+
+    ASSERT_THROW((void)new(&resource) ThrowingValue{}, std::runtime_error);
+
+    ASSERT_EQ(1u, resource.m_nbAllocations);
+    ASSERT_EQ(0u, resource.m_nbBytesInUse);
+}
+
+TEST(MemoryResourceAllocated, New_NoResource_AllocatedFromDefaultResource)
+{
+    CountingMemoryResource resource;
+    std::pmr::memory_resource* const previous = std::pmr::set_default_resource(&resource);
+
+    std::unique_ptr<IValue> value = std::make_unique<Value>(3);
+    std::pmr::set_default_resource(previous);
+
+    ASSERT_EQ(1u, resource.m_nbAllocations);
+
+    value.reset();
+    ASSERT_EQ(0u, resource.m_nbBytesInUse);
+}
+
+TEST(MemoryResourceAllocated, Model_WithResource_GameAllocatedFromResource)
+{
+    CountingMemoryResource resource;
+    LoggerMock logger;
+
+    {
+        cxmodel::Model model{std::unique_ptr<cxmodel::ICommandStack>{new(&resource) cxmodel::CommandStack(20u, &resource)}, logger, &resource};
+
+        cxmodel::NewGameInformation gameInformation;
+        gameInformation.m_gridWidth = 7u;
+        gameInformation.m_gridHeight = 6u;
+        gameInformation.m_inARowValue = 4u;
+        gameInformation.m_players.push_back(cxmodel::CreatePlayer("John Doe", cxmodel::MakeRed(), cxmodel::PlayerType::HUMAN));
+        gameInformation.m_players.push_back(cxmodel::CreatePlayer("Jane Doe", cxmodel::MakeBlue(), cxmodel::PlayerType::HUMAN));
+        model.CreateNewGame(std::move(gameInformation));
+
+        const size_t nbAllocationsBeforeDrop = resource.m_nbAllocations;
+        model.DropChip(model.GetActivePlayer().GetChip(), 0u);
+
+        // The board, the drop command and the game records all come from the resource:
+        ASSERT_GT(nbAllocationsBeforeDrop, 1u);
+        ASSERT_GT(resource.m_nbAllocations, nbAllocationsBeforeDrop);
+    }
+
+    ASSERT_EQ(0u, resource.m_nbBytesInUse);
+}
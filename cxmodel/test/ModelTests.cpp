@@ -21,14 +21,23 @@
  *
  *************************************************************************************************/
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
 #include <regex>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
+#include <cxunit/DisableStdStreamsRAII.h>
+#include <cxmodel/BotSettings.h>
 #include <cxmodel/CommandStack.h>
 #include <cxmodel/Disc.h>
 #include <cxmodel/IObserver.h>
 #include <cxmodel/Model.h>
+#include <cxmodel/MoveJournal.h>
 
 #include "CommandStackMock.h"
 #include "LoggerMock.h"
@@ -844,6 +853,101 @@ TEST_F(ModelTestFixture, /*DISABLED_*/Redo_CommandDropChipWithTwoBots_PreviousSt
     ASSERT_TRUE(model.GetChip(2u, 1u).GetColor() == cxmodel::MakeGreen());
 }
 
+TEST(Model, /*DISABLED_*/Undo_JournalWithTwoBots_HumanAndBotsDropsUndone)
+{
+    LoggerMock logger;
+    cxmodel::Model model{cxmodel::MoveJournal{10u}, logger};
+
+    cxmodel::NewGameInformation newGameInfo;
+    newGameInfo.m_gridWidth = 7u;
+    newGameInfo.m_gridHeight = 6u;
+    newGameInfo.m_inARowValue = 4u;
+
+    newGameInfo.m_players.push_back(cxmodel::CreatePlayer("P1", cxmodel::MakeRed(), cxmodel::PlayerType::HUMAN));
+    newGameInfo.m_players.push_back(cxmodel::CreatePlayer("P2", cxmodel::MakeBlue(), cxmodel::PlayerType::BOT));
+    newGameInfo.m_players.push_back(cxmodel::CreatePlayer("P3", cxmodel::MakeGreen(), cxmodel::PlayerType::BOT));
+
+    model.CreateNewGame(std::move(newGameInfo));
+    ASSERT_FALSE(model.CanUndo());
+
+    // Two turns of a human drop followed by the bots drops:
+    for(size_t drop = 0u; drop < 6u; ++drop)
+    {
+        model.DropChip(model.GetActivePlayer().GetChip(), 1u);
+    }
+    ASSERT_TRUE(model.CanUndo());
+
+    // The last turn is undone as a whole:
+    model.Undo();
+    ASSERT_TRUE(model.GetChip(2u, 1u).GetColor() == cxmodel::MakeGreen());
+    ASSERT_TRUE(model.GetChip(3u, 1u).GetColor() == cxmodel::MakeTransparent());
+    ASSERT_TRUE(model.GetActivePlayer().GetName() == "P1");
+    ASSERT_TRUE(model.GetNextPlayer().GetName() == "P2");
+
+    model.Undo();
+    ASSERT_TRUE(model.GetChip(0u, 1u).GetColor() == cxmodel::MakeTransparent());
+    ASSERT_FALSE(model.CanUndo());
+
+    // It is also redone as a whole:
+    model.Redo();
+    ASSERT_TRUE(model.GetChip(2u, 1u).GetColor() == cxmodel::MakeGreen());
+    ASSERT_TRUE(model.GetChip(3u, 1u).GetColor() == cxmodel::MakeTransparent());
+    ASSERT_TRUE(model.GetActivePlayer().GetName() == "P1");
+    ASSERT_TRUE(model.CanRedo());
+}
+
+TEST(Model, /*DISABLED_*/Undo_JournalFull_OldestTurnsForgotten)
+{
+    LoggerMock logger;
+    cxmodel::Model model{cxmodel::MoveJournal{2u}, logger};
+
+    cxmodel::NewGameInformation newGameInfo;
+    newGameInfo.m_gridWidth = 7u;
+    newGameInfo.m_gridHeight = 6u;
+    newGameInfo.m_inARowValue = 4u;
+
+    newGameInfo.m_players.push_back(cxmodel::CreatePlayer("P1", cxmodel::MakeRed(), cxmodel::PlayerType::HUMAN));
+    newGameInfo.m_players.push_back(cxmodel::CreatePlayer("P2", cxmodel::MakeBlue(), cxmodel::PlayerType::HUMAN));
+
+    model.CreateNewGame(std::move(newGameInfo));
+
+    for(size_t column = 0u; column < 3u; ++column)
+    {
+        model.DropChip(model.GetActivePlayer().GetChip(), column);
+    }
+
+    // Only the last two drops can be undone:
+    model.Undo();
+    model.Undo();
+    ASSERT_FALSE(model.CanUndo());
+    ASSERT_TRUE(model.GetChip(0u, 0u).GetColor() == cxmodel::MakeRed());
+    ASSERT_TRUE(model.GetChip(0u, 1u).GetColor() == cxmodel::MakeTransparent());
+    ASSERT_TRUE(model.GetActivePlayer().GetName() == "P2");
+}
+
+TEST(Model, /*DISABLED_*/EndCurrentGame_Journal_HistoryCleared)
+{
+    LoggerMock logger;
+    cxmodel::Model model{cxmodel::MoveJournal{10u}, logger};
+
+    cxmodel::NewGameInformation newGameInfo;
+    newGameInfo.m_gridWidth = 7u;
+    newGameInfo.m_gridHeight = 6u;
+    newGameInfo.m_inARowValue = 4u;
+
+    newGameInfo.m_players.push_back(cxmodel::CreatePlayer("P1", cxmodel::MakeRed(), cxmodel::PlayerType::HUMAN));
+    newGameInfo.m_players.push_back(cxmodel::CreatePlayer("P2", cxmodel::MakeBlue(), cxmodel::PlayerType::HUMAN));
+
+    model.CreateNewGame(std::move(newGameInfo));
+    model.DropChip(model.GetActivePlayer().GetChip(), 0u);
+    ASSERT_TRUE(model.CanUndo());
+
+    model.EndCurrentGame();
+
+    ASSERT_FALSE(model.CanUndo());
+    ASSERT_FALSE(model.CanRedo());
+}
+
 TEST(Model, /*DISABLED_*/Redo_RandomCommand_RedoCalledOnCommandStack)
 {
     std::unique_ptr<CommandStackMock> cmdStack = std::make_unique<CommandStackMock>();
@@ -947,3 +1051,521 @@ TEST_F(ModelTestFixture, /*DISABLED_*/ComputeNextDropColumn_ValidModel_ValidColu
     DropChips(1u);
     ASSERT_TRUE(GetModel().GetCurrentBotTarget() < GetModel().GetCurrentGridWidth());
 }
+
+TEST_F(ModelTestFixture, /*DISABLED_*/ComputeNextDropColumn_BotsWithSettings_ValidColumnComputedEveryTurn)
+{
+    cxmodel::Model& model = GetModel();
+
+    cxmodel::BotSettings settings;
+    settings.m_budgetType = cxmodel::SearchBudgetType::NODES;
+    settings.m_budget = 1000u;
+    settings.m_hashSizeInMB = 1u;
+
+    cxmodel::NewGameInformation newGameInfo;
+    newGameInfo.m_gridWidth = 7u;
+    newGameInfo.m_gridHeight = 6u;
+    newGameInfo.m_inARowValue = 4u;
+
+    newGameInfo.m_players.push_back(cxmodel::CreatePlayer("P1", cxmodel::MakeRed(), cxmodel::PlayerType::HUMAN));
+    newGameInfo.m_players.push_back(cxmodel::CreatePlayer("P2", cxmodel::MakeBlue(), cxmodel::PlayerType::BOT, settings));
+    newGameInfo.m_players.push_back(cxmodel::CreatePlayer("P3", cxmodel::MakeGreen(), cxmodel::PlayerType::BOT));
+
+    model.CreateNewGame(std::move(newGameInfo));
+    ASSERT_TRUE(model.GetActivePlayer().GetBotSettings() == cxmodel::BotSettings{});
+
+    // The human player drops, then each bot drops at its computed target, for a few turns:
+    for(size_t turn = 0u; turn < 3u; ++turn)
+    {
+        ASSERT_FALSE(model.GetActivePlayer().IsManaged());
+        model.DropChip(model.GetActivePlayer().GetChip(), turn);
+
+        while(model.GetActivePlayer().IsManaged())
+        {
+            const size_t target = model.GetCurrentBotTarget();
+            ASSERT_TRUE(target < model.GetCurrentGridWidth());
+            ASSERT_TRUE(model.GetChip(model.GetCurrentGridHeight() - 1u, target).GetColor() == cxmodel::MakeTransparent());
+
+            model.DropChip(model.GetActivePlayer().GetChip(), target);
+        }
+    }
+}
+
+namespace
+{
+
+cxmodel::NewGameInformation MakeRandomBotsGameInformation(std::optional<std::uint64_t> p_seed)
+{
+    cxmodel::NewGameInformation newGameInfo;
+    newGameInfo.m_gridWidth = 7u;
+    newGameInfo.m_gridHeight = 6u;
+    newGameInfo.m_inARowValue = 4u;
+    newGameInfo.m_seed = p_seed;
+
+    newGameInfo.m_players.push_back(cxmodel::CreatePlayer("P1", cxmodel::MakeRed(), cxmodel::PlayerType::BOT));
+    newGameInfo.m_players.push_back(cxmodel::CreatePlayer("P2", cxmodel::MakeBlue(), cxmodel::PlayerType::BOT));
+
+    return newGameInfo;
+}
+
+// Lets the bots play until the game ends, and returns their drops:
+std::vector<size_t> PlayBotsGame(cxmodel::Model& p_model)
+{
+    std::vector<size_t> drops;
+    while(!p_model.IsWon() && !p_model.IsTie())
+    {
+        drops.push_back(p_model.GetCurrentBotTarget());
+        p_model.DropChip(p_model.GetActivePlayer().GetChip(), drops.back());
+    }
+
+    return drops;
+}
+
+} // namespace
+
+TEST_F(ModelTestFixture, /*DISABLED_*/GetSeed_NewGameWithSeed_SeedReturned)
+{
+    cxmodel::Model& model = GetModel();
+
+    model.CreateNewGame(MakeRandomBotsGameInformation(42u));
+
+    ASSERT_EQ(model.GetSeed(), 42u);
+}
+
+TEST_F(ModelTestFixture, /*DISABLED_*/CreateNewGame_SameSeedTwice_RandomBotsReplayGame)
+{
+    cxmodel::Model& model = GetModel();
+
+    model.CreateNewGame(MakeRandomBotsGameInformation(42u));
+    const std::vector<size_t> firstGame = PlayBotsGame(model);
+    model.EndCurrentGame();
+
+    model.CreateNewGame(MakeRandomBotsGameInformation(42u));
+    const std::vector<size_t> secondGame = PlayBotsGame(model);
+
+    ASSERT_EQ(firstGame, secondGame);
+}
+
+TEST_F(ModelTestFixture, /*DISABLED_*/CreateNewGame_NoSeed_RecordedSeedReplaysGame)
+{
+    cxmodel::Model& model = GetModel();
+
+    model.CreateNewGame(MakeRandomBotsGameInformation(std::nullopt));
+    const std::uint64_t seed = model.GetSeed();
+    const std::vector<size_t> firstGame = PlayBotsGame(model);
+    model.EndCurrentGame();
+
+    model.CreateNewGame(MakeRandomBotsGameInformation(seed));
+    const std::vector<size_t> secondGame = PlayBotsGame(model);
+
+    ASSERT_EQ(firstGame, secondGame);
+}
+
+TEST_F(ModelTestFixture, /*DISABLED_*/ReinitializeCurrentGame_RandomBots_GameReplayed)
+{
+    cxmodel::Model& model = GetModel();
+
+    model.CreateNewGame(MakeRandomBotsGameInformation(7u));
+    const std::vector<size_t> firstGame = PlayBotsGame(model);
+
+    model.ReinitializeCurrentGame();
+    const std::vector<size_t> secondGame = PlayBotsGame(model);
+
+    ASSERT_EQ(firstGame, secondGame);
+}
+
+TEST_F(ModelTestFixture, /*DISABLED_*/ComputeNextDropColumn_ValidModel_StatisticsRecorded)
+{
+    CreateNewGame(6u, 7u, ModelTestFixture::NbPlayers::TWO, ModelTestFixture::InARowValue::FOUR);
+    cxmodel::Model& model = GetModel();
+
+    model.ComputeNextDropColumn(cxmodel::DropColumnComputation::RANDOM);
+
+    const cxmodel::SearchStatistics last = model.GetLastSearchStatistics();
+    ASSERT_EQ(last.m_nbComputations, 1u);
+    ASSERT_EQ(last.m_principalVariation, std::vector<size_t>{model.GetCurrentBotTarget()});
+    ASSERT_EQ(model.GetGameSearchStatistics().m_nbComputations, 1u);
+}
+
+TEST_F(ModelTestFixture, /*DISABLED_*/GetGameSearchStatistics_AlphaBetaBotPlaying_AggregatedOverGame)
+{
+    cxmodel::Model& model = GetModel();
+
+    cxmodel::BotSettings settings;
+    settings.m_algorithm = cxmodel::DropColumnComputation::ALPHA_BETA;
+    settings.m_budgetType = cxmodel::SearchBudgetType::NODES;
+    settings.m_budget = 2000u;
+    settings.m_hashSizeInMB = 1u;
+
+    cxmodel::NewGameInformation newGameInfo;
+    newGameInfo.m_gridWidth = 7u;
+    newGameInfo.m_gridHeight = 6u;
+    newGameInfo.m_inARowValue = 4u;
+
+    newGameInfo.m_players.push_back(cxmodel::CreatePlayer("P1", cxmodel::MakeRed(), cxmodel::PlayerType::HUMAN));
+    newGameInfo.m_players.push_back(cxmodel::CreatePlayer("P2", cxmodel::MakeBlue(), cxmodel::PlayerType::BOT, settings));
+
+    model.CreateNewGame(std::move(newGameInfo));
+    ASSERT_EQ(model.GetGameSearchStatistics().m_nbComputations, 0u);
+
+    size_t nbNodes = 0u;
+    for(size_t turn = 0u; turn < 3u; ++turn)
+    {
+        model.DropChip(model.GetActivePlayer().GetChip(), turn);
+
+        const cxmodel::SearchStatistics last = model.GetLastSearchStatistics();
+        ASSERT_EQ(last.m_nbComputations, 1u);
+        ASSERT_GT(last.m_nbNodes, 0u);
+        ASSERT_FALSE(last.m_principalVariation.empty());
+        ASSERT_EQ(last.m_principalVariation.front(), model.GetCurrentBotTarget());
+        nbNodes += last.m_nbNodes;
+
+        model.DropChip(model.GetActivePlayer().GetChip(), model.GetCurrentBotTarget());
+    }
+
+    const cxmodel::SearchStatistics game = model.GetGameSearchStatistics();
+    ASSERT_EQ(game.m_nbComputations, 3u);
+    ASSERT_EQ(game.m_nbNodes, nbNodes);
+    ASSERT_GT(game.m_nbTTProbes, 0u);
+
+    // Reinitializing starts a new game:
+    model.ReinitializeCurrentGame();
+    ASSERT_EQ(model.GetGameSearchStatistics().m_nbComputations, 0u);
+}
+
+TEST_F(ModelTestFixture, /*DISABLED_*/EndCurrentGame_StatisticsRecorded_StatisticsReset)
+{
+    CreateNewGame(6u, 7u, ModelTestFixture::NbPlayers::TWO, ModelTestFixture::InARowValue::FOUR);
+    cxmodel::Model& model = GetModel();
+
+    model.ComputeNextDropColumn(cxmodel::DropColumnComputation::RANDOM);
+    ASSERT_EQ(model.GetGameSearchStatistics().m_nbComputations, 1u);
+
+    model.EndCurrentGame();
+    ASSERT_EQ(model.GetLastSearchStatistics().m_nbComputations, 0u);
+    ASSERT_EQ(model.GetGameSearchStatistics().m_nbComputations, 0u);
+}
+
+TEST_F(ModelTestFixture, /*DISABLED_*/EndCurrentGame_BotTargetComputed_BotTargetReset)
+{
+    cxmodel::Model& model = GetModel();
+
+    cxmodel::NewGameInformation newGameInfo;
+    newGameInfo.m_gridWidth = 7u;
+    newGameInfo.m_gridHeight = 6u;
+    newGameInfo.m_inARowValue = 4u;
+
+    newGameInfo.m_players.push_back(cxmodel::CreatePlayer("P1", cxmodel::MakeRed(), cxmodel::PlayerType::HUMAN));
+    newGameInfo.m_players.push_back(cxmodel::CreatePlayer("P2", cxmodel::MakeBlue(), cxmodel::PlayerType::BOT));
+
+    model.CreateNewGame(std::move(newGameInfo));
+    model.DropChip(model.GetActivePlayer().GetChip(), 0u);
+    ASSERT_TRUE(model.GetActivePlayer().IsManaged());
+
+    model.EndCurrentGame();
+    ASSERT_EQ(model.GetCurrentBotTarget(), 0u);
+}
+
+namespace
+{
+
+// Waits, for a reasonable time, until the model has an analysis result:
+bool WaitForAnalysis(const cxmodel::Model& p_model)
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+    while(std::chrono::steady_clock::now() < deadline)
+    {
+        if(p_model.GetAnalysis().m_depth > 0u)
+        {
+            return true;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds{5});
+    }
+
+    return false;
+}
+
+} // namespace
+
+TEST_F(ModelTestFixture, /*DISABLED_*/GetAnalysis_NoAnalysisStarted_EmptyResult)
+{
+    CreateNewGame(6u, 7u, ModelTestFixture::NbPlayers::TWO, ModelTestFixture::InARowValue::FOUR);
+
+    ASSERT_FALSE(GetModel().IsAnalysisEnabled());
+    ASSERT_TRUE(GetModel().GetAnalysis().m_columnScores.empty());
+}
+
+TEST_F(ModelTestFixture, /*DISABLED_*/StartAnalysis_ValidGame_EveryColumnScored)
+{
+    CreateNewGame(6u, 7u, ModelTestFixture::NbPlayers::TWO, ModelTestFixture::InARowValue::FOUR);
+
+    GetModel().StartAnalysis();
+    ASSERT_TRUE(GetModel().IsAnalysisEnabled());
+
+    ASSERT_TRUE(WaitForAnalysis(GetModel()));
+    ASSERT_EQ(GetModel().GetAnalysis().m_columnScores.size(), 7u);
+}
+
+TEST_F(ModelTestFixture, /*DISABLED_*/DropChip_AnalysisEnabled_NewPositionAnalyzed)
+{
+    CreateNewGame(6u, 7u, ModelTestFixture::NbPlayers::TWO, ModelTestFixture::InARowValue::FOUR);
+
+    GetModel().StartAnalysis();
+    ASSERT_TRUE(WaitForAnalysis(GetModel()));
+
+    // Fill the first column. Once full, the analysis has no score for it:
+    DropChips(1u);
+    for(size_t row = 1u; row < 6u; ++row)
+    {
+        GetModel().DropChip(GetModel().GetActivePlayer().GetChip(), 0u);
+    }
+
+    ASSERT_TRUE(GetModel().IsAnalysisEnabled());
+    ASSERT_TRUE(WaitForAnalysis(GetModel()));
+    ASSERT_EQ(GetModel().GetAnalysis().m_columnScores[0u], cxmodel::NO_SCORE);
+}
+
+TEST_F(ModelTestFixture, /*DISABLED_*/StopAnalysis_AnalysisRunning_ResultCleared)
+{
+    CreateNewGame(6u, 7u, ModelTestFixture::NbPlayers::TWO, ModelTestFixture::InARowValue::FOUR);
+
+    GetModel().StartAnalysis();
+    ASSERT_TRUE(WaitForAnalysis(GetModel()));
+
+    GetModel().StopAnalysis();
+
+    ASSERT_FALSE(GetModel().IsAnalysisEnabled());
+    ASSERT_TRUE(GetModel().GetAnalysis().m_columnScores.empty());
+}
+
+namespace
+{
+
+cxmodel::NewGameInformation MakeTwoHumansGameInformation()
+{
+    cxmodel::NewGameInformation newGameInfo;
+    newGameInfo.m_gridWidth = 7u;
+    newGameInfo.m_gridHeight = 6u;
+    newGameInfo.m_inARowValue = 4u;
+
+    newGameInfo.m_players.push_back(cxmodel::CreatePlayer("P1", cxmodel::MakeRed(), cxmodel::PlayerType::HUMAN));
+    newGameInfo.m_players.push_back(cxmodel::CreatePlayer("P2", cxmodel::MakeBlue(), cxmodel::PlayerType::HUMAN));
+
+    return newGameInfo;
+}
+
+// Counts the notifications of each context:
+class NotificationCounter : public cxmodel::IModelObserver
+{
+
+public:
+
+    void Update(cxmodel::ModelNotificationContext p_context, cxmodel::ModelSubject* /*p_subject*/) override
+    {
+        m_contexts.push_back(p_context);
+    }
+
+    std::vector<cxmodel::ModelNotificationContext> m_contexts;
+
+};
+
+} // namespace
+
+TEST_F(ModelTestFixture, /*DISABLED_*/ApplyMoves_ValidColumns_ChipsDroppedAndNotifiedOnce)
+{
+    cxmodel::Model& model = GetModel();
+    model.CreateNewGame(MakeTwoHumansGameInformation());
+
+    NotificationCounter counter;
+    model.Attach(&counter);
+
+    ASSERT_EQ(model.ApplyMoves({0u, 1u, 2u, 0u}), 4u);
+
+    ASSERT_TRUE(model.GetChip(0u, 0u).GetColor() == cxmodel::MakeRed());
+    ASSERT_TRUE(model.GetChip(0u, 1u).GetColor() == cxmodel::MakeBlue());
+    ASSERT_TRUE(model.GetChip(0u, 2u).GetColor() == cxmodel::MakeRed());
+    ASSERT_TRUE(model.GetChip(1u, 0u).GetColor() == cxmodel::MakeBlue());
+    ASSERT_EQ(model.GetActivePlayer().GetName(), "P1");
+    ASSERT_EQ(model.GetNextPlayer().GetName(), "P2");
+
+    ASSERT_EQ(counter.m_contexts, std::vector<cxmodel::ModelNotificationContext>{cxmodel::ModelNotificationContext::MOVES_APPLIED});
+
+    model.Detatch(&counter);
+}
+
+TEST_F(ModelTestFixture, /*DISABLED_*/ApplyMoves_WinningColumns_DropsStopAtWin)
+{
+    cxmodel::Model& model = GetModel();
+    model.CreateNewGame(MakeTwoHumansGameInformation());
+
+    NotificationCounter counter;
+    model.Attach(&counter);
+
+    ASSERT_EQ(model.ApplyMoves({0u, 1u, 0u, 1u, 0u, 1u, 0u, 1u, 1u}), 7u);
+
+    ASSERT_TRUE(model.IsWon());
+    ASSERT_EQ(model.GetActivePlayer().GetName(), "P1");
+    ASSERT_TRUE(model.GetChip(3u, 1u).GetColor() == cxmodel::MakeTransparent());
+
+    const std::vector<cxmodel::ModelNotificationContext> expected{cxmodel::ModelNotificationContext::MOVES_APPLIED,
+                                                                  cxmodel::ModelNotificationContext::GAME_WON};
+    ASSERT_EQ(counter.m_contexts, expected);
+
+    // Nothing more can be dropped:
+    ASSERT_EQ(model.ApplyMoves({2u}), 0u);
+
+    model.Detatch(&counter);
+}
+
+TEST_F(ModelTestFixture, /*DISABLED_*/ApplyMoves_FullOrInvalidColumn_DropsStop)
+{
+    cxmodel::Model& model = GetModel();
+    model.CreateNewGame(MakeTwoHumansGameInformation());
+
+    ASSERT_EQ(model.ApplyMoves({0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u}), 6u);
+    ASSERT_EQ(model.ApplyMoves({1u, 7u, 1u}), 1u);
+    ASSERT_EQ(model.ApplyMoves({}), 0u);
+}
+
+TEST(Model, /*DISABLED_*/ApplyMoves_Journal_SameGameAsDroppingOneByOne)
+{
+    const std::vector<size_t> columns{3u, 3u, 4u, 2u, 5u, 6u, 2u, 4u, 0u, 1u};
+
+    LoggerMock logger;
+    cxmodel::Model applied{cxmodel::MoveJournal{100u}, logger};
+    applied.CreateNewGame(MakeTwoHumansGameInformation());
+    ASSERT_EQ(applied.ApplyMoves(columns), columns.size());
+
+    cxmodel::Model dropped{cxmodel::MoveJournal{100u}, logger};
+    dropped.CreateNewGame(MakeTwoHumansGameInformation());
+    for(const size_t column : columns)
+    {
+        dropped.DropChip(dropped.GetActivePlayer().GetChip(), column);
+    }
+
+    // The undo history is the same too:
+    do
+    {
+        for(size_t row = 0u; row < 6u; ++row)
+        {
+            for(size_t column = 0u; column < 7u; ++column)
+            {
+                ASSERT_TRUE(applied.GetChip(row, column).GetColor() == dropped.GetChip(row, column).GetColor());
+            }
+        }
+        ASSERT_EQ(applied.GetActivePlayer().GetName(), dropped.GetActivePlayer().GetName());
+
+        ASSERT_EQ(applied.CanUndo(), dropped.CanUndo());
+        applied.Undo();
+        dropped.Undo();
+    }
+    while(dropped.CanUndo());
+}
+
+namespace
+{
+
+cxmodel::NewGameInformation MakeHumanAndTwoBotsGameInformation()
+{
+    cxmodel::NewGameInformation newGameInfo = MakeTwoHumansGameInformation();
+    newGameInfo.m_players.back() = cxmodel::CreatePlayer("P2", cxmodel::MakeBlue(), cxmodel::PlayerType::BOT);
+    newGameInfo.m_players.push_back(cxmodel::CreatePlayer("P3", cxmodel::MakeGreen(), cxmodel::PlayerType::BOT));
+
+    return newGameInfo;
+}
+
+void DropTurnThenUndoAndRedoIt(cxmodel::Model& p_model)
+{
+    p_model.CreateNewGame(MakeHumanAndTwoBotsGameInformation());
+
+    // A human drop followed by the bots drops:
+    for(size_t drop = 0u; drop < 3u; ++drop)
+    {
+        p_model.DropChip(p_model.GetActivePlayer().GetChip(), 1u);
+    }
+
+    NotificationCounter counter;
+    p_model.Attach(&counter);
+
+    // The three drops are undone, then redone, but observers hear about it once each time:
+    p_model.Undo();
+    ASSERT_TRUE(p_model.GetChip(0u, 1u).GetColor() == cxmodel::MakeTransparent());
+    ASSERT_EQ(counter.m_contexts, std::vector<cxmodel::ModelNotificationContext>{cxmodel::ModelNotificationContext::UNDO_CHIP_DROPPED});
+
+    p_model.Redo();
+    ASSERT_TRUE(p_model.GetChip(2u, 1u).GetColor() == cxmodel::MakeGreen());
+    ASSERT_EQ(counter.m_contexts.size(), 2u);
+    ASSERT_TRUE(counter.m_contexts.back() == cxmodel::ModelNotificationContext::REDO_CHIP_DROPPED);
+
+    p_model.Detatch(&counter);
+}
+
+} // namespace
+
+TEST_F(ModelTestFixture, /*DISABLED_*/Undo_CommandDropChipWithTwoBots_ObserversNotifiedOnce)
+{
+    DropTurnThenUndoAndRedoIt(GetModel());
+}
+
+TEST(Model, /*DISABLED_*/Undo_JournalWithTwoBots_ObserversNotifiedOnce)
+{
+    LoggerMock logger;
+    cxmodel::Model model{cxmodel::MoveJournal{10u}, logger};
+
+    DropTurnThenUndoAndRedoIt(model);
+}
+
+TEST_F(ModelTestFixture, /*DISABLED_*/ProcessAnalysisUpdate_NewResult_ObserversNotifiedFromOwningThread)
+{
+    cxmodel::Model& model = GetModel();
+    model.CreateNewGame(MakeTwoHumansGameInformation());
+
+    std::atomic<bool> isWokenUp{false};
+    model.SetAnalysisUpdatedCallback([&isWokenUp](){isWokenUp = true;});
+
+    NotificationCounter counter;
+    model.Attach(&counter);
+
+    model.StartAnalysis();
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+    while(!isWokenUp && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds{5});
+    }
+    ASSERT_TRUE(isWokenUp);
+
+    // The analysis thread only wakes the owning thread up, which notifies:
+    ASSERT_TRUE(counter.m_contexts.empty());
+    ASSERT_TRUE(model.ProcessAnalysisUpdate());
+    ASSERT_EQ(counter.m_contexts, std::vector<cxmodel::ModelNotificationContext>{cxmodel::ModelNotificationContext::ANALYSIS_UPDATED});
+
+    model.StopAnalysis();
+    model.Detatch(&counter);
+}
+
+TEST_F(ModelTestFixture, /*DISABLED_*/ProcessAnalysisUpdate_NoAnalysis_NothingNotified)
+{
+    cxmodel::Model& model = GetModel();
+    model.CreateNewGame(MakeTwoHumansGameInformation());
+
+    NotificationCounter counter;
+    model.Attach(&counter);
+
+    ASSERT_FALSE(model.ProcessAnalysisUpdate());
+    ASSERT_TRUE(counter.m_contexts.empty());
+
+    model.Detatch(&counter);
+}
+
+TEST_F(ModelTestFixture, /*DISABLED_*/SetAnalysisUpdatedCallback_AnalysisStarted_AssertionFailed)
+{
+    cxmodel::Model& model = GetModel();
+    model.CreateNewGame(MakeTwoHumansGameInformation());
+    model.StartAnalysis();
+
+    cxunit::DisableStdStreamsRAII streamDisabler;
+    model.SetAnalysisUpdatedCallback([](){});
+
+    ASSERT_PRECONDITION_FAILED(streamDisabler);
+}
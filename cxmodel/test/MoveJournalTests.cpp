@@ -0,0 +1,382 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file MoveJournalTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <csignal>
+
+#include <sys/resource.h>
+
+#include <gtest/gtest.h>
+
+#include <cxunit/DisableStdStreamsRAII.h>
+#include <cxmodel/MappedFile.h>
+#include <cxmodel/MoveJournal.h>
+
+namespace
+{
+
+cxmodel::MoveJournal::Entry MakeEntry(std::uint8_t p_column, bool p_isTurnStart)
+{
+    return {p_column, 0u, 0u, p_isTurnStart};
+}
+
+cxmodel::MappedFile MakePageFile()
+{
+    cxmodel::MappedFile pageFile;
+    EXPECT_TRUE(pageFile.CreateTemporary().IsSuccess());
+
+    return pageFile;
+}
+
+// Turns of three drops, with columns that tell the drops apart:
+cxmodel::MoveJournal::Entry MakeNumberedEntry(size_t p_number)
+{
+    return {static_cast<std::uint8_t>(p_number % 256u), static_cast<std::uint8_t>(p_number / 256u), 0u, p_number % 3u == 0u};
+}
+
+size_t GetNumber(const cxmodel::MoveJournal::Entry& p_entry)
+{
+    return p_entry.m_row * 256u + p_entry.m_column;
+}
+
+// Limits the size files can grow to, so that growing the page file fails:
+class FileSizeLimitRAII
+{
+
+public:
+
+    explicit FileSizeLimitRAII(rlim_t p_limit)
+    {
+        EXPECT_EQ(::getrlimit(RLIMIT_FSIZE, &m_previousLimit), 0);
+
+        // Otherwise, going over the limit kills the process:
+        m_previousHandler = std::signal(SIGXFSZ, SIG_IGN);
+
+        const rlimit limit{p_limit, m_previousLimit.rlim_max};
+        EXPECT_EQ(::setrlimit(RLIMIT_FSIZE, &limit), 0);
+    }
+
+    ~FileSizeLimitRAII()
+    {
+        (void)::setrlimit(RLIMIT_FSIZE, &m_previousLimit);
+        (void)std::signal(SIGXFSZ, m_previousHandler);
+    }
+
+    FileSizeLimitRAII(const FileSizeLimitRAII&) = delete;
+    FileSizeLimitRAII& operator=(const FileSizeLimitRAII&) = delete;
+
+private:
+
+    rlimit m_previousLimit{};
+    void (*m_previousHandler)(int) = SIG_DFL;
+
+};
+
+} // namespace
+
+TEST(MoveJournal, /*DISABLED_*/Constructor_ValidCapacity_EmptyJournal)
+{
+    const cxmodel::MoveJournal journal{5u};
+
+    ASSERT_EQ(journal.GetCapacity(), 5u);
+    ASSERT_EQ(journal.GetNbEntries(), 0u);
+    ASSERT_FALSE(journal.CanUndo());
+    ASSERT_FALSE(journal.CanRedo());
+}
+
+TEST(MoveJournal, /*DISABLED_*/Constructor_ZeroCapacity_AssertionFailed)
+{
+    cxunit::DisableStdStreamsRAII streamDisabler;
+    const cxmodel::MoveJournal journal{0u};
+    ASSERT_ASSERTION_FAILED(streamDisabler);
+}
+
+TEST(MoveJournal, /*DISABLED_*/Record_TurnStart_EntryRecorded)
+{
+    cxmodel::MoveJournal journal{5u};
+
+    journal.Record({3u, 2u, 1u, true});
+
+    ASSERT_EQ(journal.GetNbEntries(), 1u);
+    ASSERT_TRUE(journal.CanUndo());
+
+    const cxmodel::MoveJournal::Entry& entry = journal.Undo();
+    ASSERT_EQ(entry.m_column, 3u);
+    ASSERT_EQ(entry.m_row, 2u);
+    ASSERT_EQ(entry.m_playerIndex, 1u);
+    ASSERT_TRUE(entry.m_isTurnStart);
+}
+
+TEST(MoveJournal, /*DISABLED_*/Record_NotTurnStartOnEmptyJournal_EntryIgnored)
+{
+    cxmodel::MoveJournal journal{5u};
+
+    journal.Record(MakeEntry(1u, false));
+
+    ASSERT_EQ(journal.GetNbEntries(), 0u);
+    ASSERT_FALSE(journal.CanUndo());
+}
+
+TEST(MoveJournal, /*DISABLED_*/Record_AfterUndo_UndoneEntriesForgotten)
+{
+    cxmodel::MoveJournal journal{5u};
+
+    journal.Record(MakeEntry(1u, true));
+    journal.Record(MakeEntry(2u, true));
+    (void)journal.Undo();
+    ASSERT_TRUE(journal.CanRedo());
+
+    journal.Record(MakeEntry(3u, true));
+
+    ASSERT_EQ(journal.GetNbEntries(), 2u);
+    ASSERT_FALSE(journal.CanRedo());
+    ASSERT_EQ(journal.Undo().m_column, 3u);
+    ASSERT_EQ(journal.Undo().m_column, 1u);
+}
+
+TEST(MoveJournal, /*DISABLED_*/Record_FullJournal_OldestTurnForgotten)
+{
+    cxmodel::MoveJournal journal{4u};
+
+    // Two turns of two drops:
+    journal.Record(MakeEntry(0u, true));
+    journal.Record(MakeEntry(1u, false));
+    journal.Record(MakeEntry(2u, true));
+    journal.Record(MakeEntry(3u, false));
+
+    // The whole first turn makes room:
+    journal.Record(MakeEntry(4u, true));
+
+    ASSERT_EQ(journal.GetNbEntries(), 3u);
+    ASSERT_EQ(journal.Undo().m_column, 4u);
+    ASSERT_EQ(journal.Undo().m_column, 3u);
+    ASSERT_EQ(journal.Undo().m_column, 2u);
+    ASSERT_FALSE(journal.CanUndo());
+}
+
+TEST(MoveJournal, /*DISABLED_*/Record_TurnLongerThanCapacity_TurnForgotten)
+{
+    cxmodel::MoveJournal journal{2u};
+
+    journal.Record(MakeEntry(0u, true));
+    journal.Record(MakeEntry(1u, false));
+    journal.Record(MakeEntry(2u, false));
+
+    ASSERT_EQ(journal.GetNbEntries(), 0u);
+    ASSERT_FALSE(journal.CanUndo());
+
+    // The next turn is recorded again:
+    journal.Record(MakeEntry(3u, true));
+    ASSERT_EQ(journal.GetNbEntries(), 1u);
+}
+
+TEST(MoveJournal, /*DISABLED_*/Record_ManyWrapArounds_LastEntriesKept)
+{
+    cxmodel::MoveJournal journal{3u};
+
+    for(std::uint8_t column = 0u; column < 100u; ++column)
+    {
+        journal.Record(MakeEntry(column, true));
+    }
+
+    ASSERT_EQ(journal.GetNbEntries(), 3u);
+    ASSERT_EQ(journal.Undo().m_column, 99u);
+    ASSERT_EQ(journal.Undo().m_column, 98u);
+    ASSERT_EQ(journal.Undo().m_column, 97u);
+    ASSERT_FALSE(journal.CanUndo());
+}
+
+TEST(MoveJournal, /*DISABLED_*/Redo_UndoneEntries_RedoneInOrder)
+{
+    cxmodel::MoveJournal journal{5u};
+
+    journal.Record(MakeEntry(1u, true));
+    journal.Record(MakeEntry(2u, false));
+    (void)journal.Undo();
+    (void)journal.Undo();
+
+    ASSERT_TRUE(journal.CanRedo());
+    ASSERT_EQ(journal.GetNextRedo().m_column, 1u);
+    ASSERT_EQ(journal.Redo().m_column, 1u);
+    ASSERT_FALSE(journal.GetNextRedo().m_isTurnStart);
+    ASSERT_EQ(journal.Redo().m_column, 2u);
+    ASSERT_FALSE(journal.CanRedo());
+}
+
+TEST(MoveJournal, /*DISABLED_*/Undo_NothingToUndo_AssertionFailed)
+{
+    cxmodel::MoveJournal journal{5u};
+
+    cxunit::DisableStdStreamsRAII streamDisabler;
+    (void)journal.Undo();
+    ASSERT_ASSERTION_FAILED(streamDisabler);
+}
+
+TEST(MoveJournal, /*DISABLED_*/Redo_NothingToRedo_AssertionFailed)
+{
+    cxmodel::MoveJournal journal{5u};
+    journal.Record(MakeEntry(1u, true));
+
+    cxunit::DisableStdStreamsRAII streamDisabler;
+    (void)journal.Redo();
+    ASSERT_ASSERTION_FAILED(streamDisabler);
+}
+
+TEST(MoveJournal, /*DISABLED_*/Clear_Entries_JournalEmptied)
+{
+    cxmodel::MoveJournal journal{5u};
+    journal.Record(MakeEntry(1u, true));
+    journal.Record(MakeEntry(2u, true));
+    (void)journal.Undo();
+
+    journal.Clear();
+
+    ASSERT_EQ(journal.GetNbEntries(), 0u);
+    ASSERT_FALSE(journal.CanUndo());
+    ASSERT_FALSE(journal.CanRedo());
+}
+
+TEST(MoveJournal, /*DISABLED_*/Constructor_PageFile_PagedJournal)
+{
+    const cxmodel::MoveJournal journal{4u, MakePageFile()};
+
+    ASSERT_TRUE(journal.IsPaged());
+    ASSERT_EQ(journal.GetCapacity(), 4u);
+    ASSERT_EQ(journal.GetNbEntries(), 0u);
+}
+
+TEST(MoveJournal, /*DISABLED_*/Record_PagedJournalFull_NothingForgotten)
+{
+    cxmodel::MoveJournal journal{4u, MakePageFile()};
+
+    for(size_t number = 0u; number < 5000u; ++number)
+    {
+        journal.Record(MakeNumberedEntry(number));
+    }
+
+    ASSERT_EQ(journal.GetNbEntries(), 5000u);
+
+    for(size_t number = 5000u; number > 0u; --number)
+    {
+        ASSERT_TRUE(journal.CanUndo());
+        ASSERT_EQ(GetNumber(journal.Undo()), number - 1u);
+    }
+    ASSERT_FALSE(journal.CanUndo());
+
+    for(size_t number = 0u; number < 5000u; ++number)
+    {
+        ASSERT_TRUE(journal.CanRedo());
+        ASSERT_EQ(journal.GetNextRedo().m_isTurnStart, number % 3u == 0u);
+        ASSERT_EQ(GetNumber(journal.Redo()), number);
+    }
+    ASSERT_FALSE(journal.CanRedo());
+}
+
+TEST(MoveJournal, /*DISABLED_*/Record_AfterUndoPastMemory_UndoneEntriesForgotten)
+{
+    cxmodel::MoveJournal journal{4u, MakePageFile()};
+
+    for(size_t number = 0u; number < 20u; ++number)
+    {
+        journal.Record(MakeNumberedEntry(number));
+    }
+
+    // Back to the drop 9, which was paged out:
+    for(size_t number = 0u; number < 11u; ++number)
+    {
+        (void)journal.Undo();
+    }
+    journal.Record(MakeNumberedEntry(30u));
+
+    ASSERT_EQ(journal.GetNbEntries(), 10u);
+    ASSERT_FALSE(journal.CanRedo());
+    ASSERT_EQ(GetNumber(journal.Undo()), 30u);
+    for(size_t number = 9u; number > 0u; --number)
+    {
+        ASSERT_EQ(GetNumber(journal.Undo()), number - 1u);
+    }
+    ASSERT_FALSE(journal.CanUndo());
+}
+
+TEST(MoveJournal, /*DISABLED_*/Undo_BackAndForthAcrossPages_EntriesKept)
+{
+    cxmodel::MoveJournal journal{4u, MakePageFile()};
+
+    for(size_t number = 0u; number < 10u; ++number)
+    {
+        journal.Record(MakeNumberedEntry(number));
+    }
+
+    // Undoing and redoing around a page boundary:
+    for(size_t round = 0u; round < 3u; ++round)
+    {
+        for(size_t number = 10u; number > 3u; --number)
+        {
+            ASSERT_EQ(GetNumber(journal.Undo()), number - 1u);
+        }
+        for(size_t number = 3u; number < 10u; ++number)
+        {
+            ASSERT_EQ(GetNumber(journal.Redo()), number);
+        }
+    }
+}
+
+TEST(MoveJournal, /*DISABLED_*/Clear_PagedJournal_JournalEmptiedAndStillPaged)
+{
+    cxmodel::MoveJournal journal{4u, MakePageFile()};
+    for(size_t number = 0u; number < 10u; ++number)
+    {
+        journal.Record(MakeNumberedEntry(number));
+    }
+
+    journal.Clear();
+
+    ASSERT_EQ(journal.GetNbEntries(), 0u);
+    ASSERT_FALSE(journal.CanUndo());
+    ASSERT_TRUE(journal.IsPaged());
+}
+
+TEST(MoveJournal, /*DISABLED_*/Record_PageFileCantGrow_UndoStopsOnTurnStart)
+{
+    cxmodel::MoveJournal journal{10u, MakePageFile()};
+
+    // Drops are paged out five at a time, which does not line up with the turns of three drops:
+    size_t number = 0u;
+    {
+        const FileSizeLimitRAII fileSizeLimit{32768u};
+        while(journal.IsPaged())
+        {
+            journal.Record(MakeNumberedEntry(number));
+            ++number;
+        }
+    }
+
+    ASSERT_TRUE(journal.CanUndo());
+    cxmodel::MoveJournal::Entry lastUndone{};
+    size_t expectedNumber = number;
+    while(journal.CanUndo())
+    {
+        lastUndone = journal.Undo();
+        ASSERT_EQ(GetNumber(lastUndone), --expectedNumber);
+    }
+    ASSERT_TRUE(lastUndone.m_isTurnStart);
+}
@@ -70,11 +70,14 @@ TEST(NewGameInformation, /*DISABLED*/MoveConstructor_OtherWithStdMove_OtherMoved
     movedFrom.m_players.push_back(cxmodel::CreatePlayer("John", cxmodel::MakeRed(), cxmodel::PlayerType::HUMAN));
     movedFrom.m_players.push_back(cxmodel::CreatePlayer("Doe", cxmodel::MakeBlue(), cxmodel::PlayerType::HUMAN));
 
+    movedFrom.m_seed = 42u;
+
     cxmodel::NewGameInformation movedTo{std::move(movedFrom)};
 
     ASSERT_TRUE(movedTo.m_gridHeight == 6u);
     ASSERT_TRUE(movedTo.m_gridWidth == 7u);
     ASSERT_TRUE(movedTo.m_inARowValue == 4u);
+    ASSERT_TRUE(movedTo.m_seed == 42u);
 
     ASSERT_TRUE(movedTo.m_players.size() == 2u);
 }
@@ -154,6 +157,18 @@ TEST(NewGameInformation, /*DISABLED_*/OperatorEqual_DifferentInARowValue_Returns
     ASSERT_FALSE(gameInfo1 == gameInfo2);
 }
 
+TEST(NewGameInformation, /*DISABLED_*/OperatorEqual_DifferentSeed_ReturnsFalse)
+{
+    const PlayerCreationInfo player1{"John Doe", cxmodel::MakeRed()};
+    const PlayerCreationInfo player2{"Jane Doe", cxmodel::MakeBlue()};
+
+    cxmodel::NewGameInformation gameInfo1 = MakeNewGameInformation(6, 7, 4, {player1, player2});
+    cxmodel::NewGameInformation gameInfo2 = MakeNewGameInformation(6, 7, 4, {player1, player2});
+    gameInfo2.m_seed = 42u;
+
+    ASSERT_FALSE(gameInfo1 == gameInfo2);
+}
+
 TEST(NewGameInformation, /*DISABLED_*/OperatorEqual_DifferentPlayers_ReturnsFalse)
 {
     const PlayerCreationInfo player1{"Player1", cxmodel::MakeRed()};
@@ -167,6 +182,20 @@ TEST(NewGameInformation, /*DISABLED_*/OperatorEqual_DifferentPlayers_ReturnsFals
     ASSERT_FALSE(gameInfo1 == gameInfo2);
 }
 
+TEST(NewGameInformation, /*DISABLED_*/OperatorEqual_DifferentBotSettings_ReturnsFalse)
+{
+    cxmodel::BotSettings settings;
+    settings.m_budget = 250u;
+
+    cxmodel::NewGameInformation gameInfo1 = MakeNewGameInformation(6, 7, 4, {{"Player1", cxmodel::MakeRed()}});
+    gameInfo1.m_players.push_back(cxmodel::CreatePlayer("Bot", cxmodel::MakeBlue(), cxmodel::PlayerType::BOT));
+
+    cxmodel::NewGameInformation gameInfo2 = MakeNewGameInformation(6, 7, 4, {{"Player1", cxmodel::MakeRed()}});
+    gameInfo2.m_players.push_back(cxmodel::CreatePlayer("Bot", cxmodel::MakeBlue(), cxmodel::PlayerType::BOT, settings));
+
+    ASSERT_FALSE(gameInfo1 == gameInfo2);
+}
+
 TEST(NewGameInformation, /*DISABLED_*/OperatorNotEqual_TwoSameInformations_ReturnsFalse)
 {
     const PlayerCreationInfo player1{"John Doe", cxmodel::MakeRed()};
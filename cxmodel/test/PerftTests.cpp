@@ -0,0 +1,158 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file PerftTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <cxmodel/Perft.h>
+
+namespace
+{
+
+cxmodel::BoardSnapshot MakeClassicPosition(const std::vector<size_t>& p_columns)
+{
+    cxmodel::BoardSnapshot snapshot{6u, 7u, 4u, 2u};
+    for(const size_t column : p_columns)
+    {
+        snapshot.DropChip(column);
+    }
+
+    return snapshot;
+}
+
+} // namespace
+
+TEST(Perft, /*DISABLED_*/Perft_DepthZero_PositionIsOnlyNode)
+{
+    const cxmodel::PerftResult result = cxmodel::Perft(MakeClassicPosition({}), 0u);
+
+    ASSERT_EQ(result.m_nbNodes, 1u);
+    ASSERT_EQ(result.m_nbWins, 0u);
+    ASSERT_EQ(result.m_nbTies, 0u);
+}
+
+// Known-good counts for the classic 7x6 board. Full columns start to matter at depth 7, as do
+// wins, after which nothing is dropped anymore:
+TEST(Perft, /*DISABLED_*/Perft_Classic7By6Board_KnownCounts)
+{
+    const cxmodel::BoardSnapshot position = MakeClassicPosition({});
+
+    ASSERT_EQ(cxmodel::Perft(position, 1u).m_nbNodes, 7u);
+    ASSERT_EQ(cxmodel::Perft(position, 2u).m_nbNodes, 49u);
+    ASSERT_EQ(cxmodel::Perft(position, 3u).m_nbNodes, 343u);
+    ASSERT_EQ(cxmodel::Perft(position, 4u).m_nbNodes, 2401u);
+    ASSERT_EQ(cxmodel::Perft(position, 5u).m_nbNodes, 16807u);
+    ASSERT_EQ(cxmodel::Perft(position, 6u).m_nbNodes, 117649u);
+
+    const cxmodel::PerftResult depth7 = cxmodel::Perft(position, 7u);
+    ASSERT_EQ(depth7.m_nbNodes, 823536u);
+    ASSERT_EQ(depth7.m_nbWins, 13032u);
+    ASSERT_EQ(depth7.m_nbTies, 0u);
+
+    const cxmodel::PerftResult depth8 = cxmodel::Perft(position, 8u);
+    ASSERT_EQ(depth8.m_nbNodes, 5673234u);
+    ASSERT_EQ(depth8.m_nbWins, 57462u);
+    ASSERT_EQ(depth8.m_nbTies, 0u);
+}
+
+TEST(Perft, /*DISABLED_*/Perft_UnwinnableBoard_AllSequencesAreTies)
+{
+    // Three in a row can never fit on a 2x2 board. Filling it takes two drops in each column,
+    // in any order:
+    const cxmodel::BoardSnapshot position{2u, 2u, 3u, 2u};
+
+    const cxmodel::PerftResult result = cxmodel::Perft(position, 5u);
+
+    ASSERT_EQ(result.m_nbNodes, 0u);
+    ASSERT_EQ(result.m_nbWins, 0u);
+    ASSERT_EQ(result.m_nbTies, 6u);
+}
+
+TEST(Perft, /*DISABLED_*/Perft_FullBoard_NoNodes)
+{
+    cxmodel::BoardSnapshot position{2u, 2u, 3u, 2u};
+    for(const size_t column : {0u, 0u, 1u, 1u})
+    {
+        position.DropChip(column);
+    }
+
+    ASSERT_EQ(cxmodel::Perft(position, 1u).m_nbNodes, 0u);
+}
+
+TEST(Perft, /*DISABLED_*/ReferencePerft_Classic7By6Board_SameCountsAsPerft)
+{
+    const cxmodel::BoardSnapshot position = MakeClassicPosition({});
+
+    for(size_t depth = 0u; depth <= 6u; ++depth)
+    {
+        ASSERT_EQ(cxmodel::ReferencePerft(position, depth), cxmodel::Perft(position, depth));
+    }
+}
+
+TEST(Perft, /*DISABLED_*/ReferencePerft_PositionWithThreats_SameCountsAsPerft)
+{
+    // Both players have open lines of three, so many sequences end early:
+    const cxmodel::BoardSnapshot position = MakeClassicPosition({3u, 3u, 2u, 2u, 4u, 4u, 0u, 6u});
+
+    const cxmodel::PerftResult expected = cxmodel::Perft(position, 5u);
+    ASSERT_GT(expected.m_nbWins, 0u);
+
+    ASSERT_EQ(cxmodel::ReferencePerft(position, 5u), expected);
+}
+
+TEST(Perft, /*DISABLED_*/ReferencePerft_ThreePlayers_SameCountsAsPerft)
+{
+    cxmodel::BoardSnapshot position{6u, 7u, 3u, 3u};
+    for(const size_t column : {3u, 2u, 4u, 3u, 2u, 4u})
+    {
+        position.DropChip(column);
+    }
+
+    const cxmodel::PerftResult expected = cxmodel::Perft(position, 4u);
+    ASSERT_GT(expected.m_nbWins, 0u);
+
+    ASSERT_EQ(cxmodel::ReferencePerft(position, 4u), expected);
+}
+
+TEST(Perft, /*DISABLED_*/ReferencePerft_UnwinnableBoard_SameCountsAsPerft)
+{
+    const cxmodel::BoardSnapshot position{2u, 2u, 3u, 2u};
+
+    ASSERT_EQ(cxmodel::ReferencePerft(position, 5u), cxmodel::Perft(position, 5u));
+}
+
+TEST(Perft, /*DISABLED_*/GetNodesPerSecond_NoTimeSpent_ReturnsZero)
+{
+    cxmodel::PerftResult result;
+    result.m_nbNodes = 1000u;
+
+    ASSERT_EQ(cxmodel::GetNodesPerSecond(result), 0u);
+}
+
+TEST(Perft, /*DISABLED_*/GetNodesPerSecond_TimeSpent_ReturnsNodesPerSecond)
+{
+    cxmodel::PerftResult result;
+    result.m_nbNodes = 1000u;
+    result.m_duration = std::chrono::microseconds{250000};
+
+    ASSERT_EQ(cxmodel::GetNodesPerSecond(result), 4000u);
+}
@@ -0,0 +1,82 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file PositionKeyTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <set>
+
+#include <gtest/gtest.h>
+
+#include <cxmodel/PositionKey.h>
+
+TEST(PositionKey, /*DISABLED_*/MakePositionKeyComponent_AllPositionsAndPieces_AllComponentsDiffer)
+{
+    std::set<cxmodel::PositionKey> components;
+
+    for(size_t row = 0u; row < 64u; ++row)
+    {
+        for(size_t column = 0u; column < 64u; ++column)
+        {
+            for(std::uint64_t piece = 1u; piece <= 10u; ++piece)
+            {
+                components.insert(cxmodel::MakePositionKeyComponent(row, column, piece));
+            }
+        }
+    }
+
+    ASSERT_EQ(components.size(), 64u * 64u * 10u);
+}
+
+TEST(PositionKey, /*DISABLED_*/MakePositionKeyComponent_SameInputs_SameComponent)
+{
+    ASSERT_EQ(cxmodel::MakePositionKeyComponent(3u, 4u, 2u), cxmodel::MakePositionKeyComponent(3u, 4u, 2u));
+    ASSERT_NE(cxmodel::MakePositionKeyComponent(3u, 4u, 2u), cxmodel::MakePositionKeyComponent(4u, 3u, 2u));
+}
+
+TEST(PositionKey, /*DISABLED_*/MakeCanonicalPositionKey_MirroredKeySmaller_MirroredKeyUsed)
+{
+    const cxmodel::CanonicalPositionKey key = cxmodel::MakeCanonicalPositionKey(10u, 5u);
+
+    ASSERT_EQ(key.m_key, 5u);
+    ASSERT_TRUE(key.m_isMirrored);
+}
+
+TEST(PositionKey, /*DISABLED_*/MakeCanonicalPositionKey_SymmetricPosition_NotMirrored)
+{
+    const cxmodel::CanonicalPositionKey key = cxmodel::MakeCanonicalPositionKey(7u, 7u);
+
+    ASSERT_EQ(key.m_key, 7u);
+    ASSERT_FALSE(key.m_isMirrored);
+}
+
+TEST(PositionKey, /*DISABLED_*/RemapColumn_Mirrored_ColumnMirrored)
+{
+    const cxmodel::CanonicalPositionKey mirrored{1u, true};
+    const cxmodel::CanonicalPositionKey notMirrored{1u, false};
+
+    ASSERT_EQ(cxmodel::RemapColumn(0u, mirrored, 7u), 6u);
+    ASSERT_EQ(cxmodel::RemapColumn(3u, mirrored, 7u), 3u);
+    ASSERT_EQ(cxmodel::RemapColumn(6u, mirrored, 8u), 1u);
+    ASSERT_EQ(cxmodel::RemapColumn(2u, notMirrored, 7u), 2u);
+
+    // Remapping twice gives back the original column:
+    ASSERT_EQ(cxmodel::RemapColumn(cxmodel::RemapColumn(5u, mirrored, 9u), mirrored, 9u), 5u);
+}
@@ -0,0 +1,148 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file RandomNumberGeneratorTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <array>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <cxunit/DisableStdStreamsRAII.h>
+#include <cxmodel/RandomNumberGenerator.h>
+
+TEST(RandomNumberGenerator, /*DISABLED_*/OperatorCall_Seed42_ReferenceNumbers)
+{
+    // From the reference xoshiro256** implementation, seeded with splitmix64:
+    cxmodel::RandomNumberGenerator generator{42u};
+
+    ASSERT_EQ(generator(), 1546998764402558742u);
+    ASSERT_EQ(generator(), 6990951692964543102u);
+    ASSERT_EQ(generator(), 12544586762248559009u);
+}
+
+TEST(RandomNumberGenerator, /*DISABLED_*/OperatorCall_SameSeed_SameNumbers)
+{
+    cxmodel::RandomNumberGenerator first{7u};
+    cxmodel::RandomNumberGenerator second{7u};
+
+    for(size_t index = 0u; index < 100u; ++index)
+    {
+        ASSERT_EQ(first(), second());
+    }
+}
+
+TEST(RandomNumberGenerator, /*DISABLED_*/OperatorCall_DifferentSeeds_DifferentNumbers)
+{
+    cxmodel::RandomNumberGenerator first{7u};
+    cxmodel::RandomNumberGenerator second{8u};
+
+    ASSERT_NE(first(), second());
+}
+
+TEST(RandomNumberGenerator, /*DISABLED_*/Jump_Seed42_ReferenceNumber)
+{
+    cxmodel::RandomNumberGenerator generator{42u};
+    generator.Jump();
+
+    ASSERT_EQ(generator(), 5766981335298035530u);
+}
+
+TEST(RandomNumberGenerator, /*DISABLED_*/Constructor_StreamIndex_StartsThatManyJumpsAhead)
+{
+    cxmodel::RandomNumberGenerator jumped{42u};
+    jumped.Jump();
+    jumped.Jump();
+
+    cxmodel::RandomNumberGenerator stream{42u, 2u};
+
+    ASSERT_EQ(stream(), jumped());
+}
+
+TEST(RandomNumberGenerator, /*DISABLED_*/Below_SmallBound_AllValuesDrawnWithinBound)
+{
+    cxmodel::RandomNumberGenerator generator{3u};
+
+    std::array<size_t, 7u> counts{};
+    for(size_t index = 0u; index < 7000u; ++index)
+    {
+        const size_t value = generator.Below(counts.size());
+        ASSERT_LT(value, counts.size());
+        ++counts[value];
+    }
+
+    for(const size_t count : counts)
+    {
+        ASSERT_GT(count, 800u);
+        ASSERT_LT(count, 1200u);
+    }
+}
+
+TEST(RandomNumberGenerator, /*DISABLED_*/Below_OneAsBound_ReturnsZero)
+{
+    cxmodel::RandomNumberGenerator generator{3u};
+
+    ASSERT_EQ(generator.Below(1u), 0u);
+}
+
+TEST(RandomNumberGenerator, /*DISABLED_*/Below_ZeroAsBound_AssertsAndReturnsZero)
+{
+    cxmodel::RandomNumberGenerator generator{3u};
+
+    cxunit::DisableStdStreamsRAII streamDisabler;
+    const size_t value = generator.Below(0u);
+    ASSERT_ASSERTION_FAILED(streamDisabler);
+
+    ASSERT_EQ(value, 0u);
+}
+
+TEST(RandomNumberGenerator, /*DISABLED_*/Generator_StandardDistribution_Usable)
+{
+    cxmodel::RandomNumberGenerator generator{3u};
+    std::uniform_int_distribution<int> distribution{1, 6};
+
+    const int value = distribution(generator);
+
+    ASSERT_GE(value, 1);
+    ASSERT_LE(value, 6);
+}
+
+TEST(RandomNumberGenerator, /*DISABLED_*/MixSeed_DifferentValues_DifferentSeeds)
+{
+    ASSERT_NE(cxmodel::MixSeed(1u, 0u), cxmodel::MixSeed(1u, 1u));
+    ASSERT_NE(cxmodel::MixSeed(1u, 0u), cxmodel::MixSeed(2u, 0u));
+    ASSERT_EQ(cxmodel::MixSeed(1u, 5u), cxmodel::MixSeed(1u, 5u));
+}
+
+TEST(RandomNumberGenerator, /*DISABLED_*/MakePlayerRandomNumberGenerator_TwoPlayers_DifferentStreams)
+{
+    cxmodel::RandomNumberGenerator first = cxmodel::MakePlayerRandomNumberGenerator(42u, 0u);
+    cxmodel::RandomNumberGenerator second = cxmodel::MakePlayerRandomNumberGenerator(42u, 1u);
+    cxmodel::RandomNumberGenerator game{42u};
+
+    const std::uint64_t firstNumber = first();
+    const std::uint64_t secondNumber = second();
+    const std::uint64_t gameNumber = game();
+
+    ASSERT_NE(firstNumber, secondNumber);
+    ASSERT_NE(firstNumber, gameNumber);
+    ASSERT_NE(secondNumber, gameNumber);
+}
@@ -0,0 +1,196 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file ReplayTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <cxunit/DisableStdStreamsRAII.h>
+#include <cxunit/TemporaryFile.h>
+#include <cxmodel/NewGameInformation.h>
+#include <cxmodel/Replay.h>
+#include <cxmodel/SavedGame.h>
+
+namespace
+{
+
+// A long tie on a 6x7 board: columns are filled two by two, so that no one wins:
+const std::vector<size_t> TIE_MOVES{0u, 1u, 0u, 1u, 0u, 1u, 1u, 0u, 1u, 0u, 1u, 0u,
+                                    2u, 3u, 2u, 3u, 2u, 3u, 3u, 2u, 3u, 2u, 3u, 2u,
+                                    4u, 5u, 4u, 5u, 4u, 5u, 5u, 4u, 5u, 4u, 5u, 4u,
+                                    6u, 6u, 6u, 6u, 6u, 6u};
+
+cxmodel::BoardSnapshot MakeBoard(const std::vector<size_t>& p_moves, size_t p_nbMoves)
+{
+    cxmodel::BoardSnapshot board{6u, 7u, 4u, 2u};
+    for(size_t index = 0u; index < p_nbMoves; ++index)
+    {
+        board.DropChip(p_moves[index]);
+    }
+
+    return board;
+}
+
+void ExpectSameBoard(const cxmodel::BoardSnapshot& p_actual, const cxmodel::BoardSnapshot& p_expected)
+{
+    ASSERT_EQ(p_actual.GetNbDrops(), p_expected.GetNbDrops());
+    ASSERT_EQ(p_actual.GetActivePlayerIndex(), p_expected.GetActivePlayerIndex());
+    ASSERT_EQ(p_actual.GetCanonicalKey().m_key, p_expected.GetCanonicalKey().m_key);
+
+    for(size_t column = 0u; column < p_expected.GetNbColumns(); ++column)
+    {
+        for(size_t row = 0u; row < p_expected.GetNbRows(); ++row)
+        {
+            ASSERT_EQ(p_actual.GetPlayerIndex(row, column), p_expected.GetPlayerIndex(row, column));
+        }
+    }
+}
+
+} // namespace
+
+TEST(Replay, /*DISABLED_*/Constructor_ValidMoves_ReplayAtFirstPly)
+{
+    const cxmodel::Replay replay{6u, 7u, 4u, 2u, TIE_MOVES};
+
+    ASSERT_EQ(replay.GetNbPlies(), TIE_MOVES.size());
+    ASSERT_EQ(replay.GetPly(), 0u);
+    ASSERT_EQ(replay.GetMove(12u), 2u);
+    ASSERT_EQ(replay.GetBoard().GetNbDrops(), 0u);
+}
+
+TEST(Replay, /*DISABLED_*/Constructor_MoveInFullColumn_MovesTruncated)
+{
+    const cxmodel::Replay replay{6u, 7u, 4u, 2u, {0u, 1u, 0u, 1u, 1u, 0u, 1u, 0u, 0u, 1u, 0u, 0u, 3u}};
+
+    ASSERT_EQ(replay.GetNbPlies(), 11u);
+}
+
+TEST(Replay, /*DISABLED_*/Constructor_MoveOutsideBoard_MovesTruncated)
+{
+    const cxmodel::Replay replay{6u, 7u, 4u, 2u, {0u, 7u, 1u}};
+
+    ASSERT_EQ(replay.GetNbPlies(), 1u);
+}
+
+TEST(Replay, /*DISABLED_*/Constructor_MovesAfterWin_MovesTruncated)
+{
+    const cxmodel::Replay replay{6u, 7u, 4u, 2u, {0u, 1u, 0u, 1u, 0u, 1u, 0u, 1u, 2u}};
+
+    ASSERT_EQ(replay.GetNbPlies(), 7u);
+}
+
+TEST(Replay, /*DISABLED_*/Constructor_InvalidKeyframeInterval_AssertionFailed)
+{
+    cxunit::DisableStdStreamsRAII streamDisabler;
+
+    const cxmodel::Replay replay{6u, 7u, 4u, 2u, TIE_MOVES, 0u};
+
+    ASSERT_PRECONDITION_FAILED(streamDisabler);
+}
+
+TEST(Replay, /*DISABLED_*/StepForward_AllPlies_BoardFollowsMoves)
+{
+    cxmodel::Replay replay{6u, 7u, 4u, 2u, TIE_MOVES};
+
+    for(size_t ply = 1u; ply <= TIE_MOVES.size(); ++ply)
+    {
+        ASSERT_TRUE(replay.StepForward());
+        ASSERT_EQ(replay.GetPly(), ply);
+        ExpectSameBoard(replay.GetBoard(), MakeBoard(TIE_MOVES, ply));
+    }
+
+    ASSERT_TRUE(replay.GetBoard().IsFull());
+    ASSERT_FALSE(replay.StepForward());
+    ASSERT_EQ(replay.GetPly(), TIE_MOVES.size());
+}
+
+TEST(Replay, /*DISABLED_*/StepBack_AllPlies_BoardFollowsMoves)
+{
+    cxmodel::Replay replay{6u, 7u, 4u, 2u, TIE_MOVES};
+    replay.Seek(TIE_MOVES.size());
+
+    for(size_t ply = TIE_MOVES.size(); ply > 0u; --ply)
+    {
+        ASSERT_TRUE(replay.StepBack());
+        ASSERT_EQ(replay.GetPly(), ply - 1u);
+        ExpectSameBoard(replay.GetBoard(), MakeBoard(TIE_MOVES, ply - 1u));
+    }
+
+    ASSERT_FALSE(replay.StepBack());
+    ASSERT_EQ(replay.GetPly(), 0u);
+}
+
+TEST(Replay, /*DISABLED_*/Seek_AnyPlyFromAnyPly_BoardAtPly)
+{
+    // Small intervals exercise the keyframes, and large ones stepping only:
+    for(const size_t keyframeInterval : {1u, 5u, 32u, 100u})
+    {
+        cxmodel::Replay replay{6u, 7u, 4u, 2u, TIE_MOVES, keyframeInterval};
+
+        for(size_t from = 0u; from <= TIE_MOVES.size(); from += 3u)
+        {
+            for(size_t to = 0u; to <= TIE_MOVES.size(); ++to)
+            {
+                replay.Seek(from);
+                replay.Seek(to);
+                ASSERT_EQ(replay.GetPly(), to);
+                ExpectSameBoard(replay.GetBoard(), MakeBoard(TIE_MOVES, to));
+            }
+        }
+    }
+}
+
+TEST(Replay, /*DISABLED_*/Seek_PastLastPly_AssertionFailed)
+{
+    cxmodel::Replay replay{6u, 7u, 4u, 2u, TIE_MOVES};
+
+    cxunit::DisableStdStreamsRAII streamDisabler;
+    replay.Seek(TIE_MOVES.size() + 1u);
+
+    ASSERT_PRECONDITION_FAILED(streamDisabler);
+    ASSERT_EQ(replay.GetPly(), 0u);
+}
+
+TEST(Replay, /*DISABLED_*/MakeReplay_SavedGame_MovesReplayed)
+{
+    const cxunit::TemporaryFile file{"cxmodel_replay.cxsg"};
+
+    cxmodel::NewGameInformation gameInformation;
+    gameInformation.m_gridWidth = 7u;
+    gameInformation.m_gridHeight = 6u;
+    gameInformation.m_inARowValue = 4u;
+    gameInformation.m_seed = 1u;
+    gameInformation.m_players.push_back(cxmodel::CreatePlayer("P1", cxmodel::MakeRed(), cxmodel::PlayerType::HUMAN));
+    gameInformation.m_players.push_back(cxmodel::CreatePlayer("P2", cxmodel::MakeBlue(), cxmodel::PlayerType::HUMAN));
+
+    cxmodel::SavedGame savedGame;
+    ASSERT_TRUE(savedGame.Create(file.GetPath(), gameInformation).IsSuccess());
+    for(const size_t column : TIE_MOVES)
+    {
+        ASSERT_TRUE(savedGame.Append(column).IsSuccess());
+    }
+
+    cxmodel::Replay replay = cxmodel::MakeReplay(savedGame, 8u);
+    ASSERT_EQ(replay.GetNbPlies(), TIE_MOVES.size());
+
+    replay.Seek(20u);
+    ExpectSameBoard(replay.GetBoard(), MakeBoard(TIE_MOVES, 20u));
+}
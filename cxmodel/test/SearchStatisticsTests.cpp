@@ -0,0 +1,116 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file SearchStatisticsTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include <cxmodel/SearchStatistics.h>
+
+namespace
+{
+
+cxmodel::SearchStatistics MakeStatistics(size_t p_nbNodes, long p_nbMicroseconds, size_t p_depth)
+{
+    cxmodel::SearchStatistics statistics;
+    statistics.m_nbComputations = 1u;
+    statistics.m_nbNodes = p_nbNodes;
+    statistics.m_duration = std::chrono::microseconds{p_nbMicroseconds};
+    statistics.m_depth = p_depth;
+    statistics.m_selectiveDepth = p_depth;
+
+    return statistics;
+}
+
+} // namespace
+
+TEST(SearchStatistics, /*DISABLED_*/GetNodesPerSecond_NoTimeSpent_ReturnsZero)
+{
+    ASSERT_EQ(cxmodel::GetNodesPerSecond(MakeStatistics(1000u, 0, 3u)), 0u);
+}
+
+TEST(SearchStatistics, /*DISABLED_*/GetNodesPerSecond_TimeSpent_ReturnsNodesPerSecond)
+{
+    ASSERT_EQ(cxmodel::GetNodesPerSecond(MakeStatistics(1000u, 500000, 3u)), 2000u);
+}
+
+TEST(SearchStatistics, /*DISABLED_*/GetBranchingFactor_NoDepth_ReturnsZero)
+{
+    ASSERT_EQ(cxmodel::GetBranchingFactor(MakeStatistics(1000u, 1000, 0u)), 0.0);
+}
+
+TEST(SearchStatistics, /*DISABLED_*/GetBranchingFactor_UniformTree_ReturnsNumberOfChildren)
+{
+    ASSERT_NEAR(cxmodel::GetBranchingFactor(MakeStatistics(343u, 1000, 3u)), 7.0, 1e-9);
+}
+
+TEST(SearchStatistics, /*DISABLED_*/GetBranchingFactor_Aggregated_NodesAveragedOverComputations)
+{
+    cxmodel::SearchStatistics aggregate;
+    cxmodel::Accumulate(aggregate, MakeStatistics(343u, 1000, 3u));
+    cxmodel::Accumulate(aggregate, MakeStatistics(343u, 1000, 3u));
+
+    ASSERT_NEAR(cxmodel::GetBranchingFactor(aggregate), 7.0, 1e-9);
+}
+
+TEST(SearchStatistics, /*DISABLED_*/Accumulate_TwoComputations_CountersSummedAndDepthsMaxedOut)
+{
+    cxmodel::SearchStatistics first = MakeStatistics(100u, 1000, 3u);
+    first.m_nbTTProbes = 10u;
+    first.m_nbTTHits = 5u;
+    first.m_nbCutoffs = 2u;
+    first.m_principalVariation = {3u, 3u};
+
+    cxmodel::SearchStatistics second = MakeStatistics(200u, 3000, 2u);
+    second.m_selectiveDepth = 4u;
+    second.m_nbTTProbes = 20u;
+    second.m_nbTTHits = 6u;
+    second.m_nbCutoffs = 7u;
+    second.m_principalVariation = {1u};
+
+    cxmodel::SearchStatistics aggregate;
+    cxmodel::Accumulate(aggregate, first);
+    cxmodel::Accumulate(aggregate, second);
+
+    ASSERT_EQ(aggregate.m_nbComputations, 2u);
+    ASSERT_EQ(aggregate.m_nbNodes, 300u);
+    ASSERT_EQ(aggregate.m_duration, std::chrono::microseconds{4000});
+    ASSERT_EQ(aggregate.m_depth, 3u);
+    ASSERT_EQ(aggregate.m_selectiveDepth, 4u);
+    ASSERT_EQ(aggregate.m_nbTTProbes, 30u);
+    ASSERT_EQ(aggregate.m_nbTTHits, 11u);
+    ASSERT_EQ(aggregate.m_nbCutoffs, 9u);
+    ASSERT_EQ(aggregate.m_principalVariation, std::vector<size_t>{1u});
+}
+
+TEST(SearchStatistics, /*DISABLED_*/StreamOutputOperator_ValidStatistics_AllFieldsWritten)
+{
+    cxmodel::SearchStatistics statistics = MakeStatistics(343u, 1000, 3u);
+    statistics.m_principalVariation = {3u, 2u, 4u};
+
+    std::ostringstream stream;
+    stream << statistics;
+
+    ASSERT_EQ(stream.str(), "computations=1, nodes=343, time=1000us, nps=343000, depth=3, seldepth=3, "
+                            "tt probes=0, tt hits=0, cutoffs=0, branching factor=7.00, pv=3 2 4");
+}
@@ -0,0 +1,241 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file SearchTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include <cxmodel/Search.h>
+
+namespace
+{
+
+cxmodel::BoardSnapshot MakeClassicPosition(const std::vector<size_t>& p_columns)
+{
+    cxmodel::BoardSnapshot snapshot{6u, 7u, 4u, 2u};
+    for(const size_t column : p_columns)
+    {
+        snapshot.DropChip(column);
+    }
+
+    return snapshot;
+}
+
+cxmodel::SearchLimits MakeDepthLimit(size_t p_depth)
+{
+    cxmodel::SearchLimits limits;
+    limits.m_maxDepth = p_depth;
+
+    return limits;
+}
+
+} // namespace
+
+TEST(Search, /*DISABLED_*/Run_ImmediateWin_WinningColumnIsBest)
+{
+    // The first player has three chips on the bottom row, in columns 0 to 2:
+    const cxmodel::BoardSnapshot position = MakeClassicPosition({0u, 0u, 1u, 1u, 2u, 2u});
+
+    const std::atomic<bool> stop{false};
+    cxmodel::Search search;
+    const cxmodel::SearchResult result = search.Run(position, MakeDepthLimit(1u), stop);
+
+    ASSERT_EQ(result.m_depth, 1u);
+    ASSERT_EQ(result.m_bestColumn, 3u);
+    ASSERT_EQ(result.m_columnScores[3u], cxmodel::WIN_SCORE - 1);
+    ASSERT_GT(result.m_statistics.m_nbNodes, 0u);
+}
+
+TEST(Search, /*DISABLED_*/Run_OpponentThreat_BlockingColumnIsBest)
+{
+    // The second player has three chips on the bottom row, in columns 0 to 2, and the
+    // first player must block:
+    const cxmodel::BoardSnapshot position = MakeClassicPosition({6u, 0u, 6u, 1u, 5u, 2u});
+
+    const std::atomic<bool> stop{false};
+    cxmodel::Search search;
+    const cxmodel::SearchResult result = search.Run(position, MakeDepthLimit(2u), stop);
+
+    ASSERT_EQ(result.m_depth, 2u);
+    ASSERT_EQ(result.m_bestColumn, 3u);
+
+    for(size_t column = 0u; column < 7u; ++column)
+    {
+        if(column != 3u)
+        {
+            ASSERT_EQ(result.m_columnScores[column], -(cxmodel::WIN_SCORE - 2));
+        }
+    }
+}
+
+TEST(Search, /*DISABLED_*/Run_FullColumn_NoScoreForColumn)
+{
+    const cxmodel::BoardSnapshot position = MakeClassicPosition({0u, 0u, 0u, 0u, 0u, 0u});
+
+    const std::atomic<bool> stop{false};
+    cxmodel::Search search;
+    const cxmodel::SearchResult result = search.Run(position, MakeDepthLimit(2u), stop);
+
+    ASSERT_EQ(result.m_columnScores[0u], cxmodel::NO_SCORE);
+    ASSERT_NE(result.m_bestColumn, 0u);
+    for(size_t column = 1u; column < 7u; ++column)
+    {
+        ASSERT_NE(result.m_columnScores[column], cxmodel::NO_SCORE);
+    }
+}
+
+TEST(Search, /*DISABLED_*/Run_AlreadyStopped_NoIterationCompleted)
+{
+    const cxmodel::BoardSnapshot position = MakeClassicPosition({});
+
+    const std::atomic<bool> stop{true};
+    cxmodel::Search search;
+    const cxmodel::SearchResult result = search.Run(position, {}, stop);
+
+    ASSERT_EQ(result.m_depth, 0u);
+    ASSERT_FALSE(result.m_isComplete);
+    ASSERT_TRUE(std::all_of(result.m_columnScores.cbegin(),
+                            result.m_columnScores.cend(),
+                            [](int p_score){return p_score == cxmodel::NO_SCORE;}));
+}
+
+TEST(Search, /*DISABLED_*/Run_NodeLimit_StopsBeforeFullDepth)
+{
+    const cxmodel::BoardSnapshot position = MakeClassicPosition({});
+
+    cxmodel::SearchLimits limits;
+    limits.m_maxNodes = 100u;
+
+    const std::atomic<bool> stop{false};
+    cxmodel::Search search;
+    const cxmodel::SearchResult result = search.Run(position, limits, stop);
+
+    // Depth 1 takes 7 nodes and depth 2 takes 49 more, but depth 3 does not fit:
+    ASSERT_EQ(result.m_depth, 2u);
+    ASSERT_FALSE(result.m_isComplete);
+    ASSERT_LE(result.m_statistics.m_nbNodes, 101u);
+}
+
+TEST(Search, /*DISABLED_*/Run_IterationCallback_CalledOncePerCompletedIteration)
+{
+    const cxmodel::BoardSnapshot position = MakeClassicPosition({3u});
+
+    size_t nbCalls = 0u;
+    size_t lastDepth = 0u;
+
+    const std::atomic<bool> stop{false};
+    cxmodel::Search search;
+    const cxmodel::SearchResult result = search.Run(position,
+                                                    MakeDepthLimit(3u),
+                                                    stop,
+                                                    [&nbCalls, &lastDepth](const cxmodel::SearchResult& p_result)
+                                                    {
+                                                        ++nbCalls;
+                                                        lastDepth = p_result.m_depth;
+                                                    });
+
+    ASSERT_EQ(nbCalls, 3u);
+    ASSERT_EQ(lastDepth, 3u);
+    ASSERT_EQ(result.m_depth, 3u);
+}
+
+TEST(Search, /*DISABLED_*/Run_ThreePlayers_OpponentsAssumedToCooperate)
+{
+    // With three players, the first player must block the third player, even if the
+    // second player plays in between:
+    cxmodel::BoardSnapshot position{6u, 7u, 4u, 3u};
+    position.PlaceChip(0u, 2u);
+    position.PlaceChip(1u, 2u);
+    position.PlaceChip(2u, 2u);
+    position.PlaceChip(6u, 1u);
+    position.SetActivePlayerIndex(0u);
+
+    const std::atomic<bool> stop{false};
+    cxmodel::Search search;
+    const cxmodel::SearchResult result = search.Run(position, MakeDepthLimit(3u), stop);
+
+    ASSERT_EQ(result.m_bestColumn, 3u);
+    ASSERT_EQ(result.m_columnScores[0u], -(cxmodel::WIN_SCORE - 3));
+}
+
+TEST(Search, /*DISABLED_*/Run_TranspositionTable_SameScoresWithFewerNodes)
+{
+    const cxmodel::BoardSnapshot position = MakeClassicPosition({3u, 3u, 2u});
+
+    const std::atomic<bool> stop{false};
+    cxmodel::Search searchWithoutTable;
+    const cxmodel::SearchResult withoutTable = searchWithoutTable.Run(position, MakeDepthLimit(6u), stop);
+
+    cxmodel::Search searchWithTable{1u};
+    const cxmodel::SearchResult withTable = searchWithTable.Run(position, MakeDepthLimit(6u), stop);
+
+    ASSERT_EQ(withTable.m_columnScores, withoutTable.m_columnScores);
+    ASSERT_EQ(withTable.m_bestColumn, withoutTable.m_bestColumn);
+    ASSERT_LT(withTable.m_statistics.m_nbNodes, withoutTable.m_statistics.m_nbNodes);
+    ASSERT_GT(withTable.m_statistics.m_nbTTHits, 0u);
+    ASSERT_LE(withTable.m_statistics.m_nbTTHits, withTable.m_statistics.m_nbTTProbes);
+    ASSERT_EQ(withoutTable.m_statistics.m_nbTTProbes, 0u);
+}
+
+TEST(Search, /*DISABLED_*/Run_Statistics_FilledForLastCompletedIteration)
+{
+    const cxmodel::BoardSnapshot position = MakeClassicPosition({3u});
+
+    const std::atomic<bool> stop{false};
+    cxmodel::Search search{1u};
+    const cxmodel::SearchResult result = search.Run(position, MakeDepthLimit(5u), stop);
+
+    const cxmodel::SearchStatistics& statistics = result.m_statistics;
+    ASSERT_EQ(statistics.m_nbComputations, 1u);
+    ASSERT_EQ(statistics.m_depth, 5u);
+    ASSERT_EQ(statistics.m_selectiveDepth, 5u);
+    ASSERT_GT(statistics.m_nbCutoffs, 0u);
+
+    // The principal variation starts with the best column, and is followed in the table:
+    ASSERT_GT(statistics.m_principalVariation.size(), 1u);
+    ASSERT_LE(statistics.m_principalVariation.size(), 5u);
+    ASSERT_EQ(statistics.m_principalVariation.front(), result.m_bestColumn);
+}
+
+TEST(Search, /*DISABLED_*/Run_NoTranspositionTable_PrincipalVariationIsBestColumn)
+{
+    const cxmodel::BoardSnapshot position = MakeClassicPosition({3u});
+
+    const std::atomic<bool> stop{false};
+    cxmodel::Search search;
+    const cxmodel::SearchResult result = search.Run(position, MakeDepthLimit(3u), stop);
+
+    ASSERT_EQ(result.m_statistics.m_principalVariation, std::vector<size_t>{result.m_bestColumn});
+}
+
+TEST(Search, /*DISABLED_*/Run_ForcedWinWithTranspositionTable_PrincipalVariationEndsWithWin)
+{
+    // The first player has three chips on the bottom row, in columns 0 to 2:
+    const cxmodel::BoardSnapshot position = MakeClassicPosition({0u, 0u, 1u, 1u, 2u, 2u});
+
+    const std::atomic<bool> stop{false};
+    cxmodel::Search search{1u};
+    const cxmodel::SearchResult result = search.Run(position, MakeDepthLimit(4u), stop);
+
+    ASSERT_EQ(result.m_statistics.m_principalVariation, std::vector<size_t>{3u});
+}
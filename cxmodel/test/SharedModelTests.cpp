@@ -0,0 +1,229 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file SharedModelTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <cxmodel/Model.h>
+#include <cxmodel/NewGameInformation.h>
+#include <cxmodel/SharedModel.h>
+
+#include "LoggerMock.h"
+
+namespace
+{
+
+cxmodel::NewGameInformation MakeTwoHumansGameInformation()
+{
+    cxmodel::NewGameInformation newGameInfo;
+    newGameInfo.m_gridWidth = 7u;
+    newGameInfo.m_gridHeight = 6u;
+    newGameInfo.m_inARowValue = 4u;
+
+    newGameInfo.m_players.push_back(cxmodel::CreatePlayer("P1", cxmodel::MakeRed(), cxmodel::PlayerType::HUMAN));
+    newGameInfo.m_players.push_back(cxmodel::CreatePlayer("P2", cxmodel::MakeBlue(), cxmodel::PlayerType::HUMAN));
+
+    return newGameInfo;
+}
+
+void DropChip(cxmodel::Model& p_model, size_t p_column)
+{
+    p_model.DropChip(p_model.GetActivePlayer().GetChip(), p_column);
+}
+
+} // namespace
+
+TEST(SharedModel, /*DISABLED_*/Constructor_NoGame_EmptyStatePublished)
+{
+    LoggerMock logger;
+    cxmodel::Model model{cxmodel::MoveJournal{10u}, logger};
+    const cxmodel::SharedModel sharedModel{model};
+
+    const auto state = sharedModel.GetState();
+    ASSERT_TRUE(state);
+    ASSERT_EQ(state->m_version, 1u);
+    ASSERT_FALSE(state->m_board);
+    ASSERT_TRUE(state->m_players.empty());
+    ASSERT_TRUE(state->m_moves.empty());
+}
+
+TEST(SharedModel, /*DISABLED_*/GetState_ModelChanged_NewStatePublished)
+{
+    LoggerMock logger;
+    cxmodel::Model model{cxmodel::MoveJournal{10u}, logger};
+    const cxmodel::SharedModel sharedModel{model};
+
+    model.CreateNewGame(MakeTwoHumansGameInformation());
+    const auto newGameState = sharedModel.GetState();
+    DropChip(model, 3u);
+    DropChip(model, 4u);
+
+    // The state held is left unchanged:
+    ASSERT_TRUE(newGameState->m_board);
+    ASSERT_EQ(newGameState->m_board->GetNbDrops(), 0u);
+    ASSERT_TRUE(newGameState->m_moves.empty());
+
+    const auto state = sharedModel.GetState();
+    ASSERT_GT(state->m_version, newGameState->m_version);
+    ASSERT_TRUE(state->m_board);
+    ASSERT_EQ(state->m_board->GetPlayerIndex(0u, 3u), 0u);
+    ASSERT_EQ(state->m_board->GetPlayerIndex(0u, 4u), 1u);
+    ASSERT_EQ(state->m_board->GetActivePlayerIndex(), 0u);
+    ASSERT_EQ(state->m_moves, (std::vector<size_t>{3u, 4u}));
+    ASSERT_EQ(state->m_players.size(), 2u);
+    ASSERT_EQ(state->m_players[1].m_name, "P2");
+    ASSERT_TRUE(state->m_players[1].m_chipColor == cxmodel::MakeBlue());
+    ASSERT_FALSE(state->m_isWon);
+    ASSERT_FALSE(state->m_isTie);
+}
+
+TEST(SharedModel, /*DISABLED_*/GetState_GameWon_WonStatePublished)
+{
+    LoggerMock logger;
+    cxmodel::Model model{cxmodel::MoveJournal{10u}, logger};
+    const cxmodel::SharedModel sharedModel{model};
+
+    model.CreateNewGame(MakeTwoHumansGameInformation());
+    ASSERT_EQ(model.ApplyMoves({0u, 1u, 0u, 1u, 0u, 1u, 0u}), 7u);
+
+    const auto state = sharedModel.GetState();
+    ASSERT_TRUE(state->m_isWon);
+    ASSERT_FALSE(state->m_isTie);
+    ASSERT_EQ(state->m_board->GetActivePlayerIndex(), 0u);
+}
+
+TEST(SharedModel, /*DISABLED_*/GetState_ChipMoved_NothingPublished)
+{
+    LoggerMock logger;
+    cxmodel::Model model{cxmodel::MoveJournal{10u}, logger};
+    const cxmodel::SharedModel sharedModel{model};
+
+    model.CreateNewGame(MakeTwoHumansGameInformation());
+    const auto newGameState = sharedModel.GetState();
+
+    // Moving the chip in the new disc area leaves the game state unchanged:
+    model.MoveRightOneColumn();
+    model.MoveLeftOneColumn();
+
+    ASSERT_EQ(sharedModel.GetState(), newGameState);
+}
+
+TEST(SharedModel, /*DISABLED_*/Post_FromAnotherThread_RunWhenProcessed)
+{
+    LoggerMock logger;
+    cxmodel::Model model{cxmodel::MoveJournal{10u}, logger};
+    model.CreateNewGame(MakeTwoHumansGameInformation());
+
+    std::atomic<size_t> nbPosted{0u};
+    cxmodel::SharedModel sharedModel{model, [&nbPosted](){++nbPosted;}};
+
+    std::thread poster{[&sharedModel]()
+    {
+        sharedModel.Post([](cxmodel::Model& p_model){DropChip(p_model, 2u);});
+        sharedModel.Post([](cxmodel::Model& p_model){DropChip(p_model, 5u);});
+    }};
+    poster.join();
+
+    ASSERT_EQ(nbPosted, 2u);
+    ASSERT_TRUE(sharedModel.GetState()->m_moves.empty());
+
+    ASSERT_EQ(sharedModel.ProcessPending(), 2u);
+    ASSERT_EQ(sharedModel.GetState()->m_moves, (std::vector<size_t>{2u, 5u}));
+
+    ASSERT_EQ(sharedModel.ProcessPending(), 0u);
+}
+
+TEST(SharedModel, /*DISABLED_*/GetState_ReadWhileModelChanges_StatesAreConsistent)
+{
+    LoggerMock logger;
+    cxmodel::Model model{cxmodel::MoveJournal{100u}, logger};
+    model.CreateNewGame(MakeTwoHumansGameInformation());
+    cxmodel::SharedModel sharedModel{model};
+
+    // Readers check that every state they get agrees with itself, and that versions never go
+    // back:
+    std::atomic<bool> isDone{false};
+    std::atomic<size_t> nbInconsistent{0u};
+    const auto read = [&sharedModel, &isDone, &nbInconsistent]()
+    {
+        std::uint64_t lastVersion = 0u;
+        while(!isDone)
+        {
+            const auto state = sharedModel.GetState();
+            const bool isConsistent = state->m_version >= lastVersion &&
+                                      state->m_board &&
+                                      state->m_board->GetNbDrops() == state->m_moves.size() &&
+                                      state->m_board->GetActivePlayerIndex() == (state->m_isWon ? (state->m_moves.size() + 1u) % 2u : state->m_moves.size() % 2u);
+            if(!isConsistent)
+            {
+                ++nbInconsistent;
+            }
+
+            lastVersion = state->m_version;
+        }
+    };
+    std::thread reader1{read};
+    std::thread reader2{read};
+
+    // Many games are played and undone, on the owning thread:
+    for(size_t game = 0u; game < 20u; ++game)
+    {
+        for(size_t drop = 0u; drop < 20u; ++drop)
+        {
+            sharedModel.Post([drop](cxmodel::Model& p_model){DropChip(p_model, (drop * 3u) % 7u);});
+        }
+        sharedModel.ProcessPending();
+
+        while(model.CanUndo())
+        {
+            model.Undo();
+        }
+    }
+
+    isDone = true;
+    reader1.join();
+    reader2.join();
+
+    ASSERT_EQ(nbInconsistent, 0u);
+}
+
+TEST(SharedModel, /*DISABLED_*/Destructor_ModelChangedAfter_NothingPublished)
+{
+    LoggerMock logger;
+    cxmodel::Model model{cxmodel::MoveJournal{10u}, logger};
+    model.CreateNewGame(MakeTwoHumansGameInformation());
+
+    std::shared_ptr<const cxmodel::ModelState> state;
+    {
+        const cxmodel::SharedModel sharedModel{model};
+        state = sharedModel.GetState();
+    }
+
+    // The facade is detached from the model, so the drop is not published:
+    DropChip(model, 0u);
+
+    ASSERT_TRUE(state->m_moves.empty());
+}
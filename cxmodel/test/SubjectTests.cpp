@@ -135,3 +135,112 @@ TEST_F(SubjectTestFixture, /*DISABLED_*/DetachAll_TwoObservers_NoLongerUpdate)
     ASSERT_EQ(1, m_observer1.GetData());
     ASSERT_EQ(1, m_observer2.GetData());
 }
+
+TEST_F(SubjectTestFixture, /*DISABLED_*/NotificationBatch_SameContextManyTimes_ObserversUpdatedOnceAtTheEnd)
+{
+    m_subject.Attach(&m_observer1);
+
+    {
+        const ConcreteSubjectMock::NotificationBatch batch{m_subject};
+
+        m_subject.IncrementData();
+        m_subject.IncrementData();
+        m_subject.IncrementData();
+
+        ASSERT_EQ(0, m_observer1.GetNbUpdates());
+    }
+
+    ASSERT_EQ(1, m_observer1.GetNbUpdates());
+    ASSERT_EQ(3, m_observer1.GetData());
+}
+
+TEST_F(SubjectTestFixture, /*DISABLED_*/NotificationBatch_DifferentContexts_AllSentInFirstRaisedOrder)
+{
+    m_subject.Attach(&m_observer1);
+
+    {
+        const ConcreteSubjectMock::NotificationBatch batch{m_subject};
+
+        m_subject.NotifyContext(cxmodel::ModelNotificationContext::UNDO_CHIP_DROPPED);
+        m_subject.NotifyContext(cxmodel::ModelNotificationContext::GAME_ENDED);
+        m_subject.NotifyContext(cxmodel::ModelNotificationContext::UNDO_CHIP_DROPPED);
+    }
+
+    ASSERT_EQ(2, m_observer1.GetNbUpdates());
+    ASSERT_TRUE(m_observer1.GetLastContext() == cxmodel::ModelNotificationContext::GAME_ENDED);
+}
+
+TEST_F(SubjectTestFixture, /*DISABLED_*/NotificationBatch_Nested_SentWhenOutermostEnds)
+{
+    m_subject.Attach(&m_observer1);
+
+    {
+        const ConcreteSubjectMock::NotificationBatch outerBatch{m_subject};
+
+        {
+            const ConcreteSubjectMock::NotificationBatch innerBatch{m_subject};
+            m_subject.IncrementData();
+        }
+
+        ASSERT_EQ(0, m_observer1.GetNbUpdates());
+
+        m_subject.IncrementData();
+    }
+
+    ASSERT_EQ(1, m_observer1.GetNbUpdates());
+    ASSERT_EQ(2, m_observer1.GetData());
+
+    m_subject.IncrementData();
+
+    ASSERT_EQ(2, m_observer1.GetNbUpdates());
+}
+
+TEST_F(SubjectTestFixture, /*DISABLED_*/Attach_SomeContexts_OnlyThoseNotified)
+{
+    m_subject.Attach(&m_observer1, {cxmodel::ModelNotificationContext::GAME_WON, cxmodel::ModelNotificationContext::GAME_TIED});
+    m_subject.Attach(&m_observer2, cxmodel::ModelSubject::ContextSet::All().Without(cxmodel::ModelNotificationContext::GAME_TIED));
+
+    m_subject.NotifyContext(cxmodel::ModelNotificationContext::CHIP_MOVED_LEFT_ONE_COLUMN);
+
+    ASSERT_EQ(0, m_observer1.GetNbUpdates());
+    ASSERT_EQ(1, m_observer2.GetNbUpdates());
+
+    m_subject.NotifyContext(cxmodel::ModelNotificationContext::GAME_TIED);
+
+    ASSERT_EQ(1, m_observer1.GetNbUpdates());
+    ASSERT_TRUE(m_observer1.GetLastContext() == cxmodel::ModelNotificationContext::GAME_TIED);
+    ASSERT_EQ(1, m_observer2.GetNbUpdates());
+}
+
+TEST_F(SubjectTestFixture, /*DISABLED_*/Detach_Subscription_NoLongerUpdates)
+{
+    cxmodel::ModelSubject::Subscription subscription1 = m_subject.Attach(&m_observer1);
+    m_subject.Attach(&m_observer2);
+    ASSERT_TRUE(subscription1.IsAttached());
+
+    m_subject.Detatch(subscription1);
+    ASSERT_FALSE(subscription1.IsAttached());
+
+    m_subject.IncrementData();
+
+    ASSERT_EQ(0, m_observer1.GetData());
+    ASSERT_EQ(1, m_observer2.GetData());
+
+    // The observer can be attached again:
+    subscription1 = m_subject.Attach(&m_observer1);
+    m_subject.IncrementData();
+
+    ASSERT_TRUE(subscription1.IsAttached());
+    ASSERT_EQ(2, m_observer1.GetData());
+}
+
+TEST_F(SubjectTestFixtureStdErrStreamRedirector, /*DISABLED_*/Detach_DetachedSubscription_PreconditionFail)
+{
+    ASSERT_TRUE(GetStdErrContents().empty());
+
+    cxmodel::ModelSubject::Subscription subscription = m_subject.Attach(&m_observer1);
+    m_subject.Detatch(subscription);
+    m_subject.Detatch(subscription);
+
+    ASSERT_PRECONDITION_FAILED(*this);
+}
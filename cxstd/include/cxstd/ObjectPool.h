@@ -0,0 +1,186 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file ObjectPool.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef OBJECTPOOL_H_B7C9D36F_6661_4DF0_A0D1_E127588A8800
+#define OBJECTPOOL_H_B7C9D36F_6661_4DF0_A0D1_E127588A8800
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace cxstd
+{
+
+/**********************************************************************************************//**
+ * @brief Pool of same type objects.
+ *
+ * Objects are constructed in slots taken from chunks of `ChunkSize` slots. When an object is
+ * destroyed, its slot goes back to the pool and is reused by the next creation. Chunks are
+ * only released with the pool, so creating and destroying objects at a steady rate stops
+ * hitting the heap once the pool is warm.
+ *
+ * @note
+ *      The pool is not thread safe.
+ * @note
+ *      All objects must be destroyed before the pool.
+ *
+ * @tparam T
+ *      The type of the pooled objects.
+ *
+ * @tparam ChunkSize
+ *      The number of slots allocated at once, when no slot is free.
+ *
+ *************************************************************************************************/
+template<typename T, std::size_t ChunkSize = 64u>
+class ObjectPool final
+{
+    static_assert(ChunkSize > 0u, "Chunks must hold at least one object.");
+
+public:
+
+    /** Gives the slot of a pooled object back to its pool, once the object is destroyed. */
+    class Deleter final
+    {
+
+    public:
+
+        Deleter() = default;
+        explicit Deleter(ObjectPool& p_pool) : m_pool{&p_pool} {}
+
+        void operator()(T* p_object) const
+        {
+            if(m_pool && p_object)
+            {
+                m_pool->Destroy(p_object);
+            }
+        }
+
+    private:
+
+        ObjectPool* m_pool = nullptr;
+
+    };
+
+    /** Owner of a pooled object. */
+    using Handle = std::unique_ptr<T, Deleter>;
+
+    ObjectPool() = default;
+
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    /******************************************************************************************//**
+     * @brief Constructs an object in a free slot.
+     *
+     * @param p_arguments
+     *      The object constructor arguments.
+     *
+     * @return
+     *      The owner of the new object. If the constructor throws, the slot is given back and
+     *      the exception is propagated.
+     *
+     *********************************************************************************************/
+    template<typename... Arguments>
+    [[nodiscard]] Handle Create(Arguments&&... p_arguments)
+    {
+        if(!m_freeSlots)
+        {
+            AddChunk();
+        }
+
+        Slot* slot = m_freeSlots;
+        m_freeSlots = slot->m_next;
+
+        T* object = nullptr;
+        try
+        {
+            object = ::new(static_cast<void*>(slot->m_storage)) T(std::forward<Arguments>(p_arguments)...);
+        }
+        catch(...)
+        {
+            slot->m_next = m_freeSlots;
+            m_freeSlots = slot;
+
+            throw;
+        }
+
+        ++m_nbInUse;
+
+        return Handle{object, Deleter{*this}};
+    }
+
+    /******************************************************************************************//**
+     * @brief Gets the number of live objects.
+     *
+     *********************************************************************************************/
+    [[nodiscard]] std::size_t GetNbInUse() const {return m_nbInUse;}
+
+    /******************************************************************************************//**
+     * @brief Gets the number of slots, free or not.
+     *
+     *********************************************************************************************/
+    [[nodiscard]] std::size_t GetCapacity() const {return m_chunks.size() * ChunkSize;}
+
+private:
+
+    union Slot
+    {
+        Slot* m_next;
+        alignas(T) unsigned char m_storage[sizeof(T)];
+    };
+
+    void AddChunk()
+    {
+        m_chunks.push_back(std::make_unique<Slot[]>(ChunkSize));
+        Slot* chunk = m_chunks.back().get();
+
+        // Slots are chained in order, so that the first ones are used first:
+        for(std::size_t index = ChunkSize; index > 0u; --index)
+        {
+            chunk[index - 1u].m_next = m_freeSlots;
+            m_freeSlots = &chunk[index - 1u];
+        }
+    }
+
+    void Destroy(T* p_object)
+    {
+        p_object->~T();
+
+        Slot* slot = reinterpret_cast<Slot*>(p_object);
+        slot->m_next = m_freeSlots;
+        m_freeSlots = slot;
+
+        --m_nbInUse;
+    }
+
+    std::vector<std::unique_ptr<Slot[]>> m_chunks;
+    Slot* m_freeSlots = nullptr;
+    std::size_t m_nbInUse = 0u;
+
+};
+
+} // namespace cxstd
+
+#endif // OBJECTPOOL_H_B7C9D36F_6661_4DF0_A0D1_E127588A8800
@@ -0,0 +1,94 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file parse.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef PARSE_H_C4473406_744B_431D_A129_288A8A367308
+#define PARSE_H_C4473406_744B_431D_A129_288A8A367308
+
+#include <charconv>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+namespace cxstd
+{
+
+/**********************************************************************************************//**
+ * @brief Parses an unsigned decimal integer.
+ *
+ * Only plain decimal digits are accepted: no sign, no spaces and no trailing characters.
+ * Numbers too large for `UnsignedInteger` are rejected.
+ *
+ * @param p_text
+ *      The text to parse.
+ *
+ * @return
+ *      The integer, if the text is a valid one, nothing otherwise.
+ *
+ *************************************************************************************************/
+template<typename UnsignedInteger = size_t>
+[[nodiscard]] std::optional<UnsignedInteger> ParseInteger(const std::string& p_text)
+{
+    static_assert(std::is_unsigned_v<UnsignedInteger>, "Only unsigned integers can be parsed.");
+
+    const char* const begin = p_text.data();
+    const char* const end = begin + p_text.size();
+
+    UnsignedInteger value = 0u;
+    const std::from_chars_result result = std::from_chars(begin, end, value, 10);
+    if(p_text.empty() || result.ec != std::errc{} || result.ptr != end)
+    {
+        return std::nullopt;
+    }
+
+    return value;
+}
+
+/**********************************************************************************************//**
+ * @brief Parses a strictly positive decimal integer.
+ *
+ * Same as `ParseInteger`, except that 0 is rejected.
+ *
+ * @param p_text
+ *      The text to parse.
+ *
+ * @return
+ *      The integer, if the text is a valid one, nothing otherwise.
+ *
+ *************************************************************************************************/
+template<typename UnsignedInteger = size_t>
+[[nodiscard]] std::optional<UnsignedInteger> ParsePositiveInteger(const std::string& p_text)
+{
+    const std::optional<UnsignedInteger> value = ParseInteger<UnsignedInteger>(p_text);
+    if(!value || *value == 0u)
+    {
+        return std::nullopt;
+    }
+
+    return value;
+}
+
+} // namespace cxstd
+
+#endif // PARSE_H_C4473406_744B_431D_A129_288A8A367308
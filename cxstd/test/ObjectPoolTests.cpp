@@ -0,0 +1,135 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file ObjectPoolTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <cxstd/ObjectPool.h>
+
+namespace
+{
+
+class Counted final
+{
+
+public:
+
+    Counted(std::string p_name, int& p_nbAlive)
+    : m_name{std::move(p_name)}
+    , m_nbAlive{p_nbAlive}
+    {
+        if(m_name.empty())
+        {
+            throw std::invalid_argument("A name is needed.");
+        }
+
+        ++m_nbAlive;
+    }
+
+    ~Counted()
+    {
+        --m_nbAlive;
+    }
+
+    [[nodiscard]] const std::string& GetName() const {return m_name;}
+
+private:
+
+    std::string m_name;
+    int& m_nbAlive;
+
+};
+
+} // namespace
+
+TEST(ObjectPool, /*DISABLED_*/Create_ValidArguments_ObjectConstructed)
+{
+    int nbAlive = 0;
+    cxstd::ObjectPool<Counted, 4u> pool;
+
+    auto object = pool.Create("first", nbAlive);
+
+    ASSERT_TRUE(object);
+    ASSERT_EQ(object->GetName(), "first");
+    ASSERT_EQ(nbAlive, 1);
+    ASSERT_EQ(pool.GetNbInUse(), 1u);
+    ASSERT_EQ(pool.GetCapacity(), 4u);
+}
+
+TEST(ObjectPool, /*DISABLED_*/Create_HandleReset_ObjectDestroyedAndSlotReused)
+{
+    int nbAlive = 0;
+    cxstd::ObjectPool<Counted, 4u> pool;
+
+    auto first = pool.Create("first", nbAlive);
+    const Counted* const firstAddress = first.get();
+    first.reset();
+
+    ASSERT_EQ(nbAlive, 0);
+    ASSERT_EQ(pool.GetNbInUse(), 0u);
+
+    auto second = pool.Create("second", nbAlive);
+    ASSERT_EQ(second.get(), firstAddress);
+    ASSERT_EQ(pool.GetCapacity(), 4u);
+}
+
+TEST(ObjectPool, /*DISABLED_*/Create_MoreObjectsThanAChunk_NewChunkAdded)
+{
+    int nbAlive = 0;
+    cxstd::ObjectPool<Counted, 4u> pool;
+
+    std::vector<cxstd::ObjectPool<Counted, 4u>::Handle> objects;
+    for(int index = 0; index < 5; ++index)
+    {
+        objects.push_back(pool.Create(std::to_string(index), nbAlive));
+    }
+
+    ASSERT_EQ(nbAlive, 5);
+    ASSERT_EQ(pool.GetNbInUse(), 5u);
+    ASSERT_EQ(pool.GetCapacity(), 8u);
+
+    for(int index = 0; index < 5; ++index)
+    {
+        ASSERT_EQ(objects[index]->GetName(), std::to_string(index));
+    }
+
+    objects.clear();
+    ASSERT_EQ(nbAlive, 0);
+    ASSERT_EQ(pool.GetNbInUse(), 0u);
+}
+
+TEST(ObjectPool, /*DISABLED_*/Create_ConstructorThrows_SlotGivenBack)
+{
+    int nbAlive = 0;
+    cxstd::ObjectPool<Counted, 1u> pool;
+
+    ASSERT_THROW((void)pool.Create("", nbAlive), std::invalid_argument);
+    ASSERT_EQ(pool.GetNbInUse(), 0u);
+
+    auto object = pool.Create("valid", nbAlive);
+    ASSERT_TRUE(object);
+    ASSERT_EQ(pool.GetCapacity(), 1u);
+}
@@ -0,0 +1,64 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file parseTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include <cxstd/parse.h>
+
+TEST(ParseInteger, /*DISABLED_*/ParseInteger_ValidNumber_NumberReturned)
+{
+    ASSERT_EQ(cxstd::ParseInteger("0"), 0u);
+    ASSERT_EQ(cxstd::ParseInteger("42"), 42u);
+    ASSERT_EQ(cxstd::ParseInteger("007"), 7u);
+}
+
+TEST(ParseInteger, /*DISABLED_*/ParseInteger_NotANumber_NothingReturned)
+{
+    ASSERT_FALSE(cxstd::ParseInteger(""));
+    ASSERT_FALSE(cxstd::ParseInteger("abc"));
+    ASSERT_FALSE(cxstd::ParseInteger("12abc"));
+    ASSERT_FALSE(cxstd::ParseInteger(" 12"));
+    ASSERT_FALSE(cxstd::ParseInteger("+12"));
+    ASSERT_FALSE(cxstd::ParseInteger("-12"));
+}
+
+TEST(ParseInteger, /*DISABLED_*/ParseInteger_Overflow_NothingReturned)
+{
+    ASSERT_EQ(cxstd::ParseInteger<std::uint64_t>("18446744073709551615"), UINT64_MAX);
+    ASSERT_FALSE(cxstd::ParseInteger<std::uint64_t>("18446744073709551616"));
+    ASSERT_FALSE(cxstd::ParseInteger<std::uint16_t>("65536"));
+}
+
+TEST(ParseInteger, /*DISABLED_*/ParsePositiveInteger_Zero_NothingReturned)
+{
+    ASSERT_FALSE(cxstd::ParsePositiveInteger("0"));
+    ASSERT_FALSE(cxstd::ParsePositiveInteger("000"));
+}
+
+TEST(ParseInteger, /*DISABLED_*/ParsePositiveInteger_ValidNumber_NumberReturned)
+{
+    ASSERT_EQ(cxstd::ParsePositiveInteger("1"), 1u);
+    ASSERT_EQ(cxstd::ParsePositiveInteger("4096"), 4096u);
+}
@@ -0,0 +1,129 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file Elo.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef ELO_H_BF3015E5_7BFF_4EE5_BFE5_4B82FD755BFA
+#define ELO_H_BF3015E5_7BFF_4EE5_BFE5_4B82FD755BFA
+
+#include <cstddef>
+
+namespace cxtournament
+{
+
+/**********************************************************************************************//**
+ * @brief Outcomes of the games played between two bots, from the first bot's point of view.
+ *
+ *************************************************************************************************/
+struct MatchScore final
+{
+    /** The number of games won. */
+    size_t m_nbWins = 0u;
+
+    /** The number of games lost. */
+    size_t m_nbLosses = 0u;
+
+    /** The number of tied games. */
+    size_t m_nbTies = 0u;
+};
+
+/**********************************************************************************************//**
+ * @brief Computes the number of games in a match score.
+ *
+ * @param p_score The match score.
+ *
+ * @return The number of games won, lost and tied.
+ *
+ *************************************************************************************************/
+[[nodiscard]] size_t GetNbGames(const MatchScore& p_score);
+
+/**********************************************************************************************//**
+ * @brief Computes the average points per game, a win being worth one point and a tie half a point.
+ *
+ * @param p_score The match score.
+ *
+ * @return The average points per game, between 0 and 1. If no game was played, 0.5 is returned.
+ *
+ *************************************************************************************************/
+[[nodiscard]] double GetPointsRatio(const MatchScore& p_score);
+
+/**********************************************************************************************//**
+ * @brief Computes the variance of the points scored in a single game.
+ *
+ * @param p_score The match score.
+ *
+ * @return The variance of the per game points. If no game was played, 0 is returned.
+ *
+ *************************************************************************************************/
+[[nodiscard]] double GetPointsVariance(const MatchScore& p_score);
+
+/**********************************************************************************************//**
+ * @brief Estimation of an Elo rating difference.
+ *
+ *************************************************************************************************/
+struct EloEstimate final
+{
+    /** The estimated Elo difference. Positive values favor the first bot. */
+    double m_difference = 0.0;
+
+    /** The half width of the 95% confidence interval around the difference. */
+    double m_errorMargin = 0.0;
+};
+
+/**********************************************************************************************//**
+ * @brief Estimates the Elo difference between two bots from the outcomes of their games.
+ *
+ * The error margin is computed from the variance of the per game points, using a normal
+ * approximation. When one bot won (or lost) every game, the difference and the error margin
+ * are both infinite.
+ *
+ * @param p_score The match score.
+ *
+ * @return The estimated Elo difference.
+ *
+ *************************************************************************************************/
+[[nodiscard]] EloEstimate EstimateElo(const MatchScore& p_score);
+
+/**********************************************************************************************//**
+ * @brief Computes the Elo difference matching an expected points ratio.
+ *
+ * @pre The points ratio is between 0 and 1.
+ *
+ * @param p_pointsRatio The expected average points per game.
+ *
+ * @return The Elo difference.
+ *
+ *************************************************************************************************/
+[[nodiscard]] double ToElo(double p_pointsRatio);
+
+/**********************************************************************************************//**
+ * @brief Computes the expected points ratio matching an Elo difference.
+ *
+ * @param p_eloDifference The Elo difference.
+ *
+ * @return The expected average points per game.
+ *
+ *************************************************************************************************/
+[[nodiscard]] double ToPointsRatio(double p_eloDifference);
+
+} // namespace cxtournament
+
+#endif // ELO_H_BF3015E5_7BFF_4EE5_BFE5_4B82FD755BFA
@@ -0,0 +1,137 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file ResultsJournal.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef RESULTSJOURNAL_H_2845E159_F837_4327_9FF0_7CEF675DAAED
+#define RESULTSJOURNAL_H_2845E159_F837_4327_9FF0_7CEF675DAAED
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <cxmodel/Status.h>
+
+namespace cxtournament
+{
+
+/**********************************************************************************************//**
+ * @brief Outcome of a tournament game, from the point of view of the pairing's first bot.
+ *
+ *************************************************************************************************/
+enum class GameOutcome
+{
+    WIN,
+    LOSS,
+    TIE,
+};
+
+/**********************************************************************************************//**
+ * @brief Record of a finished tournament game.
+ *
+ *************************************************************************************************/
+struct GameRecord final
+{
+    /** The index of the pairing the game belongs to. */
+    size_t m_pairingIndex = 0u;
+
+    /** The index of the game, within its pairing. */
+    size_t m_gameIndex = 0u;
+
+    /** The game outcome. */
+    GameOutcome m_outcome = GameOutcome::TIE;
+
+    /** The game seed. Replaying the game from it gives the same outcome. */
+    std::uint64_t m_seed = 0u;
+};
+
+/**********************************************************************************************//**
+ * @brief Text file in which tournament game results are saved as soon as games end.
+ *
+ * The first line of the file identifies the tournament (players, board, seed, etc). Then,
+ * each line records one game, for example "3 17 1-0 42" for game 17 of pairing 3, won by the
+ * pairing's first bot, from game seed 42. Lines without a seed are read with a zero seed. Since every line is flushed when written, an interrupted tournament
+ * loses at most the games that were being played, and can be resumed from the file.
+ *
+ *************************************************************************************************/
+class ResultsJournal final
+{
+
+public:
+
+    /******************************************************************************************//**
+     * @brief Constructor.
+     *
+     * @pre The header is not empty and fits on a single line.
+     *
+     * @param p_filePath The journal file path.
+     * @param p_header   The line identifying the tournament.
+     *
+     ********************************************************************************************/
+    ResultsJournal(const std::string& p_filePath, const std::string& p_header);
+
+    /******************************************************************************************//**
+     * @brief Opens the journal.
+     *
+     * If the file does not exist, it is created. Otherwise, the games it already records are
+     * read back. A line cut short by an interruption is ignored.
+     *
+     * @return A success if the journal can be written to, an error if the file can't be
+     *         opened or records another tournament.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] cxmodel::Status Open();
+
+    /******************************************************************************************//**
+     * @brief Gets the games recorded before the journal was opened.
+     *
+     * @return The game records, in file order.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] const std::vector<GameRecord>& GetPreviousRecords() const;
+
+    /******************************************************************************************//**
+     * @brief Saves a game record.
+     *
+     * The record is on disk when this call returns. Calls must be synchronized by the caller.
+     *
+     * @pre The journal is open.
+     *
+     * @param p_record The game record.
+     *
+     ********************************************************************************************/
+    void Append(const GameRecord& p_record);
+
+private:
+
+    const std::string m_filePath;
+    const std::string m_header;
+
+    std::vector<GameRecord> m_previousRecords;
+    std::ofstream m_file;
+
+};
+
+} // namespace cxtournament
+
+#endif // RESULTSJOURNAL_H_2845E159_F837_4327_9FF0_7CEF675DAAED
@@ -0,0 +1,118 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file Sprt.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef SPRT_H_F1C606AF_84C8_4FCC_8246_19F3430A5F2E
+#define SPRT_H_F1C606AF_84C8_4FCC_8246_19F3430A5F2E
+
+#include "Elo.h"
+
+namespace cxtournament
+{
+
+/**********************************************************************************************//**
+ * @brief Settings of a sequential probability ratio test (SPRT).
+ *
+ * The test decides between two hypotheses on the Elo difference between two bots: H0, the
+ * difference is `m_elo0`, and H1, the difference is `m_elo1`. Games are played until one of
+ * them is accepted, which usually takes far fewer games than a fixed length match of the
+ * same accuracy.
+ *
+ *************************************************************************************************/
+struct SprtSettings final
+{
+    /** The Elo difference under H0. */
+    double m_elo0 = 0.0;
+
+    /** The Elo difference under H1. */
+    double m_elo1 = 10.0;
+
+    /** The probability of accepting H1 when H0 is true. */
+    double m_alpha = 0.05;
+
+    /** The probability of accepting H0 when H1 is true. */
+    double m_beta = 0.05;
+};
+
+/**********************************************************************************************//**
+ * @brief Outcome of a sequential probability ratio test.
+ *
+ *************************************************************************************************/
+enum class SprtDecision
+{
+    CONTINUE,  ///< More games are needed.
+    ACCEPT_H0, ///< H0 is accepted.
+    ACCEPT_H1, ///< H1 is accepted.
+};
+
+/**********************************************************************************************//**
+ * @brief Computes the log-likelihood ratio of H1 over H0.
+ *
+ * A tie counts as half a win and half a loss, which makes this Wald's test on a binomial
+ * distribution. It is exact when games never end in a tie, and slightly overconfident
+ * otherwise. Unlike approximations based on the observed variance, it stays meaningful when
+ * a bot wins every game, which is common between bots of very different strengths.
+ *
+ * @param p_score    The match score so far.
+ * @param p_settings The test settings.
+ *
+ * @return The log-likelihood ratio.
+ *
+ *************************************************************************************************/
+[[nodiscard]] double ComputeLogLikelihoodRatio(const MatchScore& p_score, const SprtSettings& p_settings);
+
+/**********************************************************************************************//**
+ * @brief Computes the log-likelihood ratio under which H0 is accepted.
+ *
+ * @param p_settings The test settings.
+ *
+ * @return The lower bound.
+ *
+ *************************************************************************************************/
+[[nodiscard]] double GetLowerBound(const SprtSettings& p_settings);
+
+/**********************************************************************************************//**
+ * @brief Computes the log-likelihood ratio over which H1 is accepted.
+ *
+ * @param p_settings The test settings.
+ *
+ * @return The upper bound.
+ *
+ *************************************************************************************************/
+[[nodiscard]] double GetUpperBound(const SprtSettings& p_settings);
+
+/**********************************************************************************************//**
+ * @brief Decides if more games are needed.
+ *
+ * @pre `m_elo0` is less than `m_elo1`, and `m_alpha` and `m_beta` are between 0 and 1.
+ *
+ * @param p_score    The match score so far.
+ * @param p_settings The test settings.
+ *
+ * @return The test outcome.
+ *
+ *************************************************************************************************/
+[[nodiscard]] SprtDecision Decide(const MatchScore& p_score, const SprtSettings& p_settings);
+
+} // namespace cxtournament
+
+#endif // SPRT_H_F1C606AF_84C8_4FCC_8246_19F3430A5F2E
@@ -0,0 +1,271 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file Tournament.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef TOURNAMENT_H_27C96CAF_0CE0_47B0_8E50_478783E3A45A
+#define TOURNAMENT_H_27C96CAF_0CE0_47B0_8E50_478783E3A45A
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <cxmodel/BotSettings.h>
+#include <cxmodel/Status.h>
+
+#include "Elo.h"
+#include "ResultsJournal.h"
+#include "Sprt.h"
+
+namespace cxmodel
+{
+    class IConnectXLimits;
+}
+
+namespace cxtournament
+{
+
+/**********************************************************************************************//**
+ * @brief How bots are paired in a tournament.
+ *
+ *************************************************************************************************/
+enum class TournamentFormat
+{
+    ROUND_ROBIN, ///< Every bot plays every other bot.
+    GAUNTLET,    ///< The first bot plays every other bot.
+};
+
+/**********************************************************************************************//**
+ * @brief Two bots playing each other.
+ *
+ *************************************************************************************************/
+struct Pairing final
+{
+    /** The index of the first bot. Results are given from its point of view. */
+    size_t m_first = 0u;
+
+    /** The index of the second bot. */
+    size_t m_second = 0u;
+};
+
+/**********************************************************************************************//**
+ * @brief Makes the pairings of a tournament.
+ *
+ * @param p_format The tournament format.
+ * @param p_nbBots The number of bots in the tournament.
+ *
+ * @return The pairings. Each pair of bots appears at most once.
+ *
+ *************************************************************************************************/
+[[nodiscard]] std::vector<Pairing> MakePairings(TournamentFormat p_format, size_t p_nbBots);
+
+/**********************************************************************************************//**
+ * @brief Makes a random opening.
+ *
+ * The opening only depends on its arguments, so that every run of a tournament, and every
+ * pairing within it, plays the same openings.
+ *
+ * @param p_seed         The tournament seed.
+ * @param p_openingIndex The index of the opening.
+ * @param p_gridWidth    The board width.
+ * @param p_gridHeight   The board height.
+ * @param p_nbDrops      The number of drops in the opening.
+ *
+ * @pre The board has room for all the drops.
+ *
+ * @return The columns of the opening drops, in order.
+ *
+ *************************************************************************************************/
+[[nodiscard]] std::vector<size_t> MakeOpening(std::uint32_t p_seed,
+                                              size_t p_openingIndex,
+                                              size_t p_gridWidth,
+                                              size_t p_gridHeight,
+                                              size_t p_nbDrops);
+
+/**********************************************************************************************//**
+ * @brief Makes a game seed.
+ *
+ * Like openings, game seeds only depend on their arguments, so that every run of a tournament
+ * plays the same games, whichever thread plays them.
+ *
+ * @param p_seed         The tournament seed.
+ * @param p_pairingIndex The index of the pairing the game belongs to.
+ * @param p_gameIndex    The index of the game, within its pairing.
+ *
+ * @return The game seed.
+ *
+ *************************************************************************************************/
+[[nodiscard]] std::uint64_t MakeGameSeed(std::uint32_t p_seed, size_t p_pairingIndex, size_t p_gameIndex);
+
+/**********************************************************************************************//**
+ * @brief Settings of a tournament between bots.
+ *
+ *************************************************************************************************/
+struct TournamentSettings final
+{
+    /** How bots are paired. */
+    TournamentFormat m_format = TournamentFormat::ROUND_ROBIN;
+
+    /** The settings of every bot in the tournament. */
+    std::vector<cxmodel::BotSettings> m_bots;
+
+    /**
+     * The number of games each pairing plays. Every opening is played twice, each bot
+     * dropping first once, so this should be even.
+     */
+    size_t m_nbGamesPerPairing = 2u;
+
+    /** The board width. */
+    size_t m_gridWidth = 7u;
+
+    /** The board height. */
+    size_t m_gridHeight = 6u;
+
+    /** The in-a-row value. */
+    size_t m_inARowValue = 4u;
+
+    /** The number of random drops made before the bots take over. */
+    size_t m_nbOpeningDrops = 2u;
+
+    /** The seed from which openings are made. */
+    std::uint32_t m_seed = 0u;
+
+    /** The number of games played at the same time. */
+    size_t m_nbThreads = 1u;
+
+    /** If set, a pairing stops as soon as this test is decided. */
+    std::optional<SprtSettings> m_sprt;
+
+    /** If not empty, the file in which results are saved, and from which they are resumed. */
+    std::string m_resultsFilePath;
+};
+
+/**********************************************************************************************//**
+ * @brief Results of a pairing.
+ *
+ *************************************************************************************************/
+struct PairingResults final
+{
+    /** The pairing. */
+    Pairing m_pairing;
+
+    /** The outcomes of its games. */
+    MatchScore m_score;
+
+    /** The SPRT outcome. Always `CONTINUE` when no SPRT is run. */
+    SprtDecision m_sprtDecision = SprtDecision::CONTINUE;
+};
+
+/**********************************************************************************************//**
+ * @brief Results of a tournament.
+ *
+ *************************************************************************************************/
+struct TournamentResults final
+{
+    /** The results of every pairing, including resumed games. */
+    std::vector<PairingResults> m_pairings;
+
+    /** The number of games read back from the results file. */
+    size_t m_nbResumedGames = 0u;
+
+    /** The number of games played by this run. */
+    size_t m_nbPlayedGames = 0u;
+
+    /** The number of moves played by this run, opening drops included. */
+    size_t m_nbMoves = 0u;
+
+    /** The time taken by this run. */
+    std::chrono::milliseconds m_duration{0};
+};
+
+/**********************************************************************************************//**
+ * @brief Plays a tournament between bots.
+ *
+ * Games are played over a work stealing thread pool. Each worker thread owns a model (and
+ * hence, the bot strategies), so that games share nothing but the results, which are
+ * gathered under a lock.
+ *
+ *************************************************************************************************/
+class Tournament final
+{
+
+public:
+
+    /******************************************************************************************//**
+     * @brief Constructor.
+     *
+     * @param p_settings The tournament settings.
+     *
+     ********************************************************************************************/
+    explicit Tournament(const TournamentSettings& p_settings);
+
+    /******************************************************************************************//**
+     * @brief Destructor.
+     *
+     ********************************************************************************************/
+    ~Tournament();
+
+    /******************************************************************************************//**
+     * @brief Plays the tournament.
+     *
+     * Games already in the results file are not played again.
+     *
+     * @return A success if every game was played, an error otherwise.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] cxmodel::Status Run();
+
+    /******************************************************************************************//**
+     * @brief Gets the tournament results.
+     *
+     * @return The results of the last run.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] const TournamentResults& GetResults() const;
+
+private:
+
+    class Worker;
+
+    [[nodiscard]] cxmodel::Status Validate(const cxmodel::IConnectXLimits& p_limits) const;
+    [[nodiscard]] std::string MakeHeader() const;
+    [[nodiscard]] bool IsDecided(size_t p_pairingIndex) const;
+
+    void PlayGame(Worker& p_worker, size_t p_pairingIndex, size_t p_gameIndex);
+    void Record(const GameRecord& p_record);
+
+    const TournamentSettings m_settings;
+
+    std::mutex m_resultsMutex;
+    TournamentResults m_results;
+    std::unique_ptr<ResultsJournal> m_journal;
+    bool m_hasStuckGame = false;
+
+};
+
+} // namespace cxtournament
+
+#endif // TOURNAMENT_H_27C96CAF_0CE0_47B0_8E50_478783E3A45A
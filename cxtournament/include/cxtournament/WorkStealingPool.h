@@ -0,0 +1,103 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file WorkStealingPool.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef WORKSTEALINGPOOL_H_69593AB8_0205_4BF8_981D_0EA2223C0975
+#define WORKSTEALINGPOOL_H_69593AB8_0205_4BF8_981D_0EA2223C0975
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace cxtournament
+{
+
+/**********************************************************************************************//**
+ * @brief Runs a batch of independent tasks over a fixed number of worker threads.
+ *
+ * Tasks are dealt to per worker queues up front. Each worker runs the tasks of its own queue,
+ * from the front, and when it runs out, steals tasks from the back of the other queues. This
+ * keeps every worker busy until the batch is done, even when task durations vary a lot (as
+ * game durations do), without a single queue all workers would contend for.
+ *
+ * Each task is given the index of the worker running it, so that it can use resources owned
+ * by that worker without any synchronization.
+ *
+ *************************************************************************************************/
+class WorkStealingPool final
+{
+
+public:
+
+    /** A task. Its argument is the index of the worker running it. */
+    using Task = std::function<void(size_t)>;
+
+    /******************************************************************************************//**
+     * @brief Constructor.
+     *
+     * @pre There is at least one worker.
+     *
+     * @param p_nbWorkers The number of worker threads.
+     *
+     ********************************************************************************************/
+    explicit WorkStealingPool(size_t p_nbWorkers);
+
+    /******************************************************************************************//**
+     * @brief Gets the number of worker threads.
+     *
+     * @return The number of worker threads.
+     *
+     ********************************************************************************************/
+    [[nodiscard]] size_t GetNbWorkers() const;
+
+    /******************************************************************************************//**
+     * @brief Runs tasks until they are all done.
+     *
+     * The calling thread is blocked until every task has run.
+     *
+     * @param p_tasks The tasks to run.
+     *
+     ********************************************************************************************/
+    void Run(std::vector<Task>&& p_tasks);
+
+private:
+
+    struct Queue final
+    {
+        std::mutex m_mutex;
+        std::deque<Task> m_tasks;
+    };
+
+    void Work(size_t p_workerIndex);
+    [[nodiscard]] bool Pop(size_t p_workerIndex, Task& p_task);
+    [[nodiscard]] bool Steal(size_t p_workerIndex, Task& p_task);
+
+    std::vector<std::unique_ptr<Queue>> m_queues;
+
+};
+
+} // namespace cxtournament
+
+#endif // WORKSTEALINGPOOL_H_69593AB8_0205_4BF8_981D_0EA2223C0975
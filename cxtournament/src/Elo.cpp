@@ -0,0 +1,126 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file Elo.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <cmath>
+#include <limits>
+
+#include <cxinv/assertion.h>
+#include <cxtournament/Elo.h>
+
+namespace
+{
+
+// Two-sided 95% confidence, for a normal distribution:
+constexpr double CONFIDENCE_INTERVAL_Z_SCORE = 1.959964;
+
+constexpr double INFINITE = std::numeric_limits<double>::infinity();
+
+} // namespace
+
+size_t cxtournament::GetNbGames(const MatchScore& p_score)
+{
+    return p_score.m_nbWins + p_score.m_nbLosses + p_score.m_nbTies;
+}
+
+double cxtournament::GetPointsRatio(const MatchScore& p_score)
+{
+    const size_t nbGames = GetNbGames(p_score);
+    if(nbGames == 0u)
+    {
+        return 0.5;
+    }
+
+    const double nbPoints = static_cast<double>(p_score.m_nbWins) + 0.5 * static_cast<double>(p_score.m_nbTies);
+
+    return nbPoints / static_cast<double>(nbGames);
+}
+
+double cxtournament::GetPointsVariance(const MatchScore& p_score)
+{
+    const size_t nbGames = GetNbGames(p_score);
+    if(nbGames == 0u)
+    {
+        return 0.0;
+    }
+
+    const double pointsRatio = GetPointsRatio(p_score);
+    const double winDeviation = 1.0 - pointsRatio;
+    const double lossDeviation = 0.0 - pointsRatio;
+    const double tieDeviation = 0.5 - pointsRatio;
+
+    return (static_cast<double>(p_score.m_nbWins) * winDeviation * winDeviation +
+            static_cast<double>(p_score.m_nbLosses) * lossDeviation * lossDeviation +
+            static_cast<double>(p_score.m_nbTies) * tieDeviation * tieDeviation) / static_cast<double>(nbGames);
+}
+
+cxtournament::EloEstimate cxtournament::EstimateElo(const MatchScore& p_score)
+{
+    const size_t nbGames = GetNbGames(p_score);
+    if(nbGames == 0u)
+    {
+        return {};
+    }
+
+    const double pointsRatio = GetPointsRatio(p_score);
+    if(pointsRatio <= 0.0 || pointsRatio >= 1.0)
+    {
+        return {ToElo(pointsRatio), INFINITE};
+    }
+
+    const double variance = GetPointsVariance(p_score);
+
+    // The interval is computed on the points ratio, then converted to Elo, which is why it
+    // is not symmetric. Its average half width is reported:
+    const double standardError = std::sqrt(variance / static_cast<double>(nbGames));
+    const double lowerPointsRatio = pointsRatio - CONFIDENCE_INTERVAL_Z_SCORE * standardError;
+    const double upperPointsRatio = pointsRatio + CONFIDENCE_INTERVAL_Z_SCORE * standardError;
+    if(lowerPointsRatio <= 0.0 || upperPointsRatio >= 1.0)
+    {
+        return {ToElo(pointsRatio), INFINITE};
+    }
+
+    return {ToElo(pointsRatio), (ToElo(upperPointsRatio) - ToElo(lowerPointsRatio)) / 2.0};
+}
+
+double cxtournament::ToElo(double p_pointsRatio)
+{
+    PRECONDITION(p_pointsRatio >= 0.0);
+    PRECONDITION(p_pointsRatio <= 1.0);
+
+    if(p_pointsRatio <= 0.0)
+    {
+        return -INFINITE;
+    }
+
+    if(p_pointsRatio >= 1.0)
+    {
+        return INFINITE;
+    }
+
+    return -400.0 * std::log10(1.0 / p_pointsRatio - 1.0);
+}
+
+double cxtournament::ToPointsRatio(double p_eloDifference)
+{
+    return 1.0 / (1.0 + std::pow(10.0, -p_eloDifference / 400.0));
+}
@@ -0,0 +1,173 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file ResultsJournal.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <sstream>
+
+#include <cxinv/assertion.h>
+#include <cxtournament/ResultsJournal.h>
+
+namespace
+{
+
+const std::string WIN_TOKEN = "1-0";
+const std::string LOSS_TOKEN = "0-1";
+const std::string TIE_TOKEN = "1/2-1/2";
+
+const std::string& ToToken(cxtournament::GameOutcome p_outcome)
+{
+    switch(p_outcome)
+    {
+        case cxtournament::GameOutcome::WIN:
+            return WIN_TOKEN;
+
+        case cxtournament::GameOutcome::LOSS:
+            return LOSS_TOKEN;
+
+        case cxtournament::GameOutcome::TIE:
+            return TIE_TOKEN;
+
+        default:
+            break;
+    }
+
+    ASSERT_ERROR_MSG("Unknown game outcome");
+    return TIE_TOKEN;
+}
+
+bool ParseRecord(const std::string& p_line, cxtournament::GameRecord& p_record)
+{
+    std::istringstream stream{p_line};
+
+    std::string outcome;
+    if(!(stream >> p_record.m_pairingIndex >> p_record.m_gameIndex >> outcome))
+    {
+        return false;
+    }
+
+    // The seed is optional:
+    std::string extra;
+    if(stream >> p_record.m_seed)
+    {
+        if(stream >> extra)
+        {
+            return false;
+        }
+    }
+    else if(!stream.eof())
+    {
+        return false;
+    }
+
+    if(outcome == WIN_TOKEN)
+    {
+        p_record.m_outcome = cxtournament::GameOutcome::WIN;
+    }
+    else if(outcome == LOSS_TOKEN)
+    {
+        p_record.m_outcome = cxtournament::GameOutcome::LOSS;
+    }
+    else if(outcome == TIE_TOKEN)
+    {
+        p_record.m_outcome = cxtournament::GameOutcome::TIE;
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace
+
+cxtournament::ResultsJournal::ResultsJournal(const std::string& p_filePath, const std::string& p_header)
+ : m_filePath{p_filePath}
+ , m_header{p_header}
+{
+    PRECONDITION(!p_header.empty());
+    PRECONDITION(p_header.find('\n') == std::string::npos);
+}
+
+cxmodel::Status cxtournament::ResultsJournal::Open()
+{
+    IF_CONDITION_NOT_MET_DO(!m_file.is_open(), return cxmodel::MakeError("The results file is already open."););
+
+    bool endsWithNewLine = true;
+    bool isNew = true;
+    {
+        std::ifstream existing{m_filePath};
+        std::string line;
+        if(std::getline(existing, line))
+        {
+            isNew = false;
+            if(line != m_header)
+            {
+                return cxmodel::MakeError("The results file '" + m_filePath + "' belongs to another tournament.");
+            }
+
+            endsWithNewLine = !existing.eof();
+            while(std::getline(existing, line))
+            {
+                endsWithNewLine = !existing.eof();
+
+                // A line cut short may still parse (for example, if the seed is cut), so it
+                // is ignored:
+                GameRecord record;
+                if(endsWithNewLine && ParseRecord(line, record))
+                {
+                    m_previousRecords.push_back(record);
+                }
+            }
+        }
+    }
+
+    m_file.open(m_filePath, std::ios::app);
+    if(!m_file.is_open())
+    {
+        return cxmodel::MakeError("The results file '" + m_filePath + "' can't be opened.");
+    }
+
+    if(isNew)
+    {
+        m_file << m_header << std::endl;
+    }
+    else if(!endsWithNewLine)
+    {
+        // The last line was cut short, do not append to it:
+        m_file << std::endl;
+    }
+
+    return cxmodel::MakeSuccess();
+}
+
+const std::vector<cxtournament::GameRecord>& cxtournament::ResultsJournal::GetPreviousRecords() const
+{
+    return m_previousRecords;
+}
+
+void cxtournament::ResultsJournal::Append(const GameRecord& p_record)
+{
+    IF_PRECONDITION_NOT_MET_DO(m_file.is_open(), return;);
+
+    m_file << p_record.m_pairingIndex << ' ' << p_record.m_gameIndex << ' ' << ToToken(p_record.m_outcome) << ' ' << p_record.m_seed << std::endl;
+}
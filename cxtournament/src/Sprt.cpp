@@ -0,0 +1,69 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file Sprt.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <cmath>
+
+#include <cxinv/assertion.h>
+#include <cxtournament/Sprt.h>
+
+double cxtournament::ComputeLogLikelihoodRatio(const MatchScore& p_score, const SprtSettings& p_settings)
+{
+    const double nbWins = static_cast<double>(p_score.m_nbWins) + 0.5 * static_cast<double>(p_score.m_nbTies);
+    const double nbLosses = static_cast<double>(p_score.m_nbLosses) + 0.5 * static_cast<double>(p_score.m_nbTies);
+
+    const double pointsRatio0 = ToPointsRatio(p_settings.m_elo0);
+    const double pointsRatio1 = ToPointsRatio(p_settings.m_elo1);
+
+    return nbWins * std::log(pointsRatio1 / pointsRatio0) + nbLosses * std::log((1.0 - pointsRatio1) / (1.0 - pointsRatio0));
+}
+
+double cxtournament::GetLowerBound(const SprtSettings& p_settings)
+{
+    return std::log(p_settings.m_beta / (1.0 - p_settings.m_alpha));
+}
+
+double cxtournament::GetUpperBound(const SprtSettings& p_settings)
+{
+    return std::log((1.0 - p_settings.m_beta) / p_settings.m_alpha);
+}
+
+cxtournament::SprtDecision cxtournament::Decide(const MatchScore& p_score, const SprtSettings& p_settings)
+{
+    PRECONDITION(p_settings.m_elo0 < p_settings.m_elo1);
+    PRECONDITION(p_settings.m_alpha > 0.0 && p_settings.m_alpha < 1.0);
+    PRECONDITION(p_settings.m_beta > 0.0 && p_settings.m_beta < 1.0);
+
+    const double logLikelihoodRatio = ComputeLogLikelihoodRatio(p_score, p_settings);
+
+    if(logLikelihoodRatio <= GetLowerBound(p_settings))
+    {
+        return SprtDecision::ACCEPT_H0;
+    }
+
+    if(logLikelihoodRatio >= GetUpperBound(p_settings))
+    {
+        return SprtDecision::ACCEPT_H1;
+    }
+
+    return SprtDecision::CONTINUE;
+}
@@ -0,0 +1,423 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file Tournament.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <sstream>
+#include <utility>
+
+#include <cxinv/assertion.h>
+#include <cxlog/ILogger.h>
+#include <cxmodel/BotGame.h>
+#include <cxmodel/ChipColor.h>
+#include <cxmodel/IPlayer.h>
+#include <cxmodel/Model.h>
+#include <cxmodel/MoveJournal.h>
+#include <cxmodel/NewGameInformation.h>
+#include <cxmodel/RandomNumberGenerator.h>
+#include <cxtournament/Tournament.h>
+#include <cxtournament/WorkStealingPool.h>
+
+namespace
+{
+
+constexpr size_t MOVE_JOURNAL_SIZE = 200u;
+
+/*************************************************************************************************
+ * @brief Logger dropping every message.
+ *
+ * Hundreds of games are played every second, logging them would take longer than playing
+ * them.
+ *
+ ************************************************************************************************/
+class NullLogger final : public cxlog::ILogger
+{
+
+public:
+
+    void Log(const cxlog::VerbosityLevel /*p_verbosityLevel*/,
+             const std::string& /*p_fileName*/,
+             const std::string& /*p_functionName*/,
+             const size_t /*p_lineNumber*/,
+             const std::string& /*p_message*/) override
+    {
+    }
+
+    void SetVerbosityLevel(const cxlog::VerbosityLevel /*p_verbosityLevel*/) override
+    {
+    }
+
+    [[nodiscard]] cxlog::VerbosityLevel GetVerbosityLevel() const override
+    {
+        return cxlog::VerbosityLevel::NONE;
+    }
+
+};
+
+} // namespace
+
+/*************************************************************************************************
+ * @brief A worker thread's own model.
+ *
+ ************************************************************************************************/
+class cxtournament::Tournament::Worker final
+{
+
+public:
+
+    Worker()
+    : m_model{cxmodel::MoveJournal{MOVE_JOURNAL_SIZE}, m_logger}
+    {
+    }
+
+    cxmodel::Model& GetModel()
+    {
+        return m_model;
+    }
+
+private:
+
+    NullLogger m_logger;
+    cxmodel::Model m_model;
+
+};
+
+std::vector<cxtournament::Pairing> cxtournament::MakePairings(TournamentFormat p_format, size_t p_nbBots)
+{
+    std::vector<Pairing> pairings;
+
+    switch(p_format)
+    {
+        case TournamentFormat::ROUND_ROBIN:
+        {
+            for(size_t first = 0u; first < p_nbBots; ++first)
+            {
+                for(size_t second = first + 1u; second < p_nbBots; ++second)
+                {
+                    pairings.push_back({first, second});
+                }
+            }
+            break;
+        }
+
+        case TournamentFormat::GAUNTLET:
+        {
+            for(size_t second = 1u; second < p_nbBots; ++second)
+            {
+                pairings.push_back({0u, second});
+            }
+            break;
+        }
+
+        default:
+            ASSERT_ERROR_MSG("Unknown tournament format");
+            break;
+    }
+
+    return pairings;
+}
+
+std::vector<size_t> cxtournament::MakeOpening(std::uint32_t p_seed,
+                                              size_t p_openingIndex,
+                                              size_t p_gridWidth,
+                                              size_t p_gridHeight,
+                                              size_t p_nbDrops)
+{
+    PRECONDITION(p_nbDrops <= p_gridWidth * p_gridHeight);
+
+    std::seed_seq seeds{p_seed, static_cast<std::uint32_t>(p_openingIndex), static_cast<std::uint32_t>(static_cast<std::uint64_t>(p_openingIndex) >> 32u)};
+    std::mt19937 randomNumberGenerator{seeds};
+
+    std::vector<size_t> columnHeights(p_gridWidth, 0u);
+    std::vector<size_t> opening;
+    while(opening.size() < p_nbDrops)
+    {
+        std::uniform_int_distribution<size_t> distribution{0u, p_gridWidth - 1u};
+        const size_t column = distribution(randomNumberGenerator);
+
+        if(columnHeights[column] < p_gridHeight)
+        {
+            ++columnHeights[column];
+            opening.push_back(column);
+        }
+    }
+
+    return opening;
+}
+
+std::uint64_t cxtournament::MakeGameSeed(std::uint32_t p_seed, size_t p_pairingIndex, size_t p_gameIndex)
+{
+    return cxmodel::MixSeed(cxmodel::MixSeed(p_seed, p_pairingIndex), p_gameIndex);
+}
+
+cxtournament::Tournament::Tournament(const TournamentSettings& p_settings)
+ : m_settings{p_settings}
+{
+}
+
+cxtournament::Tournament::~Tournament() = default;
+
+cxmodel::Status cxtournament::Tournament::Run()
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    for(size_t workerIndex = 0u; workerIndex < std::max<size_t>(m_settings.m_nbThreads, 1u); ++workerIndex)
+    {
+        workers.push_back(std::make_unique<Worker>());
+    }
+
+    const cxmodel::Status validation = Validate(workers.front()->GetModel());
+    ON_ERROR(validation, return validation;);
+
+    m_results = {};
+    m_hasStuckGame = false;
+    for(const Pairing& pairing : MakePairings(m_settings.m_format, m_settings.m_bots.size()))
+    {
+        m_results.m_pairings.push_back({pairing, {}, SprtDecision::CONTINUE});
+    }
+
+    // Games saved by a previous run count, but are not played again:
+    std::set<std::pair<size_t, size_t>> savedGames;
+    m_journal.reset();
+    if(!m_settings.m_resultsFilePath.empty())
+    {
+        m_journal = std::make_unique<ResultsJournal>(m_settings.m_resultsFilePath, MakeHeader());
+
+        const cxmodel::Status openStatus = m_journal->Open();
+        ON_ERROR(openStatus, return openStatus;);
+
+        for(const GameRecord& record : m_journal->GetPreviousRecords())
+        {
+            const bool isKnownGame = record.m_pairingIndex < m_results.m_pairings.size() &&
+                                     record.m_gameIndex < m_settings.m_nbGamesPerPairing;
+
+            if(isKnownGame && savedGames.insert({record.m_pairingIndex, record.m_gameIndex}).second)
+            {
+                Record(record);
+                ++m_results.m_nbResumedGames;
+            }
+        }
+    }
+
+    // Game by game, every pairing in turn, so that an interrupted round robin is balanced:
+    std::vector<WorkStealingPool::Task> tasks;
+    for(size_t gameIndex = 0u; gameIndex < m_settings.m_nbGamesPerPairing; ++gameIndex)
+    {
+        for(size_t pairingIndex = 0u; pairingIndex < m_results.m_pairings.size(); ++pairingIndex)
+        {
+            if(savedGames.count({pairingIndex, gameIndex}) == 0u)
+            {
+                tasks.push_back([this, &workers, pairingIndex, gameIndex](size_t p_workerIndex)
+                {
+                    PlayGame(*workers[p_workerIndex], pairingIndex, gameIndex);
+                });
+            }
+        }
+    }
+
+    WorkStealingPool pool{workers.size()};
+    pool.Run(std::move(tasks));
+
+    m_results.m_duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    if(m_hasStuckGame)
+    {
+        return cxmodel::MakeError("Some games did not end.");
+    }
+
+    return cxmodel::MakeSuccess();
+}
+
+const cxtournament::TournamentResults& cxtournament::Tournament::GetResults() const
+{
+    return m_results;
+}
+
+cxmodel::Status cxtournament::Tournament::Validate(const cxmodel::IConnectXLimits& p_limits) const
+{
+    if(m_settings.m_bots.size() < 2u)
+    {
+        return cxmodel::MakeError("At least two bots are needed.");
+    }
+
+    if(m_settings.m_nbGamesPerPairing == 0u)
+    {
+        return cxmodel::MakeError("At least one game per pairing is needed.");
+    }
+
+    if(m_settings.m_gridWidth < p_limits.GetMinimumGridWidth() || m_settings.m_gridWidth > p_limits.GetMaximumGridWidth() ||
+       m_settings.m_gridHeight < p_limits.GetMinimumGridHeight() || m_settings.m_gridHeight > p_limits.GetMaximumGridHeight())
+    {
+        return cxmodel::MakeError("The board size is not supported.");
+    }
+
+    if(m_settings.m_inARowValue < p_limits.GetMinimumInARowValue() || m_settings.m_inARowValue > p_limits.GetMaximumInARowValue() ||
+       m_settings.m_inARowValue > std::max(m_settings.m_gridWidth, m_settings.m_gridHeight))
+    {
+        return cxmodel::MakeError("The in-a-row value is not supported.");
+    }
+
+    // With fewer drops than this, neither bot can line up enough discs to win:
+    if(m_settings.m_nbOpeningDrops >= 2u * m_settings.m_inARowValue - 1u ||
+       m_settings.m_nbOpeningDrops >= m_settings.m_gridWidth * m_settings.m_gridHeight)
+    {
+        return cxmodel::MakeError("Openings are too long.");
+    }
+
+    if(m_settings.m_sprt)
+    {
+        const SprtSettings& sprt = *m_settings.m_sprt;
+        if(sprt.m_elo0 >= sprt.m_elo1 || sprt.m_alpha <= 0.0 || sprt.m_alpha >= 1.0 || sprt.m_beta <= 0.0 || sprt.m_beta >= 1.0)
+        {
+            return cxmodel::MakeError("The SPRT settings are invalid.");
+        }
+    }
+
+    return cxmodel::MakeSuccess();
+}
+
+std::string cxtournament::Tournament::MakeHeader() const
+{
+    // Everything that changes which games are played, but not how many threads play them:
+    std::ostringstream header;
+    header << "connectx tournament: "
+           << (m_settings.m_format == TournamentFormat::GAUNTLET ? "gauntlet" : "round robin")
+           << ", bots=";
+
+    for(size_t botIndex = 0u; botIndex < m_settings.m_bots.size(); ++botIndex)
+    {
+        header << (botIndex == 0u ? "" : ",") << m_settings.m_bots[botIndex];
+    }
+
+    header << ", games=" << m_settings.m_nbGamesPerPairing
+           << ", board=" << m_settings.m_gridWidth << "x" << m_settings.m_gridHeight
+           << ", inarow=" << m_settings.m_inARowValue
+           << ", openings=" << m_settings.m_nbOpeningDrops
+           << ", seed=" << m_settings.m_seed;
+
+    return header.str();
+}
+
+bool cxtournament::Tournament::IsDecided(size_t p_pairingIndex) const
+{
+    return m_results.m_pairings[p_pairingIndex].m_sprtDecision != SprtDecision::CONTINUE;
+}
+
+void cxtournament::Tournament::PlayGame(Worker& p_worker, size_t p_pairingIndex, size_t p_gameIndex)
+{
+    {
+        std::lock_guard<std::mutex> lock{m_resultsMutex};
+        if(IsDecided(p_pairingIndex) || m_hasStuckGame)
+        {
+            return;
+        }
+    }
+
+    const Pairing pairing = m_results.m_pairings[p_pairingIndex].m_pairing;
+
+    // Every opening is played twice, each bot dropping first once:
+    const bool isFirstBotFirst = (p_gameIndex % 2u == 0u);
+    const size_t firstToDrop = isFirstBotFirst ? pairing.m_first : pairing.m_second;
+    const size_t secondToDrop = isFirstBotFirst ? pairing.m_second : pairing.m_first;
+
+    cxmodel::NewGameInformation gameInformation;
+    gameInformation.m_gridWidth = m_settings.m_gridWidth;
+    gameInformation.m_gridHeight = m_settings.m_gridHeight;
+    gameInformation.m_inARowValue = m_settings.m_inARowValue;
+    gameInformation.m_seed = MakeGameSeed(m_settings.m_seed, p_pairingIndex, p_gameIndex);
+    gameInformation.m_players.push_back(cxmodel::CreatePlayer(cxmodel::MakeBotName(firstToDrop), cxmodel::MakeRed(), cxmodel::PlayerType::BOT, m_settings.m_bots[firstToDrop]));
+    gameInformation.m_players.push_back(cxmodel::CreatePlayer(cxmodel::MakeBotName(secondToDrop), cxmodel::MakeBlue(), cxmodel::PlayerType::BOT, m_settings.m_bots[secondToDrop]));
+
+    cxmodel::Model& model = p_worker.GetModel();
+    model.CreateNewGame(std::move(gameInformation));
+
+    const std::vector<size_t> opening = MakeOpening(m_settings.m_seed,
+                                                    p_gameIndex / 2u,
+                                                    m_settings.m_gridWidth,
+                                                    m_settings.m_gridHeight,
+                                                    m_settings.m_nbOpeningDrops);
+
+    // The opening is dropped at once, so that the bots only search the positions they play:
+    const size_t nbOpeningDrops = model.ApplyMoves(opening);
+    const cxmodel::BotGameOutcome outcome = cxmodel::PlayBotGame(model, model, model, 2u, nbOpeningDrops);
+
+    GameRecord record{p_pairingIndex, p_gameIndex, GameOutcome::TIE, model.GetSeed()};
+    const bool isStuck = !outcome.m_isOver;
+    if(outcome.m_winnerIndex)
+    {
+        // The first bot is the first player when it drops first:
+        const bool isFirstBotWinner = ((*outcome.m_winnerIndex == 0u) == isFirstBotFirst);
+        record.m_outcome = isFirstBotWinner ? GameOutcome::WIN : GameOutcome::LOSS;
+    }
+
+    model.EndCurrentGame();
+
+    std::lock_guard<std::mutex> lock{m_resultsMutex};
+    if(isStuck)
+    {
+        m_hasStuckGame = true;
+        return;
+    }
+
+    if(m_journal)
+    {
+        m_journal->Append(record);
+    }
+
+    Record(record);
+    ++m_results.m_nbPlayedGames;
+    m_results.m_nbMoves += nbOpeningDrops + outcome.m_nbMoves;
+}
+
+void cxtournament::Tournament::Record(const GameRecord& p_record)
+{
+    PairingResults& results = m_results.m_pairings[p_record.m_pairingIndex];
+
+    switch(p_record.m_outcome)
+    {
+        case GameOutcome::WIN:
+            ++results.m_score.m_nbWins;
+            break;
+
+        case GameOutcome::LOSS:
+            ++results.m_score.m_nbLosses;
+            break;
+
+        case GameOutcome::TIE:
+            ++results.m_score.m_nbTies;
+            break;
+
+        default:
+            ASSERT_ERROR_MSG("Unknown game outcome");
+            break;
+    }
+
+    // Games already being played when the test is decided still count, but the decision
+    // is final:
+    if(m_settings.m_sprt && results.m_sprtDecision == SprtDecision::CONTINUE)
+    {
+        results.m_sprtDecision = Decide(results.m_score, *m_settings.m_sprt);
+    }
+}
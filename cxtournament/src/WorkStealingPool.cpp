@@ -0,0 +1,113 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file WorkStealingPool.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <thread>
+
+#include <cxinv/assertion.h>
+#include <cxtournament/WorkStealingPool.h>
+
+cxtournament::WorkStealingPool::WorkStealingPool(size_t p_nbWorkers)
+{
+    PRECONDITION(p_nbWorkers > 0u);
+
+    for(size_t workerIndex = 0u; workerIndex < p_nbWorkers; ++workerIndex)
+    {
+        m_queues.push_back(std::make_unique<Queue>());
+    }
+}
+
+size_t cxtournament::WorkStealingPool::GetNbWorkers() const
+{
+    return m_queues.size();
+}
+
+void cxtournament::WorkStealingPool::Run(std::vector<Task>&& p_tasks)
+{
+    IF_CONDITION_NOT_MET_DO(!m_queues.empty(), return;);
+
+    // Tasks are dealt one at a time, so that tasks next to each other in the batch run at
+    // about the same time:
+    for(size_t taskIndex = 0u; taskIndex < p_tasks.size(); ++taskIndex)
+    {
+        m_queues[taskIndex % m_queues.size()]->m_tasks.push_back(std::move(p_tasks[taskIndex]));
+    }
+
+    // The calling thread is the first worker:
+    std::vector<std::thread> workers;
+    for(size_t workerIndex = 1u; workerIndex < m_queues.size(); ++workerIndex)
+    {
+        workers.emplace_back([this, workerIndex](){Work(workerIndex);});
+    }
+
+    Work(0u);
+
+    for(std::thread& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+void cxtournament::WorkStealingPool::Work(size_t p_workerIndex)
+{
+    // No task is added while workers run, so once every queue is empty, the worker is done:
+    Task task;
+    while(Pop(p_workerIndex, task) || Steal(p_workerIndex, task))
+    {
+        task(p_workerIndex);
+    }
+}
+
+bool cxtournament::WorkStealingPool::Pop(size_t p_workerIndex, Task& p_task)
+{
+    Queue& queue = *m_queues[p_workerIndex];
+
+    std::lock_guard<std::mutex> lock{queue.m_mutex};
+    if(queue.m_tasks.empty())
+    {
+        return false;
+    }
+
+    p_task = std::move(queue.m_tasks.front());
+    queue.m_tasks.pop_front();
+
+    return true;
+}
+
+bool cxtournament::WorkStealingPool::Steal(size_t p_workerIndex, Task& p_task)
+{
+    for(size_t offset = 1u; offset < m_queues.size(); ++offset)
+    {
+        Queue& victim = *m_queues[(p_workerIndex + offset) % m_queues.size()];
+
+        std::lock_guard<std::mutex> lock{victim.m_mutex};
+        if(!victim.m_tasks.empty())
+        {
+            p_task = std::move(victim.m_tasks.back());
+            victim.m_tasks.pop_back();
+
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,122 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file EloTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include <cxtournament/Elo.h>
+
+TEST(Elo, /*DISABLED_*/GetNbGames_SomeGames_AllOutcomesCounted)
+{
+    const cxtournament::MatchScore score{3u, 2u, 5u};
+
+    ASSERT_EQ(cxtournament::GetNbGames(score), 10u);
+}
+
+TEST(Elo, /*DISABLED_*/GetPointsRatio_NoGames_Half)
+{
+    ASSERT_DOUBLE_EQ(cxtournament::GetPointsRatio({}), 0.5);
+}
+
+TEST(Elo, /*DISABLED_*/GetPointsRatio_SomeGames_TiesWorthHalf)
+{
+    const cxtournament::MatchScore score{3u, 2u, 5u};
+
+    ASSERT_DOUBLE_EQ(cxtournament::GetPointsRatio(score), 0.55);
+}
+
+TEST(Elo, /*DISABLED_*/GetPointsVariance_OnlyTies_Zero)
+{
+    const cxtournament::MatchScore score{0u, 0u, 10u};
+
+    ASSERT_DOUBLE_EQ(cxtournament::GetPointsVariance(score), 0.0);
+}
+
+TEST(Elo, /*DISABLED_*/GetPointsVariance_HalfWinsHalfLosses_Quarter)
+{
+    const cxtournament::MatchScore score{5u, 5u, 0u};
+
+    ASSERT_DOUBLE_EQ(cxtournament::GetPointsVariance(score), 0.25);
+}
+
+TEST(Elo, /*DISABLED_*/ToElo_KnownPointsRatios_KnownDifferences)
+{
+    ASSERT_DOUBLE_EQ(cxtournament::ToElo(0.5), 0.0);
+    ASSERT_NEAR(cxtournament::ToElo(0.75), 190.85, 0.01);
+    ASSERT_NEAR(cxtournament::ToElo(0.25), -190.85, 0.01);
+    ASSERT_TRUE(std::isinf(cxtournament::ToElo(1.0)));
+    ASSERT_TRUE(std::isinf(cxtournament::ToElo(0.0)));
+}
+
+TEST(Elo, /*DISABLED_*/ToPointsRatio_ToElo_Inverses)
+{
+    for(const double elo : {-400.0, -35.0, 0.0, 10.0, 250.0})
+    {
+        ASSERT_NEAR(cxtournament::ToElo(cxtournament::ToPointsRatio(elo)), elo, 1e-9);
+    }
+}
+
+TEST(Elo, /*DISABLED_*/EstimateElo_NoGames_NoDifference)
+{
+    const cxtournament::EloEstimate estimate = cxtournament::EstimateElo({});
+
+    ASSERT_DOUBLE_EQ(estimate.m_difference, 0.0);
+    ASSERT_DOUBLE_EQ(estimate.m_errorMargin, 0.0);
+}
+
+TEST(Elo, /*DISABLED_*/EstimateElo_EvenScore_NoDifferenceWithMargin)
+{
+    const cxtournament::MatchScore score{400u, 400u, 200u};
+
+    const cxtournament::EloEstimate estimate = cxtournament::EstimateElo(score);
+
+    ASSERT_DOUBLE_EQ(estimate.m_difference, 0.0);
+
+    // Per game variance of 0.2, over 1000 games:
+    ASSERT_NEAR(estimate.m_errorMargin, 19.28, 0.05);
+}
+
+TEST(Elo, /*DISABLED_*/EstimateElo_MoreGames_SmallerMargin)
+{
+    const cxtournament::MatchScore fewGames{60u, 40u, 0u};
+    const cxtournament::MatchScore manyGames{600u, 400u, 0u};
+
+    const cxtournament::EloEstimate fewGamesEstimate = cxtournament::EstimateElo(fewGames);
+    const cxtournament::EloEstimate manyGamesEstimate = cxtournament::EstimateElo(manyGames);
+
+    ASSERT_DOUBLE_EQ(fewGamesEstimate.m_difference, manyGamesEstimate.m_difference);
+    ASSERT_GT(fewGamesEstimate.m_difference, 0.0);
+    ASSERT_LT(manyGamesEstimate.m_errorMargin, fewGamesEstimate.m_errorMargin);
+}
+
+TEST(Elo, /*DISABLED_*/EstimateElo_AllWins_InfiniteDifference)
+{
+    const cxtournament::MatchScore score{10u, 0u, 0u};
+
+    const cxtournament::EloEstimate estimate = cxtournament::EstimateElo(score);
+
+    ASSERT_TRUE(std::isinf(estimate.m_difference));
+    ASSERT_GT(estimate.m_difference, 0.0);
+    ASSERT_TRUE(std::isinf(estimate.m_errorMargin));
+}
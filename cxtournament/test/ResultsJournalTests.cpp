@@ -0,0 +1,129 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file ResultsJournalTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <cxunit/TemporaryFile.h>
+#include <cxtournament/ResultsJournal.h>
+
+namespace
+{
+
+const std::string HEADER = "connectx tournament: test";
+
+} // namespace
+
+TEST(ResultsJournal, /*DISABLED_*/Open_NoFile_FileCreatedWithHeader)
+{
+    const cxunit::TemporaryFile file{"cxtournament_journal_new.txt"};
+    cxtournament::ResultsJournal journal{file.GetPath(), HEADER};
+
+    ASSERT_TRUE(journal.Open().IsSuccess());
+    ASSERT_TRUE(journal.GetPreviousRecords().empty());
+    ASSERT_EQ(file.Read(), HEADER + "\n");
+}
+
+TEST(ResultsJournal, /*DISABLED_*/Append_SomeRecords_OneLinePerRecord)
+{
+    const cxunit::TemporaryFile file{"cxtournament_journal_append.txt"};
+    cxtournament::ResultsJournal journal{file.GetPath(), HEADER};
+    ASSERT_TRUE(journal.Open().IsSuccess());
+
+    journal.Append({0u, 0u, cxtournament::GameOutcome::WIN, 42u});
+    journal.Append({2u, 7u, cxtournament::GameOutcome::LOSS, 0u});
+    journal.Append({1u, 3u, cxtournament::GameOutcome::TIE, 18446744073709551615u});
+
+    ASSERT_EQ(file.Read(), HEADER + "\n"
+                           "0 0 1-0 42\n"
+                           "2 7 0-1 0\n"
+                           "1 3 1/2-1/2 18446744073709551615\n");
+}
+
+TEST(ResultsJournal, /*DISABLED_*/Open_ExistingFile_RecordsReadBack)
+{
+    const cxunit::TemporaryFile file{"cxtournament_journal_existing.txt"};
+    file.Write(HEADER + "\n"
+               "0 0 1-0\n"
+               "2 7 0-1 42\n");
+
+    cxtournament::ResultsJournal journal{file.GetPath(), HEADER};
+    ASSERT_TRUE(journal.Open().IsSuccess());
+
+    const std::vector<cxtournament::GameRecord>& records = journal.GetPreviousRecords();
+    ASSERT_EQ(records.size(), 2u);
+    ASSERT_EQ(records[0].m_seed, 0u);
+    ASSERT_EQ(records[1].m_pairingIndex, 2u);
+    ASSERT_EQ(records[1].m_gameIndex, 7u);
+    ASSERT_TRUE(records[1].m_outcome == cxtournament::GameOutcome::LOSS);
+    ASSERT_EQ(records[1].m_seed, 42u);
+
+    journal.Append({1u, 3u, cxtournament::GameOutcome::TIE, 5u});
+    ASSERT_EQ(file.Read(), HEADER + "\n"
+                           "0 0 1-0\n"
+                           "2 7 0-1 42\n"
+                           "1 3 1/2-1/2 5\n");
+}
+
+TEST(ResultsJournal, /*DISABLED_*/Open_LastLineCutShort_LineIgnoredAndNotAppendedTo)
+{
+    const cxunit::TemporaryFile file{"cxtournament_journal_cut.txt"};
+    file.Write(HEADER + "\n"
+               "0 0 1-0\n"
+               "2 7 0-");
+
+    cxtournament::ResultsJournal journal{file.GetPath(), HEADER};
+    ASSERT_TRUE(journal.Open().IsSuccess());
+    ASSERT_EQ(journal.GetPreviousRecords().size(), 1u);
+
+    journal.Append({2u, 7u, cxtournament::GameOutcome::LOSS, 0u});
+    ASSERT_EQ(file.Read(), HEADER + "\n"
+                           "0 0 1-0\n"
+                           "2 7 0-\n"
+                           "2 7 0-1 0\n");
+}
+
+TEST(ResultsJournal, /*DISABLED_*/Open_LastLineSeedCutShort_LineIgnored)
+{
+    const cxunit::TemporaryFile file{"cxtournament_journal_cut_seed.txt"};
+    file.Write(HEADER + "\n"
+               "0 0 1-0 42\n"
+               "2 7 0-1 4");
+
+    cxtournament::ResultsJournal journal{file.GetPath(), HEADER};
+    ASSERT_TRUE(journal.Open().IsSuccess());
+    ASSERT_EQ(journal.GetPreviousRecords().size(), 1u);
+    ASSERT_EQ(journal.GetPreviousRecords()[0].m_seed, 42u);
+}
+
+TEST(ResultsJournal, /*DISABLED_*/Open_OtherTournament_Error)
+{
+    const cxunit::TemporaryFile file{"cxtournament_journal_other.txt"};
+    file.Write("connectx tournament: other\n"
+               "0 0 1-0\n");
+
+    cxtournament::ResultsJournal journal{file.GetPath(), HEADER};
+
+    const cxmodel::Status status = journal.Open();
+    ASSERT_FALSE(status.IsSuccess());
+    ASSERT_EQ(status.GetMessage(), "The results file '" + file.GetPath() + "' belongs to another tournament.");
+}
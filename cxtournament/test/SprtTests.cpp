@@ -0,0 +1,92 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file SprtTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include <cxtournament/Sprt.h>
+
+TEST(Sprt, /*DISABLED_*/GetBounds_DefaultSettings_SymmetricBounds)
+{
+    const cxtournament::SprtSettings settings;
+
+    ASSERT_NEAR(cxtournament::GetLowerBound(settings), -2.944, 0.001);
+    ASSERT_NEAR(cxtournament::GetUpperBound(settings), 2.944, 0.001);
+}
+
+TEST(Sprt, /*DISABLED_*/ComputeLogLikelihoodRatio_NoGames_Zero)
+{
+    ASSERT_DOUBLE_EQ(cxtournament::ComputeLogLikelihoodRatio({}, {}), 0.0);
+}
+
+TEST(Sprt, /*DISABLED_*/ComputeLogLikelihoodRatio_Ties_HalfWinHalfLoss)
+{
+    const cxtournament::MatchScore ties{0u, 0u, 10u};
+    const cxtournament::MatchScore winsAndLosses{5u, 5u, 0u};
+
+    ASSERT_DOUBLE_EQ(cxtournament::ComputeLogLikelihoodRatio(ties, {}), cxtournament::ComputeLogLikelihoodRatio(winsAndLosses, {}));
+}
+
+TEST(Sprt, /*DISABLED_*/Decide_OnlyWins_AcceptH1AfterFewGames)
+{
+    cxtournament::SprtSettings settings;
+    settings.m_elo1 = 100.0;
+
+    ASSERT_TRUE(cxtournament::Decide({5u, 0u, 0u}, settings) == cxtournament::SprtDecision::CONTINUE);
+    ASSERT_TRUE(cxtournament::Decide({20u, 0u, 0u}, settings) == cxtournament::SprtDecision::ACCEPT_H1);
+}
+
+TEST(Sprt, /*DISABLED_*/ComputeLogLikelihoodRatio_ScoreBetweenHypotheses_Zero)
+{
+    cxtournament::SprtSettings settings;
+    settings.m_elo0 = -10.0;
+    settings.m_elo1 = 10.0;
+
+    const cxtournament::MatchScore score{100u, 100u, 50u};
+
+    ASSERT_NEAR(cxtournament::ComputeLogLikelihoodRatio(score, settings), 0.0, 1e-12);
+}
+
+TEST(Sprt, /*DISABLED_*/Decide_FewGames_Continue)
+{
+    const cxtournament::MatchScore score{6u, 4u, 2u};
+
+    ASSERT_TRUE(cxtournament::Decide(score, {}) == cxtournament::SprtDecision::CONTINUE);
+}
+
+TEST(Sprt, /*DISABLED_*/Decide_ClearlyStronger_AcceptH1)
+{
+    const cxtournament::MatchScore score{700u, 300u, 0u};
+
+    ASSERT_GT(cxtournament::ComputeLogLikelihoodRatio(score, {}), 0.0);
+    ASSERT_TRUE(cxtournament::Decide(score, {}) == cxtournament::SprtDecision::ACCEPT_H1);
+}
+
+TEST(Sprt, /*DISABLED_*/Decide_ClearlyWeaker_AcceptH0)
+{
+    const cxtournament::MatchScore score{300u, 700u, 0u};
+
+    ASSERT_LT(cxtournament::ComputeLogLikelihoodRatio(score, {}), 0.0);
+    ASSERT_TRUE(cxtournament::Decide(score, {}) == cxtournament::SprtDecision::ACCEPT_H0);
+}
@@ -0,0 +1,230 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file TournamentTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include <cxunit/TemporaryFile.h>
+#include <cxtournament/Tournament.h>
+
+namespace
+{
+
+cxtournament::TournamentSettings MakeRandomBotsSettings(size_t p_nbBots)
+{
+    cxtournament::TournamentSettings settings;
+    settings.m_bots.resize(p_nbBots);
+    settings.m_nbGamesPerPairing = 10u;
+    settings.m_nbThreads = 2u;
+
+    return settings;
+}
+
+size_t GetNbGames(const cxtournament::TournamentResults& p_results)
+{
+    size_t nbGames = 0u;
+    for(const cxtournament::PairingResults& pairing : p_results.m_pairings)
+    {
+        nbGames += cxtournament::GetNbGames(pairing.m_score);
+    }
+
+    return nbGames;
+}
+
+} // namespace
+
+TEST(Tournament, /*DISABLED_*/MakePairings_RoundRobin_EveryBotPlaysEveryOtherOnce)
+{
+    const std::vector<cxtournament::Pairing> pairings = cxtournament::MakePairings(cxtournament::TournamentFormat::ROUND_ROBIN, 4u);
+
+    ASSERT_EQ(pairings.size(), 6u);
+    for(size_t first = 0u; first < 4u; ++first)
+    {
+        for(size_t second = first + 1u; second < 4u; ++second)
+        {
+            const auto isPairing = [first, second](const cxtournament::Pairing& p_pairing)
+            {
+                return p_pairing.m_first == first && p_pairing.m_second == second;
+            };
+
+            ASSERT_EQ(std::count_if(pairings.cbegin(), pairings.cend(), isPairing), 1);
+        }
+    }
+}
+
+TEST(Tournament, /*DISABLED_*/MakePairings_Gauntlet_FirstBotPlaysEveryOther)
+{
+    const std::vector<cxtournament::Pairing> pairings = cxtournament::MakePairings(cxtournament::TournamentFormat::GAUNTLET, 4u);
+
+    ASSERT_EQ(pairings.size(), 3u);
+    for(size_t index = 0u; index < pairings.size(); ++index)
+    {
+        ASSERT_EQ(pairings[index].m_first, 0u);
+        ASSERT_EQ(pairings[index].m_second, index + 1u);
+    }
+}
+
+TEST(Tournament, /*DISABLED_*/MakeOpening_SameArguments_SameOpening)
+{
+    const std::vector<size_t> opening = cxtournament::MakeOpening(42u, 3u, 7u, 6u, 4u);
+
+    ASSERT_EQ(opening.size(), 4u);
+    ASSERT_EQ(opening, cxtournament::MakeOpening(42u, 3u, 7u, 6u, 4u));
+}
+
+TEST(Tournament, /*DISABLED_*/MakeOpening_FullBoard_NoColumnOverflow)
+{
+    const std::vector<size_t> opening = cxtournament::MakeOpening(42u, 0u, 3u, 2u, 6u);
+
+    std::vector<size_t> columnHeights(3u, 0u);
+    for(const size_t column : opening)
+    {
+        ASSERT_LT(column, 3u);
+        ++columnHeights[column];
+    }
+
+    ASSERT_EQ(columnHeights, std::vector<size_t>(3u, 2u));
+}
+
+TEST(Tournament, /*DISABLED_*/MakeOpening_DifferentIndexes_DifferentOpenings)
+{
+    const std::vector<size_t> firstOpening = cxtournament::MakeOpening(42u, 0u, 7u, 6u, 6u);
+
+    bool isDifferent = false;
+    for(size_t openingIndex = 1u; openingIndex < 10u; ++openingIndex)
+    {
+        isDifferent = isDifferent || (firstOpening != cxtournament::MakeOpening(42u, openingIndex, 7u, 6u, 6u));
+    }
+
+    ASSERT_TRUE(isDifferent);
+}
+
+TEST(Tournament, /*DISABLED_*/MakeGameSeed_DifferentGames_DifferentSeeds)
+{
+    ASSERT_EQ(cxtournament::MakeGameSeed(42u, 1u, 2u), cxtournament::MakeGameSeed(42u, 1u, 2u));
+    ASSERT_NE(cxtournament::MakeGameSeed(42u, 1u, 2u), cxtournament::MakeGameSeed(42u, 2u, 1u));
+    ASSERT_NE(cxtournament::MakeGameSeed(42u, 1u, 2u), cxtournament::MakeGameSeed(43u, 1u, 2u));
+}
+
+TEST(Tournament, /*DISABLED_*/Run_RoundRobin_EveryGamePlayed)
+{
+    cxtournament::Tournament tournament{MakeRandomBotsSettings(3u)};
+
+    ASSERT_TRUE(tournament.Run().IsSuccess());
+
+    const cxtournament::TournamentResults& results = tournament.GetResults();
+    ASSERT_EQ(results.m_pairings.size(), 3u);
+    for(const cxtournament::PairingResults& pairing : results.m_pairings)
+    {
+        ASSERT_EQ(cxtournament::GetNbGames(pairing.m_score), 10u);
+        ASSERT_TRUE(pairing.m_sprtDecision == cxtournament::SprtDecision::CONTINUE);
+    }
+
+    ASSERT_EQ(results.m_nbPlayedGames, 30u);
+    ASSERT_EQ(results.m_nbResumedGames, 0u);
+    ASSERT_GE(results.m_nbMoves, 30u * 7u);
+}
+
+TEST(Tournament, /*DISABLED_*/Run_InvalidSettings_Error)
+{
+    cxtournament::TournamentSettings settings = MakeRandomBotsSettings(2u);
+    settings.m_nbOpeningDrops = 7u;
+
+    cxtournament::Tournament tournament{settings};
+
+    const cxmodel::Status status = tournament.Run();
+    ASSERT_FALSE(status.IsSuccess());
+    ASSERT_EQ(status.GetMessage(), "Openings are too long.");
+}
+
+TEST(Tournament, /*DISABLED_*/Run_OneBot_Error)
+{
+    cxtournament::Tournament tournament{MakeRandomBotsSettings(1u)};
+
+    ASSERT_FALSE(tournament.Run().IsSuccess());
+}
+
+TEST(Tournament, /*DISABLED_*/Run_Sprt_PairingStopsOnceDecided)
+{
+    // Alpha-beta against random is decided quickly:
+    cxtournament::TournamentSettings settings = MakeRandomBotsSettings(2u);
+    settings.m_bots[0].m_algorithm = cxmodel::DropColumnComputation::ALPHA_BETA;
+    settings.m_bots[0].m_budgetType = cxmodel::SearchBudgetType::NODES;
+    settings.m_bots[0].m_budget = 2000u;
+    settings.m_nbGamesPerPairing = 200u;
+    settings.m_sprt = cxtournament::SprtSettings{0.0, 100.0, 0.05, 0.05};
+
+    cxtournament::Tournament tournament{settings};
+    ASSERT_TRUE(tournament.Run().IsSuccess());
+
+    const cxtournament::PairingResults& pairing = tournament.GetResults().m_pairings.front();
+    ASSERT_TRUE(pairing.m_sprtDecision == cxtournament::SprtDecision::ACCEPT_H1);
+    ASSERT_LT(cxtournament::GetNbGames(pairing.m_score), 200u);
+}
+
+TEST(Tournament, /*DISABLED_*/Run_ResultsFile_InterruptedRunResumed)
+{
+    const cxunit::TemporaryFile file{"cxtournament_tournament_resume.txt"};
+
+    cxtournament::TournamentSettings settings = MakeRandomBotsSettings(2u);
+    settings.m_resultsFilePath = file.GetPath();
+
+    {
+        cxtournament::Tournament tournament{settings};
+        ASSERT_TRUE(tournament.Run().IsSuccess());
+    }
+
+    // Only keep the header and the first four games, as if the run had been interrupted:
+    const std::string contents = file.Read();
+    size_t position = 0u;
+    for(size_t lineIndex = 0u; lineIndex < 5u; ++lineIndex)
+    {
+        position = contents.find('\n', position) + 1u;
+    }
+    file.Write(contents.substr(0u, position));
+
+    cxtournament::Tournament tournament{settings};
+    ASSERT_TRUE(tournament.Run().IsSuccess());
+
+    const cxtournament::TournamentResults& results = tournament.GetResults();
+    ASSERT_EQ(results.m_nbResumedGames, 4u);
+    ASSERT_EQ(results.m_nbPlayedGames, 6u);
+    ASSERT_EQ(GetNbGames(results), 10u);
+}
+
+TEST(Tournament, /*DISABLED_*/Run_ResultsFileOfOtherTournament_Error)
+{
+    const cxunit::TemporaryFile file{"cxtournament_tournament_other.txt"};
+
+    cxtournament::TournamentSettings settings = MakeRandomBotsSettings(2u);
+    settings.m_resultsFilePath = file.GetPath();
+    {
+        cxtournament::Tournament tournament{settings};
+        ASSERT_TRUE(tournament.Run().IsSuccess());
+    }
+
+    settings.m_seed = 1u;
+    cxtournament::Tournament tournament{settings};
+    ASSERT_FALSE(tournament.Run().IsSuccess());
+}
@@ -0,0 +1,102 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file WorkStealingPoolTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <cxtournament/WorkStealingPool.h>
+
+TEST(WorkStealingPool, /*DISABLED_*/GetNbWorkers_SomeWorkers_SameNumber)
+{
+    const cxtournament::WorkStealingPool pool{3u};
+
+    ASSERT_EQ(pool.GetNbWorkers(), 3u);
+}
+
+TEST(WorkStealingPool, /*DISABLED_*/Run_NoTasks_Returns)
+{
+    cxtournament::WorkStealingPool pool{4u};
+
+    pool.Run({});
+}
+
+TEST(WorkStealingPool, /*DISABLED_*/Run_ManyTasks_EveryTaskRunOnce)
+{
+    constexpr size_t NB_TASKS = 1000u;
+
+    std::vector<std::atomic<size_t>> nbRuns(NB_TASKS);
+    std::vector<cxtournament::WorkStealingPool::Task> tasks;
+    for(size_t taskIndex = 0u; taskIndex < NB_TASKS; ++taskIndex)
+    {
+        tasks.push_back([&nbRuns, taskIndex](size_t /*p_workerIndex*/){++nbRuns[taskIndex];});
+    }
+
+    cxtournament::WorkStealingPool pool{4u};
+    pool.Run(std::move(tasks));
+
+    for(const std::atomic<size_t>& nbTaskRuns : nbRuns)
+    {
+        ASSERT_EQ(nbTaskRuns, 1u);
+    }
+}
+
+TEST(WorkStealingPool, /*DISABLED_*/Run_TasksOfOneWorkerBlocked_OtherWorkersStealThem)
+{
+    // The first task blocks its worker until every other task is done. Since the blocked
+    // worker's queue still holds tasks, they must be stolen for the batch to complete:
+    constexpr size_t NB_TASKS = 40u;
+
+    std::atomic<size_t> nbDone{0u};
+    std::vector<cxtournament::WorkStealingPool::Task> tasks;
+    tasks.push_back([&nbDone](size_t /*p_workerIndex*/)
+    {
+        while(nbDone < NB_TASKS - 1u)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+
+    std::mutex workersMutex;
+    std::set<size_t> workers;
+    for(size_t taskIndex = 1u; taskIndex < NB_TASKS; ++taskIndex)
+    {
+        tasks.push_back([&nbDone, &workersMutex, &workers](size_t p_workerIndex)
+        {
+            std::lock_guard<std::mutex> lock{workersMutex};
+            workers.insert(p_workerIndex);
+            ++nbDone;
+        });
+    }
+
+    cxtournament::WorkStealingPool pool{2u};
+    pool.Run(std::move(tasks));
+
+    ASSERT_EQ(nbDone, NB_TASKS - 1u);
+    ASSERT_EQ(workers.size(), 1u);
+}
@@ -0,0 +1,87 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file TemporaryFile.h
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#ifndef TEMPORARYFILE_H_D4310313_F8CF_4DCD_A5F4_D283A3715296
+#define TEMPORARYFILE_H_D4310313_F8CF_4DCD_A5F4_D283A3715296
+
+#include <string>
+
+namespace cxunit
+{
+
+/*********************************************************************************************//**
+ * @brief A file path in the temporary directory, removed on construction and destruction.
+ *
+ ************************************************************************************************/
+class TemporaryFile final
+{
+
+public:
+
+    /*****************************************************************************************//**
+     * @brief Constructor.
+     *
+     * @param p_fileName The file name, unique to the test using it.
+     *
+     ********************************************************************************************/
+    explicit TemporaryFile(const std::string& p_fileName);
+
+    /*****************************************************************************************//**
+     * @brief Destructor.
+     *
+     ********************************************************************************************/
+    ~TemporaryFile();
+
+    /*****************************************************************************************//**
+     * @brief Gets the file path.
+     *
+     * @return The file path.
+     *
+     ********************************************************************************************/
+    const std::string& GetPath() const;
+
+    /*****************************************************************************************//**
+     * @brief Reads the whole file.
+     *
+     * @return The file contents.
+     *
+     ********************************************************************************************/
+    std::string Read() const;
+
+    /*****************************************************************************************//**
+     * @brief Replaces the file contents.
+     *
+     * @param p_contents The new contents.
+     *
+     ********************************************************************************************/
+    void Write(const std::string& p_contents) const;
+
+private:
+
+    const std::string m_path;
+
+};
+
+} // namespace cxunit
+
+#endif // TEMPORARYFILE_H_D4310313_F8CF_4DCD_A5F4_D283A3715296
@@ -0,0 +1,60 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file TemporaryFile.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include <cxunit/TemporaryFile.h>
+
+cxunit::TemporaryFile::TemporaryFile(const std::string& p_fileName)
+: m_path{(std::filesystem::temp_directory_path() / p_fileName).string()}
+{
+    std::filesystem::remove(m_path);
+}
+
+cxunit::TemporaryFile::~TemporaryFile()
+{
+    std::error_code error;
+    std::filesystem::remove(m_path, error);
+}
+
+const std::string& cxunit::TemporaryFile::GetPath() const
+{
+    return m_path;
+}
+
+std::string cxunit::TemporaryFile::Read() const
+{
+    std::ifstream file{m_path};
+    std::ostringstream contents;
+    contents << file.rdbuf();
+
+    return contents.str();
+}
+
+void cxunit::TemporaryFile::Write(const std::string& p_contents) const
+{
+    std::ofstream file{m_path, std::ios::trunc};
+    file << p_contents;
+}
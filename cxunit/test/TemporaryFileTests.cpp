@@ -0,0 +1,63 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file TemporaryFileTests.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <filesystem>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <cxunit/TemporaryFile.h>
+
+TEST(TemporaryFile, /*DISABLED_*/Constructor_ExistingFile_FileRemoved)
+{
+    const cxunit::TemporaryFile previous{"cxunit_temporaryfile_existing.txt"};
+    previous.Write("Previous contents");
+
+    const cxunit::TemporaryFile file{"cxunit_temporaryfile_existing.txt"};
+
+    ASSERT_FALSE(std::filesystem::exists(file.GetPath()));
+}
+
+TEST(TemporaryFile, /*DISABLED_*/Write_SomeContents_ContentsReadBack)
+{
+    const cxunit::TemporaryFile file{"cxunit_temporaryfile_write.txt"};
+
+    file.Write("First contents");
+    file.Write("Second contents");
+
+    ASSERT_EQ(file.Read(), "Second contents");
+}
+
+TEST(TemporaryFile, /*DISABLED_*/Destructor_FileWritten_FileRemoved)
+{
+    std::string path;
+    {
+        const cxunit::TemporaryFile file{"cxunit_temporaryfile_destructor.txt"};
+        file.Write("Contents");
+        path = file.GetPath();
+
+        ASSERT_TRUE(std::filesystem::exists(path));
+    }
+
+    ASSERT_FALSE(std::filesystem::exists(path));
+}
@@ -0,0 +1,619 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file main.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cxinv/assertion.h>
+#include <cxstd/parse.h>
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t NB_COLUMNS = 7u;
+constexpr size_t NB_ROWS = 6u;
+
+const std::string USAGE =
+    "Usage: connectx-serverload --address A [OPTION]...\n"
+    "\n"
+    "Plays many games at the same time against a Connect X server ('connectx --server A'),\n"
+    "and prints the latency percentiles of its answers. Each session plays random drops on\n"
+    "the classic board against a bot, and starts a new game when one ends.\n"
+    "\n"
+    "Possible arguments:\n"
+    "--address A    'unix:PATH' or 'tcp:PORT', as given to the server\n"
+    "--sessions N   sessions open at the same time (default: 1000)\n"
+    "--turns T      human drops per session (default: 100)\n"
+    "--opponent BOT the bot played against, as for the server (default: random)\n"
+    "--think MS     pause before each drop, in milliseconds (default: 0)\n"
+    "--seed S       seed from which drops are chosen (default: 0)\n";
+
+struct Settings
+{
+    std::string m_address;
+    size_t m_nbSessions = 1000u;
+    size_t m_nbTurns = 100u;
+    std::string m_opponent = "random";
+    std::chrono::milliseconds m_thinkTime{0};
+    std::uint32_t m_seed = 0u;
+};
+
+struct Session
+{
+    int m_fd = -1;
+    std::string m_input;
+    std::array<size_t, NB_COLUMNS> m_heights{};
+    size_t m_nbTurns = 0u;
+
+    // When the last request was sent, and when the turn started:
+    Clock::time_point m_requestStart;
+    Clock::time_point m_turnStart;
+};
+
+/******************************************************************************************//**
+ * @brief Makes the load settings from the command line arguments.
+ *
+ * @param p_arguments The command line arguments, program name excluded.
+ * @param p_settings  The settings to fill.
+ *
+ * @return The first invalid argument, if any, an empty string otherwise.
+ *
+ ********************************************************************************************/
+std::string ParseSettings(const std::vector<std::string>& p_arguments, Settings& p_settings)
+{
+    for(size_t index = 0u; index < p_arguments.size(); index += 2u)
+    {
+        const std::string& option = p_arguments[index];
+        if(index + 1u == p_arguments.size())
+        {
+            return option;
+        }
+
+        const std::string& value = p_arguments[index + 1u];
+        const std::optional<size_t> number = cxstd::ParseInteger(value);
+        bool isValid = true;
+
+        if(option == "--address")
+        {
+            p_settings.m_address = value;
+        }
+        else if(option == "--sessions")
+        {
+            isValid = number.has_value() && *number > 0u;
+            p_settings.m_nbSessions = number.value_or(0u);
+        }
+        else if(option == "--turns")
+        {
+            isValid = number.has_value() && *number > 0u;
+            p_settings.m_nbTurns = number.value_or(0u);
+        }
+        else if(option == "--opponent")
+        {
+            // The load comes from the bot drops, the opponent can not be a human:
+            isValid = !value.empty() && value != "human" && value.find_first_of(" ,\n") == std::string::npos;
+            p_settings.m_opponent = value;
+        }
+        else if(option == "--think")
+        {
+            isValid = number.has_value();
+            p_settings.m_thinkTime = std::chrono::milliseconds{number.value_or(0u)};
+        }
+        else if(option == "--seed")
+        {
+            isValid = number.has_value() && *number <= UINT32_MAX;
+            p_settings.m_seed = static_cast<std::uint32_t>(number.value_or(0u));
+        }
+        else
+        {
+            return option;
+        }
+
+        if(!isValid)
+        {
+            return value;
+        }
+    }
+
+    return p_settings.m_address.empty() ? "--address" : std::string{};
+}
+
+// Each session takes a file descriptor, so the limit is raised as far as allowed:
+void RaiseFileDescriptorLimit()
+{
+    rlimit limit{};
+    if(::getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max)
+    {
+        limit.rlim_cur = limit.rlim_max;
+        ::setrlimit(RLIMIT_NOFILE, &limit);
+    }
+}
+
+// Connects, blocking, and makes the socket non blocking once connected. Returns -1 on failure.
+int Connect(const std::string& p_address)
+{
+    int fd = -1;
+
+    if(p_address.rfind("unix:", 0u) == 0u)
+    {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        std::strncpy(address.sun_path, p_address.c_str() + 5u, sizeof(address.sun_path) - 1u);
+
+        fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if(fd >= 0 && ::connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+        {
+            ::close(fd);
+            fd = -1;
+        }
+    }
+    else if(p_address.rfind("tcp:", 0u) == 0u)
+    {
+        const std::optional<size_t> port = cxstd::ParseInteger(p_address.substr(4u));
+        if(!port || *port > 65535u)
+        {
+            return -1;
+        }
+
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(static_cast<uint16_t>(*port));
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+        fd = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if(fd >= 0 && ::connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+        {
+            ::close(fd);
+            fd = -1;
+        }
+
+        const int enabled = 1;
+        if(fd >= 0)
+        {
+            ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enabled, sizeof(enabled));
+        }
+    }
+
+    if(fd >= 0)
+    {
+        ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+    }
+
+    return fd;
+}
+
+/******************************************************************************************//**
+ * @brief Drives all sessions from a single epoll loop.
+ *
+ ********************************************************************************************/
+class LoadGenerator final
+{
+
+public:
+
+    explicit LoadGenerator(const Settings& p_settings)
+    : m_settings{p_settings}
+    , m_randomGenerator{p_settings.m_seed}
+    {
+    }
+
+    [[nodiscard]] bool Run()
+    {
+        m_epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+        if(m_epollFd < 0)
+        {
+            std::cerr << "connectx-serverload: epoll: " << std::strerror(errno) << std::endl;
+            return false;
+        }
+
+        m_sessions.resize(m_settings.m_nbSessions);
+        for(size_t index = 0u; index < m_sessions.size(); ++index)
+        {
+            Session& session = m_sessions[index];
+            session.m_fd = Connect(m_settings.m_address);
+            if(session.m_fd < 0)
+            {
+                std::cerr << "connectx-serverload: cannot connect session " << index + 1u << " to '" << m_settings.m_address << "': "
+                          << std::strerror(errno) << std::endl;
+                return false;
+            }
+
+            ++m_nbOpenSessions;
+
+            epoll_event event{};
+            event.events = EPOLLIN;
+            event.data.u64 = index;
+            ::epoll_ctl(m_epollFd, EPOLL_CTL_ADD, session.m_fd, &event);
+        }
+
+        // All sessions are open, the games start:
+        m_start = Clock::now();
+        for(size_t index = 0u; index < m_sessions.size(); ++index)
+        {
+            StartGame(index);
+        }
+
+        std::array<epoll_event, 256u> events;
+        while(m_nbOpenSessions > 0u)
+        {
+            const int nbEvents = ::epoll_wait(m_epollFd, events.data(), static_cast<int>(events.size()), GetTimeout());
+            for(int index = 0; index < nbEvents; ++index)
+            {
+                Read(static_cast<size_t>(events[index].data.u64));
+            }
+
+            SendDueDrops();
+        }
+        m_duration = Clock::now() - m_start;
+
+        ::close(m_epollFd);
+
+        return m_nbErrors == 0u;
+    }
+
+    void PrintResults()
+    {
+        const double nbSeconds = std::chrono::duration<double>(m_duration).count();
+
+        std::cout << std::fixed << std::setprecision(1)
+                  << "Sessions : " << m_settings.m_nbSessions << " against '" << m_settings.m_opponent << "'" << std::endl
+                  << "Turns    : " << m_turnLatencies.size() << " (" << (nbSeconds > 0.0 ? m_turnLatencies.size() / nbSeconds : 0.0) << " turns/s)" << std::endl
+                  << "Requests : " << m_requestLatencies.size() << " (" << (nbSeconds > 0.0 ? m_requestLatencies.size() / nbSeconds : 0.0) << " requests/s)" << std::endl
+                  << "Games    : " << m_nbGames << std::endl
+                  << "Errors   : " << m_nbErrors << std::endl
+                  << "Time     : " << std::setprecision(3) << nbSeconds << " s" << std::endl
+                  << std::endl
+                  << "Latency (us)      p50      p90      p99    p99.9      max" << std::endl;
+
+        PrintPercentiles("Request ", m_requestLatencies);
+        PrintPercentiles("Turn    ", m_turnLatencies);
+    }
+
+private:
+
+    using Wakeup = std::pair<Clock::time_point, size_t>;
+
+    static void PrintPercentiles(const std::string& p_title, std::vector<uint32_t>& p_latencies)
+    {
+        std::cout << p_title;
+        if(p_latencies.empty())
+        {
+            std::cout << std::endl;
+            return;
+        }
+
+        std::sort(p_latencies.begin(), p_latencies.end());
+        for(const double percentile : {0.50, 0.90, 0.99, 0.999, 1.0})
+        {
+            const size_t rank = std::min(static_cast<size_t>(percentile * p_latencies.size()), p_latencies.size() - 1u);
+            std::cout << std::setw(9) << p_latencies[rank];
+        }
+        std::cout << std::endl;
+    }
+
+    void Send(size_t p_index, const std::string& p_line)
+    {
+        Session& session = m_sessions[p_index];
+        session.m_requestStart = Clock::now();
+
+        // Requests are small and a session only has one in flight, so they always fit in the
+        // socket buffer:
+        if(::send(session.m_fd, p_line.data(), p_line.size(), MSG_NOSIGNAL) != static_cast<ssize_t>(p_line.size()))
+        {
+            ++m_nbErrors;
+            CloseSession(p_index);
+        }
+    }
+
+    void StartGame(size_t p_index)
+    {
+        Session& session = m_sessions[p_index];
+        session.m_heights.fill(0u);
+        ++m_nbGames;
+
+        Send(p_index, "new " + std::to_string(NB_COLUMNS) + "x" + std::to_string(NB_ROWS) + " 4 human," + m_settings.m_opponent + "\n");
+    }
+
+    void ScheduleDrop(size_t p_index)
+    {
+        Session& session = m_sessions[p_index];
+        if(session.m_nbTurns == m_settings.m_nbTurns)
+        {
+            Send(p_index, "quit\n");
+            return;
+        }
+
+        if(m_settings.m_thinkTime.count() > 0)
+        {
+            m_wakeups.push({Clock::now() + m_settings.m_thinkTime, p_index});
+            return;
+        }
+
+        SendDrop(p_index);
+    }
+
+    void SendDrop(size_t p_index)
+    {
+        Session& session = m_sessions[p_index];
+
+        std::vector<size_t> freeColumns;
+        for(size_t column = 0u; column < NB_COLUMNS; ++column)
+        {
+            if(session.m_heights[column] < NB_ROWS)
+            {
+                freeColumns.push_back(column);
+            }
+        }
+        ASSERT(!freeColumns.empty());
+
+        const size_t column = freeColumns[std::uniform_int_distribution<size_t>{0u, freeColumns.size() - 1u}(m_randomGenerator)];
+        ++session.m_heights[column];
+        ++session.m_nbTurns;
+
+        Send(p_index, "drop " + std::to_string(column + 1u) + "\n");
+        session.m_turnStart = session.m_requestStart;
+    }
+
+    void SendDueDrops()
+    {
+        const Clock::time_point now = Clock::now();
+        while(!m_wakeups.empty() && m_wakeups.top().first <= now)
+        {
+            const size_t index = m_wakeups.top().second;
+            m_wakeups.pop();
+
+            if(m_sessions[index].m_fd >= 0)
+            {
+                SendDrop(index);
+            }
+        }
+    }
+
+    int GetTimeout() const
+    {
+        if(m_wakeups.empty())
+        {
+            return -1;
+        }
+
+        const auto delay = std::chrono::duration_cast<std::chrono::milliseconds>(m_wakeups.top().first - Clock::now());
+
+        return static_cast<int>(std::max<std::chrono::milliseconds::rep>(delay.count(), 0));
+    }
+
+    void Read(size_t p_index)
+    {
+        Session& session = m_sessions[p_index];
+
+        std::array<char, 1024u> buffer;
+        while(session.m_fd >= 0)
+        {
+            const ssize_t size = ::recv(session.m_fd, buffer.data(), buffer.size(), 0);
+            if(size > 0)
+            {
+                session.m_input.append(buffer.data(), static_cast<size_t>(size));
+                continue;
+            }
+
+            if(size < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            {
+                break;
+            }
+
+            // The server closes the connection after a quit, which ends the session:
+            if(session.m_nbTurns < m_settings.m_nbTurns)
+            {
+                ++m_nbErrors;
+            }
+            CloseSession(p_index);
+            return;
+        }
+
+        size_t end = session.m_input.find('\n');
+        while(end != std::string::npos && session.m_fd >= 0)
+        {
+            const std::string line = session.m_input.substr(0u, end);
+            session.m_input.erase(0u, end + 1u);
+
+            Answer(p_index, line);
+            end = session.m_input.find('\n');
+        }
+    }
+
+    void Answer(size_t p_index, const std::string& p_line)
+    {
+        Session& session = m_sessions[p_index];
+        const Clock::time_point now = Clock::now();
+
+        // A "bot C STATE" line ends the turn started by the last drop:
+        if(p_line.rfind("bot ", 0u) == 0u)
+        {
+            m_turnLatencies.push_back(ToMicroseconds(now - session.m_turnStart));
+
+            const size_t column = std::strtoul(p_line.c_str() + 4u, nullptr, 10);
+            if(column >= 1u && column <= NB_COLUMNS)
+            {
+                ++session.m_heights[column - 1u];
+            }
+
+            EndTurn(p_index, p_line.substr(p_line.find(' ', 4u) + 1u));
+            return;
+        }
+
+        m_requestLatencies.push_back(ToMicroseconds(now - session.m_requestStart));
+
+        if(p_line.rfind("ok ", 0u) != 0u)
+        {
+            std::cerr << "connectx-serverload: session " << p_index + 1u << ": " << p_line << std::endl;
+            ++m_nbErrors;
+            StartGame(p_index);
+            return;
+        }
+
+        // The first player is always the human, so only a new game gives it the turn:
+        const std::string state = p_line.substr(3u);
+        if(state == "play 1")
+        {
+            ScheduleDrop(p_index);
+        }
+        else if(state.rfind("play", 0u) != 0u)
+        {
+            // The human drop ended the game:
+            m_turnLatencies.push_back(ToMicroseconds(now - session.m_turnStart));
+            EndTurn(p_index, state);
+        }
+
+        // Otherwise, the bot is to drop, its line comes next.
+    }
+
+    void EndTurn(size_t p_index, const std::string& p_state)
+    {
+        if(p_state == "play 1")
+        {
+            ScheduleDrop(p_index);
+            return;
+        }
+
+        if(m_sessions[p_index].m_nbTurns == m_settings.m_nbTurns)
+        {
+            Send(p_index, "quit\n");
+            return;
+        }
+
+        StartGame(p_index);
+    }
+
+    void CloseSession(size_t p_index)
+    {
+        Session& session = m_sessions[p_index];
+        if(session.m_fd >= 0)
+        {
+            ::close(session.m_fd);
+            session.m_fd = -1;
+            --m_nbOpenSessions;
+        }
+    }
+
+    static uint32_t ToMicroseconds(Clock::duration p_duration)
+    {
+        return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(p_duration).count());
+    }
+
+    const Settings m_settings;
+    std::mt19937 m_randomGenerator;
+
+    int m_epollFd = -1;
+    std::vector<Session> m_sessions;
+    size_t m_nbOpenSessions = 0u;
+    std::priority_queue<Wakeup, std::vector<Wakeup>, std::greater<Wakeup>> m_wakeups;
+
+    std::vector<uint32_t> m_requestLatencies;
+    std::vector<uint32_t> m_turnLatencies;
+    size_t m_nbGames = 0u;
+    size_t m_nbErrors = 0u;
+    Clock::time_point m_start;
+    Clock::duration m_duration{};
+};
+
+} // namespace
+
+/******************************************************************************************//**
+ * @brief Start of the program in hosted environment (that is, with an operating system).
+ *
+ * @param argc
+ *      Non-negative value representing the number of arguments passed to the program
+ *      from the environment in which the program is run.
+ *
+ * @param argv
+ *      Pointer to the first element of an array of argc + 1 pointers, of which the last
+ *      one is null and the previous ones, if any, point to null-terminated multibyte
+ *      strings that represent the arguments passed to the program from the execution
+ *      environment.
+ *
+ * @return Exit status. EXIT_SUCCESS(0) for success.
+ *
+ ********************************************************************************************/
+int main(int argc, char *argv[])
+{
+    int result = EXIT_FAILURE;
+
+    try
+    {
+        const std::vector<std::string> arguments(argv + 1, argv + argc);
+        if(arguments.empty() || arguments.front() == "--help")
+        {
+            std::cout << USAGE;
+            return arguments.empty() ? EXIT_FAILURE : EXIT_SUCCESS;
+        }
+
+        Settings settings;
+        const std::string invalidArgument = ParseSettings(arguments, settings);
+        if(!invalidArgument.empty())
+        {
+            std::cerr << "connectx-serverload: invalid option '" << invalidArgument << "'" << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        RaiseFileDescriptorLimit();
+
+        LoadGenerator generator{settings};
+        const bool isSuccess = generator.Run();
+
+        generator.PrintResults();
+        result = isSuccess ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    catch(const std::exception& p_exception)
+    {
+        ASSERT_ERROR_MSG(p_exception.what());
+    }
+    catch(...)
+    {
+        ASSERT_ERROR_MSG("Unhandled exception.");
+    }
+
+    return result;
+}
@@ -0,0 +1,350 @@
+/**************************************************************************************************
+ *  This file is part of Connect X.
+ *
+ *  Connect X is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Connect X is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Connect X. If not, see <https://www.gnu.org/licenses/>.
+ *
+ *************************************************************************************************/
+/**********************************************************************************************//**
+ * @file main.cpp
+ * @date 2026
+ *
+ *************************************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cxinv/assertion.h>
+#include <cxmodel/BotSettings.h>
+#include <cxstd/parse.h>
+#include <cxtournament/Tournament.h>
+
+namespace
+{
+
+const std::string USAGE =
+    "Usage: connectx-tournament --bots BOT,BOT,... [OPTION]...\n"
+    "\n"
+    "Plays games between bots and estimates their Elo differences. A BOT is 'random' or\n"
+    "'alphabeta', optionally followed by a budget per move, as in 'alphabeta:250ms' or\n"
+    "'alphabeta:100000nodes'.\n"
+    "\n"
+    "Possible arguments:\n"
+    "--format F     'roundrobin' (default) or 'gauntlet' (the first bot plays all others)\n"
+    "--games N      games per pairing (default: 2)\n"
+    "--board WxH    board size (default: 7x6)\n"
+    "--inarow K     in-a-row value (default: 4)\n"
+    "--openings D   random drops before the bots take over (default: 2)\n"
+    "--seed S       seed from which openings are made (default: 0)\n"
+    "--threads T    games played at the same time (default: one per core)\n"
+    "--sprt E0,E1   stop a pairing once an SPRT of H0: Elo = E0 against H1: Elo = E1 is decided\n"
+    "--results FILE save results to FILE as games end, and resume from it\n";
+
+std::vector<std::string> Split(const std::string& p_string, char p_separator)
+{
+    std::vector<std::string> parts;
+
+    size_t begin = 0u;
+    size_t end = p_string.find(p_separator);
+    while(end != std::string::npos)
+    {
+        parts.push_back(p_string.substr(begin, end - begin));
+        begin = end + 1u;
+        end = p_string.find(p_separator, begin);
+    }
+    parts.push_back(p_string.substr(begin));
+
+    return parts;
+}
+
+std::optional<double> ParseReal(const std::string& p_argument)
+{
+    char* end = nullptr;
+    const double value = std::strtod(p_argument.c_str(), &end);
+    if(p_argument.empty() || *end != '\0' || !std::isfinite(value))
+    {
+        return std::nullopt;
+    }
+
+    return value;
+}
+
+/******************************************************************************************//**
+ * @brief Makes the tournament settings from the command line arguments.
+ *
+ * @param p_arguments The command line arguments, program name excluded.
+ * @param p_settings  The settings to fill.
+ *
+ * @return The first invalid argument, if any, an empty string otherwise.
+ *
+ ********************************************************************************************/
+std::string ParseSettings(const std::vector<std::string>& p_arguments, cxtournament::TournamentSettings& p_settings)
+{
+    for(size_t index = 0u; index < p_arguments.size(); index += 2u)
+    {
+        const std::string& option = p_arguments[index];
+        if(index + 1u == p_arguments.size())
+        {
+            return option;
+        }
+
+        const std::string& value = p_arguments[index + 1u];
+        bool isValid = true;
+
+        if(option == "--bots")
+        {
+            p_settings.m_bots.clear();
+            for(const std::string& bot : Split(value, ','))
+            {
+                const std::optional<cxmodel::BotSettings> botSettings = cxmodel::MakeBotSettings(bot);
+                isValid = isValid && botSettings.has_value();
+                if(isValid)
+                {
+                    p_settings.m_bots.push_back(*botSettings);
+                }
+            }
+        }
+        else if(option == "--format")
+        {
+            isValid = (value == "roundrobin" || value == "gauntlet");
+            p_settings.m_format = (value == "gauntlet") ? cxtournament::TournamentFormat::GAUNTLET : cxtournament::TournamentFormat::ROUND_ROBIN;
+        }
+        else if(option == "--games")
+        {
+            const std::optional<size_t> nbGames = cxstd::ParseInteger(value);
+            isValid = nbGames.has_value();
+            p_settings.m_nbGamesPerPairing = nbGames.value_or(0u);
+        }
+        else if(option == "--board")
+        {
+            const std::vector<std::string> dimensions = Split(value, 'x');
+            const std::optional<size_t> width = cxstd::ParseInteger(dimensions.front());
+            const std::optional<size_t> height = cxstd::ParseInteger(dimensions.back());
+            isValid = dimensions.size() == 2u && width.has_value() && height.has_value();
+            p_settings.m_gridWidth = width.value_or(0u);
+            p_settings.m_gridHeight = height.value_or(0u);
+        }
+        else if(option == "--inarow")
+        {
+            const std::optional<size_t> inARowValue = cxstd::ParseInteger(value);
+            isValid = inARowValue.has_value();
+            p_settings.m_inARowValue = inARowValue.value_or(0u);
+        }
+        else if(option == "--openings")
+        {
+            const std::optional<size_t> nbOpeningDrops = cxstd::ParseInteger(value);
+            isValid = nbOpeningDrops.has_value();
+            p_settings.m_nbOpeningDrops = nbOpeningDrops.value_or(0u);
+        }
+        else if(option == "--seed")
+        {
+            const std::optional<size_t> seed = cxstd::ParseInteger(value);
+            isValid = seed.has_value() && *seed <= UINT32_MAX;
+            p_settings.m_seed = static_cast<std::uint32_t>(seed.value_or(0u));
+        }
+        else if(option == "--threads")
+        {
+            const std::optional<size_t> nbThreads = cxstd::ParseInteger(value);
+            isValid = nbThreads.has_value() && *nbThreads > 0u;
+            p_settings.m_nbThreads = nbThreads.value_or(1u);
+        }
+        else if(option == "--sprt")
+        {
+            const std::vector<std::string> elos = Split(value, ',');
+            const std::optional<double> elo0 = ParseReal(elos.front());
+            const std::optional<double> elo1 = ParseReal(elos.back());
+            isValid = elos.size() == 2u && elo0.has_value() && elo1.has_value() && *elo0 < *elo1;
+
+            cxtournament::SprtSettings sprt;
+            sprt.m_elo0 = elo0.value_or(0.0);
+            sprt.m_elo1 = elo1.value_or(0.0);
+            p_settings.m_sprt = sprt;
+        }
+        else if(option == "--results")
+        {
+            p_settings.m_resultsFilePath = value;
+        }
+        else
+        {
+            return option;
+        }
+
+        if(!isValid)
+        {
+            return value;
+        }
+    }
+
+    return {};
+}
+
+std::string FormatElo(const cxtournament::EloEstimate& p_estimate)
+{
+    std::ostringstream stream;
+    stream << std::fixed << std::setprecision(1) << std::showpos << p_estimate.m_difference
+           << std::noshowpos << " +/- " << p_estimate.m_errorMargin;
+
+    return stream.str();
+}
+
+std::string FormatSprt(const cxtournament::PairingResults& p_results, const cxtournament::SprtSettings& p_sprt)
+{
+    std::ostringstream stream;
+    switch(p_results.m_sprtDecision)
+    {
+        case cxtournament::SprtDecision::ACCEPT_H0:
+            stream << "H0 accepted";
+            break;
+
+        case cxtournament::SprtDecision::ACCEPT_H1:
+            stream << "H1 accepted";
+            break;
+
+        case cxtournament::SprtDecision::CONTINUE:
+        default:
+            stream << "undecided";
+            break;
+    }
+
+    stream << std::fixed << std::setprecision(2)
+           << " (LLR " << cxtournament::ComputeLogLikelihoodRatio(p_results.m_score, p_sprt)
+           << " [" << cxtournament::GetLowerBound(p_sprt) << ", " << cxtournament::GetUpperBound(p_sprt) << "])";
+
+    return stream.str();
+}
+
+/******************************************************************************************//**
+ * @brief Prints the tournament results.
+ *
+ * @param p_settings The tournament settings.
+ * @param p_results  The tournament results.
+ *
+ ********************************************************************************************/
+void PrintResults(const cxtournament::TournamentSettings& p_settings, const cxtournament::TournamentResults& p_results)
+{
+    std::vector<cxtournament::MatchScore> botScores(p_settings.m_bots.size());
+    for(const cxtournament::PairingResults& pairing : p_results.m_pairings)
+    {
+        const cxtournament::MatchScore& score = pairing.m_score;
+        std::cout << "Bot " << pairing.m_pairing.m_first + 1u << " vs Bot " << pairing.m_pairing.m_second + 1u << " : "
+                  << "+" << score.m_nbWins << " -" << score.m_nbLosses << " =" << score.m_nbTies
+                  << ", Elo " << FormatElo(cxtournament::EstimateElo(score));
+
+        if(p_settings.m_sprt)
+        {
+            std::cout << ", SPRT " << FormatSprt(pairing, *p_settings.m_sprt);
+        }
+
+        std::cout << std::endl;
+
+        cxtournament::MatchScore& firstScore = botScores[pairing.m_pairing.m_first];
+        firstScore.m_nbWins += score.m_nbWins;
+        firstScore.m_nbLosses += score.m_nbLosses;
+        firstScore.m_nbTies += score.m_nbTies;
+
+        cxtournament::MatchScore& secondScore = botScores[pairing.m_pairing.m_second];
+        secondScore.m_nbWins += score.m_nbLosses;
+        secondScore.m_nbLosses += score.m_nbWins;
+        secondScore.m_nbTies += score.m_nbTies;
+    }
+
+    std::cout << std::endl;
+    for(size_t botIndex = 0u; botIndex < p_settings.m_bots.size(); ++botIndex)
+    {
+        std::cout << "Bot " << botIndex + 1u << " : Elo " << FormatElo(cxtournament::EstimateElo(botScores[botIndex]))
+                  << " against the field, " << p_settings.m_bots[botIndex] << std::endl;
+    }
+
+    const double nbSeconds = std::chrono::duration<double>(p_results.m_duration).count();
+    const double gamesPerSecond = nbSeconds > 0.0 ? static_cast<double>(p_results.m_nbPlayedGames) / nbSeconds : 0.0;
+    const double movesPerSecond = nbSeconds > 0.0 ? static_cast<double>(p_results.m_nbMoves) / nbSeconds : 0.0;
+
+    std::cout << std::endl << std::fixed << std::setprecision(1)
+              << "Games : " << p_results.m_nbPlayedGames << " played, " << p_results.m_nbResumedGames << " resumed" << std::endl
+              << "Speed : " << gamesPerSecond << " games/s, " << movesPerSecond << " moves/s on "
+              << p_settings.m_nbThreads << " threads" << std::endl;
+}
+
+} // namespace
+
+/******************************************************************************************//**
+ * @brief Start of the program in hosted environment (that is, with an operating system).
+ *
+ * @param argc
+ *      Non-negative value representing the number of arguments passed to the program
+ *      from the environment in which the program is run.
+ *
+ * @param argv
+ *      Pointer to the first element of an array of argc + 1 pointers, of which the last
+ *      one is null and the previous ones, if any, point to null-terminated multibyte
+ *      strings that represent the arguments passed to the program from the execution
+ *      environment.
+ *
+ * @return Exit status. EXIT_SUCCESS(0) for success.
+ *
+ ********************************************************************************************/
+int main(int argc, char *argv[])
+{
+    int result = EXIT_FAILURE;
+
+    try
+    {
+        const std::vector<std::string> arguments(argv + 1, argv + argc);
+        if(arguments.empty() || arguments.front() == "--help")
+        {
+            std::cout << USAGE;
+            return arguments.empty() ? EXIT_FAILURE : EXIT_SUCCESS;
+        }
+
+        cxtournament::TournamentSettings settings;
+        settings.m_nbThreads = std::max(std::thread::hardware_concurrency(), 1u);
+
+        const std::string invalidArgument = ParseSettings(arguments, settings);
+        if(!invalidArgument.empty())
+        {
+            std::cerr << "connectx-tournament: invalid option '" << invalidArgument << "'" << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        cxtournament::Tournament tournament{settings};
+        const cxmodel::Status status = tournament.Run();
+        if(!status.IsSuccess())
+        {
+            std::cerr << "connectx-tournament: " << status.GetMessage() << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        PrintResults(settings, tournament.GetResults());
+        result = EXIT_SUCCESS;
+    }
+    catch(const std::exception& p_exception)
+    {
+        ASSERT_ERROR_MSG(p_exception.what());
+    }
+    catch(...)
+    {
+        ASSERT_ERROR_MSG("Unhandled exception.");
+    }
+
+    return result;
+}